@@ -81,9 +81,9 @@ constexpr Angle::Angle(const Acceleration& acceleration_1, const Acceleration& a
 
 constexpr AccelerationMagnitude::AccelerationMagnitude(const Acceleration& acceleration) noexcept : AccelerationMagnitude(acceleration.value().magnitude()) {}
 
-constexpr Velocity::Velocity(const Acceleration& acceleration, const Duration& duration) noexcept : Velocity(acceleration.value() * duration.value()) {}
+template <typename Number> constexpr BasicVelocity<Number>::BasicVelocity(const Acceleration& acceleration, const Duration& duration) noexcept : BasicVelocity(acceleration.value() * duration.value()) {}
 
-constexpr Velocity::Velocity(const Acceleration& acceleration, const Frequency& frequency) noexcept : Velocity(acceleration.value() / frequency.value()) {}
+template <typename Number> constexpr BasicVelocity<Number>::BasicVelocity(const Acceleration& acceleration, const Frequency& frequency) noexcept : BasicVelocity(acceleration.value() / frequency.value()) {}
 
 constexpr Acceleration Direction::operator*(const AccelerationMagnitude& acceleration_magnitude) const noexcept {
   return {acceleration_magnitude, *this};
@@ -93,11 +93,11 @@ constexpr Acceleration AccelerationMagnitude::operator*(const Direction& directi
   return {*this, direction};
 }
 
-constexpr Acceleration Velocity::operator*(const Frequency& frequency) const noexcept {
+template <typename Number> constexpr Acceleration BasicVelocity<Number>::operator*(const Frequency& frequency) const noexcept {
   return {*this, frequency};
 }
 
-constexpr Acceleration Velocity::operator/(const Duration& duration) const noexcept {
+template <typename Number> constexpr Acceleration BasicVelocity<Number>::operator/(const Duration& duration) const noexcept {
   return {*this, duration};
 }
 
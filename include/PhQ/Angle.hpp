@@ -23,7 +23,8 @@ class HeatFlux;
 class Position;
 class TemperatureGradient;
 class Traction;
-class Velocity;
+template <typename Number> class BasicVelocity;
+using Velocity = BasicVelocity<double>;
 
 class Angle : public DimensionalScalarQuantity<Unit::Angle> {
 
@@ -127,12 +128,12 @@ constexpr Angle Direction::angle(const Value::Vector& vector) const noexcept {
   return {*this, vector};
 }
 
-constexpr Angle Value::Vector::angle(const Direction& direction) const noexcept {
-  return {*this, direction};
+template <typename Number> constexpr Angle Value::BasicVector<Number>::angle(const Direction& direction) const noexcept {
+  return {Value::Vector{*this}, direction};
 }
 
-constexpr Angle Value::Vector::angle(const Value::Vector& vector) const noexcept {
-  return {*this, vector};
+template <typename Number> constexpr Angle Value::BasicVector<Number>::angle(const BasicVector& vector) const noexcept {
+  return {Value::Vector{*this}, Value::Vector{vector}};
 }
 
 } // namespace PhQ
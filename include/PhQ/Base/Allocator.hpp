@@ -0,0 +1,61 @@
+// Copyright 2020 Alexandre Coderre-Chabot
+// This file is part of Physical Quantities (PhQ), a C++17 header-only library of physical quantities, physical models, and units of measure for scientific computation.
+// Physical Quantities is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+// You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Include.hpp"
+
+namespace PhQ {
+
+/// \brief Alignment in bytes of the arrays of PhQ containers: the size of a cache line, which is also a multiple of the width of every common SIMD register.
+constexpr const std::size_t array_alignment{64};
+
+/// \brief Standard allocator whose allocations are aligned to a given number of bytes, such that vectorized loops over the allocated array start on an aligned boundary.
+/// \details Elements constructed without arguments, such as by resizing a vector, are default-initialized rather than value-initialized, so resizing a vector of doubles leaves the new elements uninitialized instead of writing zeros that are about to be overwritten.
+template <typename Type, std::size_t Alignment = array_alignment> class AlignedAllocator {
+
+public:
+
+  using value_type = Type;
+
+  template <typename Other> struct rebind {
+    using other = AlignedAllocator<Other, Alignment>;
+  };
+
+  constexpr AlignedAllocator() noexcept = default;
+
+  template <typename Other> constexpr AlignedAllocator(const AlignedAllocator<Other, Alignment>&) noexcept {}
+
+  Type* allocate(std::size_t size) {
+    return static_cast<Type*>(::operator new(size * sizeof(Type), std::align_val_t{Alignment}));
+  }
+
+  void deallocate(Type* pointer, std::size_t) noexcept {
+    ::operator delete(pointer, std::align_val_t{Alignment});
+  }
+
+  template <typename Other> void construct(Other* pointer) noexcept(std::is_nothrow_default_constructible<Other>::value) {
+    ::new (static_cast<void*>(pointer)) Other;
+  }
+
+  template <typename Other, typename... Arguments> void construct(Other* pointer, Arguments&&... arguments) {
+    ::new (static_cast<void*>(pointer)) Other(std::forward<Arguments>(arguments)...);
+  }
+
+  template <typename Other> constexpr bool operator==(const AlignedAllocator<Other, Alignment>&) const noexcept {
+    return true;
+  }
+
+  template <typename Other> constexpr bool operator!=(const AlignedAllocator<Other, Alignment>&) const noexcept {
+    return false;
+  }
+
+};
+
+/// \brief Vector whose data is aligned for vectorized loops.
+template <typename Type> using AlignedVector = std::vector<Type, AlignedAllocator<Type>>;
+
+} // namespace PhQ
@@ -0,0 +1,250 @@
+// Copyright 2020 Alexandre Coderre-Chabot
+// This file is part of Physical Quantities (PhQ), a C++17 header-only library of physical quantities, physical models, and units of measure for scientific computation.
+// Physical Quantities is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+// You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "String.hpp"
+#include "Type.hpp"
+
+namespace PhQ {
+
+/// \brief Text formats in which PhQ writes and reads its objects.
+enum class TextFormat : uint_least8_t {
+  JSON,
+  YAML,
+  XML
+};
+
+// Forward declaration.
+class TextReader;
+
+/// \brief Reads an object of a given type from a PhQ::TextReader, in the format written by the json, yaml, and xml methods of that type.
+/// \details Each specialization provides a static function bool read(TextReader& reader, Type& object) noexcept that advances the reader past the object and returns true on success.
+template <typename Type, typename = void> struct Deserializer;
+
+/// \brief Single-pass cursor over a text in the JSON, YAML, or XML format written by PhQ. The text is viewed in place and nothing is allocated.
+/// \details The reader only accepts the layouts that PhQ writes: objects whose fields appear in a fixed order, with any amount of whitespace between tokens. JSON strings may not contain escape sequences, YAML scalars end at a comma or a closing brace or bracket, and XML elements have no attributes. On failure, the reader is left at an unspecified position within the text.
+class TextReader {
+
+public:
+
+  constexpr TextReader(std::string_view text, TextFormat format) noexcept : text_(text), format_(format) {}
+
+  constexpr TextFormat format() const noexcept {
+    return format_;
+  }
+
+  constexpr std::string_view remaining() const noexcept {
+    return text_;
+  }
+
+  /// \brief Whether only whitespace remains.
+  constexpr bool finished() noexcept {
+    skip_whitespace();
+    return text_.empty();
+  }
+
+  /// \brief Consume the opening of an object: a brace in JSON and YAML, and nothing in XML, where the fields of an object are sibling elements.
+  constexpr bool begin_object() noexcept {
+    return format_ == TextFormat::XML || token("{");
+  }
+
+  constexpr bool end_object() noexcept {
+    return format_ == TextFormat::XML || token("}");
+  }
+
+  /// \brief Consume the separator between two fields or two elements: a comma in JSON and YAML, and nothing in XML.
+  constexpr bool separator() noexcept {
+    return format_ == TextFormat::XML || token(",");
+  }
+
+  /// \brief Consume the key of a field: "key": in JSON, key: in YAML, and <key> in XML.
+  constexpr bool begin_field(std::string_view key) noexcept {
+    switch (format_) {
+      case TextFormat::JSON:
+        return token("\"") && exact(key) && exact("\"") && token(":");
+      case TextFormat::YAML:
+        return token(key) && token(":");
+      case TextFormat::XML:
+        return token("<") && exact(key) && exact(">");
+    }
+    return false;
+  }
+
+  /// \brief Consume the end of a field: </key> in XML, and nothing in JSON and YAML.
+  constexpr bool end_field(std::string_view key) noexcept {
+    return format_ != TextFormat::XML || (token("</") && exact(key) && exact(">"));
+  }
+
+  /// \brief Read a field with a given key whose content is an object of any type that has a PhQ::Deserializer.
+  template <typename Type> bool field(std::string_view key, Type& object) noexcept {
+    return begin_field(key) && Deserializer<Type>::read(*this, object) && end_field(key);
+  }
+
+  /// \brief Read an object whose fields are the given keys in order, each holding a number, such as the components of a PhQ::Value::Vector.
+  template <std::size_t Size> bool components(const std::array<std::string_view, Size>& keys, std::array<double, Size>& values) noexcept {
+    if (!begin_object()) {
+      return false;
+    }
+    for (std::size_t index = 0; index < Size; ++index) {
+      if ((index > 0 && !separator()) || !field(keys[index], values[index])) {
+        return false;
+      }
+    }
+    return end_object();
+  }
+
+  bool number(double& value) noexcept {
+    skip_whitespace();
+    const std::optional<double> parsed{consume_real_number(text_)};
+    if (!parsed.has_value()) {
+      return false;
+    }
+    value = parsed.value();
+    return true;
+  }
+
+  /// \brief Read a list of numbers into a vector, replacing its contents but reusing its memory: [a, b, c] in JSON and YAML, and whitespace-separated numbers up to the next element in XML.
+  bool numbers(std::vector<double>& values) noexcept {
+    values.clear();
+    if (format_ == TextFormat::XML) {
+      skip_whitespace();
+      while (!text_.empty() && text_.front() != '<') {
+        double value;
+        if (!number(value)) {
+          return false;
+        }
+        values.push_back(value);
+        skip_whitespace();
+      }
+      return true;
+    }
+    if (!token("[")) {
+      return false;
+    }
+    if (token("]")) {
+      return true;
+    }
+    do {
+      double value;
+      if (!number(value)) {
+        return false;
+      }
+      values.push_back(value);
+    } while (token(","));
+    return token("]");
+  }
+
+  /// \brief Read a string, such as the abbreviation of a unit: a quoted string in JSON, a plain or quoted scalar in YAML, and the text content of an element in XML. The string is viewed in place within the text.
+  constexpr bool string(std::string_view& value) noexcept {
+    skip_whitespace();
+    if (format_ == TextFormat::JSON || (format_ == TextFormat::YAML && !text_.empty() && text_.front() == '"')) {
+      if (!exact("\"")) {
+        return false;
+      }
+      const std::size_t end{text_.find('"')};
+      if (end == std::string_view::npos) {
+        return false;
+      }
+      value = text_.substr(0, end);
+      text_.remove_prefix(end + 1);
+      return true;
+    }
+    const std::size_t end{format_ == TextFormat::XML ? text_.find('<') : text_.find_first_of(",}]\n")};
+    value = trim_whitespace(text_.substr(0, end));
+    text_.remove_prefix(end == std::string_view::npos ? text_.size() : end);
+    return !value.empty();
+  }
+
+private:
+
+  constexpr void skip_whitespace() noexcept {
+    while (!text_.empty() && is_whitespace(text_.front())) {
+      text_.remove_prefix(1);
+    }
+  }
+
+  /// \brief Consume an expected text immediately at the cursor.
+  constexpr bool exact(std::string_view expected) noexcept {
+    if (text_.substr(0, expected.size()) != expected) {
+      return false;
+    }
+    text_.remove_prefix(expected.size());
+    return true;
+  }
+
+  /// \brief Consume an expected text after any whitespace.
+  constexpr bool token(std::string_view expected) noexcept {
+    skip_whitespace();
+    return exact(expected);
+  }
+
+  std::string_view text_;
+
+  TextFormat format_;
+
+};
+
+template <> struct Deserializer<double> {
+  static bool read(TextReader& reader, double& value) noexcept {
+    return reader.number(value);
+  }
+};
+
+/// \brief Integers, such as the exponents of a PhQ::Dimension::Set. The number must be integral and within the range of the type.
+template <typename Type> struct Deserializer<Type, std::enable_if_t<std::is_integral<Type>::value && !std::is_same<Type, bool>::value>> {
+  static bool read(TextReader& reader, Type& integer) noexcept {
+    double value;
+    if (!reader.number(value) || value != std::trunc(value) || value < static_cast<double>(std::numeric_limits<Type>::lowest()) || value > static_cast<double>(std::numeric_limits<Type>::max())) {
+      return false;
+    }
+    integer = static_cast<Type>(value);
+    return true;
+  }
+};
+
+/// \brief Enumerations, such as units of measure, read from any of their spellings with PhQ::parse.
+template <typename Type> struct Deserializer<Type, std::enable_if_t<std::is_enum<Type>::value>> {
+  static bool read(TextReader& reader, Type& enumeration) noexcept {
+    std::string_view spelling;
+    if (!reader.string(spelling)) {
+      return false;
+    }
+    const std::optional<Type> parsed{parse<Type>(spelling)};
+    if (!parsed.has_value()) {
+      return false;
+    }
+    enumeration = parsed.value();
+    return true;
+  }
+};
+
+/// \brief Read an object from a text in a given format. Returns nothing if the text is malformed or if anything other than whitespace follows the object.
+template <typename Type> std::optional<Type> parse_text(std::string_view text, TextFormat format) noexcept {
+  TextReader reader{text, format};
+  Type object;
+  if (Deserializer<Type>::read(reader, object) && reader.finished()) {
+    return {object};
+  }
+  return std::nullopt;
+}
+
+/// \brief Read an object from the text written by its json method, such as PhQ::parse_json<PhQ::Stress>(stress.json()).
+template <typename Type> std::optional<Type> parse_json(std::string_view text) noexcept {
+  return parse_text<Type>(text, TextFormat::JSON);
+}
+
+/// \brief Read an object from the text written by its yaml method.
+template <typename Type> std::optional<Type> parse_yaml(std::string_view text) noexcept {
+  return parse_text<Type>(text, TextFormat::YAML);
+}
+
+/// \brief Read an object from the text written by its xml method.
+template <typename Type> std::optional<Type> parse_xml(std::string_view text) noexcept {
+  return parse_text<Type>(text, TextFormat::XML);
+}
+
+} // namespace PhQ
@@ -10,77 +10,199 @@
 
 namespace PhQ {
 
-std::string number_to_string(double value) noexcept {
+/// \brief Number of characters that is always sufficient for the output of PhQ::number_to_chars, in either mode.
+constexpr const std::size_t number_to_chars_buffer_size{32};
+
+/// \brief Write a real number into a caller-provided character buffer [first, last) and return a pointer past the last character written, as with std::to_chars. Nothing is allocated and the result does not depend on the locale.
+/// \details By default, the precision depends on the magnitude of the number: numbers from 0.001 to 10000 are written in fixed notation with 9 to 3 decimals, and other numbers are written in scientific notation with 6 decimals. If shortest_round_trip is true, the number is instead written with the fewest digits that parse back to exactly the same double. A buffer of PhQ::number_to_chars_buffer_size characters is always sufficient.
+std::to_chars_result number_to_chars(char* first, char* last, double value, bool shortest_round_trip = false) noexcept {
   if (value == 0.0) {
-    return {"0"};
+    if (first == last) {
+      return {last, std::errc::value_too_large};
+    }
+    *first = '0';
+    return {first + 1, std::errc{}};
+  }
+  if (shortest_round_trip) {
+    return std::to_chars(first, last, value);
+  }
+  const double absolute_value{std::abs(value)};
+  if (absolute_value >= 10000.0 || absolute_value < 0.001) {
+    return std::to_chars(first, last, value, std::chars_format::scientific, 6);
+  } else if (absolute_value >= 1000.0) {
+    return std::to_chars(first, last, value, std::chars_format::fixed, 3);
+  } else if (absolute_value >= 100.0) {
+    return std::to_chars(first, last, value, std::chars_format::fixed, 4);
+  } else if (absolute_value >= 10.0) {
+    return std::to_chars(first, last, value, std::chars_format::fixed, 5);
+  } else if (absolute_value >= 1.0) {
+    return std::to_chars(first, last, value, std::chars_format::fixed, 6);
+  } else if (absolute_value >= 0.1) {
+    return std::to_chars(first, last, value, std::chars_format::fixed, 7);
+  } else if (absolute_value >= 0.01) {
+    return std::to_chars(first, last, value, std::chars_format::fixed, 8);
   } else {
-    const double absolute_value{std::abs(value)};
-    std::ostringstream stream;
-    if (absolute_value >= 10000.0 || absolute_value < 0.001) {
-      stream << std::scientific << value;
-      return stream.str();
-    } else if (absolute_value >= 1000.0) {
-      stream << std::fixed << std::setprecision(3) << value;
-      return stream.str();
-    } else if (absolute_value >= 100.0) {
-      stream << std::fixed << std::setprecision(4) << value;
-      return stream.str();
-    } else if (absolute_value >= 10.0) {
-      stream << std::fixed << std::setprecision(5) << value;
-      return stream.str();
-    } else if (absolute_value >= 1.0) {
-      stream << std::fixed << std::setprecision(6) << value;
-      return stream.str();
-    } else if (absolute_value >= 0.1) {
-      stream << std::fixed << std::setprecision(7) << value;
-      return stream.str();
-    } else if (absolute_value >= 0.01) {
-      stream << std::fixed << std::setprecision(8) << value;
-      return stream.str();
-    } else {
-      stream << std::fixed << std::setprecision(9) << value;
-      return stream.str();
+    return std::to_chars(first, last, value, std::chars_format::fixed, 9);
+  }
+}
+
+std::string number_to_string(double value, bool shortest_round_trip = false) noexcept {
+  std::array<char, number_to_chars_buffer_size> buffer;
+  const std::to_chars_result result{number_to_chars(buffer.data(), buffer.data() + buffer.size(), value, shortest_round_trip)};
+  return {buffer.data(), result.ptr};
+}
+
+/// \brief Fixed-capacity character buffer provided by the caller, to which serializers can append text without allocating memory.
+/// \details Text that does not fit is cut off at the end of the buffer, and the buffer is then marked as truncated. The buffer is not null-terminated.
+class TextBuffer {
+
+public:
+
+  constexpr TextBuffer(char* first, char* last) noexcept : first_(first), last_(last), end_(first), truncated_(false) {}
+
+  template <std::size_t Size> constexpr TextBuffer(std::array<char, Size>& characters) noexcept : TextBuffer(characters.data(), characters.data() + Size) {}
+
+  constexpr std::string_view view() const noexcept {
+    return {first_, size()};
+  }
+
+  constexpr std::size_t size() const noexcept {
+    return static_cast<std::size_t>(end_ - first_);
+  }
+
+  constexpr bool truncated() const noexcept {
+    return truncated_;
+  }
+
+  constexpr void clear() noexcept {
+    end_ = first_;
+    truncated_ = false;
+  }
+
+  constexpr void append(std::string_view text) noexcept {
+    std::size_t size{text.size()};
+    if (size > static_cast<std::size_t>(last_ - end_)) {
+      size = static_cast<std::size_t>(last_ - end_);
+      truncated_ = true;
+    }
+    for (std::size_t index = 0; index < size; ++index) {
+      end_[index] = text[index];
     }
+    end_ += size;
+  }
+
+private:
+
+  char* first_;
+
+  char* last_;
+
+  char* end_;
+
+  bool truncated_;
+
+};
+
+/// \brief Whether serializers can append text to a type: a std::string, a PhQ::TextBuffer, or a std::ostream such as std::cout or a std::ofstream.
+template <typename Sink> constexpr bool is_text_sink{std::is_same<Sink, std::string>::value || std::is_same<Sink, TextBuffer>::value || std::is_base_of<std::ostream, Sink>::value};
+
+void append(std::string& output, std::string_view text) noexcept {
+  output.append(text);
+}
+
+void append(TextBuffer& output, std::string_view text) noexcept {
+  output.append(text);
+}
+
+void append(std::ostream& output, std::string_view text) noexcept {
+  output.write(text.data(), static_cast<std::streamsize>(text.size()));
+}
+
+/// \brief Append a real number to a text sink, formatted as with PhQ::number_to_string, without any intermediate string.
+template <typename Sink> void append_number(Sink& output, double value, bool shortest_round_trip = false) noexcept {
+  std::array<char, number_to_chars_buffer_size> buffer;
+  const std::to_chars_result result{number_to_chars(buffer.data(), buffer.data() + buffer.size(), value, shortest_round_trip)};
+  append(output, {buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data())});
+}
+
+/// \brief Append an integer to a text sink without any intermediate string.
+template <typename Sink> void append_integer(Sink& output, int_least64_t value) noexcept {
+  std::array<char, 24> buffer;
+  const std::to_chars_result result{std::to_chars(buffer.data(), buffer.data() + buffer.size(), value)};
+  append(output, {buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data())});
+}
+
+/// \brief Whether a character is an ASCII whitespace character, regardless of the locale.
+constexpr bool is_whitespace(char character) noexcept {
+  return character == ' ' || character == '\t' || character == '\n' || character == '\r' || character == '\f' || character == '\v';
+}
+
+/// \brief Text without its leading and trailing ASCII whitespace. The text is not copied.
+constexpr std::string_view trim_whitespace(std::string_view text) noexcept {
+  while (!text.empty() && is_whitespace(text.front())) {
+    text.remove_prefix(1);
+  }
+  while (!text.empty() && is_whitespace(text.back())) {
+    text.remove_suffix(1);
   }
+  return text;
 }
 
-std::optional<uint_least64_t> string_to_natural_number(const std::string& text) noexcept {
-  char* end = 0;
-  const unsigned long long int value = std::strtoull(text.c_str(), &end, 10);
-  if (end != text.c_str() && *end == '\0' && value != ULLONG_MAX) {
-    return {(uint_least64_t)(value)};
+/// \brief Parse a real number at the start of a text. On success, the text is advanced past the number.
+/// \details Uses std::from_chars, so the result does not depend on the locale and nothing is allocated. An optional leading plus sign is accepted. Infinities, NaNs, and out-of-range numbers are rejected, in which case the text is left unchanged.
+std::optional<double> consume_real_number(std::string_view& text) noexcept {
+  std::string_view remainder{text};
+  std::size_t first_digit{0};
+  if (!remainder.empty() && remainder.front() == '+') {
+    remainder.remove_prefix(1);
+  } else if (!remainder.empty() && remainder.front() == '-') {
+    first_digit = 1;
   }
-  const std::optional<uint_least64_t> no_value;
-  return no_value;
+  if (remainder.size() <= first_digit || (!std::isdigit(static_cast<unsigned char>(remainder[first_digit])) && remainder[first_digit] != '.')) {
+    return std::nullopt;
+  }
+  double value{0.0};
+  const std::from_chars_result result{std::from_chars(remainder.data(), remainder.data() + remainder.size(), value)};
+  if (result.ec != std::errc{}) {
+    return std::nullopt;
+  }
+  text.remove_prefix(static_cast<std::size_t>(result.ptr - text.data()));
+  return {value};
 }
 
-std::optional<int_least64_t> string_to_integer_number(const std::string& text) noexcept {
-  char* end = 0;
-  const long long int value = std::strtoll(text.c_str(), &end, 10);
-  if (end != text.c_str() && *end == '\0' && value != LLONG_MAX) {
-    return {(int_least64_t)(value)};
+std::optional<uint_least64_t> string_to_natural_number(std::string_view text) noexcept {
+  uint_least64_t value{0};
+  const std::from_chars_result result{std::from_chars(text.data(), text.data() + text.size(), value)};
+  if (!text.empty() && result.ec == std::errc{} && result.ptr == text.data() + text.size()) {
+    return {value};
   }
-  const std::optional<int_least64_t> no_value;
-  return no_value;
+  return std::nullopt;
 }
 
-std::optional<double> string_to_real_number(const std::string& text) noexcept {
-  char* end = 0;
-  const double value = strtod(text.c_str(), &end);
-  if (end != text.c_str() && *end == '\0' && value != HUGE_VAL && value != -HUGE_VAL) {
+std::optional<int_least64_t> string_to_integer_number(std::string_view text) noexcept {
+  int_least64_t value{0};
+  const std::from_chars_result result{std::from_chars(text.data(), text.data() + text.size(), value)};
+  if (!text.empty() && result.ec == std::errc{} && result.ptr == text.data() + text.size()) {
     return {value};
   }
-  const std::optional<double> no_value;
-  return no_value;
+  return std::nullopt;
+}
+
+std::optional<double> string_to_real_number(std::string_view text) noexcept {
+  const std::optional<double> value{consume_real_number(text)};
+  if (value.has_value() && text.empty()) {
+    return value;
+  }
+  return std::nullopt;
 }
 
-std::string lowercase(const std::string& text) noexcept {
+std::string lowercase(std::string_view text) noexcept {
   std::string data{text};
   std::transform(data.begin(), data.end(), data.begin(), [](unsigned char character){return std::tolower(character);});
   return data;
 }
 
-std::string uppercase(const std::string& text) noexcept {
+std::string uppercase(std::string_view text) noexcept {
   std::string data{text};
   std::transform(data.begin(), data.end(), data.begin(), [](unsigned char character){return std::toupper(character);});
   return data;
@@ -10,23 +10,131 @@
 
 namespace PhQ {
 
-template <typename Enumeration> const std::map<Enumeration, std::string> abbreviations;
+/// \brief Abbreviation of each value of an enumeration, listed in the order of the enumeration so that it can be indexed by the underlying value of the enumeration.
+/// \details Specialized for each enumeration as a constexpr array, so no code runs at program startup to build it.
+template <typename Enumeration> constexpr const std::array<std::pair<Enumeration, std::string_view>, 0> abbreviations{};
 
-template <typename Enumeration> std::string abbreviation(Enumeration enumeration) noexcept {
-  return abbreviations<Enumeration>.find(enumeration)->second;
+/// \brief Whether every entry of a table keyed by an enumeration is listed at the index given by the underlying value of its key, so that the table can be indexed directly by that value.
+template <typename Enumeration, typename Value, std::size_t Size> constexpr bool is_indexed_by_enumeration(const std::array<std::pair<Enumeration, Value>, Size>& table) noexcept {
+  for (std::size_t index = 0; index < Size; ++index) {
+    if (static_cast<std::size_t>(table[index].first) != index) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// \brief Abbreviation of a value of an enumeration. Returns a view into constexpr storage, so nothing is looked up or copied.
+template <typename Enumeration> constexpr std::string_view abbreviation(Enumeration enumeration) noexcept {
+  return abbreviations<Enumeration>[static_cast<std::size_t>(enumeration)].second;
+}
+
+/// \brief Accepted spellings of the values of an enumeration. Several spellings can refer to the same value.
+/// \details Specialized for each enumeration as a constexpr array, so no code runs at program startup to build it.
+template <typename Enumeration> constexpr const std::array<std::pair<std::string_view, Enumeration>, 0> spellings{};
+
+/// \brief Lowercase of an ASCII letter. Every other byte, including those of multi-byte UTF-8 sequences such as "μ" or "°", is returned unchanged.
+constexpr char ascii_lowercase(char character) noexcept {
+  if (character >= 'A' && character <= 'Z') {
+    return static_cast<char>(character - 'A' + 'a');
+  } else {
+    return character;
+  }
+}
+
+/// \brief Three-way comparison of two strings, optionally ignoring the case of ASCII letters. Returns a negative number, zero, or a positive number. Never copies either string.
+constexpr int compare(std::string_view text_1, std::string_view text_2, bool ignore_ascii_case = false) noexcept {
+  const std::size_t size{text_1.size() < text_2.size() ? text_1.size() : text_2.size()};
+  for (std::size_t index = 0; index < size; ++index) {
+    const unsigned char character_1{static_cast<unsigned char>(ignore_ascii_case ? ascii_lowercase(text_1[index]) : text_1[index])};
+    const unsigned char character_2{static_cast<unsigned char>(ignore_ascii_case ? ascii_lowercase(text_2[index]) : text_2[index])};
+    if (character_1 != character_2) {
+      return character_1 < character_2 ? -1 : 1;
+    }
+  }
+  if (text_1.size() == text_2.size()) {
+    return 0;
+  } else {
+    return text_1.size() < text_2.size() ? -1 : 1;
+  }
+}
+
+/// \brief Indices of the spellings of an enumeration, sorted by spelling, optionally ignoring the case of ASCII letters. The sort is stable, so among equal spellings the one listed first comes first.
+template <typename Enumeration> constexpr std::array<uint_least16_t, spellings<Enumeration>.size()> sort_spellings(bool ignore_ascii_case) noexcept {
+  std::array<uint_least16_t, spellings<Enumeration>.size()> indices{};
+  for (std::size_t index = 0; index < indices.size(); ++index) {
+    indices[index] = static_cast<uint_least16_t>(index);
+    for (std::size_t position = index; position > 0 && compare(spellings<Enumeration>[indices[position - 1]].first, spellings<Enumeration>[index].first, ignore_ascii_case) > 0; --position) {
+      indices[position] = indices[position - 1];
+      indices[position - 1] = static_cast<uint_least16_t>(index);
+    }
+  }
+  return indices;
 }
 
-template <typename Enumeration> const std::unordered_map<std::string, Enumeration> spellings;
+/// \brief Indices of the spellings of an enumeration in sorted order, computed at compile time so that parsing is a binary search.
+template <typename Enumeration> constexpr const std::array<uint_least16_t, spellings<Enumeration>.size()> sorted_spellings{sort_spellings<Enumeration>(false)};
 
-template <typename Enumeration> std::optional<Enumeration> parse(const std::string& spelling) noexcept {
-  const typename std::unordered_map<std::string, Enumeration>::const_iterator enumeration{spellings<Enumeration>.find(spelling)};
-  if (enumeration != spellings<Enumeration>.cend()) {
-    return {enumeration->second};
+/// \brief Indices of the spellings of an enumeration in sorted order ignoring the case of ASCII letters, computed at compile time.
+template <typename Enumeration> constexpr const std::array<uint_least16_t, spellings<Enumeration>.size()> case_insensitive_sorted_spellings{sort_spellings<Enumeration>(true)};
+
+/// \brief Binary search for a spelling among the sorted indices of the spellings of an enumeration.
+template <typename Enumeration, std::size_t Size> constexpr std::optional<Enumeration> find_spelling(const std::array<uint_least16_t, Size>& sorted_indices, std::string_view spelling, bool ignore_ascii_case) noexcept {
+  std::size_t low{0};
+  std::size_t high{Size};
+  while (low < high) {
+    const std::size_t middle{low + (high - low) / 2};
+    if (compare(spellings<Enumeration>[sorted_indices[middle]].first, spelling, ignore_ascii_case) < 0) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  if (low < Size && compare(spellings<Enumeration>[sorted_indices[low]].first, spelling, ignore_ascii_case) == 0) {
+    return {spellings<Enumeration>[sorted_indices[low]].second};
   } else {
     return {};
   }
 }
 
+/// \brief Parse an enumeration value, such as a unit, from one of its spellings. Never allocates memory, and is evaluated at compile time when its argument is a constant.
+/// \details For example, PhQ::parse<PhQ::Unit::Speed>("km/s") returns PhQ::Unit::Speed::KilometrePerSecond.
+template <typename Enumeration> constexpr std::optional<Enumeration> parse(std::string_view spelling) noexcept {
+  return find_spelling<Enumeration>(sorted_spellings<Enumeration>, spelling, false);
+}
+
+/// \brief Parse an enumeration value from one of its spellings, ignoring the case of ASCII letters. An exact match takes precedence, so "MB" and "Mb" still distinguish megabytes from megabits. Otherwise, the spelling must match spellings of a single value ignoring case: an ambiguous spelling such as "mw", which could be either "mW" or "MW", is rejected. Never allocates memory.
+template <typename Enumeration> constexpr std::optional<Enumeration> parse_case_insensitive(std::string_view spelling) noexcept {
+  const std::optional<Enumeration> exact{parse<Enumeration>(spelling)};
+  if (exact.has_value()) {
+    return exact;
+  }
+  const std::array<uint_least16_t, spellings<Enumeration>.size()>& sorted_indices{case_insensitive_sorted_spellings<Enumeration>};
+  std::size_t low{0};
+  std::size_t high{sorted_indices.size()};
+  while (low < high) {
+    const std::size_t middle{low + (high - low) / 2};
+    if (compare(spellings<Enumeration>[sorted_indices[middle]].first, spelling, true) < 0) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  if (low == sorted_indices.size() || compare(spellings<Enumeration>[sorted_indices[low]].first, spelling, true) != 0) {
+    return {};
+  }
+  const Enumeration enumeration{spellings<Enumeration>[sorted_indices[low]].second};
+  for (std::size_t index = low + 1; index < sorted_indices.size() && compare(spellings<Enumeration>[sorted_indices[index]].first, spelling, true) == 0; ++index) {
+    if (spellings<Enumeration>[sorted_indices[index]].second != enumeration) {
+      return {};
+    }
+  }
+  return {enumeration};
+}
+
+/// \brief Type that is not deduced when it appears as a function parameter, so that a number of any arithmetic type can be passed for it once the other parameters have determined it, such as 2.0 * vector where vector is a PhQ::Value::BasicVector<float>.
+template <typename Type> using NonDeduced = typename std::enable_if<true, Type>::type;
+
 template <class Type> constexpr bool sort(const Type& type_1, const Type& type_2) noexcept;
 
 template <> constexpr bool sort(const double& real_1, const double& real_2) noexcept {
@@ -19,6 +19,19 @@ enum class Type : uint_least8_t {
   CompressibleNewtonianFluid
 };
 
+/// \brief Lowercase label of each type of constitutive model, listed in the order of the enumeration. Written as the type in the JSON and XML serializations of a constitutive model, so that no lowercase copy of its abbreviation is built.
+constexpr const std::array<std::pair<Type, std::string_view>, 3> labels{{
+  {Type::ElasticIsotropicSolid, "elastic isotropic solid"},
+  {Type::IncompressibleNewtonianFluid, "incompressible newtonian fluid"},
+  {Type::CompressibleNewtonianFluid, "compressible newtonian fluid"}
+}};
+
+static_assert(is_indexed_by_enumeration(labels), "The labels table must be listed in the order of its enumeration.");
+
+constexpr std::string_view label(Type type) noexcept {
+  return labels[static_cast<std::size_t>(type)].second;
+}
+
 template <Type ConstitutiveModelType> class GenericConstitutiveModel {
 
 public:
@@ -41,13 +54,17 @@ protected:
 
 } // namespace ConstitutiveModel
 
-template <> const std::map<ConstitutiveModel::Type, std::string> abbreviations<ConstitutiveModel::Type>{
+template <> constexpr const std::array<std::pair<ConstitutiveModel::Type, std::string_view>, 3> abbreviations<ConstitutiveModel::Type>{{
   {ConstitutiveModel::Type::ElasticIsotropicSolid, "Elastic Isotropic Solid"},
   {ConstitutiveModel::Type::IncompressibleNewtonianFluid, "Incompressible Newtonian Fluid"},
   {ConstitutiveModel::Type::CompressibleNewtonianFluid, "Compressible Newtonian Fluid"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<ConstitutiveModel::Type>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, ConstitutiveModel::Type> spellings<ConstitutiveModel::Type>{
+static_assert(compare(ConstitutiveModel::label(ConstitutiveModel::Type::ElasticIsotropicSolid), abbreviation(ConstitutiveModel::Type::ElasticIsotropicSolid), true) == 0 && compare(ConstitutiveModel::label(ConstitutiveModel::Type::IncompressibleNewtonianFluid), abbreviation(ConstitutiveModel::Type::IncompressibleNewtonianFluid), true) == 0 && compare(ConstitutiveModel::label(ConstitutiveModel::Type::CompressibleNewtonianFluid), abbreviation(ConstitutiveModel::Type::CompressibleNewtonianFluid), true) == 0, "Each label must be the lowercase abbreviation of its type.");
+
+template <> constexpr const std::array<std::pair<std::string_view, ConstitutiveModel::Type>, 12> spellings<ConstitutiveModel::Type>{{
   {"Elastic Isotropic Solid", ConstitutiveModel::Type::ElasticIsotropicSolid},
   {"ElasticIsotropicSolid", ConstitutiveModel::Type::ElasticIsotropicSolid},
   {"elastic isotropic solid", ConstitutiveModel::Type::ElasticIsotropicSolid},
@@ -60,7 +77,7 @@ template <> const std::unordered_map<std::string, ConstitutiveModel::Type> spell
   {"CompressibleNewtonianFluid", ConstitutiveModel::Type::CompressibleNewtonianFluid},
   {"compressible newtonian fluid", ConstitutiveModel::Type::CompressibleNewtonianFluid},
   {"compressible_newtonian_fluid", ConstitutiveModel::Type::CompressibleNewtonianFluid}
-};
+}};
 
 } // namespace PhQ
 
@@ -44,15 +44,48 @@ public:
   }
 
   std::string print() const noexcept {
-    return {"μ = " + dynamic_viscosity_.print() + ", μ_B = " + bulk_dynamic_viscosity_.print()};
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    append(output, "μ = ");
+    dynamic_viscosity_.print(output);
+    append(output, ", μ_B = ");
+    bulk_dynamic_viscosity_.print(output);
   }
 
   std::string json() const noexcept {
-    return {"{\"type\": \"" + lowercase(abbreviation(type())) + "\", \"dynamic_viscosity\": " + dynamic_viscosity_.json()+ "\", \"bulk_dynamic_viscosity\": " + bulk_dynamic_viscosity_.json() + "}"};
+    std::string text;
+    json(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output) const noexcept {
+    append(output, "{\"type\": \"");
+    append(output, label(type()));
+    append(output, "\", \"dynamic_viscosity\": ");
+    dynamic_viscosity_.json(output);
+    append(output, ", \"bulk_dynamic_viscosity\": ");
+    bulk_dynamic_viscosity_.json(output);
+    append(output, "}");
   }
 
   std::string xml() const noexcept {
-    return {"<type>" + lowercase(abbreviation(type())) + "</type><dynamic_viscosity>" + dynamic_viscosity_.xml() + "</dynamic_viscosity><bulk_dynamic_viscosity>" + bulk_dynamic_viscosity_.xml() + "</bulk_dynamic_viscosity>"};
+    std::string text;
+    xml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output) const noexcept {
+    append(output, "<type>");
+    append(output, label(type()));
+    append(output, "</type><dynamic_viscosity>");
+    dynamic_viscosity_.xml(output);
+    append(output, "</dynamic_viscosity><bulk_dynamic_viscosity>");
+    bulk_dynamic_viscosity_.xml(output);
+    append(output, "</bulk_dynamic_viscosity>");
   }
 
 protected:
@@ -73,6 +106,19 @@ constexpr bool sort(const ConstitutiveModel::CompressibleNewtonianFluid& model_1
   }
 }
 
+template <> struct Deserializer<ConstitutiveModel::CompressibleNewtonianFluid> {
+  static bool read(TextReader& reader, ConstitutiveModel::CompressibleNewtonianFluid& model) noexcept {
+    ConstitutiveModel::Type type;
+    DynamicViscosity dynamic_viscosity;
+    BulkDynamicViscosity bulk_dynamic_viscosity;
+    if (!(reader.begin_object() && reader.field("type", type) && type == ConstitutiveModel::Type::CompressibleNewtonianFluid && reader.separator() && reader.field("dynamic_viscosity", dynamic_viscosity) && reader.separator() && reader.field("bulk_dynamic_viscosity", bulk_dynamic_viscosity) && reader.end_object())) {
+      return false;
+    }
+    model = ConstitutiveModel::CompressibleNewtonianFluid{dynamic_viscosity, bulk_dynamic_viscosity};
+    return true;
+  }
+};
+
 } // namespace PhQ
 
 namespace std {
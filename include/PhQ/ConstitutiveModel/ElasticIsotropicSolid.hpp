@@ -130,15 +130,48 @@ public:
   }
 
   std::string print() const noexcept {
-    return {"G = " + shear_modulus_.print() + ", λ = " + lame_first_modulus_.print()};
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    append(output, "G = ");
+    shear_modulus_.print(output);
+    append(output, ", λ = ");
+    lame_first_modulus_.print(output);
   }
 
   std::string json() const noexcept {
-    return {"{\"type\": \"" + lowercase(abbreviation(type())) + "\", \"shear_modulus\": " + shear_modulus_.json() + ", \"lamé_first_modulus\": " + lame_first_modulus_.json() + "}"};
+    std::string text;
+    json(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output) const noexcept {
+    append(output, "{\"type\": \"");
+    append(output, label(type()));
+    append(output, "\", \"shear_modulus\": ");
+    shear_modulus_.json(output);
+    append(output, ", \"lamé_first_modulus\": ");
+    lame_first_modulus_.json(output);
+    append(output, "}");
   }
 
   std::string xml() const noexcept {
-    return {"<type>" + lowercase(abbreviation(type())) + "</type><shear_modulus>" + shear_modulus_.xml() + "</shear_modulus><lamé_first_modulus>" + lame_first_modulus_.xml() + "</lamé_first_modulus>"};
+    std::string text;
+    xml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output) const noexcept {
+    append(output, "<type>");
+    append(output, label(type()));
+    append(output, "</type><shear_modulus>");
+    shear_modulus_.xml(output);
+    append(output, "</shear_modulus><lamé_first_modulus>");
+    lame_first_modulus_.xml(output);
+    append(output, "</lamé_first_modulus>");
   }
 
 protected:
@@ -159,6 +192,19 @@ constexpr bool sort(const ConstitutiveModel::ElasticIsotropicSolid& model_1, con
   }
 }
 
+template <> struct Deserializer<ConstitutiveModel::ElasticIsotropicSolid> {
+  static bool read(TextReader& reader, ConstitutiveModel::ElasticIsotropicSolid& model) noexcept {
+    ConstitutiveModel::Type type;
+    ShearModulus shear_modulus;
+    LameFirstModulus lame_first_modulus;
+    if (!(reader.begin_object() && reader.field("type", type) && type == ConstitutiveModel::Type::ElasticIsotropicSolid && reader.separator() && reader.field("shear_modulus", shear_modulus) && reader.separator() && reader.field("lamé_first_modulus", lame_first_modulus) && reader.end_object())) {
+      return false;
+    }
+    model = ConstitutiveModel::ElasticIsotropicSolid{shear_modulus, lame_first_modulus};
+    return true;
+  }
+};
+
 } // namespace PhQ
 
 namespace std {
@@ -38,15 +38,42 @@ public:
   }
 
   std::string print() const noexcept {
-    return {"μ = " + dynamic_viscosity_.print()};
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    append(output, "μ = ");
+    dynamic_viscosity_.print(output);
   }
 
   std::string json() const noexcept {
-    return {"{\"type\": \"" + lowercase(abbreviation(type())) + "\", \"dynamic_viscosity\": " + dynamic_viscosity_.json()+ "}"};
+    std::string text;
+    json(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output) const noexcept {
+    append(output, "{\"type\": \"");
+    append(output, label(type()));
+    append(output, "\", \"dynamic_viscosity\": ");
+    dynamic_viscosity_.json(output);
+    append(output, "}");
   }
 
   std::string xml() const noexcept {
-    return {"<type>" + lowercase(abbreviation(type())) + "</type><dynamic_viscosity>" + dynamic_viscosity_.xml() + "</dynamic_viscosity>"};
+    std::string text;
+    xml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output) const noexcept {
+    append(output, "<type>");
+    append(output, label(type()));
+    append(output, "</type><dynamic_viscosity>");
+    dynamic_viscosity_.xml(output);
+    append(output, "</dynamic_viscosity>");
   }
 
 protected:
@@ -61,6 +88,18 @@ constexpr bool sort(const ConstitutiveModel::IncompressibleNewtonianFluid& model
   return sort(model_1.dynamic_viscosity(), model_2.dynamic_viscosity());
 }
 
+template <> struct Deserializer<ConstitutiveModel::IncompressibleNewtonianFluid> {
+  static bool read(TextReader& reader, ConstitutiveModel::IncompressibleNewtonianFluid& model) noexcept {
+    ConstitutiveModel::Type type;
+    DynamicViscosity dynamic_viscosity;
+    if (!(reader.begin_object() && reader.field("type", type) && type == ConstitutiveModel::Type::IncompressibleNewtonianFluid && reader.separator() && reader.field("dynamic_viscosity", dynamic_viscosity) && reader.end_object())) {
+      return false;
+    }
+    model = ConstitutiveModel::IncompressibleNewtonianFluid{dynamic_viscosity};
+    return true;
+  }
+};
+
 } // namespace PhQ
 
 namespace std {
@@ -12,7 +12,8 @@ namespace PhQ {
 
 namespace Dimension {
 
-class Base {
+/// \brief Base of the seven base physical dimensions, such as PhQ::Dimension::Length. Each derived class provides its abbreviation and label as static constexpr methods returning a std::string_view.
+template <typename BaseDimension> class Base {
 
 public:
 
@@ -20,19 +21,23 @@ public:
     return value_;
   }
 
-  virtual std::string abbreviation() const noexcept = 0;
-
-  virtual std::string label() const noexcept = 0;
-
   std::string print() const noexcept {
-    if (value_ == 0) {
-      return {};
-    } else if (value_ == 1) {
-      return abbreviation();
-    } else if (value_ > 0) {
-      return abbreviation() + "^" + std::to_string(value_);
-    } else {
-      return abbreviation() + "^(" + std::to_string(value_) + ")";
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    if (value_ != 0) {
+      append(output, BaseDimension::abbreviation());
+      if (value_ > 1) {
+        append(output, "^");
+        append_integer(output, value_);
+      } else if (value_ < 0) {
+        append(output, "^(");
+        append_integer(output, value_);
+        append(output, ")");
+      }
     }
   }
 
@@ -72,15 +77,15 @@ protected:
 
 } // namespace PhQ
 
-std::ostream& operator<<(std::ostream& output_stream, const PhQ::Dimension::Base& base) noexcept {
-  output_stream << base.print();
+template <typename BaseDimension> std::ostream& operator<<(std::ostream& output_stream, const PhQ::Dimension::Base<BaseDimension>& base) noexcept {
+  base.print(output_stream);
   return output_stream;
 }
 
 namespace std {
 
-template <> struct hash<PhQ::Dimension::Base> {
-  size_t operator()(const PhQ::Dimension::Base& base) const {
+template <typename BaseDimension> struct hash<PhQ::Dimension::Base<BaseDimension>> {
+  size_t operator()(const PhQ::Dimension::Base<BaseDimension>& base) const {
     return hash<double>()(base.value());
   }
 };
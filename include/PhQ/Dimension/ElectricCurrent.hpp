@@ -12,17 +12,17 @@ namespace PhQ {
 
 namespace Dimension {
 
-class ElectricCurrent : public Base {
+class ElectricCurrent : public Base<ElectricCurrent> {
 
 public:
 
-  constexpr ElectricCurrent(int_least8_t value = 0) noexcept : Base(value) {}
+  constexpr ElectricCurrent(int_least8_t value = 0) noexcept : Base<ElectricCurrent>(value) {}
 
-  std::string abbreviation() const noexcept {
+  static constexpr std::string_view abbreviation() noexcept {
     return "I";
   }
 
-  std::string label() const noexcept {
+  static constexpr std::string_view label() noexcept {
     return "electric_current";
   }
 
@@ -12,17 +12,17 @@ namespace PhQ {
 
 namespace Dimension {
 
-class Length : public Base {
+class Length : public Base<Length> {
 
 public:
 
-  constexpr Length(int_least8_t value = 0) noexcept : Base(value) {}
+  constexpr Length(int_least8_t value = 0) noexcept : Base<Length>(value) {}
 
-  std::string abbreviation() const noexcept {
+  static constexpr std::string_view abbreviation() noexcept {
     return "L";
   }
 
-  std::string label() const noexcept {
+  static constexpr std::string_view label() noexcept {
     return "length";
   }
 
@@ -12,17 +12,17 @@ namespace PhQ {
 
 namespace Dimension {
 
-class LuminousIntensity : public Base {
+class LuminousIntensity : public Base<LuminousIntensity> {
 
 public:
 
-  constexpr LuminousIntensity(int_least8_t value = 0) noexcept : Base(value) {}
+  constexpr LuminousIntensity(int_least8_t value = 0) noexcept : Base<LuminousIntensity>(value) {}
 
-  std::string abbreviation() const noexcept {
+  static constexpr std::string_view abbreviation() noexcept {
     return "J";
   }
 
-  std::string label() const noexcept {
+  static constexpr std::string_view label() noexcept {
     return "luminous_intensity";
   }
 
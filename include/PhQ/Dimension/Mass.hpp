@@ -12,17 +12,17 @@ namespace PhQ {
 
 namespace Dimension {
 
-class Mass : public Base {
+class Mass : public Base<Mass> {
 
 public:
 
-  constexpr Mass(int_least8_t value = 0) noexcept : Base(value) {}
+  constexpr Mass(int_least8_t value = 0) noexcept : Base<Mass>(value) {}
 
-  std::string abbreviation() const noexcept {
+  static constexpr std::string_view abbreviation() noexcept {
     return "M";
   }
 
-  std::string label() const noexcept {
+  static constexpr std::string_view label() noexcept {
     return "mass";
   }
 
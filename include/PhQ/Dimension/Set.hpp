@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "../Base/Reader.hpp"
 #include "../Base/Type.hpp"
 #include "ElectricCurrent.hpp"
 #include "Length.hpp"
@@ -19,6 +20,8 @@ namespace PhQ {
 
 namespace Dimension {
 
+/// \brief Set of the exponents of the seven base physical dimensions.
+/// \details The seven signed exponents are packed into a single 64-bit integer, one byte each, offset by 128 so that each byte is unsigned. The length exponent occupies the most significant byte and the luminous intensity exponent the least significant one, so that comparing two packed integers orders sets lexicographically by length, then mass, then time, and so on. Equality, ordering, and hashing are therefore single integer operations, and the product or quotient of two sets is a single integer addition or subtraction.
 class Set {
 
 public:
@@ -31,151 +34,303 @@ public:
     const Temperature& temperature = {},
     const SubstanceAmount& substance_amount = {},
     const LuminousIntensity& luminous_intensity = {}) noexcept
-  : length_(length),
-    mass_(mass),
-    time_(time),
-    electric_current_(electric_current),
-    temperature_(temperature),
-    substance_amount_(substance_amount),
-    luminous_intensity_(luminous_intensity) {}
+  : packed_(
+    pack(length.value(), 6)
+    | pack(mass.value(), 5)
+    | pack(time.value(), 4)
+    | pack(electric_current.value(), 3)
+    | pack(temperature.value(), 2)
+    | pack(substance_amount.value(), 1)
+    | pack(luminous_intensity.value(), 0)) {}
+
+  /// \brief Create a set from its packed representation, as returned by packed().
+  static constexpr Set from_packed(uint_least64_t packed) noexcept {
+    Set set;
+    set.packed_ = packed;
+    return set;
+  }
+
+  /// \brief Packed representation of this set. Two sets are equal if and only if their packed representations are equal.
+  constexpr uint_least64_t packed() const noexcept {
+    return packed_;
+  }
 
-  constexpr const Length& length() const noexcept {
-    return length_;
+  constexpr Length length() const noexcept {
+    return {unpack(6)};
   }
 
-  constexpr const Mass& mass() const noexcept {
-    return mass_;
+  constexpr Mass mass() const noexcept {
+    return {unpack(5)};
   }
 
-  constexpr const Time& time() const noexcept {
-    return time_;
+  constexpr Time time() const noexcept {
+    return {unpack(4)};
   }
 
-  constexpr const ElectricCurrent& electric_current() const noexcept {
-    return electric_current_;
+  constexpr ElectricCurrent electric_current() const noexcept {
+    return {unpack(3)};
   }
 
-  constexpr const Temperature& temperature() const noexcept {
-    return temperature_;
+  constexpr Temperature temperature() const noexcept {
+    return {unpack(2)};
   }
 
-  constexpr const SubstanceAmount& substance_amount() const noexcept {
-    return substance_amount_;
+  constexpr SubstanceAmount substance_amount() const noexcept {
+    return {unpack(1)};
   }
 
-  constexpr const LuminousIntensity& luminous_intensity() const noexcept {
-    return luminous_intensity_;
+  constexpr LuminousIntensity luminous_intensity() const noexcept {
+    return {unpack(0)};
   }
 
   std::string print() const noexcept {
     std::string text;
-    const std::string length{length_.print()};
-    const std::string mass{mass_.print()};
-    const std::string time{time_.print()};
-    const std::string electric_current{electric_current_.print()};
-    const std::string temperature{temperature_.print()};
-    const std::string substance_amount{substance_amount_.print()};
-    const std::string luminous_intensity{luminous_intensity_.print()};
-    text.append(length);
-    if (!length.empty() && (!mass.empty() || !time.empty() || !electric_current.empty() || !temperature.empty() || !substance_amount.empty() || !luminous_intensity.empty())) {
-      text.append("·");
-    }
-    text.append(mass);
-    if (!mass.empty() && (!time.empty() || !electric_current.empty() || !temperature.empty() || !substance_amount.empty() || !luminous_intensity.empty())) {
-      text.append("·");
-    }
-    text.append(time);
-    if (!time.empty() && (!electric_current.empty() || !temperature.empty() || !substance_amount.empty() || !luminous_intensity.empty())) {
-      text.append("·");
-    }
-    text.append(electric_current);
-    if (!electric_current.empty() && (!temperature.empty() || !substance_amount.empty() || !luminous_intensity.empty())) {
-      text.append("·");
-    }
-    text.append(temperature);
-    if (!temperature.empty() && (!substance_amount.empty() || !luminous_intensity.empty())) {
-      text.append("·");
-    }
-    text.append(substance_amount);
-    if (!substance_amount.empty() && !luminous_intensity.empty()) {
-      text.append("·");
-    }
-    text.append(luminous_intensity);
-    if (!text.empty()) {
-      return text;
-    } else {
-      return "1";
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    bool empty{true};
+    print(output, length(), empty);
+    print(output, mass(), empty);
+    print(output, time(), empty);
+    print(output, electric_current(), empty);
+    print(output, temperature(), empty);
+    print(output, substance_amount(), empty);
+    print(output, luminous_intensity(), empty);
+    if (empty) {
+      append(output, "1");
     }
   }
 
+  std::string yaml() const noexcept {
+    std::string text;
+    yaml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void yaml(Sink& output) const noexcept {
+    append(output, "{");
+    append(output, length().label());
+    append(output, ": ");
+    append_integer(output, length().value());
+    append(output, " , ");
+    append(output, mass().label());
+    append(output, ": ");
+    append_integer(output, mass().value());
+    append(output, " , ");
+    append(output, time().label());
+    append(output, ": ");
+    append_integer(output, time().value());
+    append(output, " , ");
+    append(output, electric_current().label());
+    append(output, ": ");
+    append_integer(output, electric_current().value());
+    append(output, " , ");
+    append(output, temperature().label());
+    append(output, ": ");
+    append_integer(output, temperature().value());
+    append(output, " , ");
+    append(output, substance_amount().label());
+    append(output, ": ");
+    append_integer(output, substance_amount().value());
+    append(output, " , ");
+    append(output, luminous_intensity().label());
+    append(output, ": ");
+    append_integer(output, luminous_intensity().value());
+    append(output, "}");
+  }
+
   std::string json() const noexcept {
-    return "{\"" + length_.label() + "\": " + std::to_string(length_.value()) + " , \"" + mass_.label() + "\": " + std::to_string(mass_.value()) + " , \"" + time_.label() + "\": " + std::to_string(time_.value()) + " , \"" + electric_current_.label() + "\": " + std::to_string(electric_current_.value()) + " , \"" + temperature_.label() + "\": " + std::to_string(temperature_.value()) + " , \"" + substance_amount_.label() + "\": " + std::to_string(substance_amount_.value()) + " , \"" + luminous_intensity_.label() + "\": " + std::to_string(luminous_intensity_.value()) + "}";
+    std::string text;
+    json(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output) const noexcept {
+    append(output, "{\"");
+    append(output, length().label());
+    append(output, "\": ");
+    append_integer(output, length().value());
+    append(output, " , \"");
+    append(output, mass().label());
+    append(output, "\": ");
+    append_integer(output, mass().value());
+    append(output, " , \"");
+    append(output, time().label());
+    append(output, "\": ");
+    append_integer(output, time().value());
+    append(output, " , \"");
+    append(output, electric_current().label());
+    append(output, "\": ");
+    append_integer(output, electric_current().value());
+    append(output, " , \"");
+    append(output, temperature().label());
+    append(output, "\": ");
+    append_integer(output, temperature().value());
+    append(output, " , \"");
+    append(output, substance_amount().label());
+    append(output, "\": ");
+    append_integer(output, substance_amount().value());
+    append(output, " , \"");
+    append(output, luminous_intensity().label());
+    append(output, "\": ");
+    append_integer(output, luminous_intensity().value());
+    append(output, "}");
   }
 
   std::string xml() const noexcept {
-    return "<" + length_.label() + ">" + std::to_string(length_.value()) + "</" + length_.label() + "><" + mass_.label() + ">" + std::to_string(mass_.value()) + "</" + mass_.label() + "><" + time_.label() + ">" + std::to_string(time_.value()) + "</" + time_.label() + "><" + electric_current_.label() + ">" + std::to_string(electric_current_.value()) + "</" + electric_current_.label() + "><" + temperature_.label() + ">" + std::to_string(temperature_.value()) + "</" + temperature_.label() + "><" + substance_amount_.label() + ">" + std::to_string(substance_amount_.value()) + "</" + substance_amount_.label() + "><" + luminous_intensity_.label() + ">" + std::to_string(luminous_intensity_.value()) + "</" + luminous_intensity_.label() + ">";
+    std::string text;
+    xml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output) const noexcept {
+    append(output, "<");
+    append(output, length().label());
+    append(output, ">");
+    append_integer(output, length().value());
+    append(output, "</");
+    append(output, length().label());
+    append(output, "><");
+    append(output, mass().label());
+    append(output, ">");
+    append_integer(output, mass().value());
+    append(output, "</");
+    append(output, mass().label());
+    append(output, "><");
+    append(output, time().label());
+    append(output, ">");
+    append_integer(output, time().value());
+    append(output, "</");
+    append(output, time().label());
+    append(output, "><");
+    append(output, electric_current().label());
+    append(output, ">");
+    append_integer(output, electric_current().value());
+    append(output, "</");
+    append(output, electric_current().label());
+    append(output, "><");
+    append(output, temperature().label());
+    append(output, ">");
+    append_integer(output, temperature().value());
+    append(output, "</");
+    append(output, temperature().label());
+    append(output, "><");
+    append(output, substance_amount().label());
+    append(output, ">");
+    append_integer(output, substance_amount().value());
+    append(output, "</");
+    append(output, substance_amount().label());
+    append(output, "><");
+    append(output, luminous_intensity().label());
+    append(output, ">");
+    append_integer(output, luminous_intensity().value());
+    append(output, "</");
+    append(output, luminous_intensity().label());
+    append(output, ">");
   }
 
   constexpr bool operator==(const Set& set) const noexcept {
-    return length_ == set.length_ && mass_ == set.mass_ && time_ == set.time_ && electric_current_ == set.electric_current_ && temperature_ == set.temperature_ && substance_amount_ == set.substance_amount_ && luminous_intensity_ == set.luminous_intensity_;
+    return packed_ == set.packed_;
   }
 
   constexpr bool operator!=(const Set& set) const noexcept {
-    return length_ != set.length_ || mass_ != set.mass_ || time_ != set.time_ || electric_current_ != set.electric_current_ || temperature_ != set.temperature_ || substance_amount_ != set.substance_amount_ || luminous_intensity_ != set.luminous_intensity_;
+    return packed_ != set.packed_;
   }
 
-private:
+  constexpr bool operator<(const Set& set) const noexcept {
+    return packed_ < set.packed_;
+  }
 
-  Length length_;
+  constexpr bool operator<=(const Set& set) const noexcept {
+    return packed_ <= set.packed_;
+  }
+
+  constexpr bool operator>(const Set& set) const noexcept {
+    return packed_ > set.packed_;
+  }
+
+  constexpr bool operator>=(const Set& set) const noexcept {
+    return packed_ >= set.packed_;
+  }
+
+  /// \brief Dimension set of the product of two quantities: each exponent is the sum of the two corresponding exponents.
+  /// \details The offsets are removed once so that the bytes never carry into one another, provided each resulting exponent lies between -128 and 127.
+  constexpr Set operator*(const Set& set) const noexcept {
+    return from_packed(packed_ + set.packed_ - zero_);
+  }
+
+  /// \brief Dimension set of the quotient of two quantities: each exponent is the difference of the two corresponding exponents.
+  constexpr Set operator/(const Set& set) const noexcept {
+    return from_packed(packed_ - set.packed_ + zero_);
+  }
+
+  constexpr void operator*=(const Set& set) noexcept {
+    packed_ = packed_ + set.packed_ - zero_;
+  }
+
+  constexpr void operator/=(const Set& set) noexcept {
+    packed_ = packed_ - set.packed_ + zero_;
+  }
 
-  Mass mass_;
+private:
 
-  Time time_;
+  /// \brief Packed representation of the set in which all seven exponents are zero.
+  static constexpr uint_least64_t zero_{0x0080808080808080};
 
-  ElectricCurrent electric_current_;
+  /// \brief Append a base physical dimension with a non-zero exponent, separated from the previous one by a middle dot.
+  template <typename Sink, typename BaseDimension> static void print(Sink& output, const Base<BaseDimension>& base, bool& empty) noexcept {
+    if (base.value() != 0) {
+      if (!empty) {
+        append(output, "·");
+      }
+      base.print(output);
+      empty = false;
+    }
+  }
 
-  Temperature temperature_;
+  static constexpr uint_least64_t pack(int_least8_t value, int position) noexcept {
+    return static_cast<uint_least64_t>(static_cast<uint_least8_t>(value + 128)) << (8 * position);
+  }
 
-  SubstanceAmount substance_amount_;
+  constexpr int_least8_t unpack(int position) const noexcept {
+    return static_cast<int_least8_t>(static_cast<int>((packed_ >> (8 * position)) & 0xFF) - 128);
+  }
 
-  LuminousIntensity luminous_intensity_;
+  uint_least64_t packed_;
 
 };
 
 } // namespace Dimension
 
 template <> constexpr bool sort(const Dimension::Set& set_1, const Dimension::Set& set_2) noexcept {
-  if (set_1.length() == set_2.length()) {
-    if (set_1.mass() == set_2.mass()) {
-      if (set_1.time() == set_2.time()) {
-        if (set_1.electric_current() == set_2.electric_current()) {
-          if (set_1.temperature() == set_2.temperature()) {
-            if (set_1.substance_amount() == set_2.substance_amount()) {
-              return set_1.luminous_intensity() < set_2.luminous_intensity();
-            } else {
-              return set_1.substance_amount() < set_2.substance_amount();
-            }
-          } else {
-            return set_1.temperature() < set_2.temperature();
-          }
-        } else {
-          return set_1.electric_current() < set_2.electric_current();
-        }
-      } else {
-        return set_1.time() < set_2.time();
-      }
-    } else {
-      return set_1.mass() < set_2.mass();
+  return set_1 < set_2;
+}
+
+template <> struct Deserializer<Dimension::Set> {
+  static bool read(TextReader& reader, Dimension::Set& set) noexcept {
+    std::array<int_least8_t, 7> exponents;
+    if (!(reader.begin_object()
+      && reader.field(Dimension::Length::label(), exponents[0]) && reader.separator()
+      && reader.field(Dimension::Mass::label(), exponents[1]) && reader.separator()
+      && reader.field(Dimension::Time::label(), exponents[2]) && reader.separator()
+      && reader.field(Dimension::ElectricCurrent::label(), exponents[3]) && reader.separator()
+      && reader.field(Dimension::Temperature::label(), exponents[4]) && reader.separator()
+      && reader.field(Dimension::SubstanceAmount::label(), exponents[5]) && reader.separator()
+      && reader.field(Dimension::LuminousIntensity::label(), exponents[6])
+      && reader.end_object())) {
+      return false;
     }
-  } else {
-    return set_1.length() < set_2.length();
+    set = {exponents[0], exponents[1], exponents[2], exponents[3], exponents[4], exponents[5], exponents[6]};
+    return true;
   }
-}
+};
 
 } // namespace PhQ
 
 std::ostream& operator<<(std::ostream& output_stream, const PhQ::Dimension::Set& set) {
-  output_stream << set.print();
+  set.print(output_stream);
   return output_stream;
 }
 
@@ -183,14 +338,7 @@ namespace std {
 
 template <> struct hash<PhQ::Dimension::Set> {
   size_t operator()(const PhQ::Dimension::Set& set) const {
-    return
-      hash<PhQ::Dimension::Length>()(set.length())
-      ^ hash<PhQ::Dimension::Mass>()(set.mass())
-      ^ hash<PhQ::Dimension::Time>()(set.time())
-      ^ hash<PhQ::Dimension::ElectricCurrent>()(set.electric_current())
-      ^ hash<PhQ::Dimension::Temperature>()(set.temperature())
-      ^ hash<PhQ::Dimension::SubstanceAmount>()(set.substance_amount())
-      ^ hash<PhQ::Dimension::LuminousIntensity>()(set.luminous_intensity());
+    return hash<uint_least64_t>()(set.packed());
   }
 };
 
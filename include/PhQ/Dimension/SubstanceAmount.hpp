@@ -12,17 +12,17 @@ namespace PhQ {
 
 namespace Dimension {
 
-class SubstanceAmount : public Base {
+class SubstanceAmount : public Base<SubstanceAmount> {
 
 public:
 
-  constexpr SubstanceAmount(int_least8_t value = 0) noexcept : Base(value) {}
+  constexpr SubstanceAmount(int_least8_t value = 0) noexcept : Base<SubstanceAmount>(value) {}
 
-  std::string abbreviation() const noexcept {
+  static constexpr std::string_view abbreviation() noexcept {
     return "N";
   }
 
-  std::string label() const noexcept {
+  static constexpr std::string_view label() noexcept {
     return "substance_amount";
   }
 
@@ -12,17 +12,17 @@ namespace PhQ {
 
 namespace Dimension {
 
-class Temperature : public Base {
+class Temperature : public Base<Temperature> {
 
 public:
 
-  constexpr Temperature(int_least8_t value = 0) noexcept : Base(value) {}
+  constexpr Temperature(int_least8_t value = 0) noexcept : Base<Temperature>(value) {}
 
-  std::string abbreviation() const noexcept {
+  static constexpr std::string_view abbreviation() noexcept {
     return "Θ";
   }
 
-  std::string label() const noexcept {
+  static constexpr std::string_view label() noexcept {
     return "temperature";
   }
 
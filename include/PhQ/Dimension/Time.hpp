@@ -12,17 +12,17 @@ namespace PhQ {
 
 namespace Dimension {
 
-class Time : public Base {
+class Time : public Base<Time> {
 
 public:
 
-  constexpr Time(int_least8_t value = 0) noexcept : Base(value) {}
+  constexpr Time(int_least8_t value = 0) noexcept : Base<Time>(value) {}
 
-  std::string abbreviation() const noexcept {
+  static constexpr std::string_view abbreviation() noexcept {
     return "T";
   }
 
-  std::string label() const noexcept {
+  static constexpr std::string_view label() noexcept {
     return "time";
   }
 
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "Base/Reader.hpp"
 #include "Base/String.hpp"
 #include "Base/Type.hpp"
 
@@ -13,9 +14,12 @@ namespace PhQ {
 
 // Forward declarations.
 namespace Value {
-class Vector;
-class SymmetricDyadic;
-class Dyadic;
+template <typename Number = double> class BasicVector;
+template <typename Number = double> class BasicSymmetricDyadic;
+template <typename Number = double> class BasicDyadic;
+using Vector = BasicVector<double>;
+using SymmetricDyadic = BasicSymmetricDyadic<double>;
+using Dyadic = BasicDyadic<double>;
 } // namespace Value
 class Acceleration;
 class AccelerationMagnitude;
@@ -34,7 +38,8 @@ class StaticPressure;
 class TemperatureGradient;
 class TemperatureGradientMagnitude;
 class Traction;
-class Velocity;
+template <typename Number> class BasicVelocity;
+using Velocity = BasicVelocity<double>;
 
 class Direction {
 
@@ -113,31 +118,67 @@ public:
   constexpr Angle angle(const Value::Vector& vector) const noexcept;
 
   std::string print() const noexcept {
-    return
-      "(" + PhQ::number_to_string(x_) + ", " +
-      PhQ::number_to_string(y_) + ", " +
-      PhQ::number_to_string(z_) + ")";
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    PhQ::append(output, "(");
+    PhQ::append_number(output, x_);
+    PhQ::append(output, ", ");
+    PhQ::append_number(output, y_);
+    PhQ::append(output, ", ");
+    PhQ::append_number(output, z_);
+    PhQ::append(output, ")");
   }
 
   std::string yaml() const noexcept {
-    return
-      "{x:" + PhQ::number_to_string(x_) +
-      " , y:" + PhQ::number_to_string(y_) +
-      " , z:" + PhQ::number_to_string(z_) + "}";
+    std::string text;
+    yaml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void yaml(Sink& output) const noexcept {
+    PhQ::append(output, "{x:");
+    PhQ::append_number(output, x_);
+    PhQ::append(output, " , y:");
+    PhQ::append_number(output, y_);
+    PhQ::append(output, " , z:");
+    PhQ::append_number(output, z_);
+    PhQ::append(output, "}");
   }
 
   std::string json() const noexcept {
-    return
-      "{\"x\":" + PhQ::number_to_string(x_) +
-      " , \"y\":" + PhQ::number_to_string(y_) +
-      " , \"z\":" + PhQ::number_to_string(z_) + "}";
+    std::string text;
+    json(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void json(Sink& output) const noexcept {
+    PhQ::append(output, "{\"x\":");
+    PhQ::append_number(output, x_);
+    PhQ::append(output, " , \"y\":");
+    PhQ::append_number(output, y_);
+    PhQ::append(output, " , \"z\":");
+    PhQ::append_number(output, z_);
+    PhQ::append(output, "}");
   }
 
   std::string xml() const noexcept {
-    return
-      "<x>" + PhQ::number_to_string(x_) +
-      "</x><y>" + PhQ::number_to_string(y_) +
-      "</y><z>" + PhQ::number_to_string(z_) + "</z>";
+    std::string text;
+    xml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void xml(Sink& output) const noexcept {
+    PhQ::append(output, "<x>");
+    PhQ::append_number(output, x_);
+    PhQ::append(output, "</x><y>");
+    PhQ::append_number(output, y_);
+    PhQ::append(output, "</y><z>");
+    PhQ::append_number(output, z_);
+    PhQ::append(output, "</z>");
   }
 
   constexpr bool operator==(const Direction& direction) const noexcept {
@@ -186,10 +227,21 @@ template <> constexpr bool sort(const Direction& direction_1, const Direction& d
   }
 }
 
+template <> struct Deserializer<Direction> {
+  static bool read(TextReader& reader, Direction& direction) noexcept {
+    std::array<double, 3> x_y_z;
+    if (!reader.components({"x", "y", "z"}, x_y_z) || (x_y_z[0] == 0.0 && x_y_z[1] == 0.0 && x_y_z[2] == 0.0)) {
+      return false;
+    }
+    direction = {x_y_z[0], x_y_z[1], x_y_z[2]};
+    return true;
+  }
+};
+
 } // namespace PhQ
 
 std::ostream& operator<<(std::ostream& output_stream, const PhQ::Direction& direction) noexcept {
-  output_stream << direction.print();
+  direction.print(output_stream);
   return output_stream;
 }
 
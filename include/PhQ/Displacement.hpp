@@ -16,7 +16,8 @@ namespace PhQ {
 class Duration;
 class Frequency;
 class Position;
-class Velocity;
+template <typename Number> class BasicVelocity;
+using Velocity = BasicVelocity<double>;
 
 class Displacement : public DimensionalVectorQuantity<Unit::Length> {
 
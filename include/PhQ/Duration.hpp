@@ -28,7 +28,8 @@ class SpecificEnergy;
 class SpecificPower;
 class Speed;
 class Strain;
-class StrainRate;
+template <typename Number> class BasicStrainRate;
+using StrainRate = BasicStrainRate<double>;
 class Time;
 class Volume;
 class VolumeRate;
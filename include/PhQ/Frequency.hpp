@@ -15,7 +15,8 @@ namespace PhQ {
 class Acceleration;
 class Displacement;
 class Length;
-class Velocity;
+template <typename Number> class BasicVelocity;
+using Velocity = BasicVelocity<double>;
 
 class Frequency : public DimensionalScalarQuantity<Unit::Frequency> {
 
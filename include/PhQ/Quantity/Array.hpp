@@ -0,0 +1,461 @@
+// Copyright 2020 Alexandre Coderre-Chabot
+// This file is part of Physical Quantities (PhQ), a C++17 header-only library of physical quantities, physical models, and units of measure for scientific computation.
+// Physical Quantities is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+// You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "../Base/Allocator.hpp"
+#include "../Value/Pack.hpp"
+#include "Sequence.hpp"
+
+namespace PhQ {
+
+/// \brief Dimensionless scalar physical quantities, such as PhQ::ReynoldsNumber, and generic scalar physical quantities.
+template <typename Type> struct ArrayElement<Type, std::enable_if_t<std::is_base_of<DimensionlessScalarQuantity, Type>::value || is_generic_scalar_quantity<Type>>> {
+  static constexpr std::size_t size{1};
+
+  static constexpr std::array<double, size> components(const Type& quantity) noexcept {
+    return {quantity.value()};
+  }
+
+  static constexpr Type make(const std::array<double, size>& values) noexcept {
+    return Type{values[0]};
+  }
+};
+
+/// \brief Directions, whose components are those of their unit vector. The zero direction, which is the default direction, is represented by zero components.
+template <> struct ArrayElement<Direction> {
+  static constexpr std::size_t size{3};
+
+  static constexpr std::array<double, size> components(const Direction& direction) noexcept {
+    return {direction.x(), direction.y(), direction.z()};
+  }
+
+  static Direction make(const std::array<double, size>& values) noexcept {
+    if (values[0] == 0.0 && values[1] == 0.0 && values[2] == 0.0) {
+      return Direction{};
+    }
+    return Direction{values[0], values[1], values[2]};
+  }
+};
+
+// Forward declaration.
+template <typename Derived, typename Element> class LazyExpression;
+
+/// \brief Pack type of a given width for elements with a given number of components: PhQ::Value::ScalarPack for 1, PhQ::Value::VectorPack for 3, PhQ::Value::SymmetricDyadicPack for 6, and PhQ::Value::DyadicPack for 9.
+template <std::size_t ComponentCount, std::size_t Width, typename Number> struct ArrayPackOf;
+
+template <std::size_t Width, typename Number> struct ArrayPackOf<1, Width, Number> {
+  using Type = Value::ScalarPack<Width, Number>;
+};
+
+template <std::size_t Width, typename Number> struct ArrayPackOf<3, Width, Number> {
+  using Type = Value::VectorPack<Width, Number>;
+};
+
+template <std::size_t Width, typename Number> struct ArrayPackOf<6, Width, Number> {
+  using Type = Value::SymmetricDyadicPack<Width, Number>;
+};
+
+template <std::size_t Width, typename Number> struct ArrayPackOf<9, Width, Number> {
+  using Type = Value::DyadicPack<Width, Number>;
+};
+
+/// \brief Tag of the constructor of a PhQ::QuantityArray whose components are left uninitialized, for results that are about to be written in full.
+struct UninitializedArray {};
+
+/// \brief Container of physical quantities of one type that stores each component in its own contiguous, aligned array: a structure of arrays. For example, a QuantityArray<PhQ::Velocity> holds one array of x components, one of y components, and one of z components, all in the standard unit.
+/// \details Compared to a std::vector of quantities, which interleaves the components of each quantity, this layout lets the compiler vectorize bulk operations, since each loop reads and writes contiguous runs of numbers. Bulk operations keep the semantics of the element type: sums, differences, and scaling of whole arrays, as well as the magnitudes, directions, dot products, and cross products of arrays of vector quantities, and the products of arrays of scalar quantities and directions, which yield arrays of the related vector quantity. Arrays in a bulk operation must have the same size, otherwise the operation throws. A single element can be read as a quantity with get() or with operator[] on a constant or temporary array, and read or written through the proxy returned by operator[] on any other array. The components are stored as doubles by default; a QuantityArray<PhQ::Velocity, float> stores them as floats, which halves the memory and bandwidth of a large field, and its bulk operations run in single precision. Its elements are still read and written as double-precision quantities, rounding each component to single precision when it is written.
+template <typename Type, typename Number = double> class QuantityArray {
+
+public:
+
+  static constexpr std::size_t component_count{ArrayElement<Type>::size};
+
+  /// \brief Proxy to a single element of a quantity array, which converts to the element type and can be assigned from it.
+  class Reference {
+
+  public:
+
+    operator Type() const noexcept {
+      return array_.get(index_);
+    }
+
+    Reference& operator=(const Type& quantity) noexcept {
+      array_.set(index_, quantity);
+      return *this;
+    }
+
+    Reference& operator=(const Reference& reference) noexcept {
+      array_.set(index_, reference.array_.get(reference.index_));
+      return *this;
+    }
+
+  private:
+
+    constexpr Reference(QuantityArray& array, std::size_t index) noexcept : array_(array), index_(index) {}
+
+    QuantityArray& array_;
+
+    std::size_t index_;
+
+    friend class QuantityArray;
+
+  };
+
+  QuantityArray() noexcept = default;
+
+  /// \brief Create a quantity array of a given size whose components are all zero.
+  explicit QuantityArray(std::size_t size) {
+    resize(size);
+  }
+
+  explicit QuantityArray(const std::vector<Type>& quantities) : QuantityArray(quantities.size(), UninitializedArray{}) {
+    for (std::size_t index = 0; index < quantities.size(); ++index) {
+      set(index, quantities[index]);
+    }
+  }
+
+  /// \brief Explicit conversion from an array of the same quantities stored at another precision, such as widening single-precision storage to double precision or narrowing double-precision storage to single precision.
+  template <typename OtherNumber, std::enable_if_t<!std::is_same<OtherNumber, Number>::value, bool> = true> explicit QuantityArray(const QuantityArray<Type, OtherNumber>& array) : QuantityArray(array.size(), UninitializedArray{}) {
+    for (std::size_t component = 0; component < component_count; ++component) {
+      const OtherNumber* const values{array.component(component)};
+      Number* const results{components_[component].data()};
+      for (std::size_t index = 0; index < size(); ++index) {
+        results[index] = static_cast<Number>(values[index]);
+      }
+    }
+  }
+
+  /// \brief Compute a lazy expression of PhQ/Quantity/Lazy.hpp, such as PhQ::lazy(velocities) + duration * PhQ::lazy(accelerations), one component at a time in a single pass over its arrays. The expression must involve at least one quantity array, which sets the size of this array. Throws if the expression involves quantity arrays of different sizes.
+  template <typename Expression, std::enable_if_t<std::is_base_of<LazyExpression<Expression, Type>, Expression>::value, bool> = true> QuantityArray(const Expression& expression) : QuantityArray(expression.size(), UninitializedArray{}) {
+    static_assert(Expression::involves_arrays, "PhQ::QuantityArray can only be created from a lazy expression that involves quantity arrays.");
+    assign(expression);
+  }
+
+  /// \brief Compute a lazy expression into this array. Each element of the result depends only on the elements at the same index of the arrays in the expression, so this array may itself appear in the expression. An expression that involves no quantity arrays is assigned to every element. Throws if the expression involves quantity arrays of a different size than this one.
+  template <typename Expression, std::enable_if_t<std::is_base_of<LazyExpression<Expression, Type>, Expression>::value, bool> = true> QuantityArray& operator=(const Expression& expression) {
+    if constexpr (Expression::involves_arrays) {
+      check_size(expression.size());
+    }
+    assign(expression);
+    return *this;
+  }
+
+  std::vector<Type> to_vector() const {
+    std::vector<Type> quantities;
+    quantities.reserve(size());
+    for (std::size_t index = 0; index < size(); ++index) {
+      quantities.push_back(get(index));
+    }
+    return quantities;
+  }
+
+  std::size_t size() const noexcept {
+    return components_[0].size();
+  }
+
+  bool empty() const noexcept {
+    return components_[0].empty();
+  }
+
+  void reserve(std::size_t capacity) {
+    for (AlignedVector<Number>& component : components_) {
+      component.reserve(capacity);
+    }
+  }
+
+  /// \brief Resize the array. New elements have zero components.
+  void resize(std::size_t size) {
+    for (AlignedVector<Number>& component : components_) {
+      component.resize(size, Number{0});
+    }
+  }
+
+  void clear() noexcept {
+    for (AlignedVector<Number>& component : components_) {
+      component.clear();
+    }
+  }
+
+  void push_back(const Type& quantity) {
+    const std::array<double, component_count> values{ArrayElement<Type>::components(quantity)};
+    for (std::size_t component = 0; component < component_count; ++component) {
+      components_[component].push_back(static_cast<Number>(values[component]));
+    }
+  }
+
+  Type get(std::size_t index) const noexcept {
+    std::array<double, component_count> values;
+    for (std::size_t component = 0; component < component_count; ++component) {
+      values[component] = components_[component][index];
+    }
+    return ArrayElement<Type>::make(values);
+  }
+
+  void set(std::size_t index, const Type& quantity) noexcept {
+    const std::array<double, component_count> values{ArrayElement<Type>::components(quantity)};
+    for (std::size_t component = 0; component < component_count; ++component) {
+      components_[component][index] = static_cast<Number>(values[component]);
+    }
+  }
+
+  Type operator[](std::size_t index) const& noexcept {
+    return get(index);
+  }
+
+  Reference operator[](std::size_t index) & noexcept {
+    return {*this, index};
+  }
+
+  /// \brief Contiguous, aligned array of one component of every element in the standard unit, in the order of PhQ::component_labels, such as the y components of an array of velocities.
+  const Number* component(std::size_t component) const noexcept {
+    return components_[component].data();
+  }
+
+  Number* component(std::size_t component) noexcept {
+    return components_[component].data();
+  }
+
+  /// \brief Pack of the values in the standard unit of a given number of consecutive elements starting at a given index, such as a PhQ::Value::VectorPack for an array of velocities or of directions.
+  template <std::size_t Width> typename ArrayPackOf<component_count, Width, Number>::Type load(std::size_t index) const noexcept {
+    if constexpr (component_count == 1) {
+      return Value::ScalarPack<Width, Number>::load(component(0), index);
+    } else {
+      return ArrayPackOf<component_count, Width, Number>::Type::load(component_pointers(), index);
+    }
+  }
+
+  /// \brief Write a pack of values in the standard unit to consecutive elements starting at a given index.
+  template <typename Pack, std::enable_if_t<std::is_same<Pack, typename ArrayPackOf<component_count, Pack::width, Number>::Type>::value, bool> = true> void store(std::size_t index, const Pack& pack) noexcept {
+    if constexpr (component_count == 1) {
+      pack.store(component(0), index);
+    } else {
+      std::array<Number*, component_count> pointers;
+      for (std::size_t component_ = 0; component_ < component_count; ++component_) {
+        pointers[component_] = component(component_);
+      }
+      pack.store(pointers, index);
+    }
+  }
+
+  QuantityArray operator+(const QuantityArray& array) const {
+    check_size(array.size());
+    QuantityArray result{size(), UninitializedArray{}};
+    for (std::size_t component = 0; component < component_count; ++component) {
+      transform(component, array, result, [](Number value1, Number value2) { return value1 + value2; });
+    }
+    return result;
+  }
+
+  void operator+=(const QuantityArray& array) {
+    check_size(array.size());
+    for (std::size_t component = 0; component < component_count; ++component) {
+      transform(component, array, *this, [](Number value1, Number value2) { return value1 + value2; });
+    }
+  }
+
+  QuantityArray operator-(const QuantityArray& array) const {
+    check_size(array.size());
+    QuantityArray result{size(), UninitializedArray{}};
+    for (std::size_t component = 0; component < component_count; ++component) {
+      transform(component, array, result, [](Number value1, Number value2) { return value1 - value2; });
+    }
+    return result;
+  }
+
+  void operator-=(const QuantityArray& array) {
+    check_size(array.size());
+    for (std::size_t component = 0; component < component_count; ++component) {
+      transform(component, array, *this, [](Number value1, Number value2) { return value1 - value2; });
+    }
+  }
+
+  QuantityArray operator*(Number real) const {
+    QuantityArray result{size(), UninitializedArray{}};
+    for (std::size_t component = 0; component < component_count; ++component) {
+      scale(component, real, result);
+    }
+    return result;
+  }
+
+  void operator*=(Number real) noexcept {
+    for (std::size_t component = 0; component < component_count; ++component) {
+      scale(component, real, *this);
+    }
+  }
+
+  QuantityArray operator/(Number real) const {
+    return *this * (Number{1} / real);
+  }
+
+  void operator/=(Number real) noexcept {
+    *this *= Number{1} / real;
+  }
+
+  /// \brief Magnitudes of an array of vector quantities, such as the speeds of an array of velocities.
+  template <typename Vector = Type> QuantityArray<decltype(std::declval<const Vector&>().magnitude()), Number> magnitude() const {
+    QuantityArray<decltype(std::declval<const Vector&>().magnitude()), Number> result{size(), UninitializedArray{}};
+    magnitude(result);
+    return result;
+  }
+
+  /// \brief Magnitudes of an array of vector quantities, written into an array that is resized to the size of this one, so that its memory can be reused between calls.
+  template <typename Magnitude> void magnitude(QuantityArray<Magnitude, Number>& result) const {
+    static_assert(component_count == 3 && std::is_same<Magnitude, decltype(std::declval<const Type&>().magnitude())>::value, "PhQ::QuantityArray::magnitude requires vector quantities and an array of their magnitudes.");
+    result.components_[0].resize(size());
+    const Number* const x{component(0)};
+    const Number* const y{component(1)};
+    const Number* const z{component(2)};
+    Number* const magnitudes{result.component(0)};
+    for (std::size_t index = 0; index < size(); ++index) {
+      magnitudes[index] = std::sqrt(x[index] * x[index] + y[index] * y[index] + z[index] * z[index]);
+    }
+  }
+
+  /// \brief Directions of an array of vector quantities. Unlike PhQ::Direction, a zero vector yields the zero direction rather than throwing.
+  template <typename Vector = Type, std::enable_if_t<std::is_same<decltype(std::declval<const Vector&>().direction()), Direction>::value, bool> = true> QuantityArray<Direction, Number> direction() const {
+    QuantityArray<Direction, Number> result{size(), UninitializedArray{}};
+    const Number* const x{component(0)};
+    const Number* const y{component(1)};
+    const Number* const z{component(2)};
+    Number* const result_x{result.component(0)};
+    Number* const result_y{result.component(1)};
+    Number* const result_z{result.component(2)};
+    for (std::size_t index = 0; index < size(); ++index) {
+      const Number magnitude{std::sqrt(x[index] * x[index] + y[index] * y[index] + z[index] * z[index])};
+      const Number inverse{magnitude > Number{0} ? Number{1} / magnitude : Number{0}};
+      result_x[index] = x[index] * inverse;
+      result_y[index] = y[index] * inverse;
+      result_z[index] = z[index] * inverse;
+    }
+    return result;
+  }
+
+  /// \brief Dot products of the elements of two arrays of vector quantities or directions. The result is an array of generic scalar quantities whose physical dimension set is the product of those of the operands; with an array of directions, it is the array of projections, such as the speeds of an array of velocities along an array of directions.
+  template <typename Other> auto dot(const QuantityArray<Other, Number>& array) const {
+    static_assert(component_count == 3 && QuantityArray<Other, Number>::component_count == 3, "PhQ::QuantityArray::dot requires vector quantities or directions.");
+    check_size(array.size());
+    QuantityArray<GenericScalarQuantity<(dimension_set_of<Type>() * dimension_set_of<Other>()).packed()>, Number> result{size(), UninitializedArray{}};
+    const Number* const x1{component(0)};
+    const Number* const y1{component(1)};
+    const Number* const z1{component(2)};
+    const Number* const x2{array.component(0)};
+    const Number* const y2{array.component(1)};
+    const Number* const z2{array.component(2)};
+    Number* const products{result.component(0)};
+    for (std::size_t index = 0; index < size(); ++index) {
+      products[index] = x1[index] * x2[index] + y1[index] * y2[index] + z1[index] * z2[index];
+    }
+    return result;
+  }
+
+  /// \brief Cross products of the elements of this array of vector quantities and of an array of directions, which are vector quantities of the same type.
+  QuantityArray cross(const QuantityArray<Direction, Number>& directions) const {
+    static_assert(component_count == 3, "PhQ::QuantityArray::cross requires vector quantities.");
+    check_size(directions.size());
+    QuantityArray result{size(), UninitializedArray{}};
+    const Number* const x1{component(0)};
+    const Number* const y1{component(1)};
+    const Number* const z1{component(2)};
+    const Number* const x2{directions.component(0)};
+    const Number* const y2{directions.component(1)};
+    const Number* const z2{directions.component(2)};
+    Number* const x{result.component(0)};
+    Number* const y{result.component(1)};
+    Number* const z{result.component(2)};
+    for (std::size_t index = 0; index < size(); ++index) {
+      x[index] = y1[index] * z2[index] - z1[index] * y2[index];
+      y[index] = z1[index] * x2[index] - x1[index] * z2[index];
+      z[index] = x1[index] * y2[index] - y1[index] * x2[index];
+    }
+    return result;
+  }
+
+  /// \brief Products of the elements of this array of scalar quantities and of an array of directions, such as the velocities of an array of speeds along an array of directions.
+  template <typename Scalar = Type> QuantityArray<decltype(std::declval<const Scalar&>() * std::declval<const Direction&>()), Number> operator*(const QuantityArray<Direction, Number>& directions) const {
+    static_assert(component_count == 1, "PhQ::QuantityArray::operator* with directions requires scalar quantities.");
+    check_size(directions.size());
+    QuantityArray<decltype(std::declval<const Scalar&>() * std::declval<const Direction&>()), Number> result{size(), UninitializedArray{}};
+    const Number* const magnitudes{component(0)};
+    for (std::size_t component = 0; component < 3; ++component) {
+      const Number* const values{directions.component(component)};
+      Number* const results{result.component(component)};
+      for (std::size_t index = 0; index < size(); ++index) {
+        results[index] = magnitudes[index] * values[index];
+      }
+    }
+    return result;
+  }
+
+private:
+
+  QuantityArray(std::size_t size, UninitializedArray) {
+    for (AlignedVector<Number>& component : components_) {
+      component.resize(size);
+    }
+  }
+
+  /// \brief Physical dimension set of an element type, which is dimensionless for directions.
+  template <typename Element> static constexpr Dimension::Set dimension_set_of() noexcept {
+    if constexpr (std::is_same<Element, Direction>::value) {
+      return {};
+    } else {
+      return dimension<QuantityUnit<Element>>;
+    }
+  }
+
+  /// \brief Throw if an array in a bulk operation has a different size than this one.
+  void check_size(std::size_t other_size) const {
+    if (size() != other_size) {
+      throw std::runtime_error{"Cannot operate on quantity arrays of " + std::to_string(size()) + " and " + std::to_string(other_size) + " elements."};
+    }
+  }
+
+  template <typename Expression> void assign(const Expression& expression) noexcept {
+    for (std::size_t component = 0; component < component_count; ++component) {
+      Number* const results{components_[component].data()};
+      for (std::size_t index = 0; index < size(); ++index) {
+        results[index] = static_cast<Number>(expression(component, index));
+      }
+    }
+  }
+
+  template <typename Operation> void transform(std::size_t component, const QuantityArray& array, QuantityArray& result, Operation operation) const noexcept {
+    const Number* const values1{components_[component].data()};
+    const Number* const values2{array.components_[component].data()};
+    Number* const results{result.components_[component].data()};
+    for (std::size_t index = 0; index < size(); ++index) {
+      results[index] = operation(values1[index], values2[index]);
+    }
+  }
+
+  std::array<const Number*, component_count> component_pointers() const noexcept {
+    std::array<const Number*, component_count> pointers;
+    for (std::size_t component_ = 0; component_ < component_count; ++component_) {
+      pointers[component_] = component(component_);
+    }
+    return pointers;
+  }
+
+  void scale(std::size_t component, Number real, QuantityArray& result) const noexcept {
+    const Number* const values{components_[component].data()};
+    Number* const results{result.components_[component].data()};
+    for (std::size_t index = 0; index < size(); ++index) {
+      results[index] = values[index] * real;
+    }
+  }
+
+  std::array<AlignedVector<Number>, component_count> components_;
+
+  template <typename OtherType, typename OtherNumber> friend class QuantityArray;
+
+};
+
+} // namespace PhQ
+
+template <typename Type, typename Number> PhQ::QuantityArray<Type, Number> operator*(PhQ::NonDeduced<Number> real, const PhQ::QuantityArray<Type, Number>& array) {
+  return array * real;
+}
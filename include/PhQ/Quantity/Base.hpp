@@ -10,16 +10,22 @@
 
 namespace PhQ {
 
+/// \brief Base of all physical quantities. Has no virtual functions and no data members, so a physical quantity is exactly the size of its values.
+/// \details Every physical quantity provides a constexpr dimension() method. The interface is resolved statically on the concrete quantity type rather than through a virtual table.
 class Quantity {
 
-public:
-
-  virtual Dimension::Set dimension() const noexcept = 0;
-
 protected:
 
   constexpr Quantity() noexcept = default;
 
 };
 
+// Forward declarations. The values of dimensional scalar, vector, and symmetric dyadic tensor physical quantities are stored as doubles unless another number type is given, such as float for PhQ::BasicVelocity<float>.
+template <typename Unit, typename Number = double> class DimensionalScalarQuantity;
+template <typename Unit, typename Number = double> class DimensionalSymmetricDyadicQuantity;
+template <typename Unit, typename Number = double> class DimensionalVectorQuantity;
+
+/// \brief Value type of a physical quantity: double, PhQ::Value::Vector, PhQ::Value::SymmetricDyadic, or PhQ::Value::Dyadic, or their counterparts at another precision, such as float or PhQ::Value::BasicVector<float>.
+template <typename Type> using QuantityValue = std::decay_t<decltype(std::declval<const Type&>().value())>;
+
 } // namespace PhQ
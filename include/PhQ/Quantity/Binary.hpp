@@ -0,0 +1,310 @@
+// Copyright 2020 Alexandre Coderre-Chabot
+// This file is part of Physical Quantities (PhQ), a C++17 header-only library of physical quantities, physical models, and units of measure for scientific computation.
+// Physical Quantities is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+// You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Sequence.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+// Undefined at the end of this header, so that it does not leak into the code that includes it.
+#define PHQ_MEMORY_MAPPING
+#endif
+
+namespace PhQ {
+
+/// \brief Header of a PhQ binary file of dimensional physical quantities. The header is 64 bytes long and is followed by the payload: the components of each quantity in order, as raw doubles, expressed in the unit recorded in the header.
+/// \details The header records everything needed to check that a file holds a given quantity type: the number of components of each quantity (1 for a scalar, 3 for a vector, 6 for a symmetric dyadic, and 9 for a dyadic), the packed physical dimension set, and the unit, both as the underlying value of its enumeration and as its abbreviation. Numbers are stored in the byte order of the machine that wrote the file, which is recorded so that a mismatch is detected rather than misread.
+struct BinaryHeader {
+
+  static constexpr std::array<char, 4> expected_magic{'P', 'h', 'Q', 'B'};
+
+  static constexpr uint32_t expected_byte_order{0x01020304};
+
+  static constexpr uint16_t current_version{1};
+
+  std::array<char, 4> magic{expected_magic};
+
+  uint32_t byte_order{expected_byte_order};
+
+  uint16_t version{current_version};
+
+  uint16_t unit{0};
+
+  uint8_t components{0};
+
+  std::array<uint8_t, 3> reserved{};
+
+  uint64_t dimension{0};
+
+  uint64_t count{0};
+
+  /// \brief Offset of the payload from the start of the file, in bytes. Always a multiple of the alignment of a double.
+  uint64_t payload_offset{0};
+
+  /// \brief Abbreviation of the unit, null-padded. Truncated if longer than the field, in which case it is not null-terminated.
+  std::array<char, 24> unit_abbreviation{};
+
+};
+
+static_assert(sizeof(BinaryHeader) == 64, "PhQ::BinaryHeader must be 64 bytes long.");
+
+/// \brief Header of a binary file of dimensional physical quantities of a given type, in a given unit.
+template <typename Type> BinaryHeader binary_header(std::size_t count, QuantityUnit<Type> unit) noexcept {
+  BinaryHeader header;
+  header.unit = static_cast<uint16_t>(unit);
+  header.components = static_cast<uint8_t>(component_labels<QuantityValue<Type>>.size());
+  header.dimension = dimension<QuantityUnit<Type>>.packed();
+  header.count = count;
+  header.payload_offset = sizeof(BinaryHeader);
+  const std::string_view abbreviation_text{abbreviation(unit)};
+  std::copy_n(abbreviation_text.begin(), std::min(abbreviation_text.size(), header.unit_abbreviation.size()), header.unit_abbreviation.begin());
+  return header;
+}
+
+/// \brief Whether a header describes quantities of a given type and whether a file of a given size holds all of them. On success, the unit recorded in the header is returned.
+template <typename Type> std::optional<QuantityUnit<Type>> check_binary_header(const BinaryHeader& header, std::size_t file_size) noexcept {
+  constexpr const std::size_t component_count{component_labels<QuantityValue<Type>>.size()};
+  if (header.magic != BinaryHeader::expected_magic || header.byte_order != BinaryHeader::expected_byte_order || header.version != BinaryHeader::current_version || header.components != component_count || header.dimension != dimension<QuantityUnit<Type>>.packed() || header.unit >= abbreviations<QuantityUnit<Type>>.size() || header.payload_offset < sizeof(BinaryHeader) || header.payload_offset % alignof(double) != 0 || header.payload_offset > file_size || header.count > (file_size - header.payload_offset) / (component_count * sizeof(double))) {
+    return std::nullopt;
+  }
+  const QuantityUnit<Type> unit{static_cast<QuantityUnit<Type>>(header.unit)};
+  const std::string_view expected_abbreviation{abbreviation(unit)};
+  const std::string_view recorded_abbreviation{header.unit_abbreviation.data(), std::min(expected_abbreviation.size(), header.unit_abbreviation.size())};
+  if (expected_abbreviation.substr(0, recorded_abbreviation.size()) != recorded_abbreviation || (recorded_abbreviation.size() < header.unit_abbreviation.size() && header.unit_abbreviation[recorded_abbreviation.size()] != '\0')) {
+    return std::nullopt;
+  }
+  return {unit};
+}
+
+/// \brief Write a sequence of dimensional physical quantities to a binary output stream as a PhQ binary file: a PhQ::BinaryHeader followed by the raw components of each quantity, converted to the unit in bulk. Returns whether the stream is still good.
+/// \details The stream should be opened in binary mode, such as a std::ofstream opened with std::ios::binary. The quantities are converted in chunks, so little memory is needed beyond the stream buffer.
+template <typename Type> bool write_binary(std::ostream& output, const std::vector<Type>& quantities, QuantityUnit<Type> unit = standard_unit<QuantityUnit<Type>>) noexcept {
+  constexpr const std::size_t component_count{component_labels<QuantityValue<Type>>.size()};
+  constexpr const std::size_t chunk_size{4096};
+  const BinaryHeader header{binary_header<Type>(quantities.size(), unit)};
+  output.write(reinterpret_cast<const char*>(&header), sizeof(BinaryHeader));
+  std::vector<double> chunk;
+  chunk.reserve(chunk_size * component_count);
+  for (std::size_t first = 0; first < quantities.size(); first += chunk_size) {
+    const std::size_t last{std::min(first + chunk_size, quantities.size())};
+    chunk.clear();
+    for (std::size_t index = first; index < last; ++index) {
+      const std::array<double, component_count> values{components(quantities[index].value())};
+      chunk.insert(chunk.end(), values.begin(), values.end());
+    }
+    convert_in_place(chunk.data(), chunk.size(), standard_unit<QuantityUnit<Type>>, unit);
+    output.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(chunk.size() * sizeof(double)));
+  }
+  return output.good();
+}
+
+template <typename Type> bool write_binary(std::ostream& output, const std::vector<Type>& quantities, System system) noexcept {
+  return write_binary(output, quantities, unit<QuantityUnit<Type>>(system));
+}
+
+/// \brief Typed view of the dimensional physical quantities of a PhQ binary file, which is memory-mapped rather than read.
+/// \details Opening a file only maps it and checks its header against the quantity type, so no number is parsed or copied. The payload is then accessed in place, either as contiguous real numbers through values(), or one quantity at a time by value through operator[] and iterators, which copy only the components of that quantity. If the file was written in a unit other than the standard unit, the payload is converted to the standard unit in bulk on first access; the mapping is private, so this conversion copies only the pages it touches and never modifies the file. On platforms without memory mapping, the payload is read into memory instead.
+template <typename Type> class MappedQuantities {
+
+public:
+
+  /// \brief Map a PhQ binary file of quantities of this type. Check valid() before accessing the quantities.
+  explicit MappedQuantities(const std::string& path) noexcept {
+#ifdef PHQ_MEMORY_MAPPING
+    const int file{::open(path.c_str(), O_RDONLY)};
+    if (file < 0) {
+      return;
+    }
+    struct stat status;
+    if (::fstat(file, &status) == 0 && static_cast<std::size_t>(status.st_size) >= sizeof(BinaryHeader)) {
+      void* mapping{::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0)};
+      if (mapping != MAP_FAILED) {
+        mapping_ = mapping;
+        mapping_size_ = static_cast<std::size_t>(status.st_size);
+      }
+    }
+    ::close(file);
+    if (mapping_ != nullptr) {
+      open(static_cast<char*>(mapping_), mapping_size_);
+    }
+#else
+    std::ifstream file{path, std::ios::binary | std::ios::ate};
+    if (!file) {
+      return;
+    }
+    const std::size_t file_size{static_cast<std::size_t>(file.tellg())};
+    buffer_.resize((file_size + sizeof(double) - 1) / sizeof(double));
+    file.seekg(0);
+    if (file_size >= sizeof(BinaryHeader) && file.read(reinterpret_cast<char*>(buffer_.data()), static_cast<std::streamsize>(file_size))) {
+      open(reinterpret_cast<char*>(buffer_.data()), file_size);
+    }
+#endif
+  }
+
+  MappedQuantities(const MappedQuantities&) = delete;
+
+  MappedQuantities& operator=(const MappedQuantities&) = delete;
+
+  MappedQuantities(MappedQuantities&& other) noexcept : mapping_(std::exchange(other.mapping_, nullptr)), mapping_size_(std::exchange(other.mapping_size_, 0)), buffer_(std::move(other.buffer_)), payload_(std::exchange(other.payload_, nullptr)), size_(std::exchange(other.size_, 0)), file_unit_(other.file_unit_), converted_(other.converted_) {}
+
+  MappedQuantities& operator=(MappedQuantities&& other) noexcept {
+    if (this != &other) {
+      unmap();
+      mapping_ = std::exchange(other.mapping_, nullptr);
+      mapping_size_ = std::exchange(other.mapping_size_, 0);
+      buffer_ = std::move(other.buffer_);
+      payload_ = std::exchange(other.payload_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+      file_unit_ = other.file_unit_;
+      converted_ = other.converted_;
+    }
+    return *this;
+  }
+
+  ~MappedQuantities() noexcept {
+    unmap();
+  }
+
+  /// \brief Whether the file was mapped and its header describes quantities of this type.
+  bool valid() const noexcept {
+    return payload_ != nullptr;
+  }
+
+  std::size_t size() const noexcept {
+    return size_;
+  }
+
+  bool empty() const noexcept {
+    return size_ == 0;
+  }
+
+  /// \brief Unit in which the quantities are stored in the file.
+  QuantityUnit<Type> file_unit() const noexcept {
+    return file_unit_;
+  }
+
+  /// \brief Components of the quantities in the standard unit, contiguous and in order. Converts the payload on first access if the file was written in another unit.
+  const double* values() noexcept {
+    if (!converted_ && payload_ != nullptr) {
+      convert_in_place(payload_, size_ * component_labels<QuantityValue<Type>>.size(), file_unit_, standard_unit<QuantityUnit<Type>>);
+      converted_ = true;
+    }
+    return payload_;
+  }
+
+  /// \brief Quantity at a given index, read by value from its components in the standard unit.
+  Type operator[](std::size_t index) noexcept {
+    constexpr const std::size_t component_count{component_labels<QuantityValue<Type>>.size()};
+    std::array<double, component_count> components;
+    std::copy_n(values() + index * component_count, component_count, components.begin());
+    return ArrayElement<Type>::make(components);
+  }
+
+  /// \brief Input iterator over the quantities, which are read by value, such as for std::vector<PhQ::Velocity>{mapped.begin(), mapped.end()}.
+  class Iterator {
+
+  public:
+
+    using iterator_category = std::input_iterator_tag;
+
+    using value_type = Type;
+
+    using difference_type = std::ptrdiff_t;
+
+    using pointer = void;
+
+    using reference = Type;
+
+    Iterator(MappedQuantities& quantities, std::size_t index) noexcept : quantities_(&quantities), index_(index) {}
+
+    Type operator*() const noexcept {
+      return (*quantities_)[index_];
+    }
+
+    Iterator& operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+
+    Iterator operator++(int) noexcept {
+      Iterator previous{*this};
+      ++index_;
+      return previous;
+    }
+
+    bool operator==(const Iterator& other) const noexcept {
+      return index_ == other.index_;
+    }
+
+    bool operator!=(const Iterator& other) const noexcept {
+      return index_ != other.index_;
+    }
+
+  private:
+
+    MappedQuantities* quantities_;
+
+    std::size_t index_;
+
+  };
+
+  Iterator begin() noexcept {
+    return {*this, 0};
+  }
+
+  Iterator end() noexcept {
+    return {*this, size_};
+  }
+
+private:
+
+  void open(char* bytes, std::size_t file_size) noexcept {
+    BinaryHeader header;
+    std::memcpy(&header, bytes, sizeof(BinaryHeader));
+    const std::optional<QuantityUnit<Type>> unit{check_binary_header<Type>(header, file_size)};
+    if (unit.has_value()) {
+      payload_ = reinterpret_cast<double*>(bytes + header.payload_offset);
+      size_ = static_cast<std::size_t>(header.count);
+      file_unit_ = unit.value();
+      converted_ = file_unit_ == standard_unit<QuantityUnit<Type>>;
+    }
+  }
+
+  void unmap() noexcept {
+#ifdef PHQ_MEMORY_MAPPING
+    if (mapping_ != nullptr) {
+      ::munmap(mapping_, mapping_size_);
+    }
+#endif
+    mapping_ = nullptr;
+    mapping_size_ = 0;
+    payload_ = nullptr;
+    size_ = 0;
+  }
+
+  void* mapping_{nullptr};
+
+  std::size_t mapping_size_{0};
+
+  std::vector<double> buffer_;
+
+  double* payload_{nullptr};
+
+  std::size_t size_{0};
+
+  QuantityUnit<Type> file_unit_{standard_unit<QuantityUnit<Type>>};
+
+  bool converted_{true};
+
+};
+
+} // namespace PhQ
+
+#undef PHQ_MEMORY_MAPPING
@@ -11,6 +11,7 @@
 
 namespace PhQ {
 
+/// \brief Base of all dimensional physical quantities. Derived classes provide print, json, and xml methods, each optionally taking a unit or a unit system.
 template <typename Unit> class DimensionalQuantity : public Quantity {
 
 public:
@@ -23,33 +24,32 @@ public:
     return standard_unit<Unit>;
   }
 
-  virtual std::string print() const noexcept = 0;
-
-  virtual std::string print(Unit unit) const noexcept = 0;
-
-  virtual std::string print(System system) const noexcept = 0;
-
-  virtual std::string json() const noexcept = 0;
-
-  virtual std::string json(Unit unit) const noexcept = 0;
-
-  virtual std::string json(System system) const noexcept = 0;
-
-  virtual std::string xml() const noexcept = 0;
-
-  virtual std::string xml(Unit unit) const noexcept = 0;
-
-  virtual std::string xml(System system) const noexcept = 0;
-
 protected:
 
   constexpr DimensionalQuantity() noexcept : Quantity() {}
 
 };
 
-template <typename Unit> std::ostream& operator<<(std::ostream& stream, const DimensionalQuantity<Unit>& quantity) noexcept {
-  stream << quantity.print();
-  return stream;
+/// \brief Unit type of a dimensional physical quantity, such as PhQ::Unit::Pressure for PhQ::Stress.
+template <typename Type> using QuantityUnit = decltype(std::declval<const Type&>().unit());
+
+/// \brief Create a physical quantity from a value expressed in a unit known at compile time. The conversion to the standard unit is resolved at compile time.
+/// \details For example, PhQ::make<PhQ::StaticPressure, PhQ::Unit::Pressure::PoundPerSquareInch>(14.7) creates a static pressure of 101352.9 Pa. The value can be a number or a PhQ::Value::Vector, PhQ::Value::SymmetricDyadic, or PhQ::Value::Dyadic.
+template <typename Quantity, auto OldUnit, typename ValueType> constexpr Quantity make(const ValueType& value) noexcept {
+  return {convert<OldUnit, standard_unit<decltype(OldUnit)>>(value), standard_unit<decltype(OldUnit)>};
 }
 
+/// \brief Dimensional physical quantities, read from their value followed by the abbreviation of their unit, and converted to the standard unit.
+template <typename Type> struct Deserializer<Type, std::enable_if_t<std::is_base_of<DimensionalQuantity<QuantityUnit<Type>>, Type>::value>> {
+  static bool read(TextReader& reader, Type& quantity) noexcept {
+    QuantityValue<Type> value;
+    QuantityUnit<Type> unit;
+    if (!(reader.begin_object() && reader.field("value", value) && reader.separator() && reader.field("unit", unit) && reader.end_object())) {
+      return false;
+    }
+    quantity = Type{value, unit};
+    return true;
+  }
+};
+
 } // namespace PhQ
@@ -20,7 +20,7 @@ public:
     return value_;
   }
 
-  Value::Dyadic value(const Unit unit) const noexcept {
+  constexpr Value::Dyadic value(const Unit unit) const noexcept {
     if (unit == standard_unit<Unit>) {
       return value_;
     } else {
@@ -37,51 +37,165 @@ public:
   }
 
   std::string print() const noexcept {
-    return value_.print() + " " + abbreviation(standard_unit<Unit>);
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    value_.print(output);
+    append(output, " ");
+    append(output, abbreviation(standard_unit<Unit>));
   }
 
   std::string print(Unit unit) const noexcept {
-    return value(unit).print() + " " + abbreviation(unit);
+    std::string text;
+    print(text, unit);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output, Unit unit) const noexcept {
+    value(unit).print(output);
+    append(output, " ");
+    append(output, abbreviation(unit));
   }
 
   std::string print(System system) const noexcept {
-    return value(system).print() + " " + abbreviation(unit<Unit>(system));
+    std::string text;
+    print(text, system);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output, System system) const noexcept {
+    value(system).print(output);
+    append(output, " ");
+    append(output, abbreviation(unit<Unit>(system)));
   }
 
   std::string yaml() const noexcept {
-    return "{value: " + value_.yaml() + ", unit: " + abbreviation(standard_unit<Unit>) + "}";
+    std::string text;
+    yaml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void yaml(Sink& output) const noexcept {
+    append(output, "{value: ");
+    value_.yaml(output);
+    append(output, ", unit: ");
+    append(output, abbreviation(standard_unit<Unit>));
+    append(output, "}");
   }
 
   std::string yaml(Unit unit) const noexcept {
-    return "{value: " + value(unit).yaml() + ", unit: " + abbreviation(unit) + "}";
+    std::string text;
+    yaml(text, unit);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void yaml(Sink& output, Unit unit) const noexcept {
+    append(output, "{value: ");
+    value(unit).yaml(output);
+    append(output, ", unit: ");
+    append(output, abbreviation(unit));
+    append(output, "}");
   }
 
   std::string yaml(System system) const noexcept {
-    return "{value: " + value(system).yaml() + ", unit: " + abbreviation(unit<Unit>(system)) + "}";
+    std::string text;
+    yaml(text, system);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void yaml(Sink& output, System system) const noexcept {
+    append(output, "{value: ");
+    value(system).yaml(output);
+    append(output, ", unit: ");
+    append(output, abbreviation(unit<Unit>(system)));
+    append(output, "}");
   }
 
   std::string json() const noexcept {
-    return "{\"value\": " + value_.json() + ", \"unit\": \"" + abbreviation(standard_unit<Unit>) + "\"}";
+    std::string text;
+    json(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output) const noexcept {
+    append(output, "{\"value\": ");
+    value_.json(output);
+    append(output, ", \"unit\": \"");
+    append(output, abbreviation(standard_unit<Unit>));
+    append(output, "\"}");
   }
 
   std::string json(Unit unit) const noexcept {
-    return "{\"value\": " + value(unit).json() + ", \"unit\": \"" + abbreviation(unit) + "\"}";
+    std::string text;
+    json(text, unit);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output, Unit unit) const noexcept {
+    append(output, "{\"value\": ");
+    value(unit).json(output);
+    append(output, ", \"unit\": \"");
+    append(output, abbreviation(unit));
+    append(output, "\"}");
   }
 
   std::string json(System system) const noexcept {
-    return "{\"value\": " + value(system).json() + ", \"unit\": \"" + abbreviation(unit<Unit>(system)) + "\"}";
+    std::string text;
+    json(text, system);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output, System system) const noexcept {
+    append(output, "{\"value\": ");
+    value(system).json(output);
+    append(output, ", \"unit\": \"");
+    append(output, abbreviation(unit<Unit>(system)));
+    append(output, "\"}");
   }
 
   std::string xml() const noexcept {
-    return "<value>" + value_.xml() + "</value><unit>" + abbreviation(standard_unit<Unit>) + "</unit>";
+    std::string text;
+    xml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output) const noexcept {
+    append(output, "<value>");
+    value_.xml(output);
+    append(output, "</value><unit>");
+    append(output, abbreviation(standard_unit<Unit>));
+    append(output, "</unit>");
   }
 
   std::string xml(Unit unit) const noexcept {
-    return "<value>" + value(unit).xml() + "</value><unit>" + abbreviation(unit) + "</unit>";
+    std::string text;
+    xml(text, unit);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output, Unit unit) const noexcept {
+    append(output, "<value>");
+    value(unit).xml(output);
+    append(output, "</value><unit>");
+    append(output, abbreviation(unit));
+    append(output, "</unit>");
   }
 
   std::string xml(System system) const noexcept {
-    return "<value>" + value(system).xml() + "</value><unit>" + abbreviation(unit<Unit>(system)) + "</unit>";
+    std::string text;
+    xml(text, system);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output, System system) const noexcept {
+    append(output, "<value>");
+    value(system).xml(output);
+    append(output, "</value><unit>");
+    append(output, abbreviation(unit<Unit>(system)));
+    append(output, "</unit>");
   }
 
   constexpr DimensionalDyadicQuantity<Unit> operator*(double real) const noexcept {
@@ -139,7 +253,7 @@ template <typename Unit> constexpr PhQ::DimensionalDyadicQuantity<Unit> operator
 }
 
 template <typename Unit> std::ostream& operator<<(std::ostream& output_stream, const PhQ::DimensionalDyadicQuantity<Unit>& dyadic) noexcept {
-  output_stream << dyadic.print();
+  dyadic.print(output_stream);
   return output_stream;
 }
 
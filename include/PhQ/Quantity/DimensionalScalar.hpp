@@ -6,20 +6,22 @@
 
 #pragma once
 
+#include "../Unit/Expression.hpp"
 #include "Dimensional.hpp"
 #include "DimensionlessScalar.hpp"
+#include "GenericScalar.hpp"
 
 namespace PhQ {
 
-template <typename Unit> class DimensionalScalarQuantity : public DimensionalQuantity<Unit> {
+template <typename Unit, typename Number> class DimensionalScalarQuantity : public DimensionalQuantity<Unit> {
 
 public:
 
-  constexpr double value() const noexcept {
+  constexpr Number value() const noexcept {
     return value_;
   }
 
-  double value(const Unit unit) const noexcept {
+  constexpr Number value(const Unit unit) const noexcept {
     if (unit == standard_unit<Unit>) {
       return value_;
     } else {
@@ -27,7 +29,7 @@ public:
     }
   }
 
-  double value(const System system) const noexcept {
+  Number value(const System system) const noexcept {
     if (system == standard_system) {
       return value_;
     } else {
@@ -36,117 +38,284 @@ public:
   }
 
   std::string print() const noexcept {
-    return number_to_string(value_) + " " + abbreviation(standard_unit<Unit>);
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    append_number(output, value_);
+    append(output, " ");
+    append(output, abbreviation(standard_unit<Unit>));
   }
 
   std::string print(Unit unit) const noexcept {
-    return number_to_string(value(unit)) + " " + abbreviation(unit);
+    std::string text;
+    print(text, unit);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output, Unit unit) const noexcept {
+    append_number(output, value(unit));
+    append(output, " ");
+    append(output, abbreviation(unit));
   }
 
   std::string print(System system) const noexcept {
-    return number_to_string(value(system)) + " " + abbreviation(unit<Unit>(system));
+    std::string text;
+    print(text, system);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output, System system) const noexcept {
+    append_number(output, value(system));
+    append(output, " ");
+    append(output, abbreviation(unit<Unit>(system)));
   }
 
   std::string yaml() const noexcept {
-    return "{value: " + number_to_string(value_) + " , unit: " + abbreviation(standard_unit<Unit>) + "}";
+    std::string text;
+    yaml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void yaml(Sink& output) const noexcept {
+    append(output, "{value: ");
+    append_number(output, value_);
+    append(output, " , unit: ");
+    append(output, abbreviation(standard_unit<Unit>));
+    append(output, "}");
   }
 
   std::string yaml(Unit unit) const noexcept {
-    return "{value: " + number_to_string(value(unit)) + " , unit: " + abbreviation(unit) + "}";
+    std::string text;
+    yaml(text, unit);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void yaml(Sink& output, Unit unit) const noexcept {
+    append(output, "{value: ");
+    append_number(output, value(unit));
+    append(output, " , unit: ");
+    append(output, abbreviation(unit));
+    append(output, "}");
   }
 
   std::string yaml(System system) const noexcept {
-    return "{value: " + number_to_string(value(system)) + " , unit: " + abbreviation(unit<Unit>(system)) + "}";
+    std::string text;
+    yaml(text, system);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void yaml(Sink& output, System system) const noexcept {
+    append(output, "{value: ");
+    append_number(output, value(system));
+    append(output, " , unit: ");
+    append(output, abbreviation(unit<Unit>(system)));
+    append(output, "}");
   }
 
   std::string json() const noexcept {
-    return "{\"value\": " + number_to_string(value_) + " , \"unit\": \"" + abbreviation(standard_unit<Unit>) + "\"}";
+    std::string text;
+    json(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output) const noexcept {
+    append(output, "{\"value\": ");
+    append_number(output, value_);
+    append(output, " , \"unit\": \"");
+    append(output, abbreviation(standard_unit<Unit>));
+    append(output, "\"}");
   }
 
   std::string json(Unit unit) const noexcept {
-    return "{\"value\": " + number_to_string(value(unit)) + " , \"unit\": \"" + abbreviation(unit) + "\"}";
+    std::string text;
+    json(text, unit);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output, Unit unit) const noexcept {
+    append(output, "{\"value\": ");
+    append_number(output, value(unit));
+    append(output, " , \"unit\": \"");
+    append(output, abbreviation(unit));
+    append(output, "\"}");
   }
 
   std::string json(System system) const noexcept {
-    return "{\"value\": " + number_to_string(value(system)) + " , \"unit\": \"" + abbreviation(unit<Unit>(system)) + "\"}";
+    std::string text;
+    json(text, system);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output, System system) const noexcept {
+    append(output, "{\"value\": ");
+    append_number(output, value(system));
+    append(output, " , \"unit\": \"");
+    append(output, abbreviation(unit<Unit>(system)));
+    append(output, "\"}");
   }
 
   std::string xml() const noexcept {
-    return "<value>" + number_to_string(value_) + "</value><unit>" + abbreviation(standard_unit<Unit>) + "</unit>";
+    std::string text;
+    xml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output) const noexcept {
+    append(output, "<value>");
+    append_number(output, value_);
+    append(output, "</value><unit>");
+    append(output, abbreviation(standard_unit<Unit>));
+    append(output, "</unit>");
   }
 
   std::string xml(Unit unit) const noexcept {
-    return "<value>" + number_to_string(value(unit)) + "</value><unit>" + abbreviation(unit) + "</unit>";
+    std::string text;
+    xml(text, unit);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output, Unit unit) const noexcept {
+    append(output, "<value>");
+    append_number(output, value(unit));
+    append(output, "</value><unit>");
+    append(output, abbreviation(unit));
+    append(output, "</unit>");
   }
 
   std::string xml(System system) const noexcept {
-    return "<value>" + number_to_string(value(system)) + "</value><unit>" + abbreviation(unit<Unit>(system)) + "</unit>";
+    std::string text;
+    xml(text, system);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output, System system) const noexcept {
+    append(output, "<value>");
+    append_number(output, value(system));
+    append(output, "</value><unit>");
+    append(output, abbreviation(unit<Unit>(system)));
+    append(output, "</unit>");
   }
 
-  constexpr DimensionalScalarQuantity<Unit> operator*(double real) const noexcept {
+  constexpr DimensionalScalarQuantity<Unit, Number> operator*(Number real) const noexcept {
     return {value_ * real};
   }
 
-  constexpr DimensionalScalarQuantity<Unit> operator*(const DimensionlessScalarQuantity& scalar) const noexcept {
-    return {value_ * scalar.value()};
+  constexpr DimensionalScalarQuantity<Unit, Number> operator*(const DimensionlessScalarQuantity& scalar) const noexcept {
+    return {value_ * static_cast<Number>(scalar.value())};
   }
 
-  constexpr void operator*=(double real) noexcept {
+  constexpr void operator*=(Number real) noexcept {
     value_ *= real;
   }
 
   constexpr void operator*=(const DimensionlessScalarQuantity& scalar) noexcept {
-    value_ *= scalar.value();
+    value_ *= static_cast<Number>(scalar.value());
   }
 
-  constexpr DimensionalScalarQuantity<Unit> operator/(double real) const noexcept {
+  constexpr DimensionalScalarQuantity<Unit, Number> operator/(Number real) const noexcept {
     return {value_ / real};
   }
 
-  constexpr double operator/(const DimensionlessScalarQuantity& scalar) const noexcept {
-    return {value_ / scalar.value()};
+  constexpr Number operator/(const DimensionlessScalarQuantity& scalar) const noexcept {
+    return {value_ / static_cast<Number>(scalar.value())};
   }
 
-  constexpr void operator/=(double real) noexcept {
+  constexpr void operator/=(Number real) noexcept {
     value_ /= real;
   }
 
   constexpr void operator/=(const DimensionlessScalarQuantity& scalar) noexcept {
-    value_ /= scalar.value();
+    value_ /= static_cast<Number>(scalar.value());
   }
 
 protected:
 
   constexpr DimensionalScalarQuantity() noexcept : DimensionalQuantity<Unit>(), value_() {}
 
-  constexpr DimensionalScalarQuantity(double value) noexcept : DimensionalQuantity<Unit>(), value_(value) {}
+  constexpr DimensionalScalarQuantity(Number value) noexcept : DimensionalQuantity<Unit>(), value_(value) {}
 
-  constexpr DimensionalScalarQuantity(double value, Unit unit) noexcept : DimensionalQuantity<Unit>(), value_(convert(value, unit, standard_unit<Unit>)) {}
+  constexpr DimensionalScalarQuantity(Number value, Unit unit) noexcept : DimensionalQuantity<Unit>(), value_(convert(value, unit, standard_unit<Unit>)) {}
 
-  double value_;
+  Number value_;
 
 };
 
-template <typename Unit> constexpr DimensionalScalarQuantity<Unit> DimensionlessScalarQuantity::operator*(const DimensionalScalarQuantity<Unit>& dimensional_scalar) noexcept {
+template <typename Unit, typename Number> constexpr DimensionalScalarQuantity<Unit, Number> DimensionlessScalarQuantity::operator*(const DimensionalScalarQuantity<Unit, Number>& dimensional_scalar) noexcept {
   return {dimensional_scalar * value_};
 }
 
+/// \brief Parse a scalar physical quantity from text such as "12.5 km/s" or "300 K". Returns nothing if the text is malformed.
+/// \details For a dimensional scalar physical quantity, the number is followed by a spelling of one of its units or by a unit expression of the same physical dimension set, such as "12.5 kg·m/s^2" for a PhQ::ForceMagnitude, with or without whitespace in between. A unit that starts with a numeric factor, such as "5 2·m" or "1 000·m", is rejected. For a dimensionless scalar physical quantity such as PhQ::ReynoldsNumber, the text is only a number. Leading and trailing whitespace is ignored. The number is parsed with std::from_chars and the unit with PhQ::resolve_unit, so the result does not depend on the locale, and nothing is allocated for a spelling of the unit or for a unit expression that is already cached.
+template <typename Type> std::optional<Type> parse_quantity(std::string_view text) noexcept {
+  text = trim_whitespace(text);
+  const std::optional<double> value{consume_real_number(text)};
+  if (!value.has_value()) {
+    return std::nullopt;
+  }
+  if constexpr (is_dimensional_scalar_quantity<Type>) {
+    text = trim_whitespace(text);
+    if (starts_with_numeric_factor(text)) {
+      return std::nullopt;
+    }
+    const std::optional<ConversionFactor> factor{resolve_unit<QuantityUnit<Type>>(text)};
+    if (!factor.has_value()) {
+      return std::nullopt;
+    }
+    return Type{factor.value()(value.value()), standard_unit<QuantityUnit<Type>>};
+  } else {
+    static_assert(std::is_base_of<DimensionlessScalarQuantity, Type>::value, "PhQ::parse_quantity requires a scalar physical quantity.");
+    if (!text.empty()) {
+      return std::nullopt;
+    }
+    return Type{value.value()};
+  }
+}
+
+/// \brief Parse a sequence of scalar physical quantities from a buffer of records separated by a delimiter, such as one quantity per line. Each parsed quantity is passed in order to a function. Records that are empty or only whitespace are skipped.
+/// \details Returns false at the first malformed record, after passing every preceding quantity to the function. The records are viewed in place within the buffer, so nothing is allocated per record.
+template <typename Type, typename Function> bool parse_quantities(std::string_view text, Function&& function, char delimiter = '\n') {
+  while (!text.empty()) {
+    const std::size_t end{text.find(delimiter)};
+    const std::string_view record{trim_whitespace(text.substr(0, end))};
+    if (!record.empty()) {
+      const std::optional<Type> quantity{parse_quantity<Type>(record)};
+      if (!quantity.has_value()) {
+        return false;
+      }
+      function(quantity.value());
+    }
+    if (end == std::string_view::npos) {
+      break;
+    }
+    text.remove_prefix(end + 1);
+  }
+  return true;
+}
+
+/// \brief Parse a sequence of scalar physical quantities from a buffer of records separated by a delimiter and append them to a vector. Returns false at the first malformed record, after appending every preceding quantity.
+template <typename Type> bool parse_quantities(std::string_view text, std::vector<Type>& quantities, char delimiter = '\n') {
+  return parse_quantities<Type>(text, [&quantities](const Type& quantity) { quantities.push_back(quantity); }, delimiter);
+}
+
 } // namespace PhQ
 
-template <typename Unit> constexpr PhQ::DimensionalScalarQuantity<Unit> operator*(double real, const PhQ::DimensionalScalarQuantity<Unit>& scalar) noexcept {
+template <typename Unit, typename Number> constexpr PhQ::DimensionalScalarQuantity<Unit, Number> operator*(PhQ::NonDeduced<Number> real, const PhQ::DimensionalScalarQuantity<Unit, Number>& scalar) noexcept {
   return {scalar * real};
 }
 
-template <typename Unit> std::ostream& operator<<(std::ostream& output_stream, const PhQ::DimensionalScalarQuantity<Unit>& scalar) noexcept {
-  output_stream << scalar.print();
+template <typename Unit, typename Number> std::ostream& operator<<(std::ostream& output_stream, const PhQ::DimensionalScalarQuantity<Unit, Number>& scalar) noexcept {
+  scalar.print(output_stream);
   return output_stream;
 }
 
 namespace std {
 
-template <typename Unit> struct hash<PhQ::DimensionalScalarQuantity<Unit>> {
-  size_t operator()(const PhQ::DimensionalScalarQuantity<Unit>& quantity) const {
-    return hash<double>()(quantity.value());
+template <typename Unit, typename Number> struct hash<PhQ::DimensionalScalarQuantity<Unit, Number>> {
+  size_t operator()(const PhQ::DimensionalScalarQuantity<Unit, Number>& quantity) const {
+    return hash<Number>()(quantity.value());
   }
 };
 
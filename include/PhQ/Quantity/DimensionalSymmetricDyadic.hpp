@@ -12,15 +12,15 @@
 
 namespace PhQ {
 
-template <typename Unit> class DimensionalSymmetricDyadicQuantity : public DimensionalQuantity<Unit> {
+template <typename Unit, typename Number> class DimensionalSymmetricDyadicQuantity : public DimensionalQuantity<Unit> {
 
 public:
 
-  constexpr const Value::SymmetricDyadic& value() const noexcept {
+  constexpr const Value::BasicSymmetricDyadic<Number>& value() const noexcept {
     return value_;
   }
 
-  Value::SymmetricDyadic value(const Unit unit) const noexcept {
+  constexpr Value::BasicSymmetricDyadic<Number> value(const Unit unit) const noexcept {
     if (unit == standard_unit<Unit>) {
       return value_;
     } else {
@@ -28,7 +28,7 @@ public:
     }
   }
 
-  Value::SymmetricDyadic value(const System system) const noexcept {
+  Value::BasicSymmetricDyadic<Number> value(const System system) const noexcept {
     if (system == standard_system) {
       return value_;
     } else {
@@ -37,117 +37,231 @@ public:
   }
 
   std::string print() const noexcept {
-    return value_.print() + " " + abbreviation(standard_unit<Unit>);
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    value_.print(output);
+    append(output, " ");
+    append(output, abbreviation(standard_unit<Unit>));
   }
 
   std::string print(Unit unit) const noexcept {
-    return value(unit).print() + " " + abbreviation(unit);
+    std::string text;
+    print(text, unit);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output, Unit unit) const noexcept {
+    value(unit).print(output);
+    append(output, " ");
+    append(output, abbreviation(unit));
   }
 
   std::string print(System system) const noexcept {
-    return value(system).print() + " " + abbreviation(unit<Unit>(system));
+    std::string text;
+    print(text, system);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output, System system) const noexcept {
+    value(system).print(output);
+    append(output, " ");
+    append(output, abbreviation(unit<Unit>(system)));
   }
 
   std::string yaml() const noexcept {
-    return "{value: " + value_.yaml() + ", unit: " + abbreviation(standard_unit<Unit>) + "}";
+    std::string text;
+    yaml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void yaml(Sink& output) const noexcept {
+    append(output, "{value: ");
+    value_.yaml(output);
+    append(output, ", unit: ");
+    append(output, abbreviation(standard_unit<Unit>));
+    append(output, "}");
   }
 
   std::string yaml(Unit unit) const noexcept {
-    return "{value: " + value(unit).yaml() + ", unit: " + abbreviation(unit) + "}";
+    std::string text;
+    yaml(text, unit);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void yaml(Sink& output, Unit unit) const noexcept {
+    append(output, "{value: ");
+    value(unit).yaml(output);
+    append(output, ", unit: ");
+    append(output, abbreviation(unit));
+    append(output, "}");
   }
 
   std::string yaml(System system) const noexcept {
-    return "{value: " + value(system).yaml() + ", unit: " + abbreviation(unit<Unit>(system)) + "}";
+    std::string text;
+    yaml(text, system);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void yaml(Sink& output, System system) const noexcept {
+    append(output, "{value: ");
+    value(system).yaml(output);
+    append(output, ", unit: ");
+    append(output, abbreviation(unit<Unit>(system)));
+    append(output, "}");
   }
 
   std::string json() const noexcept {
-    return "{\"value\": " + value_.json() + ", \"unit\": \"" + abbreviation(standard_unit<Unit>) + "\"}";
+    std::string text;
+    json(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output) const noexcept {
+    append(output, "{\"value\": ");
+    value_.json(output);
+    append(output, ", \"unit\": \"");
+    append(output, abbreviation(standard_unit<Unit>));
+    append(output, "\"}");
   }
 
   std::string json(Unit unit) const noexcept {
-    return "{\"value\": " + value(unit).json() + ", \"unit\": \"" + abbreviation(unit) + "\"}";
+    std::string text;
+    json(text, unit);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output, Unit unit) const noexcept {
+    append(output, "{\"value\": ");
+    value(unit).json(output);
+    append(output, ", \"unit\": \"");
+    append(output, abbreviation(unit));
+    append(output, "\"}");
   }
 
   std::string json(System system) const noexcept {
-    return "{\"value\": " + value(system).json() + ", \"unit\": \"" + abbreviation(unit<Unit>(system)) + "\"}";
+    std::string text;
+    json(text, system);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output, System system) const noexcept {
+    append(output, "{\"value\": ");
+    value(system).json(output);
+    append(output, ", \"unit\": \"");
+    append(output, abbreviation(unit<Unit>(system)));
+    append(output, "\"}");
   }
 
   std::string xml() const noexcept {
-    return "<value>" + value_.xml() + "</value><unit>" + abbreviation(standard_unit<Unit>) + "</unit>";
+    std::string text;
+    xml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output) const noexcept {
+    append(output, "<value>");
+    value_.xml(output);
+    append(output, "</value><unit>");
+    append(output, abbreviation(standard_unit<Unit>));
+    append(output, "</unit>");
   }
 
   std::string xml(Unit unit) const noexcept {
-    return "<value>" + value(unit).xml() + "</value><unit>" + abbreviation(unit) + "</unit>";
+    std::string text;
+    xml(text, unit);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output, Unit unit) const noexcept {
+    append(output, "<value>");
+    value(unit).xml(output);
+    append(output, "</value><unit>");
+    append(output, abbreviation(unit));
+    append(output, "</unit>");
   }
 
   std::string xml(System system) const noexcept {
-    return "<value>" + value(system).xml() + "</value><unit>" + abbreviation(unit<Unit>(system)) + "</unit>";
+    std::string text;
+    xml(text, system);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output, System system) const noexcept {
+    append(output, "<value>");
+    value(system).xml(output);
+    append(output, "</value><unit>");
+    append(output, abbreviation(unit<Unit>(system)));
+    append(output, "</unit>");
   }
 
-  constexpr DimensionalSymmetricDyadicQuantity<Unit> operator*(double real) const noexcept {
+  constexpr DimensionalSymmetricDyadicQuantity<Unit, Number> operator*(Number real) const noexcept {
     return {value_ * real};
   }
 
-  constexpr DimensionalSymmetricDyadicQuantity<Unit> operator*(const DimensionlessScalarQuantity& scalar) const noexcept {
-    return {value_ * scalar.value()};
+  constexpr DimensionalSymmetricDyadicQuantity<Unit, Number> operator*(const DimensionlessScalarQuantity& scalar) const noexcept {
+    return {value_ * static_cast<Number>(scalar.value())};
   }
 
-  constexpr void operator*=(double real) noexcept {
+  constexpr void operator*=(Number real) noexcept {
     value_ *= real;
   }
 
   constexpr void operator*=(const DimensionlessScalarQuantity& scalar) noexcept {
-    value_ *= scalar.value();
+    value_ *= static_cast<Number>(scalar.value());
   }
 
-  constexpr DimensionalSymmetricDyadicQuantity<Unit> operator/(double real) const noexcept {
+  constexpr DimensionalSymmetricDyadicQuantity<Unit, Number> operator/(Number real) const noexcept {
     return {value_ / real};
   }
 
-  constexpr DimensionalSymmetricDyadicQuantity<Unit> operator/(const DimensionlessScalarQuantity& scalar) const noexcept {
-    return {value_ / scalar.value()};
+  constexpr DimensionalSymmetricDyadicQuantity<Unit, Number> operator/(const DimensionlessScalarQuantity& scalar) const noexcept {
+    return {value_ / static_cast<Number>(scalar.value())};
   }
 
-  constexpr void operator/=(double real) noexcept {
+  constexpr void operator/=(Number real) noexcept {
     value_ /= real;
   }
 
   constexpr void operator/=(const DimensionlessScalarQuantity& scalar) noexcept {
-    value_ /= scalar.value();
+    value_ /= static_cast<Number>(scalar.value());
   }
 
 protected:
 
   constexpr DimensionalSymmetricDyadicQuantity() noexcept : DimensionalQuantity<Unit>(), value_() {}
 
-  constexpr DimensionalSymmetricDyadicQuantity(const Value::SymmetricDyadic& value) noexcept : DimensionalQuantity<Unit>(), value_(value) {}
+  constexpr DimensionalSymmetricDyadicQuantity(const Value::BasicSymmetricDyadic<Number>& value) noexcept : DimensionalQuantity<Unit>(), value_(value) {}
 
-  constexpr DimensionalSymmetricDyadicQuantity(const Value::SymmetricDyadic& value, Unit unit) noexcept : DimensionalQuantity<Unit>(), value_(convert(value, unit, standard_unit<Unit>)) {}
+  constexpr DimensionalSymmetricDyadicQuantity(const Value::BasicSymmetricDyadic<Number>& value, Unit unit) noexcept : DimensionalQuantity<Unit>(), value_(convert(value, unit, standard_unit<Unit>)) {}
 
-  Value::SymmetricDyadic value_;
+  Value::BasicSymmetricDyadic<Number> value_;
 
 };
 
-template <typename Unit> constexpr DimensionalSymmetricDyadicQuantity<Unit> DimensionlessScalarQuantity::operator*(const DimensionalSymmetricDyadicQuantity<Unit>& dimensional_symmetric_dyadic) noexcept {
+template <typename Unit, typename Number> constexpr DimensionalSymmetricDyadicQuantity<Unit, Number> DimensionlessScalarQuantity::operator*(const DimensionalSymmetricDyadicQuantity<Unit, Number>& dimensional_symmetric_dyadic) noexcept {
   return {dimensional_symmetric_dyadic * value_};
 }
 
 } // namespace PhQ
 
-template <typename Unit> constexpr PhQ::DimensionalSymmetricDyadicQuantity<Unit> operator*(double real, const PhQ::DimensionalSymmetricDyadicQuantity<Unit>& symmetric_dyadic) noexcept {
+template <typename Unit, typename Number> constexpr PhQ::DimensionalSymmetricDyadicQuantity<Unit, Number> operator*(PhQ::NonDeduced<Number> real, const PhQ::DimensionalSymmetricDyadicQuantity<Unit, Number>& symmetric_dyadic) noexcept {
   return {symmetric_dyadic * real};
 }
 
-template <typename Unit> std::ostream& operator<<(std::ostream& output_stream, const PhQ::DimensionalSymmetricDyadicQuantity<Unit>& symmetric_dyadic) noexcept {
-  output_stream << symmetric_dyadic.print();
+template <typename Unit, typename Number> std::ostream& operator<<(std::ostream& output_stream, const PhQ::DimensionalSymmetricDyadicQuantity<Unit, Number>& symmetric_dyadic) noexcept {
+  symmetric_dyadic.print(output_stream);
   return output_stream;
 }
 
 namespace std {
 
-template <typename Unit> struct hash<PhQ::DimensionalSymmetricDyadicQuantity<Unit>> {
-  size_t operator()(const PhQ::DimensionalSymmetricDyadicQuantity<Unit>& quantity) const {
-    return hash<PhQ::Value::SymmetricDyadic>()(quantity.value());
+template <typename Unit, typename Number> struct hash<PhQ::DimensionalSymmetricDyadicQuantity<Unit, Number>> {
+  size_t operator()(const PhQ::DimensionalSymmetricDyadicQuantity<Unit, Number>& quantity) const {
+    return hash<PhQ::Value::BasicSymmetricDyadic<Number>>()(quantity.value());
   }
 };
 
@@ -10,6 +10,7 @@
 
 namespace PhQ {
 
+/// \brief Base of all dimensionless physical quantities. Derived classes provide print, json, and xml methods.
 class DimensionlessQuantity : public Quantity {
 
 public:
@@ -18,21 +19,27 @@ public:
     return {};
   }
 
-  virtual std::string print() const noexcept = 0;
-
-  virtual std::string json() const noexcept = 0;
-
-  virtual std::string xml() const noexcept = 0;
-
 protected:
 
   constexpr DimensionlessQuantity() noexcept : Quantity() {}
 
 };
 
-std::ostream& operator<<(std::ostream& stream, const DimensionlessQuantity& quantity) noexcept {
-  stream << quantity.print();
+template <typename Type, typename std::enable_if<std::is_base_of<DimensionlessQuantity, Type>::value, bool>::type = true> std::ostream& operator<<(std::ostream& stream, const Type& quantity) noexcept {
+  quantity.print(stream);
   return stream;
 }
 
+/// \brief Dimensionless physical quantities, read from their value alone.
+template <typename Type> struct Deserializer<Type, std::enable_if_t<std::is_base_of<DimensionlessQuantity, Type>::value>> {
+  static bool read(TextReader& reader, Type& quantity) noexcept {
+    QuantityValue<Type> value;
+    if (!Deserializer<QuantityValue<Type>>::read(reader, value)) {
+      return false;
+    }
+    quantity = Type{value};
+    return true;
+  }
+};
+
 } // namespace PhQ
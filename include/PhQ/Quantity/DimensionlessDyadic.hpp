@@ -20,15 +20,33 @@ public:
   }
 
   std::string print() const noexcept {
-    return value_.print();
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    value_.print(output);
   }
 
   std::string json() const noexcept {
-    return value_.json();
+    std::string text;
+    json(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output) const noexcept {
+    value_.json(output);
   }
 
   std::string xml() const noexcept {
-    return value_.xml();
+    std::string text;
+    xml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output) const noexcept {
+    value_.xml(output);
   }
 
   constexpr DimensionlessDyadicQuantity operator*(double real) const noexcept {
@@ -14,9 +14,6 @@ namespace PhQ {
 class DimensionlessDyadicQuantity;
 class DimensionlessSymmetricDyadicQuantity;
 template <typename Unit> class DimensionalDyadicQuantity;
-template <typename Unit> class DimensionalScalarQuantity;
-template <typename Unit> class DimensionalSymmetricDyadicQuantity;
-template <typename Unit> class DimensionalVectorQuantity;
 
 class DimensionlessScalarQuantity : public DimensionlessQuantity {
 
@@ -27,15 +24,33 @@ public:
   }
 
   std::string print() const noexcept {
-    return number_to_string(value_);
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    append_number(output, value_);
   }
 
   std::string json() const noexcept {
-    return number_to_string(value_);
+    std::string text;
+    json(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output) const noexcept {
+    append_number(output, value_);
   }
 
   std::string xml() const noexcept {
-    return number_to_string(value_);
+    std::string text;
+    xml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output) const noexcept {
+    append_number(output, value_);
   }
 
   constexpr bool operator==(const DimensionlessScalarQuantity& scalar) const noexcept {
@@ -106,11 +121,11 @@ public:
 
   constexpr DimensionlessDyadicQuantity operator*(const DimensionlessDyadicQuantity& dyadic) const noexcept;
 
-  template <typename Unit> constexpr DimensionalScalarQuantity<Unit> operator*(const DimensionalScalarQuantity<Unit>& dimensional_scalar) noexcept;
+  template <typename Unit, typename Number> constexpr DimensionalScalarQuantity<Unit, Number> operator*(const DimensionalScalarQuantity<Unit, Number>& dimensional_scalar) noexcept;
 
-  template <typename Unit> constexpr DimensionalVectorQuantity<Unit> operator*(const DimensionalVectorQuantity<Unit>& dimensional_vector) noexcept;
+  template <typename Unit, typename Number> constexpr DimensionalVectorQuantity<Unit, Number> operator*(const DimensionalVectorQuantity<Unit, Number>& dimensional_vector) noexcept;
 
-  template <typename Unit> constexpr DimensionalSymmetricDyadicQuantity<Unit> operator*(const DimensionalSymmetricDyadicQuantity<Unit>& dimensional_symmetric_dyadic) noexcept;
+  template <typename Unit, typename Number> constexpr DimensionalSymmetricDyadicQuantity<Unit, Number> operator*(const DimensionalSymmetricDyadicQuantity<Unit, Number>& dimensional_symmetric_dyadic) noexcept;
 
   template <typename Unit> constexpr DimensionalDyadicQuantity<Unit> operator*(const DimensionalDyadicQuantity<Unit>& dimensional_dyadic) noexcept;
 
@@ -0,0 +1,453 @@
+// Copyright 2020 Alexandre Coderre-Chabot
+// This file is part of Physical Quantities (PhQ), a C++17 header-only library of physical quantities, physical models, and units of measure for scientific computation.
+// Physical Quantities is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+// You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "DimensionalScalar.hpp"
+
+namespace PhQ {
+
+/// \brief Whether a type is a named dimensional scalar physical quantity or a generic scalar physical quantity, both of which convert to and from a PhQ::DynamicQuantity.
+template <typename Type> constexpr bool is_typed_scalar_quantity{is_dimensional_scalar_quantity<Type> || is_generic_scalar_quantity<Type>};
+
+/// \brief Unit in which a named dimensional scalar quantity or a generic scalar quantity is displayed once converted to a PhQ::DynamicQuantity: the standard unit of a named quantity, and base units, represented by a null pointer, for a generic quantity.
+template <typename Type> constexpr const ResolvedUnit* display_unit_of() noexcept {
+  if constexpr (is_dimensional_scalar_quantity<Type>) {
+    return &standard_resolved_unit<QuantityUnit<Type>>;
+  } else {
+    return nullptr;
+  }
+}
+
+/// \brief Scalar physical quantity whose physical dimension set is only known at run time, such as a quantity read from a configuration file or from a column of a table whose schema is not known at compile time.
+/// \details The value is always expressed in the base units of the metre-kilogram-second-kelvin system, alongside the packed physical dimension set and a pointer to the unit in which the quantity is displayed. Multiplication and division combine the dimension sets, which is a single operation on their packed representations; addition and subtraction compare them and throw if they differ. Converting from any named dimensional scalar quantity, such as PhQ::Length, or from any generic scalar quantity copies its value, and converting back checks the dimension set and copies the value again, so neither conversion loses precision. A dynamic quantity is the size of three doubles.
+class DynamicQuantity {
+
+public:
+
+  constexpr DynamicQuantity() noexcept : value_(), dimension_set_(), unit_(nullptr) {}
+
+  /// \brief Create a dynamic quantity from a value expressed in the base units of the metre-kilogram-second-kelvin system. It is displayed in these base units.
+  constexpr DynamicQuantity(double value, const Dimension::Set& dimension_set) noexcept : value_(value), dimension_set_(dimension_set), unit_(nullptr) {}
+
+  /// \brief Create a dynamic quantity from a value expressed in a resolved unit, which must outlive the quantity, such as the result of PhQ::find_unit_expression or PhQ::standard_resolved_unit. It is displayed in this unit.
+  constexpr DynamicQuantity(double value, const ResolvedUnit& unit) noexcept : value_(unit.factor()(value)), dimension_set_(unit.dimension()), unit_(&unit) {}
+
+  DynamicQuantity(double value, ResolvedUnit&& unit) = delete;
+
+  template <typename Type, std::enable_if_t<is_typed_scalar_quantity<Type>, bool> = true> constexpr DynamicQuantity(const Type& quantity) noexcept : value_(quantity.value()), dimension_set_(dimension_of<Type>), unit_(display_unit_of<Type>()) {}
+
+  /// \brief Convert to a named dimensional scalar quantity or to a generic scalar quantity. Returns nothing if its physical dimension set differs.
+  template <typename Type> constexpr std::optional<Type> to() const noexcept {
+    static_assert(is_typed_scalar_quantity<Type>, "PhQ::DynamicQuantity::to requires a named dimensional scalar quantity or a generic scalar quantity.");
+    if (dimension_set_ != dimension_of<Type>) {
+      return std::nullopt;
+    }
+    if constexpr (is_dimensional_scalar_quantity<Type>) {
+      return Type{value_, standard_unit<QuantityUnit<Type>>};
+    } else {
+      return Type{value_};
+    }
+  }
+
+  constexpr const Dimension::Set& dimension() const noexcept {
+    return dimension_set_;
+  }
+
+  /// \brief Value expressed in the base units of the metre-kilogram-second-kelvin system.
+  constexpr double value() const noexcept {
+    return value_;
+  }
+
+  /// \brief Unit in which the quantity is displayed, or a null pointer if it is displayed in base units.
+  constexpr const ResolvedUnit* unit() const noexcept {
+    return unit_;
+  }
+
+  /// \brief Value expressed in the unit in which the quantity is displayed.
+  constexpr double display_value() const noexcept {
+    return unit_ == nullptr ? value_ : (value_ - unit_->factor().offset()) / unit_->factor().scale();
+  }
+
+  /// \brief Display the quantity in a unit given as a spelling or as a unit expression, such as "kW" or "kg·m^2/s^3". Returns false and leaves the quantity unchanged if the unit does not resolve to the same physical dimension set, or if the unit is new and the intern table of the cache of unit expressions is full.
+  bool display_in(std::string_view unit) noexcept {
+    const std::optional<ResolvedUnit> resolved{resolve_unit_expression(unit)};
+    if (!resolved.has_value() || resolved.value().dimension() != dimension_set_) {
+      return false;
+    }
+    const ResolvedUnit* const interned{intern_resolved_unit(resolved.value())};
+    if (interned == nullptr) {
+      return false;
+    }
+    unit_ = interned;
+    return true;
+  }
+
+  std::string print() const noexcept {
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    append_number(output, display_value());
+    if (unit_ == nullptr) {
+      append_base_units(output, dimension_set_);
+    } else {
+      append(output, " ");
+      append(output, unit_->abbreviation());
+    }
+  }
+
+  constexpr bool operator==(const DynamicQuantity& quantity) const noexcept {
+    return value_ == quantity.value_ && dimension_set_ == quantity.dimension_set_;
+  }
+
+  constexpr bool operator!=(const DynamicQuantity& quantity) const noexcept {
+    return value_ != quantity.value_ || dimension_set_ != quantity.dimension_set_;
+  }
+
+  /// \brief Sum of two quantities of the same physical dimension set, displayed in the unit of this quantity. Throws if the dimension sets differ.
+  DynamicQuantity operator+(const DynamicQuantity& quantity) const {
+    check_dimension(quantity, "add");
+    return {value_ + quantity.value_, dimension_set_, unit_};
+  }
+
+  void operator+=(const DynamicQuantity& quantity) {
+    check_dimension(quantity, "add");
+    value_ += quantity.value_;
+  }
+
+  /// \brief Difference of two quantities of the same physical dimension set, displayed in the unit of this quantity. Throws if the dimension sets differ.
+  DynamicQuantity operator-(const DynamicQuantity& quantity) const {
+    check_dimension(quantity, "subtract");
+    return {value_ - quantity.value_, dimension_set_, unit_};
+  }
+
+  void operator-=(const DynamicQuantity& quantity) {
+    check_dimension(quantity, "subtract");
+    value_ -= quantity.value_;
+  }
+
+  /// \brief Product of two quantities, displayed in base units.
+  constexpr DynamicQuantity operator*(const DynamicQuantity& quantity) const noexcept {
+    return {value_ * quantity.value_, dimension_set_ * quantity.dimension_set_};
+  }
+
+  constexpr DynamicQuantity operator*(double real) const noexcept {
+    return {value_ * real, dimension_set_, unit_};
+  }
+
+  constexpr void operator*=(double real) noexcept {
+    value_ *= real;
+  }
+
+  /// \brief Quotient of two quantities, displayed in base units.
+  constexpr DynamicQuantity operator/(const DynamicQuantity& quantity) const noexcept {
+    return {value_ / quantity.value_, dimension_set_ / quantity.dimension_set_};
+  }
+
+  constexpr DynamicQuantity operator/(double real) const noexcept {
+    return {value_ / real, dimension_set_, unit_};
+  }
+
+  constexpr void operator/=(double real) noexcept {
+    value_ /= real;
+  }
+
+private:
+
+  constexpr DynamicQuantity(double value, const Dimension::Set& dimension_set, const ResolvedUnit* unit) noexcept : value_(value), dimension_set_(dimension_set), unit_(unit) {}
+
+  void check_dimension(const DynamicQuantity& quantity, std::string_view operation) const {
+    if (dimension_set_ != quantity.dimension_set_) {
+      throw std::runtime_error{"Cannot " + std::string{operation} + " " + print() + " and " + quantity.print() + " because their physical dimension sets differ."};
+    }
+  }
+
+  double value_;
+
+  Dimension::Set dimension_set_;
+
+  const ResolvedUnit* unit_;
+
+  friend class DynamicColumn;
+
+};
+
+/// \brief Create a dynamic quantity from a value expressed in a unit given as a spelling or as a unit expression, such as "kW" or "kg·m^2/s^3". Returns nothing if the unit does not resolve. The unit is resolved through the cache of unit expressions and interned as the display unit; if the intern table of the cache is full, the quantity is displayed in base units instead.
+std::optional<DynamicQuantity> make_dynamic_quantity(double value, std::string_view unit) noexcept {
+  const std::optional<ResolvedUnit> resolved{resolve_unit_expression(unit)};
+  if (!resolved.has_value()) {
+    return std::nullopt;
+  }
+  const ResolvedUnit* const interned{intern_resolved_unit(resolved.value())};
+  if (interned == nullptr) {
+    return DynamicQuantity{resolved.value().factor()(value), resolved.value().dimension()};
+  }
+  return DynamicQuantity{value, *interned};
+}
+
+/// \brief Parse a dynamic quantity from text such as "12.5 kg·m/s^2", "300 K", or "0.5" for a dimensionless number. Returns nothing if the text is malformed.
+std::optional<DynamicQuantity> parse_dynamic_quantity(std::string_view text) noexcept {
+  text = trim_whitespace(text);
+  const std::optional<double> value{consume_real_number(text)};
+  if (!value.has_value()) {
+    return std::nullopt;
+  }
+  text = trim_whitespace(text);
+  if (text.empty()) {
+    return DynamicQuantity{value.value(), Dimension::Set{}};
+  }
+  if (starts_with_numeric_factor(text)) {
+    return std::nullopt;
+  }
+  return make_dynamic_quantity(value.value(), text);
+}
+
+/// \brief Column of scalar physical quantities that share one physical dimension set known only at run time, such as a column of a table whose schema is read from a configuration file.
+/// \details The values are stored contiguously in the base units of the metre-kilogram-second-kelvin system, alongside a single dimension set and a single display unit. Arithmetic on columns checks or combines the dimension sets once per column and then operates on the values in a plain loop, so the per-element cost is that of the arithmetic on doubles. Operations between columns of different sizes, and additions and subtractions of columns of different dimension sets, throw.
+class DynamicColumn {
+
+public:
+
+  /// \brief Create an empty column of a physical dimension set, displayed in base units.
+  explicit DynamicColumn(const Dimension::Set& dimension_set = {}) noexcept : values_(), dimension_set_(dimension_set), unit_(nullptr) {}
+
+  /// \brief Create a column from values expressed in the base units of the metre-kilogram-second-kelvin system.
+  DynamicColumn(std::vector<double> values, const Dimension::Set& dimension_set) noexcept : values_(std::move(values)), dimension_set_(dimension_set), unit_(nullptr) {}
+
+  /// \brief Create a column from values expressed in a resolved unit, which must outlive the column. The values are converted to base units in bulk.
+  DynamicColumn(std::vector<double> values, const ResolvedUnit& unit) noexcept : values_(std::move(values)), dimension_set_(unit.dimension()), unit_(&unit) {
+    const ConversionFactor factor{unit.factor()};
+    for (double& value : values_) {
+      value = factor(value);
+    }
+  }
+
+  DynamicColumn(std::vector<double> values, ResolvedUnit&& unit) = delete;
+
+  /// \brief Create a column from a sequence of named dimensional scalar quantities or of generic scalar quantities, such as a std::vector<PhQ::Power>.
+  template <typename Type, std::enable_if_t<is_typed_scalar_quantity<Type>, bool> = true> explicit DynamicColumn(const std::vector<Type>& quantities) noexcept : values_(quantities.size()), dimension_set_(dimension_of<Type>), unit_(display_unit_of<Type>()) {
+    for (std::size_t index = 0; index < quantities.size(); ++index) {
+      values_[index] = quantities[index].value();
+    }
+  }
+
+  /// \brief Convert to a sequence of named dimensional scalar quantities or of generic scalar quantities. The physical dimension set is checked once for the whole column; returns nothing if it differs.
+  template <typename Type> std::optional<std::vector<Type>> to() const noexcept {
+    static_assert(is_typed_scalar_quantity<Type>, "PhQ::DynamicColumn::to requires a named dimensional scalar quantity or a generic scalar quantity.");
+    if (dimension_set_ != dimension_of<Type>) {
+      return std::nullopt;
+    }
+    std::vector<Type> quantities;
+    quantities.reserve(values_.size());
+    for (const double value : values_) {
+      if constexpr (is_dimensional_scalar_quantity<Type>) {
+        quantities.emplace_back(value, standard_unit<QuantityUnit<Type>>);
+      } else {
+        quantities.emplace_back(value);
+      }
+    }
+    return {std::move(quantities)};
+  }
+
+  const Dimension::Set& dimension() const noexcept {
+    return dimension_set_;
+  }
+
+  /// \brief Values expressed in the base units of the metre-kilogram-second-kelvin system, contiguous and in order.
+  const std::vector<double>& values() const noexcept {
+    return values_;
+  }
+
+  /// \brief Unit in which the quantities are displayed, or a null pointer if they are displayed in base units.
+  const ResolvedUnit* unit() const noexcept {
+    return unit_;
+  }
+
+  std::size_t size() const noexcept {
+    return values_.size();
+  }
+
+  bool empty() const noexcept {
+    return values_.empty();
+  }
+
+  void reserve(std::size_t capacity) {
+    values_.reserve(capacity);
+  }
+
+  DynamicQuantity operator[](std::size_t index) const noexcept {
+    return {values_[index], dimension_set_, unit_};
+  }
+
+  /// \brief Append a quantity. Returns false and leaves the column unchanged if its physical dimension set differs.
+  bool push_back(const DynamicQuantity& quantity) {
+    if (quantity.dimension() != dimension_set_) {
+      return false;
+    }
+    values_.push_back(quantity.value());
+    return true;
+  }
+
+  /// \brief Display the quantities in a unit given as a spelling or as a unit expression. Returns false and leaves the column unchanged if the unit does not resolve to the same physical dimension set, or if the unit is new and the intern table of the cache of unit expressions is full.
+  bool display_in(std::string_view unit) noexcept {
+    const std::optional<ResolvedUnit> resolved{resolve_unit_expression(unit)};
+    if (!resolved.has_value() || resolved.value().dimension() != dimension_set_) {
+      return false;
+    }
+    const ResolvedUnit* const interned{intern_resolved_unit(resolved.value())};
+    if (interned == nullptr) {
+      return false;
+    }
+    unit_ = interned;
+    return true;
+  }
+
+  /// \brief Values expressed in the unit in which the quantities are displayed, converted in bulk into a vector whose memory is reused.
+  void display_values(std::vector<double>& values) const {
+    values.resize(values_.size());
+    const double scale{unit_ == nullptr ? 1.0 : unit_->factor().scale()};
+    const double offset{unit_ == nullptr ? 0.0 : unit_->factor().offset()};
+    for (std::size_t index = 0; index < values_.size(); ++index) {
+      values[index] = (values_[index] - offset) / scale;
+    }
+  }
+
+  /// \brief Element-wise sum of two columns of the same size and physical dimension set, displayed in the unit of this column. Throws otherwise.
+  DynamicColumn operator+(const DynamicColumn& column) const {
+    check_dimension(column, "add");
+    return combine(column, dimension_set_, unit_, [](double value1, double value2) { return value1 + value2; });
+  }
+
+  /// \brief Element-wise difference of two columns of the same size and physical dimension set, displayed in the unit of this column. Throws otherwise.
+  DynamicColumn operator-(const DynamicColumn& column) const {
+    check_dimension(column, "subtract");
+    return combine(column, dimension_set_, unit_, [](double value1, double value2) { return value1 - value2; });
+  }
+
+  /// \brief Element-wise product of two columns of the same size, displayed in base units. Throws otherwise.
+  DynamicColumn operator*(const DynamicColumn& column) const {
+    return combine(column, dimension_set_ * column.dimension_set_, nullptr, [](double value1, double value2) { return value1 * value2; });
+  }
+
+  /// \brief Element-wise quotient of two columns of the same size, displayed in base units. Throws otherwise.
+  DynamicColumn operator/(const DynamicColumn& column) const {
+    return combine(column, dimension_set_ / column.dimension_set_, nullptr, [](double value1, double value2) { return value1 / value2; });
+  }
+
+  /// \brief Sum of each quantity of this column and a quantity of the same physical dimension set. Throws if the dimension sets differ.
+  DynamicColumn operator+(const DynamicQuantity& quantity) const {
+    check_dimension(quantity, "add");
+    return transform(dimension_set_, unit_, [addend = quantity.value()](double value) { return value + addend; });
+  }
+
+  /// \brief Difference of each quantity of this column and a quantity of the same physical dimension set. Throws if the dimension sets differ.
+  DynamicColumn operator-(const DynamicQuantity& quantity) const {
+    check_dimension(quantity, "subtract");
+    return transform(dimension_set_, unit_, [subtrahend = quantity.value()](double value) { return value - subtrahend; });
+  }
+
+  /// \brief Product of each quantity of this column and a quantity, displayed in base units.
+  DynamicColumn operator*(const DynamicQuantity& quantity) const {
+    return transform(dimension_set_ * quantity.dimension(), nullptr, [factor = quantity.value()](double value) { return value * factor; });
+  }
+
+  /// \brief Quotient of each quantity of this column and a quantity, displayed in base units.
+  DynamicColumn operator/(const DynamicQuantity& quantity) const {
+    return transform(dimension_set_ / quantity.dimension(), nullptr, [divisor = quantity.value()](double value) { return value / divisor; });
+  }
+
+  DynamicColumn operator*(double real) const {
+    return transform(dimension_set_, unit_, [real](double value) { return value * real; });
+  }
+
+  DynamicColumn operator/(double real) const {
+    return transform(dimension_set_, unit_, [real](double value) { return value / real; });
+  }
+
+private:
+
+  DynamicColumn(std::size_t size, const Dimension::Set& dimension_set, const ResolvedUnit* unit) noexcept : values_(size), dimension_set_(dimension_set), unit_(unit) {}
+
+  template <typename Operation> DynamicColumn combine(const DynamicColumn& column, const Dimension::Set& dimension_set, const ResolvedUnit* unit, Operation operation) const {
+    if (values_.size() != column.values_.size()) {
+      throw std::runtime_error{"Cannot operate on columns of " + std::to_string(values_.size()) + " and " + std::to_string(column.values_.size()) + " dynamic quantities."};
+    }
+    DynamicColumn result{values_.size(), dimension_set, unit};
+    const double* const values1{values_.data()};
+    const double* const values2{column.values_.data()};
+    double* const results{result.values_.data()};
+    for (std::size_t index = 0; index < values_.size(); ++index) {
+      results[index] = operation(values1[index], values2[index]);
+    }
+    return result;
+  }
+
+  template <typename Operation> DynamicColumn transform(const Dimension::Set& dimension_set, const ResolvedUnit* unit, Operation operation) const {
+    DynamicColumn result{values_.size(), dimension_set, unit};
+    const double* const values{values_.data()};
+    double* const results{result.values_.data()};
+    for (std::size_t index = 0; index < values_.size(); ++index) {
+      results[index] = operation(values[index]);
+    }
+    return result;
+  }
+
+  void check_dimension(const Dimension::Set& dimension_set, std::string_view operation) const {
+    if (dimension_set_ != dimension_set) {
+      throw std::runtime_error{"Cannot " + std::string{operation} + " dynamic quantities of the physical dimension sets " + dimension_set_.print() + " and " + dimension_set.print() + "."};
+    }
+  }
+
+  void check_dimension(const DynamicColumn& column, std::string_view operation) const {
+    check_dimension(column.dimension_set_, operation);
+  }
+
+  void check_dimension(const DynamicQuantity& quantity, std::string_view operation) const {
+    check_dimension(quantity.dimension(), operation);
+  }
+
+  std::vector<double> values_;
+
+  Dimension::Set dimension_set_;
+
+  const ResolvedUnit* unit_;
+
+};
+
+/// \brief Create a column from values expressed in a unit given as a spelling or as a unit expression, such as "kW" or "kg·m^2/s^3". The unit is resolved once for the whole column and interned as the display unit; if the intern table of the cache of unit expressions is full, the column is displayed in base units instead. Returns nothing if the unit does not resolve.
+std::optional<DynamicColumn> make_dynamic_column(std::vector<double> values, std::string_view unit) noexcept {
+  const std::optional<ResolvedUnit> resolved{resolve_unit_expression(unit)};
+  if (!resolved.has_value()) {
+    return std::nullopt;
+  }
+  const ResolvedUnit* const interned{intern_resolved_unit(resolved.value())};
+  if (interned == nullptr) {
+    const ConversionFactor factor{resolved.value().factor()};
+    for (double& value : values) {
+      value = factor(value);
+    }
+    return DynamicColumn{std::move(values), resolved.value().dimension()};
+  }
+  return DynamicColumn{std::move(values), *interned};
+}
+
+} // namespace PhQ
+
+constexpr PhQ::DynamicQuantity operator*(double real, const PhQ::DynamicQuantity& quantity) noexcept {
+  return quantity * real;
+}
+
+PhQ::DynamicColumn operator*(double real, const PhQ::DynamicColumn& column) {
+  return column * real;
+}
+
+std::ostream& operator<<(std::ostream& output_stream, const PhQ::DynamicQuantity& quantity) noexcept {
+  quantity.print(output_stream);
+  return output_stream;
+}
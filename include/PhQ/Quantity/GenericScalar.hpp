@@ -0,0 +1,195 @@
+// Copyright 2020 Alexandre Coderre-Chabot
+// This file is part of Physical Quantities (PhQ), a C++17 header-only library of physical quantities, physical models, and units of measure for scientific computation.
+// Physical Quantities is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+// You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Dimensional.hpp"
+
+namespace PhQ {
+
+// Forward declaration.
+template <uint_least64_t PackedDimensionSet> class GenericScalarQuantity;
+
+/// \brief Whether a type is a named dimensional scalar physical quantity such as PhQ::Length or PhQ::StaticPressure.
+template <typename Type, typename = void> constexpr bool is_dimensional_scalar_quantity{false};
+
+template <typename Type> constexpr bool is_dimensional_scalar_quantity<Type, std::void_t<decltype(std::declval<const Type&>().unit())>>{std::is_base_of<DimensionalScalarQuantity<decltype(std::declval<const Type&>().unit())>, Type>::value};
+
+/// \brief Whether a type is a PhQ::GenericScalarQuantity.
+template <typename Type> constexpr bool is_generic_scalar_quantity{false};
+
+template <uint_least64_t PackedDimensionSet> constexpr bool is_generic_scalar_quantity<GenericScalarQuantity<PackedDimensionSet>>{true};
+
+/// \brief Physical dimension set of a named dimensional scalar physical quantity or of a generic scalar physical quantity.
+template <typename Type, typename = void> constexpr Dimension::Set dimension_of{Type::dimension_set};
+
+template <typename Type> constexpr Dimension::Set dimension_of<Type, std::enable_if_t<is_dimensional_scalar_quantity<Type>>>{dimension<decltype(std::declval<const Type&>().unit())>};
+
+/// \brief Whether a type is a named dimensional scalar physical quantity of a given physical dimension set.
+template <typename Type> constexpr bool is_dimensional_scalar_quantity_of(const Dimension::Set& dimension_set) noexcept {
+  if constexpr (is_dimensional_scalar_quantity<Type>) {
+    return dimension_of<Type> == dimension_set;
+  } else {
+    return false;
+  }
+}
+
+/// \brief Whether a type is a named dimensional scalar physical quantity whose physical dimension set does not capture its meaning, such as PhQ::AngularSpeed or PhQ::Temperature. See PhQ::has_ambiguous_dimension.
+template <typename Type, typename = void> constexpr bool is_dimension_ambiguous_quantity{false};
+
+template <typename Type> constexpr bool is_dimension_ambiguous_quantity<Type, std::void_t<decltype(std::declval<const Type&>().unit())>>{has_ambiguous_dimension<decltype(std::declval<const Type&>().unit())>};
+
+/// \brief Append the base units of the metre-kilogram-second-kelvin system that correspond to a physical dimension set to a text sink, preceded by a space, such as " kg·m·s^(-2)". Appends nothing if the dimension set is dimensionless.
+template <typename Sink> void append_base_units(Sink& output, const Dimension::Set& dimension_set) noexcept {
+  static constexpr std::array<std::string_view, 7> symbols{"m", "kg", "s", "A", "K", "mol", "cd"};
+  const std::array<int_least8_t, 7> exponents{dimension_set.length().value(), dimension_set.mass().value(), dimension_set.time().value(), dimension_set.electric_current().value(), dimension_set.temperature().value(), dimension_set.substance_amount().value(), dimension_set.luminous_intensity().value()};
+  bool first{true};
+  for (std::size_t index = 0; index < exponents.size(); ++index) {
+    if (exponents[index] != 0) {
+      append(output, first ? " " : "·");
+      append(output, symbols[index]);
+      if (exponents[index] > 1) {
+        append(output, "^");
+        append_integer(output, exponents[index]);
+      } else if (exponents[index] < 0) {
+        append(output, "^(");
+        append_integer(output, exponents[index]);
+        append(output, ")");
+      }
+      first = false;
+    }
+  }
+}
+
+/// \brief Scalar physical quantity whose physical dimension set is known at compile time but which has no named class, such as the product of a mass rate and a speed.
+/// \details The packed representation of the dimension set, as returned by PhQ::Dimension::Set::packed(), is the template parameter. The value is always expressed in the base units of the metre-kilogram-second-kelvin system. Multiplying or dividing any two dimensional scalar quantities for which no named relation exists yields a generic scalar quantity, which converts implicitly to and from any named dimensional scalar quantity of the same dimension set, except that it converts only explicitly to those whose dimension set does not capture their meaning, such as PhQ::Frequency and PhQ::Temperature. For example, a PhQ::MassRate multiplied by a PhQ::Speed converts to a PhQ::ForceMagnitude. A generic scalar quantity is exactly the size of a double.
+template <uint_least64_t PackedDimensionSet> class GenericScalarQuantity : public Quantity {
+
+public:
+
+  static constexpr Dimension::Set dimension_set{Dimension::Set::from_packed(PackedDimensionSet)};
+
+  constexpr GenericScalarQuantity() noexcept : Quantity(), value_() {}
+
+  /// \brief Create a generic scalar quantity from a value expressed in the base units of the metre-kilogram-second-kelvin system.
+  explicit constexpr GenericScalarQuantity(double value) noexcept : Quantity(), value_(value) {}
+
+  template <typename Type, std::enable_if_t<is_dimensional_scalar_quantity_of<Type>(dimension_set), bool> = true> constexpr GenericScalarQuantity(const Type& quantity) noexcept : Quantity(), value_(quantity.value()) {}
+
+  template <typename Type, std::enable_if_t<is_dimensional_scalar_quantity_of<Type>(dimension_set) && !is_dimension_ambiguous_quantity<Type>, bool> = true> constexpr operator Type() const noexcept {
+    return {value_, standard_unit<decltype(std::declval<const Type&>().unit())>};
+  }
+
+  /// \brief Conversion to a named quantity whose dimension set does not capture its meaning, such as a PhQ::Frequency, which shares its dimension set with a PhQ::AngularSpeed, or a PhQ::Temperature, which shares its dimension set with a PhQ::TemperatureDifference. This conversion is explicit because the dimension set alone cannot tell whether it is meant.
+  template <typename Type, std::enable_if_t<is_dimensional_scalar_quantity_of<Type>(dimension_set) && is_dimension_ambiguous_quantity<Type>, bool> = true> explicit constexpr operator Type() const noexcept {
+    return {value_, standard_unit<decltype(std::declval<const Type&>().unit())>};
+  }
+
+  constexpr Dimension::Set dimension() const noexcept {
+    return dimension_set;
+  }
+
+  constexpr double value() const noexcept {
+    return value_;
+  }
+
+  std::string print() const noexcept {
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    append_number(output, value_);
+    append_base_units(output, dimension_set);
+  }
+
+  constexpr bool operator==(const GenericScalarQuantity& quantity) const noexcept {
+    return value_ == quantity.value_;
+  }
+
+  constexpr bool operator!=(const GenericScalarQuantity& quantity) const noexcept {
+    return value_ != quantity.value_;
+  }
+
+  constexpr bool operator<(const GenericScalarQuantity& quantity) const noexcept {
+    return value_ < quantity.value_;
+  }
+
+  constexpr bool operator<=(const GenericScalarQuantity& quantity) const noexcept {
+    return value_ <= quantity.value_;
+  }
+
+  constexpr bool operator>(const GenericScalarQuantity& quantity) const noexcept {
+    return value_ > quantity.value_;
+  }
+
+  constexpr bool operator>=(const GenericScalarQuantity& quantity) const noexcept {
+    return value_ >= quantity.value_;
+  }
+
+  constexpr GenericScalarQuantity operator+(const GenericScalarQuantity& quantity) const noexcept {
+    return GenericScalarQuantity{value_ + quantity.value_};
+  }
+
+  constexpr void operator+=(const GenericScalarQuantity& quantity) noexcept {
+    value_ += quantity.value_;
+  }
+
+  constexpr GenericScalarQuantity operator-(const GenericScalarQuantity& quantity) const noexcept {
+    return GenericScalarQuantity{value_ - quantity.value_};
+  }
+
+  constexpr void operator-=(const GenericScalarQuantity& quantity) noexcept {
+    value_ -= quantity.value_;
+  }
+
+  constexpr GenericScalarQuantity operator*(double real) const noexcept {
+    return GenericScalarQuantity{value_ * real};
+  }
+
+  constexpr void operator*=(double real) noexcept {
+    value_ *= real;
+  }
+
+  constexpr GenericScalarQuantity operator/(double real) const noexcept {
+    return GenericScalarQuantity{value_ / real};
+  }
+
+  constexpr void operator/=(double real) noexcept {
+    value_ /= real;
+  }
+
+private:
+
+  double value_;
+
+};
+
+/// \brief Result of multiplying or dividing two scalar physical quantities with the given dimension set: a double if the dimension set is dimensionless, and a generic scalar quantity otherwise.
+template <uint_least64_t PackedDimensionSet> using GenericScalarResult = std::conditional_t<Dimension::Set::from_packed(PackedDimensionSet) == Dimension::Set{}, double, GenericScalarQuantity<PackedDimensionSet>>;
+
+/// \brief Whether the generic product and quotient operators apply to a pair of types. Named relations declared as member operators, such as PhQ::Length::operator*(const PhQ::Length&), are non-template exact matches and therefore always take precedence.
+template <typename Type1, typename Type2> constexpr bool is_generic_scalar_operation{(is_dimensional_scalar_quantity<Type1> || is_generic_scalar_quantity<Type1>) && (is_dimensional_scalar_quantity<Type2> || is_generic_scalar_quantity<Type2>)};
+
+} // namespace PhQ
+
+template <typename Type1, typename Type2, std::enable_if_t<PhQ::is_generic_scalar_operation<Type1, Type2>, bool> = true> constexpr PhQ::GenericScalarResult<(PhQ::dimension_of<Type1> * PhQ::dimension_of<Type2>).packed()> operator*(const Type1& quantity1, const Type2& quantity2) noexcept {
+  return PhQ::GenericScalarResult<(PhQ::dimension_of<Type1> * PhQ::dimension_of<Type2>).packed()>{quantity1.value() * quantity2.value()};
+}
+
+template <typename Type1, typename Type2, std::enable_if_t<PhQ::is_generic_scalar_operation<Type1, Type2>, bool> = true> constexpr PhQ::GenericScalarResult<(PhQ::dimension_of<Type1> / PhQ::dimension_of<Type2>).packed()> operator/(const Type1& quantity1, const Type2& quantity2) noexcept {
+  return PhQ::GenericScalarResult<(PhQ::dimension_of<Type1> / PhQ::dimension_of<Type2>).packed()>{quantity1.value() / quantity2.value()};
+}
+
+template <uint_least64_t PackedDimensionSet> constexpr PhQ::GenericScalarQuantity<PackedDimensionSet> operator*(double real, const PhQ::GenericScalarQuantity<PackedDimensionSet>& quantity) noexcept {
+  return quantity * real;
+}
+
+template <uint_least64_t PackedDimensionSet> std::ostream& operator<<(std::ostream& output_stream, const PhQ::GenericScalarQuantity<PackedDimensionSet>& quantity) noexcept {
+  quantity.print(output_stream);
+  return output_stream;
+}
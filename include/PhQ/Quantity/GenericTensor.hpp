@@ -0,0 +1,167 @@
+// Copyright 2020 Alexandre Coderre-Chabot
+// This file is part of Physical Quantities (PhQ), a C++17 header-only library of physical quantities, physical models, and units of measure for scientific computation.
+// Physical Quantities is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+// You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "GenericScalar.hpp"
+
+namespace PhQ {
+
+// Forward declaration.
+template <uint_least64_t PackedDimensionSet, typename ValueType> class GenericTensorQuantity;
+
+/// \brief Whether a type is a named dimensional vector, symmetric dyadic tensor, or dyadic tensor physical quantity such as PhQ::Velocity or PhQ::Stress.
+template <typename Type, typename = void> constexpr bool is_dimensional_tensor_quantity{false};
+
+template <typename Type> constexpr bool is_dimensional_tensor_quantity<Type, std::void_t<decltype(std::declval<const Type&>().unit())>>{std::is_base_of<DimensionalQuantity<decltype(std::declval<const Type&>().unit())>, Type>::value && !std::is_same<QuantityValue<Type>, double>::value};
+
+/// \brief Whether a type is a PhQ::GenericTensorQuantity.
+template <typename Type> constexpr bool is_generic_tensor_quantity{false};
+
+template <uint_least64_t PackedDimensionSet, typename ValueType> constexpr bool is_generic_tensor_quantity<GenericTensorQuantity<PackedDimensionSet, ValueType>>{true};
+
+template <typename Type> constexpr Dimension::Set dimension_of<Type, std::enable_if_t<is_dimensional_tensor_quantity<Type>>>{dimension<decltype(std::declval<const Type&>().unit())>};
+
+/// \brief Whether a type is a named dimensional physical quantity of a given physical dimension set whose value is of a given type, such as PhQ::Value::Vector.
+template <typename Type, typename ValueType> constexpr bool is_dimensional_tensor_quantity_of(const Dimension::Set& dimension_set) noexcept {
+  if constexpr (is_dimensional_tensor_quantity<Type>) {
+    return std::is_same<QuantityValue<Type>, ValueType>::value && dimension_of<Type> == dimension_set;
+  } else {
+    return false;
+  }
+}
+
+/// \brief Vector, symmetric dyadic tensor, or dyadic tensor physical quantity whose physical dimension set is known at compile time but which has no named class, such as the product of a mass rate and a velocity.
+/// \details This is the counterpart of PhQ::GenericScalarQuantity for values of type PhQ::Value::Vector, PhQ::Value::SymmetricDyadic, and PhQ::Value::Dyadic. The value is always expressed in the base units of the metre-kilogram-second-kelvin system. Multiplying a vector or tensor quantity by a scalar quantity, dividing it by a scalar quantity, or multiplying two tensor quantities whose values can be multiplied, such as a dyadic tensor and a vector, yields a generic tensor quantity when no named relation exists. It converts implicitly to and from any named dimensional quantity of the same dimension set and value type. For example, a PhQ::MassRate multiplied by a PhQ::Velocity converts to a PhQ::Force.
+template <uint_least64_t PackedDimensionSet, typename ValueType> class GenericTensorQuantity : public Quantity {
+
+public:
+
+  static constexpr Dimension::Set dimension_set{Dimension::Set::from_packed(PackedDimensionSet)};
+
+  constexpr GenericTensorQuantity() noexcept : Quantity(), value_() {}
+
+  /// \brief Create a generic tensor quantity from a value expressed in the base units of the metre-kilogram-second-kelvin system.
+  explicit constexpr GenericTensorQuantity(const ValueType& value) noexcept : Quantity(), value_(value) {}
+
+  template <typename Type, std::enable_if_t<is_dimensional_tensor_quantity_of<Type, ValueType>(dimension_set), bool> = true> constexpr GenericTensorQuantity(const Type& quantity) noexcept : Quantity(), value_(quantity.value()) {}
+
+  template <typename Type, std::enable_if_t<is_dimensional_tensor_quantity_of<Type, ValueType>(dimension_set), bool> = true> constexpr operator Type() const noexcept {
+    return {value_, standard_unit<decltype(std::declval<const Type&>().unit())>};
+  }
+
+  constexpr Dimension::Set dimension() const noexcept {
+    return dimension_set;
+  }
+
+  constexpr const ValueType& value() const noexcept {
+    return value_;
+  }
+
+  std::string print() const noexcept {
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    value_.print(output);
+    append_base_units(output, dimension_set);
+  }
+
+  constexpr bool operator==(const GenericTensorQuantity& quantity) const noexcept {
+    return value_ == quantity.value_;
+  }
+
+  constexpr bool operator!=(const GenericTensorQuantity& quantity) const noexcept {
+    return value_ != quantity.value_;
+  }
+
+  constexpr GenericTensorQuantity operator+(const GenericTensorQuantity& quantity) const noexcept {
+    return GenericTensorQuantity{value_ + quantity.value_};
+  }
+
+  constexpr void operator+=(const GenericTensorQuantity& quantity) noexcept {
+    value_ += quantity.value_;
+  }
+
+  constexpr GenericTensorQuantity operator-(const GenericTensorQuantity& quantity) const noexcept {
+    return GenericTensorQuantity{value_ - quantity.value_};
+  }
+
+  constexpr void operator-=(const GenericTensorQuantity& quantity) noexcept {
+    value_ -= quantity.value_;
+  }
+
+  constexpr GenericTensorQuantity operator*(double real) const noexcept {
+    return GenericTensorQuantity{value_ * real};
+  }
+
+  constexpr void operator*=(double real) noexcept {
+    value_ *= real;
+  }
+
+  constexpr GenericTensorQuantity operator/(double real) const noexcept {
+    return GenericTensorQuantity{value_ / real};
+  }
+
+  constexpr void operator/=(double real) noexcept {
+    value_ /= real;
+  }
+
+private:
+
+  ValueType value_;
+
+};
+
+template <uint_least64_t PackedDimensionSet> using GenericVectorQuantity = GenericTensorQuantity<PackedDimensionSet, Value::Vector>;
+
+template <uint_least64_t PackedDimensionSet> using GenericSymmetricDyadicQuantity = GenericTensorQuantity<PackedDimensionSet, Value::SymmetricDyadic>;
+
+template <uint_least64_t PackedDimensionSet> using GenericDyadicQuantity = GenericTensorQuantity<PackedDimensionSet, Value::Dyadic>;
+
+/// \brief Result of a generic product or quotient with the given dimension set and value type: the value itself if the dimension set is dimensionless, and a generic tensor quantity otherwise.
+template <uint_least64_t PackedDimensionSet, typename ValueType> using GenericTensorResult = std::conditional_t<Dimension::Set::from_packed(PackedDimensionSet) == Dimension::Set{}, ValueType, GenericTensorQuantity<PackedDimensionSet, ValueType>>;
+
+/// \brief Value type of the product or quotient of the values of two physical quantities, if their values can be multiplied or divided, such as PhQ::Value::Vector for a PhQ::Value::Dyadic times a PhQ::Value::Vector.
+template <typename Value1, typename Value2, bool Divide, typename = void> struct GenericTensorValue {};
+
+template <typename Value1, typename Value2> struct GenericTensorValue<Value1, Value2, false, std::void_t<decltype(std::declval<const Value1&>() * std::declval<const Value2&>())>> {
+  using Type = decltype(std::declval<const Value1&>() * std::declval<const Value2&>());
+};
+
+template <typename Value1, typename Value2> struct GenericTensorValue<Value1, Value2, true, std::void_t<decltype(std::declval<const Value1&>() / std::declval<const Value2&>())>> {
+  using Type = decltype(std::declval<const Value1&>() / std::declval<const Value2&>());
+};
+
+/// \brief Whether the generic tensor product and quotient operators apply to a pair of types: both are dimensional or generic physical quantities, at least one of them is a vector or tensor, and their values can be multiplied or divided. Named relations declared as member operators, such as PhQ::Velocity::operator*(const PhQ::Duration&), are non-template exact matches and therefore always take precedence.
+template <typename Type> constexpr bool is_generic_scalar_operand{is_dimensional_scalar_quantity<Type> || is_generic_scalar_quantity<Type>};
+
+template <typename Type> constexpr bool is_generic_tensor_operand{is_dimensional_tensor_quantity<Type> || is_generic_tensor_quantity<Type>};
+
+template <typename Type1, typename Type2, bool Divide, typename = void> constexpr bool is_generic_tensor_operation{false};
+
+template <typename Type1, typename Type2, bool Divide> constexpr bool is_generic_tensor_operation<Type1, Type2, Divide, std::void_t<typename GenericTensorValue<QuantityValue<Type1>, QuantityValue<Type2>, Divide>::Type>>{(is_generic_tensor_operand<Type1> && (is_generic_scalar_operand<Type2> || is_generic_tensor_operand<Type2>)) || (is_generic_scalar_operand<Type1> && is_generic_tensor_operand<Type2>)};
+
+} // namespace PhQ
+
+template <typename Type1, typename Type2, std::enable_if_t<PhQ::is_generic_tensor_operation<Type1, Type2, false>, bool> = true> constexpr PhQ::GenericTensorResult<(PhQ::dimension_of<Type1> * PhQ::dimension_of<Type2>).packed(), typename PhQ::GenericTensorValue<PhQ::QuantityValue<Type1>, PhQ::QuantityValue<Type2>, false>::Type> operator*(const Type1& quantity1, const Type2& quantity2) noexcept {
+  return PhQ::GenericTensorResult<(PhQ::dimension_of<Type1> * PhQ::dimension_of<Type2>).packed(), typename PhQ::GenericTensorValue<PhQ::QuantityValue<Type1>, PhQ::QuantityValue<Type2>, false>::Type>{quantity1.value() * quantity2.value()};
+}
+
+template <typename Type1, typename Type2, std::enable_if_t<PhQ::is_generic_tensor_operation<Type1, Type2, true>, bool> = true> constexpr PhQ::GenericTensorResult<(PhQ::dimension_of<Type1> / PhQ::dimension_of<Type2>).packed(), typename PhQ::GenericTensorValue<PhQ::QuantityValue<Type1>, PhQ::QuantityValue<Type2>, true>::Type> operator/(const Type1& quantity1, const Type2& quantity2) noexcept {
+  return PhQ::GenericTensorResult<(PhQ::dimension_of<Type1> / PhQ::dimension_of<Type2>).packed(), typename PhQ::GenericTensorValue<PhQ::QuantityValue<Type1>, PhQ::QuantityValue<Type2>, true>::Type>{quantity1.value() / quantity2.value()};
+}
+
+template <uint_least64_t PackedDimensionSet, typename ValueType> constexpr PhQ::GenericTensorQuantity<PackedDimensionSet, ValueType> operator*(double real, const PhQ::GenericTensorQuantity<PackedDimensionSet, ValueType>& quantity) noexcept {
+  return quantity * real;
+}
+
+template <uint_least64_t PackedDimensionSet, typename ValueType> std::ostream& operator<<(std::ostream& output_stream, const PhQ::GenericTensorQuantity<PackedDimensionSet, ValueType>& quantity) noexcept {
+  quantity.print(output_stream);
+  return output_stream;
+}
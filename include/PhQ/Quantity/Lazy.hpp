@@ -0,0 +1,302 @@
+// Copyright 2020 Alexandre Coderre-Chabot
+// This file is part of Physical Quantities (PhQ), a C++17 header-only library of physical quantities, physical models, and units of measure for scientific computation.
+// Physical Quantities is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+// You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Array.hpp"
+
+// Lazy expressions: sums, differences, negations, and scalings of values, quantities, and quantity arrays that are recorded rather than computed, and then computed one component at a time when the expression is evaluated, so that no intermediate value or array is ever created. Lazy expressions are opt-in: an expression becomes lazy only when one of its operands is wrapped with PhQ::lazy, and the usual eager operators are unaffected otherwise.
+
+namespace PhQ {
+
+/// \brief Whether a type can scale a lazy expression: a real number, a dimensionless scalar physical quantity, or a dimensional scalar physical quantity. Real numbers and dimensionless scalar physical quantities preserve the type of the expression, whereas dimensional scalar physical quantities change it as the eager product does, such as a lazy acceleration times a duration, which is a lazy velocity.
+template <typename Type> constexpr bool is_lazy_factor{std::is_arithmetic<Type>::value || std::is_base_of<DimensionlessScalarQuantity, Type>::value || is_dimensional_scalar_quantity<Type>};
+
+template <typename Factor> constexpr double lazy_factor_value(const Factor& factor) noexcept {
+  if constexpr (std::is_arithmetic<Factor>::value) {
+    return static_cast<double>(factor);
+  } else {
+    return factor.value();
+  }
+}
+
+/// \brief Base of every lazy expression. Each expression has an element type, which is the type of its result, such as PhQ::Value::SymmetricDyadic or PhQ::Velocity; a number of components, as given by PhQ::ArrayElement; whether it involves quantity arrays; a size, which is the number of elements of the quantity arrays that it involves, or 0 if it involves none; and a function that computes one component of one element, such as expression(1, index) for the y component of the element at a given index.
+template <typename Derived, typename Element> class LazyExpression {
+
+public:
+
+  using Type = Element;
+
+  static constexpr std::size_t component_count{ArrayElement<Element>::size};
+
+  /// \brief Compute the value of an expression that involves no quantity arrays.
+  constexpr Element evaluate() const noexcept {
+    std::array<double, component_count> values{};
+    for (std::size_t component = 0; component < component_count; ++component) {
+      values[component] = static_cast<double>(derived()(component, 0));
+    }
+    return ArrayElement<Element>::make(values);
+  }
+
+  /// \brief Compute the element at a given index of an expression that involves quantity arrays.
+  constexpr Element evaluate(std::size_t index) const noexcept {
+    std::array<double, component_count> values{};
+    for (std::size_t component = 0; component < component_count; ++component) {
+      values[component] = static_cast<double>(derived()(component, index));
+    }
+    return ArrayElement<Element>::make(values);
+  }
+
+protected:
+
+  constexpr const Derived& derived() const noexcept {
+    return static_cast<const Derived&>(*this);
+  }
+
+};
+
+template <typename Type, typename = void> struct IsLazyExpression : std::false_type {};
+
+template <typename Type> struct IsLazyExpression<Type, std::void_t<typename Type::Type>> : std::is_base_of<LazyExpression<Type, typename Type::Type>, Type> {};
+
+template <typename Type> constexpr bool is_lazy_expression{IsLazyExpression<Type>::value};
+
+/// \brief Lazy expression holding a single value or quantity, whose components are the same at every index.
+template <typename Element> class LazyValue : public LazyExpression<LazyValue<Element>, Element> {
+
+public:
+
+  static constexpr bool involves_arrays{false};
+
+  explicit constexpr LazyValue(const Element& element) noexcept : components_(ArrayElement<Element>::components(element)) {}
+
+  constexpr std::size_t size() const noexcept {
+    return 0;
+  }
+
+  constexpr double operator()(std::size_t component, std::size_t) const noexcept {
+    return components_[component];
+  }
+
+private:
+
+  std::array<double, ArrayElement<Element>::size> components_;
+
+};
+
+/// \brief Lazy expression referring to a quantity array, which must outlive the expression.
+template <typename Element, typename Number> class LazyArray : public LazyExpression<LazyArray<Element, Number>, Element> {
+
+public:
+
+  static constexpr bool involves_arrays{true};
+
+  explicit LazyArray(const QuantityArray<Element, Number>& array) noexcept : components_(), size_(array.size()) {
+    for (std::size_t component = 0; component < ArrayElement<Element>::size; ++component) {
+      components_[component] = array.component(component);
+    }
+  }
+
+  constexpr std::size_t size() const noexcept {
+    return size_;
+  }
+
+  constexpr Number operator()(std::size_t component, std::size_t index) const noexcept {
+    return components_[component][index];
+  }
+
+private:
+
+  std::array<const Number*, ArrayElement<Element>::size> components_;
+
+  std::size_t size_;
+
+};
+
+/// \brief Size of a lazy expression with two operands: that of the operands that involve quantity arrays. Throws if both operands involve quantity arrays of different sizes.
+template <typename Left, typename Right> std::size_t lazy_size(const Left& left, const Right& right) {
+  if constexpr (Left::involves_arrays && Right::involves_arrays) {
+    if (left.size() != right.size()) {
+      throw std::runtime_error{"Cannot operate on quantity arrays of " + std::to_string(left.size()) + " and " + std::to_string(right.size()) + " elements."};
+    }
+    return left.size();
+  } else if constexpr (Left::involves_arrays) {
+    return left.size();
+  } else {
+    return right.size();
+  }
+}
+
+/// \brief Lazy sum or difference of two lazy expressions of the same element type. Its size throws if both expressions involve quantity arrays of different sizes.
+template <typename Left, typename Right, bool Subtract> class LazySum : public LazyExpression<LazySum<Left, Right, Subtract>, typename Left::Type> {
+
+  static_assert(std::is_same<typename Left::Type, typename Right::Type>::value, "PhQ::LazySum requires expressions of the same type.");
+
+public:
+
+  static constexpr bool involves_arrays{Left::involves_arrays || Right::involves_arrays};
+
+  constexpr LazySum(const Left& left, const Right& right) noexcept : left_(left), right_(right) {}
+
+  std::size_t size() const {
+    return lazy_size(left_, right_);
+  }
+
+  constexpr auto operator()(std::size_t component, std::size_t index) const noexcept {
+    if constexpr (Subtract) {
+      return left_(component, index) - right_(component, index);
+    } else {
+      return left_(component, index) + right_(component, index);
+    }
+  }
+
+private:
+
+  Left left_;
+
+  Right right_;
+
+};
+
+template <typename Inner> class LazyNegation : public LazyExpression<LazyNegation<Inner>, typename Inner::Type> {
+
+public:
+
+  static constexpr bool involves_arrays{Inner::involves_arrays};
+
+  explicit constexpr LazyNegation(const Inner& inner) noexcept : inner_(inner) {}
+
+  std::size_t size() const {
+    return inner_.size();
+  }
+
+  constexpr auto operator()(std::size_t component, std::size_t index) const noexcept {
+    return -inner_(component, index);
+  }
+
+private:
+
+  Inner inner_;
+
+};
+
+/// \brief Element type of a lazy expression scaled by a factor: unchanged for real numbers and dimensionless scalar physical quantities, and that of the eager product or quotient for dimensional scalar physical quantities.
+template <typename Element, typename Factor, bool Divide, typename = void> struct LazyScaledType {
+  using Type = Element;
+};
+
+template <typename Element, typename Factor> struct LazyScaledType<Element, Factor, false, std::enable_if_t<is_dimensional_scalar_quantity<Factor>>> {
+  using Type = decltype(std::declval<const Element&>() * std::declval<const Factor&>());
+};
+
+template <typename Element, typename Factor> struct LazyScaledType<Element, Factor, true, std::enable_if_t<is_dimensional_scalar_quantity<Factor>>> {
+  using Type = decltype(std::declval<const Element&>() / std::declval<const Factor&>());
+};
+
+/// \brief Lazy product or quotient of a lazy expression and a factor. The factor is held as a real number in the standard unit.
+template <typename Inner, typename Factor, bool Divide> class LazyScale : public LazyExpression<LazyScale<Inner, Factor, Divide>, typename LazyScaledType<typename Inner::Type, Factor, Divide>::Type> {
+
+public:
+
+  static constexpr bool involves_arrays{Inner::involves_arrays};
+
+  constexpr LazyScale(const Inner& inner, const Factor& factor) noexcept : inner_(inner), factor_(lazy_factor_value(factor)) {}
+
+  std::size_t size() const {
+    return inner_.size();
+  }
+
+  /// \brief The factor is rounded to the numeric type of the inner expression, so that single-precision arrays are scaled in single precision.
+  constexpr auto operator()(std::size_t component, std::size_t index) const noexcept {
+    using Number = decltype(inner_(component, index));
+    if constexpr (Divide) {
+      return inner_(component, index) / static_cast<Number>(factor_);
+    } else {
+      return inner_(component, index) * static_cast<Number>(factor_);
+    }
+  }
+
+private:
+
+  Inner inner_;
+
+  double factor_;
+
+};
+
+/// \brief Start a lazy expression from a value, such as a PhQ::Value::SymmetricDyadic, or from a physical quantity, such as a PhQ::Velocity. The value is copied.
+template <typename Element> constexpr LazyValue<Element> lazy(const Element& element) noexcept {
+  return LazyValue<Element>{element};
+}
+
+/// \brief Start a lazy expression from a quantity array. The array is referred to rather than copied, so it must outlive the expression. Assigning the expression to a quantity array of the same size computes each of its components in a single pass, with no intermediate arrays; the array being assigned may itself appear in the expression, as in velocities = PhQ::lazy(velocities) + duration * PhQ::lazy(accelerations).
+template <typename Element, typename Number> LazyArray<Element, Number> lazy(const QuantityArray<Element, Number>& array) noexcept {
+  return LazyArray<Element, Number>{array};
+}
+
+template <typename Operand, typename Element> struct IsQuantityArrayOf : std::false_type {};
+
+template <typename Element, typename Number> struct IsQuantityArrayOf<QuantityArray<Element, Number>, Element> : std::true_type {};
+
+template <typename Operand> struct LazyArrayOf {
+  static constexpr bool value{false};
+};
+
+template <typename Element, typename Number> struct LazyArrayOf<QuantityArray<Element, Number>> {
+  static constexpr bool value{true};
+
+  using Type = LazyArray<Element, Number>;
+};
+
+/// \brief Lazy expression of an operand of a lazy operator: a lazy expression is kept as is, a quantity array is referred to by a PhQ::LazyArray, and a value or physical quantity is held in a PhQ::LazyValue.
+template <typename Operand> constexpr auto lazy_operand(const Operand& operand) noexcept {
+  if constexpr (is_lazy_expression<Operand>) {
+    return operand;
+  } else if constexpr (LazyArrayOf<Operand>::value) {
+    return typename LazyArrayOf<Operand>::Type{operand};
+  } else {
+    return LazyValue<Operand>{operand};
+  }
+}
+
+/// \brief Whether a sum or difference is lazy: either both operands are lazy expressions of the same type, or one of them is a lazy expression and the other is a value, physical quantity, or quantity array of its type.
+template <typename Left, typename Right> constexpr bool is_lazy_sum_operation() noexcept {
+  if constexpr (is_lazy_expression<Left> && is_lazy_expression<Right>) {
+    return true;
+  } else if constexpr (is_lazy_expression<Left>) {
+    return std::is_same<typename Left::Type, Right>::value || IsQuantityArrayOf<Right, typename Left::Type>::value;
+  } else if constexpr (is_lazy_expression<Right>) {
+    return std::is_same<Left, typename Right::Type>::value || IsQuantityArrayOf<Left, typename Right::Type>::value;
+  } else {
+    return false;
+  }
+}
+
+} // namespace PhQ
+
+template <typename Left, typename Right, std::enable_if_t<PhQ::is_lazy_sum_operation<Left, Right>(), bool> = true> constexpr auto operator+(const Left& left, const Right& right) noexcept {
+  return PhQ::LazySum<decltype(PhQ::lazy_operand(left)), decltype(PhQ::lazy_operand(right)), false>{PhQ::lazy_operand(left), PhQ::lazy_operand(right)};
+}
+
+template <typename Left, typename Right, std::enable_if_t<PhQ::is_lazy_sum_operation<Left, Right>(), bool> = true> constexpr auto operator-(const Left& left, const Right& right) noexcept {
+  return PhQ::LazySum<decltype(PhQ::lazy_operand(left)), decltype(PhQ::lazy_operand(right)), true>{PhQ::lazy_operand(left), PhQ::lazy_operand(right)};
+}
+
+template <typename Inner, std::enable_if_t<PhQ::is_lazy_expression<Inner>, bool> = true> constexpr PhQ::LazyNegation<Inner> operator-(const Inner& inner) noexcept {
+  return PhQ::LazyNegation<Inner>{inner};
+}
+
+template <typename Inner, typename Factor, std::enable_if_t<PhQ::is_lazy_expression<Inner> && PhQ::is_lazy_factor<Factor>, bool> = true> constexpr PhQ::LazyScale<Inner, Factor, false> operator*(const Inner& inner, const Factor& factor) noexcept {
+  return {inner, factor};
+}
+
+template <typename Factor, typename Inner, std::enable_if_t<PhQ::is_lazy_factor<Factor> && PhQ::is_lazy_expression<Inner>, bool> = true> constexpr PhQ::LazyScale<Inner, Factor, false> operator*(const Factor& factor, const Inner& inner) noexcept {
+  return {inner, factor};
+}
+
+template <typename Inner, typename Factor, std::enable_if_t<PhQ::is_lazy_expression<Inner> && PhQ::is_lazy_factor<Factor>, bool> = true> constexpr PhQ::LazyScale<Inner, Factor, true> operator/(const Inner& inner, const Factor& factor) noexcept {
+  return {inner, factor};
+}
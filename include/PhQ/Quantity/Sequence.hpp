@@ -0,0 +1,318 @@
+// Copyright 2020 Alexandre Coderre-Chabot
+// This file is part of Physical Quantities (PhQ), a C++17 header-only library of physical quantities, physical models, and units of measure for scientific computation.
+// Physical Quantities is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+// You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "DimensionalDyadic.hpp"
+#include "DimensionalSymmetricDyadic.hpp"
+#include "DimensionalVector.hpp"
+
+namespace PhQ {
+
+/// \brief Labels of the components of a value type, in the order in which sequence writers emit them as columns. Value types of any numeric type, such as PhQ::Value::BasicVector<float>, have the same labels as their double-precision counterparts.
+template <typename Value> constexpr std::array<std::string_view, 0> component_labels{};
+
+template <> constexpr std::array<std::string_view, 1> component_labels<double>{"value"};
+
+template <> constexpr std::array<std::string_view, 1> component_labels<float>{"value"};
+
+template <typename Number> constexpr std::array<std::string_view, 3> component_labels<Value::BasicVector<Number>>{"x", "y", "z"};
+
+template <typename Number> constexpr std::array<std::string_view, 6> component_labels<Value::BasicSymmetricDyadic<Number>>{"xx", "xy", "xz", "yy", "yz", "zz"};
+
+template <typename Number> constexpr std::array<std::string_view, 9> component_labels<Value::BasicDyadic<Number>>{"xx", "xy", "xz", "yx", "yy", "yz", "zx", "zy", "zz"};
+
+/// \brief Components of a value, in the order of PhQ::component_labels, as double-precision numbers. Components of values of other numeric types, such as float, are widened exactly.
+constexpr std::array<double, 1> components(double value) noexcept {
+  return {value};
+}
+
+template <typename Number> constexpr std::array<double, 3> components(const Value::BasicVector<Number>& vector) noexcept {
+  return {static_cast<double>(vector.x()), static_cast<double>(vector.y()), static_cast<double>(vector.z())};
+}
+
+template <typename Number> constexpr std::array<double, 6> components(const Value::BasicSymmetricDyadic<Number>& symmetric_dyadic) noexcept {
+  return {static_cast<double>(symmetric_dyadic.xx()), static_cast<double>(symmetric_dyadic.xy()), static_cast<double>(symmetric_dyadic.xz()), static_cast<double>(symmetric_dyadic.yy()), static_cast<double>(symmetric_dyadic.yz()), static_cast<double>(symmetric_dyadic.zz())};
+}
+
+template <typename Number> constexpr std::array<double, 9> components(const Value::BasicDyadic<Number>& dyadic) noexcept {
+  return {static_cast<double>(dyadic.xx()), static_cast<double>(dyadic.xy()), static_cast<double>(dyadic.xz()), static_cast<double>(dyadic.yx()), static_cast<double>(dyadic.yy()), static_cast<double>(dyadic.yz()), static_cast<double>(dyadic.zx()), static_cast<double>(dyadic.zy()), static_cast<double>(dyadic.zz())};
+}
+
+/// \brief Describes how the elements of a PhQ::QuantityArray, and of sequences of physical quantities that are written or read, are split into components and assembled from them. Each specialization provides the number of components, a function that returns the components of an element in the standard unit, and a function that creates an element from its components.
+template <typename Type, typename = void> struct ArrayElement;
+
+/// \brief Real numbers, which have a single component.
+template <> struct ArrayElement<double> {
+  static constexpr std::size_t size{1};
+
+  static constexpr std::array<double, size> components(double value) noexcept {
+    return {value};
+  }
+
+  static constexpr double make(const std::array<double, size>& values) noexcept {
+    return values[0];
+  }
+};
+
+template <> struct ArrayElement<float> {
+  static constexpr std::size_t size{1};
+
+  static constexpr std::array<double, size> components(float value) noexcept {
+    return {static_cast<double>(value)};
+  }
+
+  static constexpr float make(const std::array<double, size>& values) noexcept {
+    return static_cast<float>(values[0]);
+  }
+};
+
+/// \brief Vectors, symmetric dyadic tensors, and dyadic tensors, whose components are listed in the order of PhQ::component_labels.
+template <typename Number> struct ArrayElement<Value::BasicVector<Number>> {
+  static constexpr std::size_t size{3};
+
+  static constexpr std::array<double, size> components(const Value::BasicVector<Number>& vector) noexcept {
+    return PhQ::components(vector);
+  }
+
+  static constexpr Value::BasicVector<Number> make(const std::array<double, size>& values) noexcept {
+    return Value::BasicVector<Number>{Value::Vector{values}};
+  }
+};
+
+template <typename Number> struct ArrayElement<Value::BasicSymmetricDyadic<Number>> {
+  static constexpr std::size_t size{6};
+
+  static constexpr std::array<double, size> components(const Value::BasicSymmetricDyadic<Number>& symmetric_dyadic) noexcept {
+    return PhQ::components(symmetric_dyadic);
+  }
+
+  static constexpr Value::BasicSymmetricDyadic<Number> make(const std::array<double, size>& values) noexcept {
+    return Value::BasicSymmetricDyadic<Number>{Value::SymmetricDyadic{values}};
+  }
+};
+
+template <typename Number> struct ArrayElement<Value::BasicDyadic<Number>> {
+  static constexpr std::size_t size{9};
+
+  static constexpr std::array<double, size> components(const Value::BasicDyadic<Number>& dyadic) noexcept {
+    return PhQ::components(dyadic);
+  }
+
+  static constexpr Value::BasicDyadic<Number> make(const std::array<double, size>& values) noexcept {
+    return Value::BasicDyadic<Number>{Value::Dyadic{values}};
+  }
+};
+
+/// \brief Dimensional physical quantities of any numeric type, whose components are those of their value in the standard unit.
+template <typename Type> struct ArrayElement<Type, std::enable_if_t<std::is_base_of<DimensionalQuantity<QuantityUnit<Type>>, Type>::value>> {
+  static constexpr std::size_t size{component_labels<QuantityValue<Type>>.size()};
+
+  static constexpr std::array<double, size> components(const Type& quantity) noexcept {
+    return PhQ::components(quantity.value());
+  }
+
+  static constexpr Type make(const std::array<double, size>& values) noexcept {
+    return Type{ArrayElement<QuantityValue<Type>>::make(values), standard_unit<QuantityUnit<Type>>};
+  }
+};
+
+/// \brief One component of a sequence of dimensional physical quantities, gathered into a contiguous column and converted to a unit in bulk. The column is resized to the number of quantities, so its memory can be reused between calls.
+template <typename Type> void gather_column(const std::vector<Type>& quantities, std::size_t component, QuantityUnit<Type> unit, std::vector<double>& column) noexcept {
+  column.resize(quantities.size());
+  for (std::size_t index = 0; index < quantities.size(); ++index) {
+    column[index] = components(quantities[index].value())[component];
+  }
+  convert_in_place(column.data(), column.size(), standard_unit<QuantityUnit<Type>>, unit);
+}
+
+/// \brief Append numbers to a text sink, separated by a separator.
+template <typename Sink> void append_numbers(Sink& output, const std::vector<double>& values, std::string_view separator) noexcept {
+  for (std::size_t index = 0; index < values.size(); ++index) {
+    if (index > 0) {
+      append(output, separator);
+    }
+    append_number(output, values[index]);
+  }
+}
+
+/// \brief Append a sequence of dimensional physical quantities to a text sink as a single JSON object. The unit and the physical dimension set are written once, followed by one dense array of numbers per component, converted to the unit in bulk.
+/// \details For example, a sequence of two temperatures yields {"unit": "K", "dimension": {...}, "values": [300.0000, 310.0000]}, and a sequence of velocities yields "values": {"x": [...], "y": [...], "z": [...]}.
+template <typename Sink, typename Type> void json_sequence(Sink& output, const std::vector<Type>& quantities, QuantityUnit<Type> unit = standard_unit<QuantityUnit<Type>>) noexcept {
+  constexpr const std::array labels{component_labels<QuantityValue<Type>>};
+  std::vector<double> column;
+  append(output, "{\"unit\": \"");
+  append(output, abbreviation(unit));
+  append(output, "\", \"dimension\": ");
+  dimension<QuantityUnit<Type>>.json(output);
+  append(output, ", \"values\": ");
+  if (labels.size() > 1) {
+    append(output, "{");
+  }
+  for (std::size_t component = 0; component < labels.size(); ++component) {
+    if (labels.size() > 1) {
+      append(output, component > 0 ? ", \"" : "\"");
+      append(output, labels[component]);
+      append(output, "\": ");
+    }
+    gather_column(quantities, component, unit, column);
+    append(output, "[");
+    append_numbers(output, column, ", ");
+    append(output, "]");
+  }
+  if (labels.size() > 1) {
+    append(output, "}");
+  }
+  append(output, "}");
+}
+
+template <typename Sink, typename Type> void json_sequence(Sink& output, const std::vector<Type>& quantities, System system) noexcept {
+  json_sequence(output, quantities, unit<QuantityUnit<Type>>(system));
+}
+
+/// \brief Append a sequence of dimensional physical quantities to a text sink as a single YAML flow mapping. The unit and the physical dimension set are written once, followed by one dense sequence of numbers per component, converted to the unit in bulk.
+template <typename Sink, typename Type> void yaml_sequence(Sink& output, const std::vector<Type>& quantities, QuantityUnit<Type> unit = standard_unit<QuantityUnit<Type>>) noexcept {
+  constexpr const std::array labels{component_labels<QuantityValue<Type>>};
+  std::vector<double> column;
+  append(output, "{unit: ");
+  append(output, abbreviation(unit));
+  append(output, ", dimension: ");
+  dimension<QuantityUnit<Type>>.yaml(output);
+  append(output, ", values: ");
+  if (labels.size() > 1) {
+    append(output, "{");
+  }
+  for (std::size_t component = 0; component < labels.size(); ++component) {
+    if (labels.size() > 1) {
+      append(output, component > 0 ? ", " : "");
+      append(output, labels[component]);
+      append(output, ": ");
+    }
+    gather_column(quantities, component, unit, column);
+    append(output, "[");
+    append_numbers(output, column, ", ");
+    append(output, "]");
+  }
+  if (labels.size() > 1) {
+    append(output, "}");
+  }
+  append(output, "}");
+}
+
+template <typename Sink, typename Type> void yaml_sequence(Sink& output, const std::vector<Type>& quantities, System system) noexcept {
+  yaml_sequence(output, quantities, unit<QuantityUnit<Type>>(system));
+}
+
+/// \brief Append a sequence of dimensional physical quantities to a text sink as XML elements. The unit and the physical dimension set are written once, followed by one element per component whose content is a whitespace-separated list of numbers, converted to the unit in bulk.
+/// \details For example, a sequence of two temperatures yields <unit>K</unit><dimension>...</dimension><values>300.0000 310.0000</values>, and a sequence of velocities yields <values><x>...</x><y>...</y><z>...</z></values>.
+template <typename Sink, typename Type> void xml_sequence(Sink& output, const std::vector<Type>& quantities, QuantityUnit<Type> unit = standard_unit<QuantityUnit<Type>>) noexcept {
+  constexpr const std::array labels{component_labels<QuantityValue<Type>>};
+  std::vector<double> column;
+  append(output, "<unit>");
+  append(output, abbreviation(unit));
+  append(output, "</unit><dimension>");
+  dimension<QuantityUnit<Type>>.xml(output);
+  append(output, "</dimension><values>");
+  for (std::size_t component = 0; component < labels.size(); ++component) {
+    if (labels.size() > 1) {
+      append(output, "<");
+      append(output, labels[component]);
+      append(output, ">");
+    }
+    gather_column(quantities, component, unit, column);
+    append_numbers(output, column, " ");
+    if (labels.size() > 1) {
+      append(output, "</");
+      append(output, labels[component]);
+      append(output, ">");
+    }
+  }
+  append(output, "</values>");
+}
+
+template <typename Sink, typename Type> void xml_sequence(Sink& output, const std::vector<Type>& quantities, System system) noexcept {
+  xml_sequence(output, quantities, unit<QuantityUnit<Type>>(system));
+}
+
+/// \brief Append a sequence of dimensional physical quantities to a text sink as comma-separated values: a header row that names each component and its unit once, such as "x [m/s],y [m/s],z [m/s]", followed by one row per quantity, converted to the unit in bulk.
+template <typename Sink, typename Type> void csv_sequence(Sink& output, const std::vector<Type>& quantities, QuantityUnit<Type> unit = standard_unit<QuantityUnit<Type>>) noexcept {
+  constexpr const std::array labels{component_labels<QuantityValue<Type>>};
+  std::array<std::vector<double>, labels.size()> columns;
+  for (std::size_t component = 0; component < labels.size(); ++component) {
+    if (component > 0) {
+      append(output, ",");
+    }
+    append(output, labels[component]);
+    append(output, " [");
+    append(output, abbreviation(unit));
+    append(output, "]");
+    gather_column(quantities, component, unit, columns[component]);
+  }
+  append(output, "\n");
+  for (std::size_t index = 0; index < quantities.size(); ++index) {
+    for (std::size_t component = 0; component < labels.size(); ++component) {
+      if (component > 0) {
+        append(output, ",");
+      }
+      append_number(output, columns[component][index]);
+    }
+    append(output, "\n");
+  }
+}
+
+template <typename Sink, typename Type> void csv_sequence(Sink& output, const std::vector<Type>& quantities, System system) noexcept {
+  csv_sequence(output, quantities, unit<QuantityUnit<Type>>(system));
+}
+
+/// \brief Sequences of dimensional physical quantities, read from the format written by PhQ::json_sequence, PhQ::yaml_sequence, or PhQ::xml_sequence. The unit can be any spelling or unit expression of the physical dimension set of the quantity type, which must match the recorded dimension set.
+/// \details Each component is parsed into a contiguous column in a single pass and converted to the standard unit in bulk with a single multiply-add per value, after which the quantities are assembled. For example, PhQ::parse_json<std::vector<PhQ::Velocity>>(text) reads back a sequence of velocities.
+template <typename Type> struct Deserializer<std::vector<Type>, std::enable_if_t<std::is_base_of<DimensionalQuantity<QuantityUnit<Type>>, Type>::value>> {
+  static bool read(TextReader& reader, std::vector<Type>& quantities) noexcept {
+    constexpr const std::array labels{component_labels<QuantityValue<Type>>};
+    std::string_view unit;
+    Dimension::Set dimension_set;
+    if (!(reader.begin_object() && reader.begin_field("unit") && reader.string(unit) && reader.end_field("unit") && reader.separator() && reader.field("dimension", dimension_set) && dimension_set == dimension<QuantityUnit<Type>> && reader.separator() && reader.begin_field("values"))) {
+      return false;
+    }
+    if (labels.size() > 1 && !reader.begin_object()) {
+      return false;
+    }
+    const std::optional<ConversionFactor> factor{starts_with_numeric_factor(trim_whitespace(unit)) ? std::nullopt : resolve_unit<QuantityUnit<Type>>(unit)};
+    if (!factor.has_value()) {
+      return false;
+    }
+    std::array<std::vector<double>, labels.size()> columns;
+    for (std::size_t component = 0; component < labels.size(); ++component) {
+      if (labels.size() > 1 && ((component > 0 && !reader.separator()) || !reader.begin_field(labels[component]))) {
+        return false;
+      }
+      if (!reader.numbers(columns[component]) || columns[component].size() != columns[0].size()) {
+        return false;
+      }
+      if (labels.size() > 1 && !reader.end_field(labels[component])) {
+        return false;
+      }
+      for (double& value : columns[component]) {
+        value = factor.value()(value);
+      }
+    }
+    if ((labels.size() > 1 && !reader.end_object()) || !reader.end_field("values") || !reader.end_object()) {
+      return false;
+    }
+    quantities.clear();
+    quantities.reserve(columns[0].size());
+    for (std::size_t index = 0; index < columns[0].size(); ++index) {
+      std::array<double, labels.size()> values;
+      for (std::size_t component = 0; component < labels.size(); ++component) {
+        values[component] = columns[component][index];
+      }
+      quantities.push_back(ArrayElement<Type>::make(values));
+    }
+    return true;
+  }
+};
+
+} // namespace PhQ
@@ -0,0 +1,349 @@
+// Copyright 2020 Alexandre Coderre-Chabot
+// This file is part of Physical Quantities (PhQ), a C++17 header-only library of physical quantities, physical models, and units of measure for scientific computation.
+// Physical Quantities is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+// You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Array.hpp"
+
+// Raw views: the values of contiguous containers of physical quantities seen as real numbers in the standard unit, and buffers of real numbers in the standard unit seen as physical quantities. A physical quantity has no data members other than its value, whose components are stored consecutively in the order of PhQ::component_labels, so a contiguous container of N quantities with C components each occupies the same bytes as N * C real numbers. Reading these bytes as real numbers is implementation-defined rather than guaranteed by the C++ standard: it relies on the layout checked by PhQ::has_raw_layout and on pointer arithmetic across the quantities of a container, which GCC, Clang, and MSVC support. Buffers of real numbers are never read as quantities in place; their quantities are copied in and out by value.
+
+namespace PhQ {
+
+/// \brief Numeric type in which a value type stores its components, such as float for a PhQ::Value::BasicVector<float>. Real numbers and directions store doubles.
+template <typename Value> struct ValueNumber {
+  using Type = double;
+};
+
+template <> struct ValueNumber<float> {
+  using Type = float;
+};
+
+template <typename Number> struct ValueNumber<Value::BasicVector<Number>> {
+  using Type = Number;
+};
+
+template <typename Number> struct ValueNumber<Value::BasicSymmetricDyadic<Number>> {
+  using Type = Number;
+};
+
+template <typename Number> struct ValueNumber<Value::BasicDyadic<Number>> {
+  using Type = Number;
+};
+
+/// \brief Numeric type in which a physical quantity or a value type stores its components, such as float for a PhQ::BasicVelocity<float>.
+template <typename Type, typename = void> struct RawNumberOf : ValueNumber<Type> {};
+
+template <typename Type> struct RawNumberOf<Type, std::void_t<QuantityValue<Type>>> : ValueNumber<QuantityValue<Type>> {};
+
+template <typename Type> using RawNumber = typename RawNumberOf<Type>::Type;
+
+/// \brief Whether a type can be viewed as a sequence of real numbers: a physical quantity, a direction, or a value type whose components are exactly its data members, in the order of PhQ::component_labels.
+template <typename Type> constexpr bool has_raw_layout{std::is_standard_layout<Type>::value && std::is_trivially_copyable<Type>::value && sizeof(Type) == ArrayElement<Type>::size * sizeof(RawNumber<Type>) && alignof(Type) == alignof(RawNumber<Type>)};
+
+/// \brief Index of the component of a type that has a given label, such as 1 for the xy component of a PhQ::Stress, or the number of components of the type if no component has this label.
+template <typename Type> constexpr std::size_t component_index(std::string_view label) noexcept {
+  constexpr auto labels{component_labels<QuantityValue<Type>>};
+  for (std::size_t index = 0; index < labels.size(); ++index) {
+    if (labels[index] == label) {
+      return index;
+    }
+  }
+  return labels.size();
+}
+
+/// \brief Non-owning view of real numbers spaced by a constant stride, such as every component of an array of velocities, whose stride is 1, or the xy components of an array of stresses, whose stride is 6. The number type may be const for read-only views. The numbers are in the standard unit of the quantities that they belong to. The viewed storage must outlive the view.
+template <typename Number> class RawView {
+
+public:
+
+  constexpr RawView() noexcept : data_(nullptr), size_(0), stride_(1) {}
+
+  constexpr RawView(Number* data, std::size_t size, std::size_t stride = 1) noexcept : data_(data), size_(size), stride_(stride) {}
+
+  /// \brief Conversion from a mutable view to a read-only view.
+  template <typename OtherNumber, std::enable_if_t<std::is_same<const OtherNumber, Number>::value && !std::is_same<OtherNumber, Number>::value, bool> = true> constexpr RawView(const RawView<OtherNumber>& view) noexcept : data_(view.data()), size_(view.size()), stride_(view.stride()) {}
+
+  /// \brief Address of the first number, which can be handed to a library that takes a pointer and a stride, such as the x and incx arguments of BLAS.
+  constexpr Number* data() const noexcept {
+    return data_;
+  }
+
+  constexpr std::size_t size() const noexcept {
+    return size_;
+  }
+
+  /// \brief Distance between consecutive numbers, counted in numbers rather than in bytes.
+  constexpr std::size_t stride() const noexcept {
+    return stride_;
+  }
+
+  constexpr bool empty() const noexcept {
+    return size_ == 0;
+  }
+
+  /// \brief Whether the numbers are consecutive in memory, in which case data() and size() describe a plain array.
+  constexpr bool contiguous() const noexcept {
+    return stride_ == 1;
+  }
+
+  constexpr Number& operator[](std::size_t index) const noexcept {
+    return data_[index * stride_];
+  }
+
+private:
+
+  Number* data_;
+
+  std::size_t size_;
+
+  std::size_t stride_;
+
+};
+
+/// \brief Non-owning view of a contiguous container of physical quantities, such as a std::vector<PhQ::Velocity>, whose values can be seen as real numbers in the standard unit, of the numeric type of the quantities. The type may be const for read-only views. The viewed container must outlive the view.
+template <typename Type> class QuantityView {
+
+  static_assert(has_raw_layout<std::remove_const_t<Type>>, "PhQ::QuantityView requires a type whose components are exactly its data members.");
+
+public:
+
+  using Number = std::conditional_t<std::is_const<Type>::value, const RawNumber<std::remove_const_t<Type>>, RawNumber<std::remove_const_t<Type>>>;
+
+  static constexpr std::size_t component_count{ArrayElement<std::remove_const_t<Type>>::size};
+
+  constexpr QuantityView() noexcept : data_(nullptr), size_(0) {}
+
+  constexpr QuantityView(Type* quantities, std::size_t size) noexcept : data_(quantities), size_(size) {}
+
+  constexpr Type* data() const noexcept {
+    return data_;
+  }
+
+  constexpr std::size_t size() const noexcept {
+    return size_;
+  }
+
+  constexpr bool empty() const noexcept {
+    return size_ == 0;
+  }
+
+  constexpr Type* begin() const noexcept {
+    return data_;
+  }
+
+  constexpr Type* end() const noexcept {
+    return data_ + size_;
+  }
+
+  constexpr Type& operator[](std::size_t index) const noexcept {
+    return data_[index];
+  }
+
+  /// \brief Every component of every quantity, as a contiguous view of size * component_count numbers. This reinterprets the storage of the quantities, which is implementation-defined.
+  RawView<Number> values() const noexcept {
+    return {reinterpret_cast<Number*>(data_), size_ * component_count};
+  }
+
+  /// \brief One component of every quantity, such as the xy components of a view of stresses, as a view whose stride is the number of components. This reinterprets the storage of the quantities, which is implementation-defined.
+  RawView<Number> component(std::size_t component) const noexcept {
+    return {reinterpret_cast<Number*>(data_) + component, size_, component_count};
+  }
+
+private:
+
+  Type* data_;
+
+  std::size_t size_;
+
+};
+
+/// \brief Non-owning view of a buffer of real numbers in the standard unit as physical quantities, such as a buffer of 3 * N doubles filled by a solver seen as N velocities. The buffer holds numbers of the numeric type of the quantities, such as floats for PhQ::BasicVelocity<float>. Quantities are read from and written to the buffer by value, one component at a time, so the buffer is only ever accessed as real numbers. The type may be const for read-only views. The viewed buffer must outlive the view.
+template <typename Type> class BufferView {
+
+public:
+
+  using Element = std::remove_const_t<Type>;
+
+  using Number = std::conditional_t<std::is_const<Type>::value, const RawNumber<Element>, RawNumber<Element>>;
+
+  static constexpr std::size_t component_count{ArrayElement<Element>::size};
+
+  /// \brief Proxy for the quantity at a given index of a mutable view, which reads the quantity when converted and writes it when assigned.
+  class Reference {
+
+  public:
+
+    explicit constexpr Reference(RawNumber<Element>* values) noexcept : values_(values) {}
+
+    constexpr operator Element() const noexcept {
+      return read(values_);
+    }
+
+    constexpr Reference& operator=(const Element& quantity) noexcept {
+      write(values_, quantity);
+      return *this;
+    }
+
+    constexpr Reference& operator=(const Reference& reference) noexcept {
+      write(values_, read(reference.values_));
+      return *this;
+    }
+
+    constexpr Reference& operator+=(const Element& quantity) noexcept {
+      return *this = read(values_) + quantity;
+    }
+
+    constexpr Reference& operator-=(const Element& quantity) noexcept {
+      return *this = read(values_) - quantity;
+    }
+
+  private:
+
+    RawNumber<Element>* values_;
+
+  };
+
+  /// \brief Read-only iterator over the quantities of a view, which yields each quantity by value.
+  class Iterator {
+
+  public:
+
+    constexpr Iterator(const RawNumber<Element>* values) noexcept : values_(values) {}
+
+    constexpr Element operator*() const noexcept {
+      return read(values_);
+    }
+
+    constexpr Iterator& operator++() noexcept {
+      values_ += component_count;
+      return *this;
+    }
+
+    constexpr bool operator==(const Iterator& iterator) const noexcept {
+      return values_ == iterator.values_;
+    }
+
+    constexpr bool operator!=(const Iterator& iterator) const noexcept {
+      return values_ != iterator.values_;
+    }
+
+  private:
+
+    const RawNumber<Element>* values_;
+
+  };
+
+  constexpr BufferView() noexcept : data_(nullptr), size_(0) {}
+
+  /// \brief View of a given number of quantities whose components start at a given address. The buffer must hold size * component_count numbers.
+  constexpr BufferView(Number* values, std::size_t size) noexcept : data_(values), size_(size) {}
+
+  constexpr Number* data() const noexcept {
+    return data_;
+  }
+
+  constexpr std::size_t size() const noexcept {
+    return size_;
+  }
+
+  constexpr bool empty() const noexcept {
+    return size_ == 0;
+  }
+
+  constexpr Iterator begin() const noexcept {
+    return {data_};
+  }
+
+  constexpr Iterator end() const noexcept {
+    return {data_ + size_ * component_count};
+  }
+
+  constexpr Element get(std::size_t index) const noexcept {
+    return read(data_ + index * component_count);
+  }
+
+  template <typename Quantity = Type, std::enable_if_t<!std::is_const<Quantity>::value, bool> = true> constexpr void set(std::size_t index, const Element& quantity) const noexcept {
+    write(data_ + index * component_count, quantity);
+  }
+
+  /// \brief Quantity at a given index: a copy for read-only views, and a PhQ::BufferView::Reference for mutable views.
+  constexpr auto operator[](std::size_t index) const noexcept {
+    if constexpr (std::is_const<Type>::value) {
+      return get(index);
+    } else {
+      return Reference{data_ + index * component_count};
+    }
+  }
+
+  /// \brief Every component of every quantity, as a contiguous view of size * component_count numbers.
+  constexpr RawView<Number> values() const noexcept {
+    return {data_, size_ * component_count};
+  }
+
+  /// \brief One component of every quantity, such as the xy components of a view of stresses, as a view whose stride is the number of components.
+  constexpr RawView<Number> component(std::size_t component) const noexcept {
+    return {data_ + component, size_, component_count};
+  }
+
+private:
+
+  static constexpr Element read(const RawNumber<Element>* values) noexcept {
+    std::array<double, component_count> components{};
+    for (std::size_t component = 0; component < component_count; ++component) {
+      components[component] = static_cast<double>(values[component]);
+    }
+    return ArrayElement<Element>::make(components);
+  }
+
+  static constexpr void write(RawNumber<Element>* values, const Element& quantity) noexcept {
+    const std::array<double, component_count> components{ArrayElement<Element>::components(quantity)};
+    for (std::size_t component = 0; component < component_count; ++component) {
+      values[component] = static_cast<RawNumber<Element>>(components[component]);
+    }
+  }
+
+  Number* data_;
+
+  std::size_t size_;
+
+};
+
+/// \brief View of the values of a contiguous container of physical quantities, such as a std::vector<PhQ::Velocity>, as real numbers in the standard unit, without copying.
+template <typename Type> QuantityView<Type> view(std::vector<Type>& quantities) noexcept {
+  return {quantities.data(), quantities.size()};
+}
+
+template <typename Type> QuantityView<const Type> view(const std::vector<Type>& quantities) noexcept {
+  return {quantities.data(), quantities.size()};
+}
+
+template <typename Type, std::size_t Size> QuantityView<Type> view(std::array<Type, Size>& quantities) noexcept {
+  return {quantities.data(), Size};
+}
+
+template <typename Type, std::size_t Size> QuantityView<const Type> view(const std::array<Type, Size>& quantities) noexcept {
+  return {quantities.data(), Size};
+}
+
+/// \brief View of a buffer of real numbers in the standard unit as a given number of physical quantities, such as PhQ::view<PhQ::Velocity>(solution, count) for a solution vector of 3 * count doubles, or PhQ::view<PhQ::BasicVelocity<float>>(solution, count) for one of floats. The buffer is not copied as a whole; each quantity is copied when it is read or written.
+template <typename Type> BufferView<Type> view(RawNumber<Type>* values, std::size_t size) noexcept {
+  return {values, size};
+}
+
+template <typename Type> BufferView<const Type> view(const RawNumber<Type>* values, std::size_t size) noexcept {
+  return {values, size};
+}
+
+/// \brief View of one component of a quantity array, such as the xy components of a PhQ::QuantityArray<PhQ::Stress>. Since quantity arrays store each component in its own array, the view is contiguous.
+template <typename Type, typename Number> RawView<Number> view(QuantityArray<Type, Number>& array, std::size_t component) noexcept {
+  return {array.component(component), array.size()};
+}
+
+template <typename Type, typename Number> RawView<const Number> view(const QuantityArray<Type, Number>& array, std::size_t component) noexcept {
+  return {array.component(component), array.size()};
+}
+
+} // namespace PhQ
@@ -21,7 +21,8 @@ class DynamicViscosity;
 class KinematicViscosity;
 class MassDensity;
 class ReynoldsNumber;
-class Velocity;
+template <typename Number> class BasicVelocity;
+using Velocity = BasicVelocity<double>;
 
 class Speed : public DimensionalScalarQuantity<Unit::Speed> {
 
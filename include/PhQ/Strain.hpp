@@ -15,7 +15,8 @@ namespace PhQ {
 class DisplacementGradient;
 class Duration;
 class Frequency;
-class StrainRate;
+template <typename Number> class BasicStrainRate;
+using StrainRate = BasicStrainRate<double>;
 
 class Strain : public DimensionlessSymmetricDyadicQuantity {
 
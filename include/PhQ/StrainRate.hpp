@@ -16,42 +16,46 @@ namespace PhQ {
 // Forward declaration.
 class VelocityGradient;
 
-class StrainRate : public DimensionalSymmetricDyadicQuantity<Unit::Frequency> {
+/// \brief Strain rate tensor, whose components are stored as a given number type. PhQ::StrainRate is the double-precision strain rate used throughout the library; a PhQ::BasicStrainRate<float> halves the memory of a large field of strain rates. Relations with other physical quantities, such as the product of a strain rate and a duration, are defined for PhQ::StrainRate.
+template <typename Number> class BasicStrainRate : public DimensionalSymmetricDyadicQuantity<Unit::Frequency, Number> {
 
 public:
 
-  constexpr StrainRate() noexcept : DimensionalSymmetricDyadicQuantity<Unit::Frequency>() {}
+  constexpr BasicStrainRate() noexcept : DimensionalSymmetricDyadicQuantity<Unit::Frequency, Number>() {}
 
-  constexpr StrainRate(const Value::SymmetricDyadic& value, Unit::Frequency unit) noexcept : DimensionalSymmetricDyadicQuantity<Unit::Frequency>(value, unit) {}
+  constexpr BasicStrainRate(const Value::BasicSymmetricDyadic<Number>& value, Unit::Frequency unit) noexcept : DimensionalSymmetricDyadicQuantity<Unit::Frequency, Number>(value, unit) {}
 
-  constexpr StrainRate(const Strain& strain, const Duration& duration) noexcept : StrainRate(strain.value() / duration.value()) {}
+  /// \brief Explicit conversion from a strain rate stored as another number type, such as widening single precision to double precision or narrowing double precision to single precision.
+  template <typename OtherNumber, std::enable_if_t<!std::is_same<OtherNumber, Number>::value, bool> = true> explicit constexpr BasicStrainRate(const BasicStrainRate<OtherNumber>& strain_rate) noexcept : BasicStrainRate(Value::BasicSymmetricDyadic<Number>{strain_rate.value()}) {}
 
-  constexpr StrainRate(const Strain& strain, const Frequency& frequency) noexcept : StrainRate(strain.value() * frequency.value()) {}
+  constexpr BasicStrainRate(const Strain& strain, const Duration& duration) noexcept : BasicStrainRate(strain.value() / duration.value()) {}
 
-  constexpr StrainRate(const VelocityGradient& velocity_gradient) noexcept;
+  constexpr BasicStrainRate(const Strain& strain, const Frequency& frequency) noexcept : BasicStrainRate(strain.value() * frequency.value()) {}
 
-  constexpr bool operator==(const StrainRate& strain_rate) const noexcept {
-    return value_ == strain_rate.value_;
+  constexpr BasicStrainRate(const VelocityGradient& velocity_gradient) noexcept;
+
+  constexpr bool operator==(const BasicStrainRate& strain_rate) const noexcept {
+    return this->value_ == strain_rate.value_;
   }
 
-  constexpr bool operator!=(const StrainRate& strain_rate) const noexcept {
-    return value_ != strain_rate.value_;
+  constexpr bool operator!=(const BasicStrainRate& strain_rate) const noexcept {
+    return this->value_ != strain_rate.value_;
   }
 
-  constexpr StrainRate operator+(const StrainRate& strain_rate) const noexcept {
-    return {value_ + strain_rate.value_};
+  constexpr BasicStrainRate operator+(const BasicStrainRate& strain_rate) const noexcept {
+    return {this->value_ + strain_rate.value_};
   }
 
-  constexpr void operator+=(const StrainRate& strain_rate) noexcept {
-    value_ += strain_rate.value_;
+  constexpr void operator+=(const BasicStrainRate& strain_rate) noexcept {
+    this->value_ += strain_rate.value_;
   }
 
-  constexpr StrainRate operator-(const StrainRate& strain_rate) const noexcept {
-    return {value_ - strain_rate.value_};
+  constexpr BasicStrainRate operator-(const BasicStrainRate& strain_rate) const noexcept {
+    return {this->value_ - strain_rate.value_};
   }
 
-  constexpr void operator-=(const StrainRate& strain_rate) noexcept {
-    value_ -= strain_rate.value_;
+  constexpr void operator-=(const BasicStrainRate& strain_rate) noexcept {
+    this->value_ -= strain_rate.value_;
   }
 
   constexpr Strain operator*(const Duration& duration) const noexcept {
@@ -64,10 +68,12 @@ public:
 
 protected:
 
-  constexpr StrainRate(const Value::SymmetricDyadic& value) noexcept : DimensionalSymmetricDyadicQuantity<Unit::Frequency>(value) {}
+  constexpr BasicStrainRate(const Value::BasicSymmetricDyadic<Number>& value) noexcept : DimensionalSymmetricDyadicQuantity<Unit::Frequency, Number>(value) {}
 
 };
 
+using StrainRate = BasicStrainRate<double>;
+
 template <> constexpr bool sort(const StrainRate& strain_rate_1, const StrainRate& strain_rate_2) noexcept {
   return sort(strain_rate_1.value(), strain_rate_2.value());
 }
@@ -96,9 +102,9 @@ constexpr StrainRate Frequency::operator*(const Strain& strain) const noexcept {
 
 namespace std {
 
-template <> struct hash<PhQ::StrainRate> {
-  size_t operator()(const PhQ::StrainRate& strain_rate) const {
-    return hash<PhQ::Value::SymmetricDyadic>()(strain_rate.value());
+template <typename Number> struct hash<PhQ::BasicStrainRate<Number>> {
+  size_t operator()(const PhQ::BasicStrainRate<Number>& strain_rate) const {
+    return hash<PhQ::Value::BasicSymmetricDyadic<Number>>()(strain_rate.value());
   }
 };
 
@@ -18,16 +18,18 @@ enum class System : uint_least8_t {
   InchPoundSecondRankine,
 };
 
-const System standard_system{System::MetreKilogramSecondKelvin};
+constexpr const System standard_system{System::MetreKilogramSecondKelvin};
 
-template <> const std::map<System, std::string> abbreviations<System>{
+template <> constexpr const std::array<std::pair<System, std::string_view>, 4> abbreviations<System>{{
   {System::MetreKilogramSecondKelvin, "m·kg·s·K"},
   {System::MillimetreGramSecondKelvin, "mm·g·s·K"},
   {System::FootPoundSecondRankine, "ft·lbf·s·°R"},
   {System::InchPoundSecondRankine, "in·lbf·s·°R"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<System>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, System> spellings<System>{
+template <> constexpr const std::array<std::pair<std::string_view, System>, 94> spellings<System>{{
   {"m·kg·s·K", System::MetreKilogramSecondKelvin},
   {"m-kg-s-K", System::MetreKilogramSecondKelvin},
   {"m kg s K", System::MetreKilogramSecondKelvin},
@@ -121,28 +123,30 @@ template <> const std::unordered_map<std::string, System> spellings<System>{
   {"in-lb", System::InchPoundSecondRankine},
   {"in lb", System::InchPoundSecondRankine},
   {"in, lb", System::InchPoundSecondRankine},
-  {"in", System::InchPoundSecondRankine},
-};
+  {"in", System::InchPoundSecondRankine}
+}};
 
-template <typename Unit> const std::map<System, Unit> consistent_units;
+/// \brief Unit of a given type in each unit system, listed in the order of the PhQ::System enumeration.
+template <typename Unit> constexpr const std::array<std::pair<System, Unit>, 0> consistent_units{};
 
 /// \brief Obtain a unit of a given type from a unit system.
 /// \details For example, PhQ::unit<Force>(PhQ::System::MetreKilogramSecondKelvin) returns PhQ::Unit::Force::Newton.
 template <typename Unit> constexpr Unit unit(const System& system) noexcept {
-  return consistent_units<Unit>.at(system);
+  return consistent_units<Unit>[static_cast<std::size_t>(system)].second;
 }
 
-template <typename Unit> const std::map<Unit, System> related_systems;
+/// \brief Units of a given type that are the consistent unit of a unit system, each with its unit system.
+template <typename Unit> constexpr const std::array<std::pair<Unit, System>, 0> related_systems{};
 
 /// \brief Obtain a unit system, if one exists, from a unit.
 /// \details For example, PhQ::system(PhQ::Unit::Length::Millimetre) returns PhQ::System::MillimetreGramSecondKelvin.
-template <typename Unit> std::optional<System> system(const Unit& unit) noexcept {
-  const typename std::map<Unit, System>::const_iterator system{related_systems<Unit>.find(unit)};
-  if (system != related_systems<Unit>.cend()) {
-    return {system->second};
-  } else {
-    return {};
+template <typename Unit> constexpr std::optional<System> system(const Unit& unit) noexcept {
+  for (const std::pair<Unit, System>& entry : related_systems<Unit>) {
+    if (entry.first == unit) {
+      return {entry.second};
+    }
   }
+  return {};
 }
 
 } // namespace PhQ
@@ -11,78 +11,84 @@
 
 namespace PhQ {
 
-class Temperature : public DimensionalScalarQuantity<Unit::Temperature> {
+/// \brief Temperature, whose value is stored as a given number type. PhQ::Temperature is the double-precision temperature used throughout the library; a PhQ::BasicTemperature<float> halves the memory of a large field of temperatures. Relations with other physical quantities, such as the difference of two temperatures, are defined for PhQ::Temperature.
+template <typename Number> class BasicTemperature : public DimensionalScalarQuantity<Unit::Temperature, Number> {
 
 public:
 
-  constexpr Temperature() noexcept : DimensionalScalarQuantity<Unit::Temperature>() {}
+  constexpr BasicTemperature() noexcept : DimensionalScalarQuantity<Unit::Temperature, Number>() {}
 
-  constexpr Temperature(double value, Unit::Temperature unit) noexcept : DimensionalScalarQuantity<Unit::Temperature>(value, unit) {}
+  constexpr BasicTemperature(Number value, Unit::Temperature unit) noexcept : DimensionalScalarQuantity<Unit::Temperature, Number>(value, unit) {}
 
-  constexpr bool operator==(const Temperature& temperature) const noexcept {
-    return value_ == temperature.value_;
+  /// \brief Explicit conversion from a temperature stored as another number type, such as widening single precision to double precision or narrowing double precision to single precision.
+  template <typename OtherNumber, std::enable_if_t<!std::is_same<OtherNumber, Number>::value, bool> = true> explicit constexpr BasicTemperature(const BasicTemperature<OtherNumber>& temperature) noexcept : BasicTemperature(static_cast<Number>(temperature.value())) {}
+
+  constexpr bool operator==(const BasicTemperature& temperature) const noexcept {
+    return this->value_ == temperature.value_;
   }
 
-  constexpr bool operator!=(const Temperature& temperature) const noexcept {
-    return value_ != temperature.value_;
+  constexpr bool operator!=(const BasicTemperature& temperature) const noexcept {
+    return this->value_ != temperature.value_;
   }
 
-  constexpr bool operator<(const Temperature& temperature) const noexcept {
-    return value_ < temperature.value_;
+  constexpr bool operator<(const BasicTemperature& temperature) const noexcept {
+    return this->value_ < temperature.value_;
   }
 
-  constexpr bool operator<=(const Temperature& temperature) const noexcept {
-    return value_ <= temperature.value_;
+  constexpr bool operator<=(const BasicTemperature& temperature) const noexcept {
+    return this->value_ <= temperature.value_;
   }
 
-  constexpr bool operator>(const Temperature& temperature) const noexcept {
-    return value_ > temperature.value_;
+  constexpr bool operator>(const BasicTemperature& temperature) const noexcept {
+    return this->value_ > temperature.value_;
   }
 
-  constexpr bool operator>=(const Temperature& temperature) const noexcept {
-    return value_ >= temperature.value_;
+  constexpr bool operator>=(const BasicTemperature& temperature) const noexcept {
+    return this->value_ >= temperature.value_;
   }
 
-  constexpr Temperature operator+(const Temperature& temperature) const noexcept {
-    return {value_ + temperature.value_};
+  constexpr BasicTemperature operator+(const BasicTemperature& temperature) const noexcept {
+    return {this->value_ + temperature.value_};
   }
 
-  constexpr Temperature operator+(const TemperatureDifference& temperature_difference) const noexcept {
-    return {value_ + temperature_difference.value()};
+  constexpr BasicTemperature operator+(const TemperatureDifference& temperature_difference) const noexcept {
+    return {this->value_ + temperature_difference.value()};
   }
 
-  constexpr void operator+=(const Temperature& temperature) noexcept {
-    value_ += temperature.value_;
+  constexpr void operator+=(const BasicTemperature& temperature) noexcept {
+    this->value_ += temperature.value_;
   }
 
   constexpr void operator+=(const TemperatureDifference& temperature_difference) noexcept {
-    value_ += temperature_difference.value();
+    this->value_ += temperature_difference.value();
   }
 
-  constexpr TemperatureDifference operator-(const Temperature& temperature) const noexcept {
-    return {value_ - temperature.value_};
+  constexpr TemperatureDifference operator-(const BasicTemperature& temperature) const noexcept {
+    return {this->value_ - temperature.value_};
   }
 
-  constexpr Temperature operator-(const TemperatureDifference& temperature_difference) const noexcept {
-    return {value_ - temperature_difference.value()};
+  constexpr BasicTemperature operator-(const TemperatureDifference& temperature_difference) const noexcept {
+    return {this->value_ - temperature_difference.value()};
   }
 
-  constexpr void operator-=(const Temperature& temperature) noexcept {
-    value_ -= temperature.value_;
+  constexpr void operator-=(const BasicTemperature& temperature) noexcept {
+    this->value_ -= temperature.value_;
   }
 
   constexpr void operator-=(const TemperatureDifference& temperature_difference) noexcept {
-    value_ -= temperature_difference.value();
+    this->value_ -= temperature_difference.value();
   }
 
 protected:
 
-  constexpr Temperature(double value) noexcept : DimensionalScalarQuantity<Unit::Temperature>(value) {}
+  constexpr BasicTemperature(Number value) noexcept : DimensionalScalarQuantity<Unit::Temperature, Number>(value) {}
 
   friend class TemperatureDifference;
 
 };
 
+using Temperature = BasicTemperature<double>;
+
 template <> constexpr bool sort(const Temperature& temperature_1, const Temperature& temperature_2) noexcept {
   return sort(temperature_1.value(), temperature_2.value());
 }
@@ -99,9 +105,9 @@ constexpr Temperature TemperatureDifference::operator-(const Temperature& temper
 
 namespace std {
 
-template <> struct hash<PhQ::Temperature> {
-  size_t operator()(const PhQ::Temperature& temperature) const {
-    return hash<double>()(temperature.value());
+template <typename Number> struct hash<PhQ::BasicTemperature<Number>> {
+  size_t operator()(const PhQ::BasicTemperature<Number>& temperature) const {
+    return hash<Number>()(temperature.value());
   }
 };
 
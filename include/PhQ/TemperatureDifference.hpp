@@ -15,7 +15,8 @@ namespace PhQ {
 class Length;
 class LinearThermalExpansionCoefficient;
 class StrainScalar;
-class Temperature;
+template <typename Number> class BasicTemperature;
+using Temperature = BasicTemperature<double>;
 class TemperatureGradientMagnitude;
 class VolumetricThermalExpansionCoefficient;
 
@@ -83,7 +84,7 @@ protected:
 
   constexpr TemperatureDifference(double value) noexcept : DimensionalScalarQuantity<Unit::TemperatureDifference>(value) {}
 
-  friend class Temperature;
+  template <typename Number> friend class BasicTemperature;
 
 };
 
@@ -18,6 +18,18 @@ enum class Type : uint_least8_t {
   IdealGas
 };
 
+/// \brief Lowercase label of each type of thermodynamic state model, listed in the order of the enumeration. Written as the type in the JSON and XML serializations of a thermodynamic state model, so that no lowercase copy of its abbreviation is built.
+constexpr const std::array<std::pair<Type, std::string_view>, 2> labels{{
+  {Type::IncompressibleFluid, "incompressible fluid"},
+  {Type::IdealGas, "ideal gas"}
+}};
+
+static_assert(is_indexed_by_enumeration(labels), "The labels table must be listed in the order of its enumeration.");
+
+constexpr std::string_view label(Type type) noexcept {
+  return labels[static_cast<std::size_t>(type)].second;
+}
+
 template <Type ThermodynamicStateModelType> class GenericThermodynamicStateModel {
 
 public:
@@ -40,12 +52,16 @@ protected:
 
 } // namespace ThermodynamicStateModel
 
-template <> const std::map<ThermodynamicStateModel::Type, std::string> abbreviations<ThermodynamicStateModel::Type>{
+template <> constexpr const std::array<std::pair<ThermodynamicStateModel::Type, std::string_view>, 2> abbreviations<ThermodynamicStateModel::Type>{{
   {ThermodynamicStateModel::Type::IncompressibleFluid, "Incompressible Fluid"},
   {ThermodynamicStateModel::Type::IdealGas, "Ideal Gas"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<ThermodynamicStateModel::Type>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, ThermodynamicStateModel::Type> spellings<ThermodynamicStateModel::Type>{
+static_assert(compare(ThermodynamicStateModel::label(ThermodynamicStateModel::Type::IncompressibleFluid), abbreviation(ThermodynamicStateModel::Type::IncompressibleFluid), true) == 0 && compare(ThermodynamicStateModel::label(ThermodynamicStateModel::Type::IdealGas), abbreviation(ThermodynamicStateModel::Type::IdealGas), true) == 0, "Each label must be the lowercase abbreviation of its type.");
+
+template <> constexpr const std::array<std::pair<std::string_view, ThermodynamicStateModel::Type>, 8> spellings<ThermodynamicStateModel::Type>{{
   {"Incompressible Fluid", ThermodynamicStateModel::Type::IncompressibleFluid},
   {"IncompressibleFluid", ThermodynamicStateModel::Type::IncompressibleFluid},
   {"incompressible fluid", ThermodynamicStateModel::Type::IncompressibleFluid},
@@ -54,7 +70,7 @@ template <> const std::unordered_map<std::string, ThermodynamicStateModel::Type>
   {"IdealGas", ThermodynamicStateModel::Type::IdealGas},
   {"ideal gas", ThermodynamicStateModel::Type::IdealGas},
   {"ideal_gas", ThermodynamicStateModel::Type::IdealGas}
-};
+}};
 
 } // namespace PhQ
 
@@ -63,15 +63,48 @@ public:
   }
 
   std::string print() const noexcept {
-    return {"R_gas = " + specific_gas_constant_.print() + ", c_p = " + specific_isobaric_heat_capacity_.print()};
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    append(output, "R_gas = ");
+    specific_gas_constant_.print(output);
+    append(output, ", c_p = ");
+    specific_isobaric_heat_capacity_.print(output);
   }
 
   std::string json() const noexcept {
-    return {"{\"type\": \"" + lowercase(abbreviation(type())) + "\", \"specific_gas_constant\": " + specific_gas_constant_.json()+ "\", \"specific_isobaric_heat_capacity\": " + specific_isobaric_heat_capacity_.json() + "}"};
+    std::string text;
+    json(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output) const noexcept {
+    append(output, "{\"type\": \"");
+    append(output, label(type()));
+    append(output, "\", \"specific_gas_constant\": ");
+    specific_gas_constant_.json(output);
+    append(output, ", \"specific_isobaric_heat_capacity\": ");
+    specific_isobaric_heat_capacity_.json(output);
+    append(output, "}");
   }
 
   std::string xml() const noexcept {
-    return {"<type>" + lowercase(abbreviation(type())) + "</type><specific_gas_constant>" + specific_gas_constant_.xml() + "</specific_gas_constant><specific_isobaric_heat_capacity>" + specific_isobaric_heat_capacity_.xml() + "</specific_isobaric_heat_capacity>"};
+    std::string text;
+    xml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output) const noexcept {
+    append(output, "<type>");
+    append(output, label(type()));
+    append(output, "</type><specific_gas_constant>");
+    specific_gas_constant_.xml(output);
+    append(output, "</specific_gas_constant><specific_isobaric_heat_capacity>");
+    specific_isobaric_heat_capacity_.xml(output);
+    append(output, "</specific_isobaric_heat_capacity>");
   }
 
 protected:
@@ -92,6 +125,19 @@ constexpr bool sort(const ThermodynamicStateModel::IdealGas& model_1, const Ther
   }
 }
 
+template <> struct Deserializer<ThermodynamicStateModel::IdealGas> {
+  static bool read(TextReader& reader, ThermodynamicStateModel::IdealGas& model) noexcept {
+    ThermodynamicStateModel::Type type;
+    SpecificGasConstant specific_gas_constant;
+    SpecificIsobaricHeatCapacity specific_isobaric_heat_capacity;
+    if (!(reader.begin_object() && reader.field("type", type) && type == ThermodynamicStateModel::Type::IdealGas && reader.separator() && reader.field("specific_gas_constant", specific_gas_constant) && reader.separator() && reader.field("specific_isobaric_heat_capacity", specific_isobaric_heat_capacity) && reader.end_object())) {
+      return false;
+    }
+    model = ThermodynamicStateModel::IdealGas{specific_gas_constant, specific_isobaric_heat_capacity};
+    return true;
+  }
+};
+
 } // namespace PhQ
 
 namespace std {
@@ -31,15 +31,48 @@ public:
   }
 
   std::string print() const noexcept {
-    return {"ρ = " + mass_density_.print() + ", c_p = " + specific_isobaric_heat_capacity_.print()};
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    append(output, "ρ = ");
+    mass_density_.print(output);
+    append(output, ", c_p = ");
+    specific_isobaric_heat_capacity_.print(output);
   }
 
   std::string json() const noexcept {
-    return {"{\"type\": \"" + lowercase(abbreviation(type())) + "\", \"mass_density\": " + mass_density_.json()+ "\", \"specific_isobaric_heat_capacity\": " + specific_isobaric_heat_capacity_.json() + "}"};
+    std::string text;
+    json(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void json(Sink& output) const noexcept {
+    append(output, "{\"type\": \"");
+    append(output, label(type()));
+    append(output, "\", \"mass_density\": ");
+    mass_density_.json(output);
+    append(output, ", \"specific_isobaric_heat_capacity\": ");
+    specific_isobaric_heat_capacity_.json(output);
+    append(output, "}");
   }
 
   std::string xml() const noexcept {
-    return {"<type>" + lowercase(abbreviation(type())) + "</type><mass_density>" + specific_isobaric_heat_capacity_.xml() + "</mass_density><specific_isobaric_heat_capacity>" + specific_isobaric_heat_capacity_.xml() + "</specific_isobaric_heat_capacity>"};
+    std::string text;
+    xml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<is_text_sink<Sink>, bool> = true> void xml(Sink& output) const noexcept {
+    append(output, "<type>");
+    append(output, label(type()));
+    append(output, "</type><mass_density>");
+    mass_density_.xml(output);
+    append(output, "</mass_density><specific_isobaric_heat_capacity>");
+    specific_isobaric_heat_capacity_.xml(output);
+    append(output, "</specific_isobaric_heat_capacity>");
   }
 
 protected:
@@ -60,6 +93,19 @@ constexpr bool sort(const ThermodynamicStateModel::IncompressibleFluid& model_1,
   }
 }
 
+template <> struct Deserializer<ThermodynamicStateModel::IncompressibleFluid> {
+  static bool read(TextReader& reader, ThermodynamicStateModel::IncompressibleFluid& model) noexcept {
+    ThermodynamicStateModel::Type type;
+    MassDensity mass_density;
+    SpecificIsobaricHeatCapacity specific_isobaric_heat_capacity;
+    if (!(reader.begin_object() && reader.field("type", type) && type == ThermodynamicStateModel::Type::IncompressibleFluid && reader.separator() && reader.field("mass_density", mass_density) && reader.separator() && reader.field("specific_isobaric_heat_capacity", specific_isobaric_heat_capacity) && reader.end_object())) {
+      return false;
+    }
+    model = ThermodynamicStateModel::IncompressibleFluid{mass_density, specific_isobaric_heat_capacity};
+    return true;
+  }
+};
+
 } // namespace PhQ
 
 namespace std {
@@ -7,6 +7,8 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -29,7 +31,7 @@ enum class Acceleration : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::Acceleration, std::string> abbreviations<Unit::Acceleration>{
+template <> constexpr const std::array<std::pair<Unit::Acceleration, std::string_view>, 12> abbreviations<Unit::Acceleration>{{
   {Unit::Acceleration::MilePerSquareSecond, "mi/s^2"},
   {Unit::Acceleration::KilometrePerSquareSecond, "km/s^2"},
   {Unit::Acceleration::YardPerSquareSecond, "yd/s^2"},
@@ -42,9 +44,11 @@ template <> const std::map<Unit::Acceleration, std::string> abbreviations<Unit::
   {Unit::Acceleration::MilliinchPerSquareSecond, "thou/s^2"},
   {Unit::Acceleration::MicrometrePerSquareSecond, "μm/s^2"},
   {Unit::Acceleration::MicroinchPerSquareSecond, "μin/s^2"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::Acceleration>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::Acceleration> spellings<Unit::Acceleration>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::Acceleration>, 102> spellings<Unit::Acceleration>{{
   {"mi/s^2", Unit::Acceleration::MilePerSquareSecond},
   {"mi/s2", Unit::Acceleration::MilePerSquareSecond},
   {"mi/s/s", Unit::Acceleration::MilePerSquareSecond},
@@ -147,195 +151,41 @@ template <> const std::unordered_map<std::string, Unit::Acceleration> spellings<
   {"uin/sec^2", Unit::Acceleration::MicroinchPerSquareSecond},
   {"uin/sec2", Unit::Acceleration::MicroinchPerSquareSecond},
   {"uin/sec/sec", Unit::Acceleration::MicroinchPerSquareSecond}
-};
+}};
 
-template <> const std::map<System, Unit::Acceleration> consistent_units<Unit::Acceleration>{
+template <> constexpr const std::array<std::pair<System, Unit::Acceleration>, 4> consistent_units<Unit::Acceleration>{{
   {System::MetreKilogramSecondKelvin, Unit::Acceleration::MetrePerSquareSecond},
   {System::MillimetreGramSecondKelvin, Unit::Acceleration::MillimetrePerSquareSecond},
   {System::FootPoundSecondRankine, Unit::Acceleration::FootPerSquareSecond},
   {System::InchPoundSecondRankine, Unit::Acceleration::InchPerSquareSecond}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::Acceleration>), "The consistent_units table must be listed in the order of its enumeration.");
 
-template <> const std::map<Unit::Acceleration, System> related_systems<Unit::Acceleration>{
+template <> constexpr const std::array<std::pair<Unit::Acceleration, System>, 4> related_systems<Unit::Acceleration>{{
   {Unit::Acceleration::MetrePerSquareSecond, System::MetreKilogramSecondKelvin},
   {Unit::Acceleration::MillimetrePerSquareSecond, System::MillimetreGramSecondKelvin},
   {Unit::Acceleration::FootPerSquareSecond, System::FootPoundSecondRankine},
-  {Unit::Acceleration::InchPerSquareSecond, System::InchPoundSecondRankine},
-};
+  {Unit::Acceleration::InchPerSquareSecond, System::InchPoundSecondRankine}
+}};
 
 template <> constexpr const Unit::Acceleration standard_unit<Unit::Acceleration>{Unit::Acceleration::MetrePerSquareSecond};
 
 template <> constexpr const Dimension::Set dimension<Unit::Acceleration>{Dimension::Set{Dimension::Length{1}, Dimension::Mass{}, Dimension::Time{-2}}};
 
-template <> const std::map<Unit::Acceleration, std::map<Unit::Acceleration, std::function<void(std::vector<double>&)>>> conversions<Unit::Acceleration>{
-  {Unit::Acceleration::MilePerSquareSecond, {
-    {Unit::Acceleration::MilePerSquareSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Acceleration::KilometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.609344;});}},
-    {Unit::Acceleration::YardPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1760.0;});}},
-    {Unit::Acceleration::MetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1609.344;});}},
-    {Unit::Acceleration::FootPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 5280.0;});}},
-    {Unit::Acceleration::DecimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 16093.44;});}},
-    {Unit::Acceleration::InchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 63360.0;});}},
-    {Unit::Acceleration::CentimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 160934.4;});}},
-    {Unit::Acceleration::MillimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1609344.0;});}},
-    {Unit::Acceleration::MilliinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 63360000.0;});}},
-    {Unit::Acceleration::MicrometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1609344000.0;});}},
-    {Unit::Acceleration::MicroinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 63360000000.0;});}}
-  }},
-  {Unit::Acceleration::KilometrePerSquareSecond, {
-    {Unit::Acceleration::MilePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.609344;});}},
-    {Unit::Acceleration::KilometrePerSquareSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Acceleration::YardPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0009144;});}},
-    {Unit::Acceleration::MetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::Acceleration::FootPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0003048;});}},
-    {Unit::Acceleration::DecimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10000.0;});}},
-    {Unit::Acceleration::InchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0000254;});}},
-    {Unit::Acceleration::CentimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 100000.0;});}},
-    {Unit::Acceleration::MillimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0;});}},
-    {Unit::Acceleration::MilliinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0000000254;});}},
-    {Unit::Acceleration::MicrometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000000.0;});}},
-    {Unit::Acceleration::MicroinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0000000000254;});}}
-  }},
-  {Unit::Acceleration::YardPerSquareSecond, {
-    {Unit::Acceleration::MilePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1760.0;});}},
-    {Unit::Acceleration::KilometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0009144;});}},
-    {Unit::Acceleration::YardPerSquareSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Acceleration::MetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.9144;});}},
-    {Unit::Acceleration::FootPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3.0;});}},
-    {Unit::Acceleration::DecimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 9.144;});}},
-    {Unit::Acceleration::InchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 36.0;});}},
-    {Unit::Acceleration::CentimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 91.44;});}},
-    {Unit::Acceleration::MillimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 914.4;});}},
-    {Unit::Acceleration::MilliinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 36000.0;});}},
-    {Unit::Acceleration::MicrometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 914400.0;});}},
-    {Unit::Acceleration::MicroinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 36000000.0;});}}
-  }},
-  {Unit::Acceleration::MetrePerSquareSecond, {
-    {Unit::Acceleration::MilePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1609.344;});}},
-    {Unit::Acceleration::KilometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Acceleration::YardPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.9144;});}},
-    {Unit::Acceleration::MetrePerSquareSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Acceleration::FootPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.3048;});}},
-    {Unit::Acceleration::DecimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10.0;});}},
-    {Unit::Acceleration::InchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0254;});}},
-    {Unit::Acceleration::CentimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 100.0;});}},
-    {Unit::Acceleration::MillimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::Acceleration::MilliinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0000254;});}},
-    {Unit::Acceleration::MicrometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0;});}},
-    {Unit::Acceleration::MicroinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0000000254;});}}
-  }},
-  {Unit::Acceleration::FootPerSquareSecond, {
-    {Unit::Acceleration::MilePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 5280.0;});}},
-    {Unit::Acceleration::KilometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0003048;});}},
-    {Unit::Acceleration::YardPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 3.0;});}},
-    {Unit::Acceleration::MetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.3048;});}},
-    {Unit::Acceleration::FootPerSquareSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Acceleration::DecimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3.048;});}},
-    {Unit::Acceleration::InchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12.0;});}},
-    {Unit::Acceleration::CentimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 30.48;});}},
-    {Unit::Acceleration::MillimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 304.8;});}},
-    {Unit::Acceleration::MilliinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12000.0;});}},
-    {Unit::Acceleration::MicrometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 304800.0;});}},
-    {Unit::Acceleration::MicroinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12000000.0;});}}
-  }},
-  {Unit::Acceleration::DecimetrePerSquareSecond, {
-    {Unit::Acceleration::MilePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 16093.44;});}},
-    {Unit::Acceleration::KilometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0001;});}},
-    {Unit::Acceleration::YardPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 9.144;});}},
-    {Unit::Acceleration::MetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.1;});}},
-    {Unit::Acceleration::FootPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 3.048;});}},
-    {Unit::Acceleration::DecimetrePerSquareSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Acceleration::InchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.254;});}},
-    {Unit::Acceleration::CentimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10.0;});}},
-    {Unit::Acceleration::MillimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 100.0;});}},
-    {Unit::Acceleration::MilliinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.000254;});}},
-    {Unit::Acceleration::MicrometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 100000.0;});}},
-    {Unit::Acceleration::MicroinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.000000254;});}}
-  }},
-  {Unit::Acceleration::InchPerSquareSecond, {
-    {Unit::Acceleration::MilePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 63360.0;});}},
-    {Unit::Acceleration::KilometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0000254;});}},
-    {Unit::Acceleration::YardPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 36.0;});}},
-    {Unit::Acceleration::MetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254;});}},
-    {Unit::Acceleration::FootPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12.0;});}},
-    {Unit::Acceleration::DecimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.254;});}},
-    {Unit::Acceleration::InchPerSquareSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Acceleration::CentimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 2.54;});}},
-    {Unit::Acceleration::MillimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 25.4;});}},
-    {Unit::Acceleration::MilliinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::Acceleration::MicrometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 25400.0;});}},
-    {Unit::Acceleration::MicroinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0;});}}
-  }},
-  {Unit::Acceleration::CentimetrePerSquareSecond, {
-    {Unit::Acceleration::MilePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 160934.4;});}},
-    {Unit::Acceleration::KilometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.00001;});}},
-    {Unit::Acceleration::YardPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 91.44;});}},
-    {Unit::Acceleration::MetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.01;});}},
-    {Unit::Acceleration::FootPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 30.48;});}},
-    {Unit::Acceleration::DecimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.1;});}},
-    {Unit::Acceleration::InchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 2.54;});}},
-    {Unit::Acceleration::CentimetrePerSquareSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Acceleration::MillimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10.0;});}},
-    {Unit::Acceleration::MilliinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.00254;});}},
-    {Unit::Acceleration::MicrometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10000.0;});}},
-    {Unit::Acceleration::MicroinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.00000254;});}}
-  }},
-  {Unit::Acceleration::MillimetrePerSquareSecond, {
-    {Unit::Acceleration::MilePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1609344.0;});}},
-    {Unit::Acceleration::KilometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001;});}},
-    {Unit::Acceleration::YardPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 914.4;});}},
-    {Unit::Acceleration::MetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Acceleration::FootPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 304.8;});}},
-    {Unit::Acceleration::DecimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.01;});}},
-    {Unit::Acceleration::InchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 25.4;});}},
-    {Unit::Acceleration::CentimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.1;});}},
-    {Unit::Acceleration::MillimetrePerSquareSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Acceleration::MilliinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0254;});}},
-    {Unit::Acceleration::MicrometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::Acceleration::MicroinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0000254;});}}
-  }},
-  {Unit::Acceleration::MilliinchPerSquareSecond, {
-    {Unit::Acceleration::MilePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 63360000.0;});}},
-    {Unit::Acceleration::KilometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0000000254;});}},
-    {Unit::Acceleration::YardPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 36000.0;});}},
-    {Unit::Acceleration::MetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0000254;});}},
-    {Unit::Acceleration::FootPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12000.0;});}},
-    {Unit::Acceleration::DecimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000254;});}},
-    {Unit::Acceleration::InchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Acceleration::CentimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.00254;});}},
-    {Unit::Acceleration::MillimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254;});}},
-    {Unit::Acceleration::MilliinchPerSquareSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Acceleration::MicrometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 25.4;});}},
-    {Unit::Acceleration::MicroinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}}
-  }},
-  {Unit::Acceleration::MicrometrePerSquareSecond, {
-    {Unit::Acceleration::MilePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1609344000.0;});}},
-    {Unit::Acceleration::KilometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000000001;});}},
-    {Unit::Acceleration::YardPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 914400.0;});}},
-    {Unit::Acceleration::MetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001;});}},
-    {Unit::Acceleration::FootPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 304800.0;});}},
-    {Unit::Acceleration::DecimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.00001;});}},
-    {Unit::Acceleration::InchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 25400.0;});}},
-    {Unit::Acceleration::CentimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0001;});}},
-    {Unit::Acceleration::MillimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Acceleration::MilliinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 25.4;});}},
-    {Unit::Acceleration::MicrometrePerSquareSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Acceleration::MicroinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0254;});}}
-  }},
-  {Unit::Acceleration::MicroinchPerSquareSecond, {
-    {Unit::Acceleration::MilePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 63360000000.0;});}},
-    {Unit::Acceleration::KilometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0000000000254;});}},
-    {Unit::Acceleration::YardPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 36000000.0;});}},
-    {Unit::Acceleration::MetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0000000254;});}},
-    {Unit::Acceleration::FootPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12000000.0;});}},
-    {Unit::Acceleration::DecimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000000254;});}},
-    {Unit::Acceleration::InchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001;});}},
-    {Unit::Acceleration::CentimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.00000254;});}},
-    {Unit::Acceleration::MillimetrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0000254;});}},
-    {Unit::Acceleration::MilliinchPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Acceleration::MicrometrePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254;});}},
-    {Unit::Acceleration::MicroinchPerSquareSecond, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 12> conversion_factors<Unit::Acceleration>{
+  derived_conversion_factor<Unit::Acceleration>(Unit::Length::Mile, Unit::Time::Second),
+  derived_conversion_factor<Unit::Acceleration>(Unit::Length::Kilometre, Unit::Time::Second),
+  derived_conversion_factor<Unit::Acceleration>(Unit::Length::Yard, Unit::Time::Second),
+  derived_conversion_factor<Unit::Acceleration>(Unit::Length::Metre, Unit::Time::Second),
+  derived_conversion_factor<Unit::Acceleration>(Unit::Length::Foot, Unit::Time::Second),
+  derived_conversion_factor<Unit::Acceleration>(Unit::Length::Decimetre, Unit::Time::Second),
+  derived_conversion_factor<Unit::Acceleration>(Unit::Length::Inch, Unit::Time::Second),
+  derived_conversion_factor<Unit::Acceleration>(Unit::Length::Centimetre, Unit::Time::Second),
+  derived_conversion_factor<Unit::Acceleration>(Unit::Length::Millimetre, Unit::Time::Second),
+  derived_conversion_factor<Unit::Acceleration>(Unit::Length::Milliinch, Unit::Time::Second),
+  derived_conversion_factor<Unit::Acceleration>(Unit::Length::Micrometre, Unit::Time::Second),
+  derived_conversion_factor<Unit::Acceleration>(Unit::Length::Microinch, Unit::Time::Second)
 };
 
 } // namespace PhQ
@@ -21,14 +21,16 @@ enum class Angle : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::Angle, std::string> abbreviations<Unit::Angle>{
+template <> constexpr const std::array<std::pair<Unit::Angle, std::string_view>, 4> abbreviations<Unit::Angle>{{
   {Unit::Angle::Radian, "rad"},
   {Unit::Angle::Degree, "deg"},
   {Unit::Angle::Arcminute, "arcmin"},
   {Unit::Angle::Arcsecond, "arcsec"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::Angle>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::Angle> spellings<Unit::Angle>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::Angle>, 18> spellings<Unit::Angle>{{
   {"rad", Unit::Angle::Radian},
   {"radian", Unit::Angle::Radian},
   {"radians", Unit::Angle::Radian},
@@ -47,44 +49,28 @@ template <> const std::unordered_map<std::string, Unit::Angle> spellings<Unit::A
   {"arcsec", Unit::Angle::Arcsecond},
   {"arcsecond", Unit::Angle::Arcsecond},
   {"arcseconds", Unit::Angle::Arcsecond}
-};
+}};
 
-template <> const std::map<System, Unit::Angle> consistent_units<Unit::Angle>{
+template <> constexpr const std::array<std::pair<System, Unit::Angle>, 4> consistent_units<Unit::Angle>{{
   {System::MetreKilogramSecondKelvin, Unit::Angle::Radian},
   {System::MillimetreGramSecondKelvin, Unit::Angle::Radian},
   {System::FootPoundSecondRankine, Unit::Angle::Radian},
   {System::InchPoundSecondRankine, Unit::Angle::Radian}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::Angle>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::Angle standard_unit<Unit::Angle>{Unit::Angle::Radian};
 
 template <> constexpr const Dimension::Set dimension<Unit::Angle>{Dimension::Set{}};
 
-template <> const std::map<Unit::Angle, std::map<Unit::Angle, std::function<void(std::vector<double>&)>>> conversions<Unit::Angle>{
-  {Unit::Angle::Radian, {
-    {Unit::Angle::Radian, [](std::vector<double>& values)->void{}},
-    {Unit::Angle::Degree, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 180.0 / Pi;});}},
-    {Unit::Angle::Arcminute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10800.0 / Pi;});}},
-    {Unit::Angle::Arcsecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 648000.0 / Pi;});}}
-  }},
-  {Unit::Angle::Degree, {
-    {Unit::Angle::Radian, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 180.0;});}},
-    {Unit::Angle::Degree, [](std::vector<double>& values)->void{}},
-    {Unit::Angle::Arcminute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 60.0;});}},
-    {Unit::Angle::Arcsecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3600.0;});}}
-  }},
-  {Unit::Angle::Arcminute, {
-    {Unit::Angle::Radian, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 10800.0;});}},
-    {Unit::Angle::Degree, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 60.0;});}},
-    {Unit::Angle::Arcminute, [](std::vector<double>& values)->void{}},
-    {Unit::Angle::Arcsecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 60.0;});}}
-  }},
-  {Unit::Angle::Arcsecond, {
-    {Unit::Angle::Radian, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 648000.0;});}},
-    {Unit::Angle::Degree, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 3600.0;});}},
-    {Unit::Angle::Arcminute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 60.0;});}},
-    {Unit::Angle::Arcsecond, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr bool has_ambiguous_dimension<Unit::Angle>{true};
+
+template <> constexpr const std::array<ConversionFactor, 4> conversion_factors<Unit::Angle>{
+  ConversionFactor{1.0},
+  ConversionFactor{Pi / 180.0},
+  ConversionFactor{Pi / 10800.0},
+  ConversionFactor{Pi / 648000.0}
 };
 
 } // namespace PhQ
@@ -7,6 +7,8 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Angle.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -26,7 +28,7 @@ enum class AngularAcceleration : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::AngularAcceleration, std::string> abbreviations<Unit::AngularAcceleration>{
+template <> constexpr const std::array<std::pair<Unit::AngularAcceleration, std::string_view>, 9> abbreviations<Unit::AngularAcceleration>{{
   {Unit::AngularAcceleration::RadianPerSquareSecond, "rad/s^2"},
   {Unit::AngularAcceleration::RadianPerSquareMinute, "rad/min^2"},
   {Unit::AngularAcceleration::RadianPerSquareHour, "rad/hr^2"},
@@ -35,10 +37,12 @@ template <> const std::map<Unit::AngularAcceleration, std::string> abbreviations
   {Unit::AngularAcceleration::DegreePerSquareHour, "deg/hr^2"},
   {Unit::AngularAcceleration::RevolutionPerSquareSecond, "rev/s^2"},
   {Unit::AngularAcceleration::RevolutionPerSquareMinute, "rev/min^2"},
-  {Unit::AngularAcceleration::RevolutionPerSquareHour, "rev/hr^2"},
-};
+  {Unit::AngularAcceleration::RevolutionPerSquareHour, "rev/hr^2"}
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::AngularAcceleration>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::AngularAcceleration> spellings<Unit::AngularAcceleration>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::AngularAcceleration>, 48> spellings<Unit::AngularAcceleration>{{
   {"rad/s^2", Unit::AngularAcceleration::RadianPerSquareSecond},
   {"rad/s2", Unit::AngularAcceleration::RadianPerSquareSecond},
   {"rad/s/s", Unit::AngularAcceleration::RadianPerSquareSecond},
@@ -87,119 +91,33 @@ template <> const std::unordered_map<std::string, Unit::AngularAcceleration> spe
   {"rev/hr^2", Unit::AngularAcceleration::RevolutionPerSquareHour},
   {"rev/hr2", Unit::AngularAcceleration::RevolutionPerSquareHour},
   {"rev/hr/hr", Unit::AngularAcceleration::RevolutionPerSquareHour}
-};
+}};
 
-template <> const std::map<System, Unit::AngularAcceleration> consistent_units<Unit::AngularAcceleration>{
+template <> constexpr const std::array<std::pair<System, Unit::AngularAcceleration>, 4> consistent_units<Unit::AngularAcceleration>{{
   {System::MetreKilogramSecondKelvin, Unit::AngularAcceleration::RadianPerSquareSecond},
   {System::MillimetreGramSecondKelvin, Unit::AngularAcceleration::RadianPerSquareSecond},
   {System::FootPoundSecondRankine, Unit::AngularAcceleration::RadianPerSquareSecond},
   {System::InchPoundSecondRankine, Unit::AngularAcceleration::RadianPerSquareSecond}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::AngularAcceleration>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::AngularAcceleration standard_unit<Unit::AngularAcceleration>{Unit::AngularAcceleration::RadianPerSquareSecond};
 
 template <> constexpr const Dimension::Set dimension<Unit::AngularAcceleration>{Dimension::Set{Dimension::Length{}, Dimension::Mass{}, Dimension::Time{-2}}};
 
-template <> const std::map<Unit::AngularAcceleration, std::map<Unit::AngularAcceleration, std::function<void(std::vector<double>&)>>> conversions<Unit::AngularAcceleration>{
-  {Unit::AngularAcceleration::RadianPerSquareSecond, {
-    {Unit::AngularAcceleration::RadianPerSquareSecond, [](std::vector<double>& values)->void{}},
-    {Unit::AngularAcceleration::RadianPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3600.0;});}},
-    {Unit::AngularAcceleration::RadianPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12960000.0;});}},
-    {Unit::AngularAcceleration::DegreePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 180.0 / Pi;});}},
-    {Unit::AngularAcceleration::DegreePerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 648000.0 / Pi;});}},
-    {Unit::AngularAcceleration::DegreePerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 2332800000.0 / Pi;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.5 / Pi;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1800.0 / Pi;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 6480000.0 / Pi;});}}
-  }},
-  {Unit::AngularAcceleration::RadianPerSquareMinute, {
-    {Unit::AngularAcceleration::RadianPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 3600.0;});}},
-    {Unit::AngularAcceleration::RadianPerSquareMinute, [](std::vector<double>& values)->void{}},
-    {Unit::AngularAcceleration::RadianPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3600.0;});}},
-    {Unit::AngularAcceleration::DegreePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.05 / Pi;});}},
-    {Unit::AngularAcceleration::DegreePerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 180.0 / Pi;});}},
-    {Unit::AngularAcceleration::DegreePerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 648000.0 / Pi;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 7200.0 * Pi;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.5 / Pi;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1800.0 / Pi;});}}
-  }},
-  {Unit::AngularAcceleration::RadianPerSquareHour, {
-    {Unit::AngularAcceleration::RadianPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12960000.0;});}},
-    {Unit::AngularAcceleration::RadianPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 3600.0;});}},
-    {Unit::AngularAcceleration::RadianPerSquareHour, [](std::vector<double>& values)->void{}},
-    {Unit::AngularAcceleration::DegreePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 72000.0 * Pi;});}},
-    {Unit::AngularAcceleration::DegreePerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.05 / Pi;});}},
-    {Unit::AngularAcceleration::DegreePerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 180.0 / Pi;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 25920000.0 * Pi;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 7200.0 * Pi;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.5 / Pi;});}}
-  }},
-  {Unit::AngularAcceleration::DegreePerSquareSecond, {
-    {Unit::AngularAcceleration::RadianPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 180.0;});}},
-    {Unit::AngularAcceleration::RadianPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 20.0 * Pi;});}},
-    {Unit::AngularAcceleration::RadianPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 72000.0 * Pi;});}},
-    {Unit::AngularAcceleration::DegreePerSquareSecond, [](std::vector<double>& values)->void{}},
-    {Unit::AngularAcceleration::DegreePerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3600.0;});}},
-    {Unit::AngularAcceleration::DegreePerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12960000.0;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 360.0;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10.0;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 36000.0;});}}
-  }},
-  {Unit::AngularAcceleration::DegreePerSquareMinute, {
-    {Unit::AngularAcceleration::RadianPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 648000.0;});}},
-    {Unit::AngularAcceleration::RadianPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 180.0;});}},
-    {Unit::AngularAcceleration::RadianPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 20.0 * Pi;});}},
-    {Unit::AngularAcceleration::DegreePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 3600.0;});}},
-    {Unit::AngularAcceleration::DegreePerSquareMinute, [](std::vector<double>& values)->void{}},
-    {Unit::AngularAcceleration::DegreePerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3600.0;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1296000.0;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 360.0;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10.0;});}}
-  }},
-  {Unit::AngularAcceleration::DegreePerSquareHour, {
-    {Unit::AngularAcceleration::RadianPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 2332800000.0;});}},
-    {Unit::AngularAcceleration::RadianPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 648000.0;});}},
-    {Unit::AngularAcceleration::RadianPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 180.0;});}},
-    {Unit::AngularAcceleration::DegreePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12960000.0;});}},
-    {Unit::AngularAcceleration::DegreePerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 3600.0;});}},
-    {Unit::AngularAcceleration::DegreePerSquareHour, [](std::vector<double>& values)->void{}},
-    {Unit::AngularAcceleration::RevolutionPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 4665600000.0;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1296000.0;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 360.0;});}}
-  }},
-  {Unit::AngularAcceleration::RevolutionPerSquareSecond, {
-    {Unit::AngularAcceleration::RadianPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 2.0 * Pi;});}},
-    {Unit::AngularAcceleration::RadianPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 7200.0 * Pi;});}},
-    {Unit::AngularAcceleration::RadianPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 25920000.0 * Pi;});}},
-    {Unit::AngularAcceleration::DegreePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 360.0;});}},
-    {Unit::AngularAcceleration::DegreePerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1296000.0;});}},
-    {Unit::AngularAcceleration::DegreePerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 4665600000.0;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareSecond, [](std::vector<double>& values)->void{}},
-    {Unit::AngularAcceleration::RevolutionPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3600.0;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12960000.0;});}}
-  }},
-  {Unit::AngularAcceleration::RevolutionPerSquareMinute, {
-    {Unit::AngularAcceleration::RadianPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 1800.0;});}},
-    {Unit::AngularAcceleration::RadianPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 2.0 * Pi;});}},
-    {Unit::AngularAcceleration::RadianPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 7200.0 * Pi;});}},
-    {Unit::AngularAcceleration::DegreePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.1;});}},
-    {Unit::AngularAcceleration::DegreePerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 360.0;});}},
-    {Unit::AngularAcceleration::DegreePerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1296000.0;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 3600.0;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareMinute, [](std::vector<double>& values)->void{}},
-    {Unit::AngularAcceleration::RevolutionPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3600.0;});}}
-  }},
-  {Unit::AngularAcceleration::RevolutionPerSquareHour, {
-    {Unit::AngularAcceleration::RadianPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 6480000.0;});}},
-    {Unit::AngularAcceleration::RadianPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 1800.0;});}},
-    {Unit::AngularAcceleration::RadianPerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 2.0 * Pi;});}},
-    {Unit::AngularAcceleration::DegreePerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 36000;});}},
-    {Unit::AngularAcceleration::DegreePerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.1;});}},
-    {Unit::AngularAcceleration::DegreePerSquareHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 360.0;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12960000.0;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 3600.0;});}},
-    {Unit::AngularAcceleration::RevolutionPerSquareHour, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr bool has_ambiguous_dimension<Unit::AngularAcceleration>{true};
+
+template <> constexpr const std::array<ConversionFactor, 9> conversion_factors<Unit::AngularAcceleration>{
+  derived_conversion_factor<Unit::AngularAcceleration>(Unit::Angle::Radian, Unit::Time::Second),
+  derived_conversion_factor<Unit::AngularAcceleration>(Unit::Angle::Radian, Unit::Time::Minute),
+  derived_conversion_factor<Unit::AngularAcceleration>(Unit::Angle::Radian, Unit::Time::Hour),
+  derived_conversion_factor<Unit::AngularAcceleration>(Unit::Angle::Degree, Unit::Time::Second),
+  derived_conversion_factor<Unit::AngularAcceleration>(Unit::Angle::Degree, Unit::Time::Minute),
+  derived_conversion_factor<Unit::AngularAcceleration>(Unit::Angle::Degree, Unit::Time::Hour),
+  derived_conversion_factor<Unit::AngularAcceleration>(2.0 * Pi, Unit::Angle::Radian, Unit::Time::Second),
+  derived_conversion_factor<Unit::AngularAcceleration>(2.0 * Pi, Unit::Angle::Radian, Unit::Time::Minute),
+  derived_conversion_factor<Unit::AngularAcceleration>(2.0 * Pi, Unit::Angle::Radian, Unit::Time::Hour)
 };
 
 } // namespace PhQ
@@ -7,6 +7,8 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Angle.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -26,7 +28,7 @@ enum class AngularSpeed : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::AngularSpeed, std::string> abbreviations<Unit::AngularSpeed>{
+template <> constexpr const std::array<std::pair<Unit::AngularSpeed, std::string_view>, 9> abbreviations<Unit::AngularSpeed>{{
   {Unit::AngularSpeed::RadianPerSecond, "rad/s"},
   {Unit::AngularSpeed::RadianPerMinute, "rad/min"},
   {Unit::AngularSpeed::RadianPerHour, "rad/hr"},
@@ -35,10 +37,12 @@ template <> const std::map<Unit::AngularSpeed, std::string> abbreviations<Unit::
   {Unit::AngularSpeed::DegreePerHour, "deg/hr"},
   {Unit::AngularSpeed::RevolutionPerSecond, "rev/s"},
   {Unit::AngularSpeed::RevolutionPerMinute, "rev/min"},
-  {Unit::AngularSpeed::RevolutionPerHour, "rev/hr"},
-};
+  {Unit::AngularSpeed::RevolutionPerHour, "rev/hr"}
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::AngularSpeed>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::AngularSpeed> spellings<Unit::AngularSpeed>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::AngularSpeed>, 16> spellings<Unit::AngularSpeed>{{
   {"rad/s", Unit::AngularSpeed::RadianPerSecond},
   {"rad/sec", Unit::AngularSpeed::RadianPerSecond},
   {"rad/min", Unit::AngularSpeed::RadianPerMinute},
@@ -55,119 +59,33 @@ template <> const std::unordered_map<std::string, Unit::AngularSpeed> spellings<
   {"rev/sec", Unit::AngularSpeed::RevolutionPerSecond},
   {"rev/min", Unit::AngularSpeed::RevolutionPerMinute},
   {"rev/hr", Unit::AngularSpeed::RevolutionPerHour}
-};
+}};
 
-template <> const std::map<System, Unit::AngularSpeed> consistent_units<Unit::AngularSpeed>{
+template <> constexpr const std::array<std::pair<System, Unit::AngularSpeed>, 4> consistent_units<Unit::AngularSpeed>{{
   {System::MetreKilogramSecondKelvin, Unit::AngularSpeed::RadianPerSecond},
   {System::MillimetreGramSecondKelvin, Unit::AngularSpeed::RadianPerSecond},
   {System::FootPoundSecondRankine, Unit::AngularSpeed::RadianPerSecond},
   {System::InchPoundSecondRankine, Unit::AngularSpeed::RadianPerSecond}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::AngularSpeed>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::AngularSpeed standard_unit<Unit::AngularSpeed>{Unit::AngularSpeed::RadianPerSecond};
 
 template <> constexpr const Dimension::Set dimension<Unit::AngularSpeed>{Dimension::Set{Dimension::Length{}, Dimension::Mass{}, Dimension::Time{-1}}};
 
-template <> const std::map<Unit::AngularSpeed, std::map<Unit::AngularSpeed, std::function<void(std::vector<double>&)>>> conversions<Unit::AngularSpeed>{
-  {Unit::AngularSpeed::RadianPerSecond, {
-    {Unit::AngularSpeed::RadianPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::AngularSpeed::RadianPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 60.0;});}},
-    {Unit::AngularSpeed::RadianPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3600.0;});}},
-    {Unit::AngularSpeed::DegreePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 180.0 / Pi;});}},
-    {Unit::AngularSpeed::DegreePerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10800.0 / Pi;});}},
-    {Unit::AngularSpeed::DegreePerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 648000.0 / Pi;});}},
-    {Unit::AngularSpeed::RevolutionPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.5 / Pi;});}},
-    {Unit::AngularSpeed::RevolutionPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 30.0 / Pi;});}},
-    {Unit::AngularSpeed::RevolutionPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1800.0 / Pi;});}}
-  }},
-  {Unit::AngularSpeed::RadianPerMinute, {
-    {Unit::AngularSpeed::RadianPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 60.0;});}},
-    {Unit::AngularSpeed::RadianPerMinute, [](std::vector<double>& values)->void{}},
-    {Unit::AngularSpeed::RadianPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 60.0;});}},
-    {Unit::AngularSpeed::DegreePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3.0 / Pi;});}},
-    {Unit::AngularSpeed::DegreePerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 180.0 / Pi;});}},
-    {Unit::AngularSpeed::DegreePerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10800.0 / Pi;});}},
-    {Unit::AngularSpeed::RevolutionPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 120.0 * Pi;});}},
-    {Unit::AngularSpeed::RevolutionPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.5 / Pi;});}},
-    {Unit::AngularSpeed::RevolutionPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 30.0 / Pi;});}}
-  }},
-  {Unit::AngularSpeed::RadianPerHour, {
-    {Unit::AngularSpeed::RadianPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 3600.0;});}},
-    {Unit::AngularSpeed::RadianPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 60.0;});}},
-    {Unit::AngularSpeed::RadianPerHour, [](std::vector<double>& values)->void{}},
-    {Unit::AngularSpeed::DegreePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.05 / Pi;});}},
-    {Unit::AngularSpeed::DegreePerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3.0 / Pi;});}},
-    {Unit::AngularSpeed::DegreePerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 180.0 / Pi;});}},
-    {Unit::AngularSpeed::RevolutionPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 7200.0 * Pi;});}},
-    {Unit::AngularSpeed::RevolutionPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 120.0 * Pi;});}},
-    {Unit::AngularSpeed::RevolutionPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.5 / Pi;});}}
-  }},
-  {Unit::AngularSpeed::DegreePerSecond, {
-    {Unit::AngularSpeed::RadianPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 180.0;});}},
-    {Unit::AngularSpeed::RadianPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 3.0;});}},
-    {Unit::AngularSpeed::RadianPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 20.0 * Pi;});}},
-    {Unit::AngularSpeed::DegreePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::AngularSpeed::DegreePerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 60.0;});}},
-    {Unit::AngularSpeed::DegreePerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3600.0;});}},
-    {Unit::AngularSpeed::RevolutionPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 360.0;});}},
-    {Unit::AngularSpeed::RevolutionPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 6.0;});}},
-    {Unit::AngularSpeed::RevolutionPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10.0;});}}
-  }},
-  {Unit::AngularSpeed::DegreePerMinute, {
-    {Unit::AngularSpeed::RadianPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 10800.0;});}},
-    {Unit::AngularSpeed::RadianPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 180.0;});}},
-    {Unit::AngularSpeed::RadianPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 3.0;});}},
-    {Unit::AngularSpeed::DegreePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 60.0;});}},
-    {Unit::AngularSpeed::DegreePerMinute, [](std::vector<double>& values)->void{}},
-    {Unit::AngularSpeed::DegreePerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 60.0;});}},
-    {Unit::AngularSpeed::RevolutionPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 21600.0;});}},
-    {Unit::AngularSpeed::RevolutionPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 360.0;});}},
-    {Unit::AngularSpeed::RevolutionPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 6.0;});}}
-  }},
-  {Unit::AngularSpeed::DegreePerHour, {
-    {Unit::AngularSpeed::RadianPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 648000.0;});}},
-    {Unit::AngularSpeed::RadianPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 10800.0;});}},
-    {Unit::AngularSpeed::RadianPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 180.0;});}},
-    {Unit::AngularSpeed::DegreePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 3600.0;});}},
-    {Unit::AngularSpeed::DegreePerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 60.0;});}},
-    {Unit::AngularSpeed::DegreePerHour, [](std::vector<double>& values)->void{}},
-    {Unit::AngularSpeed::RevolutionPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1296000.0;});}},
-    {Unit::AngularSpeed::RevolutionPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 21600.0;});}},
-    {Unit::AngularSpeed::RevolutionPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 360.0;});}}
-  }},
-  {Unit::AngularSpeed::RevolutionPerSecond, {
-    {Unit::AngularSpeed::RadianPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 2.0 * Pi;});}},
-    {Unit::AngularSpeed::RadianPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 120.0 * Pi;});}},
-    {Unit::AngularSpeed::RadianPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 7200.0 * Pi;});}},
-    {Unit::AngularSpeed::DegreePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 360.0;});}},
-    {Unit::AngularSpeed::DegreePerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 21600.0;});}},
-    {Unit::AngularSpeed::DegreePerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1296000.0;});}},
-    {Unit::AngularSpeed::RevolutionPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::AngularSpeed::RevolutionPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 60.0;});}},
-    {Unit::AngularSpeed::RevolutionPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3600.0;});}}
-  }},
-  {Unit::AngularSpeed::RevolutionPerMinute, {
-    {Unit::AngularSpeed::RadianPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 30.0;});}},
-    {Unit::AngularSpeed::RadianPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 2.0 * Pi;});}},
-    {Unit::AngularSpeed::RadianPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 120.0 * Pi;});}},
-    {Unit::AngularSpeed::DegreePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 6.0;});}},
-    {Unit::AngularSpeed::DegreePerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 360.0;});}},
-    {Unit::AngularSpeed::DegreePerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 21600.0;});}},
-    {Unit::AngularSpeed::RevolutionPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 60.0;});}},
-    {Unit::AngularSpeed::RevolutionPerMinute, [](std::vector<double>& values)->void{}},
-    {Unit::AngularSpeed::RevolutionPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 60.0;});}}
-  }},
-  {Unit::AngularSpeed::RevolutionPerHour, {
-    {Unit::AngularSpeed::RadianPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 1800.0;});}},
-    {Unit::AngularSpeed::RadianPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= Pi / 30.0;});}},
-    {Unit::AngularSpeed::RadianPerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 2.0 * Pi;});}},
-    {Unit::AngularSpeed::DegreePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.1;});}},
-    {Unit::AngularSpeed::DegreePerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 6.0;});}},
-    {Unit::AngularSpeed::DegreePerHour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 360.0;});}},
-    {Unit::AngularSpeed::RevolutionPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 3600.0;});}},
-    {Unit::AngularSpeed::RevolutionPerMinute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 60.0;});}},
-    {Unit::AngularSpeed::RevolutionPerHour, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr bool has_ambiguous_dimension<Unit::AngularSpeed>{true};
+
+template <> constexpr const std::array<ConversionFactor, 9> conversion_factors<Unit::AngularSpeed>{
+  derived_conversion_factor<Unit::AngularSpeed>(Unit::Angle::Radian, Unit::Time::Second),
+  derived_conversion_factor<Unit::AngularSpeed>(Unit::Angle::Radian, Unit::Time::Minute),
+  derived_conversion_factor<Unit::AngularSpeed>(Unit::Angle::Radian, Unit::Time::Hour),
+  derived_conversion_factor<Unit::AngularSpeed>(Unit::Angle::Degree, Unit::Time::Second),
+  derived_conversion_factor<Unit::AngularSpeed>(Unit::Angle::Degree, Unit::Time::Minute),
+  derived_conversion_factor<Unit::AngularSpeed>(Unit::Angle::Degree, Unit::Time::Hour),
+  derived_conversion_factor<Unit::AngularSpeed>(2.0 * Pi, Unit::Angle::Radian, Unit::Time::Second),
+  derived_conversion_factor<Unit::AngularSpeed>(2.0 * Pi, Unit::Angle::Radian, Unit::Time::Minute),
+  derived_conversion_factor<Unit::AngularSpeed>(2.0 * Pi, Unit::Angle::Radian, Unit::Time::Hour)
 };
 
 } // namespace PhQ
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
 
 namespace PhQ {
 
@@ -31,7 +32,7 @@ enum class Area : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::Area, std::string> abbreviations<Unit::Area>{
+template <> constexpr const std::array<std::pair<Unit::Area, std::string_view>, 12> abbreviations<Unit::Area>{{
   {Unit::Area::SquareMile, "mi^2"},
   {Unit::Area::SquareKilometre, "km^2"},
 //  {Unit::Area::Hectare, "ha"},
@@ -46,9 +47,11 @@ template <> const std::map<Unit::Area, std::string> abbreviations<Unit::Area>{
   {Unit::Area::SquareMilliinch, "thou^2"},
   {Unit::Area::SquareMicrometre, "μm^2"},
   {Unit::Area::SquareMicroinch, "μin^2"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::Area>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::Area> spellings<Unit::Area>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::Area>, 34> spellings<Unit::Area>{{
   {"mi^2", Unit::Area::SquareMile},
   {"mi2", Unit::Area::SquareMile},
   {"km^2", Unit::Area::SquareKilometre},
@@ -85,195 +88,41 @@ template <> const std::unordered_map<std::string, Unit::Area> spellings<Unit::Ar
   {"μin2", Unit::Area::SquareMicroinch},
   {"uin^2", Unit::Area::SquareMicroinch},
   {"uin2", Unit::Area::SquareMicroinch}
-};
+}};
 
-template <> const std::map<System, Unit::Area> consistent_units<Unit::Area>{
+template <> constexpr const std::array<std::pair<System, Unit::Area>, 4> consistent_units<Unit::Area>{{
   {System::MetreKilogramSecondKelvin, Unit::Area::SquareMetre},
   {System::MillimetreGramSecondKelvin, Unit::Area::SquareMillimetre},
   {System::FootPoundSecondRankine, Unit::Area::SquareFoot},
   {System::InchPoundSecondRankine, Unit::Area::SquareInch}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::Area>), "The consistent_units table must be listed in the order of its enumeration.");
 
-template <> const std::map<Unit::Area, System> related_systems<Unit::Area>{
+template <> constexpr const std::array<std::pair<Unit::Area, System>, 4> related_systems<Unit::Area>{{
   {Unit::Area::SquareMetre, System::MetreKilogramSecondKelvin},
   {Unit::Area::SquareMillimetre, System::MillimetreGramSecondKelvin},
   {Unit::Area::SquareFoot, System::FootPoundSecondRankine},
-  {Unit::Area::SquareInch, System::InchPoundSecondRankine},
-};
+  {Unit::Area::SquareInch, System::InchPoundSecondRankine}
+}};
 
 template <> constexpr const Unit::Area standard_unit<Unit::Area>{Unit::Area::SquareMetre};
 
 template <> constexpr const Dimension::Set dimension<Unit::Area>{Dimension::Set{Dimension::Length{2}}};
 
-template <> const std::map<Unit::Area, std::map<Unit::Area, std::function<void(std::vector<double>&)>>> conversions<Unit::Area>{
-  {Unit::Area::SquareMile, {
-    {Unit::Area::SquareMile, [](std::vector<double>& values)->void{}},
-    {Unit::Area::SquareKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1.609344, 2);});}},
-    {Unit::Area::SquareYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1760.0, 2);});}},
-    {Unit::Area::SquareMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1609.344, 2);});}},
-    {Unit::Area::SquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(5280.0, 2);});}},
-    {Unit::Area::SquareDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(16093.44, 2);});}},
-    {Unit::Area::SquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(63360.0, 2);});}},
-    {Unit::Area::SquareCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(160934.4, 2);});}},
-    {Unit::Area::SquareMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1609344.0, 2);});}},
-    {Unit::Area::SquareMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(63360000.0, 2);});}},
-    {Unit::Area::SquareMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1609344000.0, 2);});}},
-    {Unit::Area::SquareMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(63360000000.0, 2);});}}
-  }},
-  {Unit::Area::SquareKilometre, {
-    {Unit::Area::SquareMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1.609344, 2);});}},
-    {Unit::Area::SquareKilometre, [](std::vector<double>& values)->void{}},
-    {Unit::Area::SquareYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0009144, 2);});}},
-    {Unit::Area::SquareMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 2);});}},
-    {Unit::Area::SquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0003048, 2);});}},
-    {Unit::Area::SquareDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10000.0, 2);});}},
-    {Unit::Area::SquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000254, 2);});}},
-    {Unit::Area::SquareCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100000.0, 2);});}},
-    {Unit::Area::SquareMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000.0, 2);});}},
-    {Unit::Area::SquareMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000000254, 2);});}},
-    {Unit::Area::SquareMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000000.0, 2);});}},
-    {Unit::Area::SquareMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000000000254, 2);});}}
-  }},
-  {Unit::Area::SquareYard, {
-    {Unit::Area::SquareMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1760.0, 2);});}},
-    {Unit::Area::SquareKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0009144, 2);});}},
-    {Unit::Area::SquareYard, [](std::vector<double>& values)->void{}},
-    {Unit::Area::SquareMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.9144, 2);});}},
-    {Unit::Area::SquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(3.0, 2);});}},
-    {Unit::Area::SquareDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(9.144, 2);});}},
-    {Unit::Area::SquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(36.0, 2);});}},
-    {Unit::Area::SquareCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(91.44, 2);});}},
-    {Unit::Area::SquareMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(914.4, 2);});}},
-    {Unit::Area::SquareMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(36000.0, 2);});}},
-    {Unit::Area::SquareMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(914400.0, 2);});}},
-    {Unit::Area::SquareMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(36000000.0, 2);});}}
-  }},
-  {Unit::Area::SquareMetre, {
-    {Unit::Area::SquareMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1609.344, 2);});}},
-    {Unit::Area::SquareKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 2);});}},
-    {Unit::Area::SquareYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.9144, 2);});}},
-    {Unit::Area::SquareMetre, [](std::vector<double>& values)->void{}},
-    {Unit::Area::SquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.3048, 2);});}},
-    {Unit::Area::SquareDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 2);});}},
-    {Unit::Area::SquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0254, 2);});}},
-    {Unit::Area::SquareCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100.0, 2);});}},
-    {Unit::Area::SquareMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 2);});}},
-    {Unit::Area::SquareMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000254, 2);});}},
-    {Unit::Area::SquareMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000.0, 2);});}},
-    {Unit::Area::SquareMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000000254, 2);});}}
-  }},
-  {Unit::Area::SquareFoot, {
-    {Unit::Area::SquareMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(5280.0, 2);});}},
-    {Unit::Area::SquareKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0003048, 2);});}},
-    {Unit::Area::SquareYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(3.0, 2);});}},
-    {Unit::Area::SquareMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.3048, 2);});}},
-    {Unit::Area::SquareFoot, [](std::vector<double>& values)->void{}},
-    {Unit::Area::SquareDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(3.048, 2);});}},
-    {Unit::Area::SquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12.0, 2);});}},
-    {Unit::Area::SquareCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(30.48, 2);});}},
-    {Unit::Area::SquareMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(304.8, 2);});}},
-    {Unit::Area::SquareMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12000.0, 2);});}},
-    {Unit::Area::SquareMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(304800.0, 2);});}},
-    {Unit::Area::SquareMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12000000.0, 2);});}}
-  }},
-  {Unit::Area::SquareDecimetre, {
-    {Unit::Area::SquareMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(16093.44, 2);});}},
-    {Unit::Area::SquareKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0001, 2);});}},
-    {Unit::Area::SquareYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(9.144, 2);});}},
-    {Unit::Area::SquareMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 2);});}},
-    {Unit::Area::SquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(3.048, 2);});}},
-    {Unit::Area::SquareDecimetre, [](std::vector<double>& values)->void{}},
-    {Unit::Area::SquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.254, 2);});}},
-    {Unit::Area::SquareCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 2);});}},
-    {Unit::Area::SquareMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100.0, 2);});}},
-    {Unit::Area::SquareMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.000254, 2);});}},
-    {Unit::Area::SquareMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100000.0, 2);});}},
-    {Unit::Area::SquareMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.000000254, 2);});}}
-  }},
-  {Unit::Area::SquareInch, {
-    {Unit::Area::SquareMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(63360.0, 2);});}},
-    {Unit::Area::SquareKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000254, 2);});}},
-    {Unit::Area::SquareYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(36.0, 2);});}},
-    {Unit::Area::SquareMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 2);});}},
-    {Unit::Area::SquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12.0, 2);});}},
-    {Unit::Area::SquareDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.254, 2);});}},
-    {Unit::Area::SquareInch, [](std::vector<double>& values)->void{}},
-    {Unit::Area::SquareCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(2.54, 2);});}},
-    {Unit::Area::SquareMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(25.4, 2);});}},
-    {Unit::Area::SquareMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 2);});}},
-    {Unit::Area::SquareMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(25400.0, 2);});}},
-    {Unit::Area::SquareMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000.0, 2);});}}
-  }},
-  {Unit::Area::SquareCentimetre, {
-    {Unit::Area::SquareMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(160934.4, 2);});}},
-    {Unit::Area::SquareKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00001, 2);});}},
-    {Unit::Area::SquareYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(91.44, 2);});}},
-    {Unit::Area::SquareMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.01, 2);});}},
-    {Unit::Area::SquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(30.48, 2);});}},
-    {Unit::Area::SquareDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 2);});}},
-    {Unit::Area::SquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(2.54, 2);});}},
-    {Unit::Area::SquareCentimetre, [](std::vector<double>& values)->void{}},
-    {Unit::Area::SquareMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 2);});}},
-    {Unit::Area::SquareMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.00254, 2);});}},
-    {Unit::Area::SquareMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10000.0, 2);});}},
-    {Unit::Area::SquareMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.00000254, 2);});}}
-  }},
-  {Unit::Area::SquareMillimetre, {
-    {Unit::Area::SquareMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1609344.0, 2);});}},
-    {Unit::Area::SquareKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000001, 2);});}},
-    {Unit::Area::SquareYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(914.4, 2);});}},
-    {Unit::Area::SquareMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 2);});}},
-    {Unit::Area::SquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(304.8, 2);});}},
-    {Unit::Area::SquareDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.01, 2);});}},
-    {Unit::Area::SquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(25.4, 2);});}},
-    {Unit::Area::SquareCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 2);});}},
-    {Unit::Area::SquareMillimetre, [](std::vector<double>& values)->void{}},
-    {Unit::Area::SquareMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0254, 2);});}},
-    {Unit::Area::SquareMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 2);});}},
-    {Unit::Area::SquareMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000254, 2);});}}
-  }},
-  {Unit::Area::SquareMilliinch, {
-    {Unit::Area::SquareMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(63360000.0, 2);});}},
-    {Unit::Area::SquareKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000000254, 2);});}},
-    {Unit::Area::SquareYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(36000.0, 2);});}},
-    {Unit::Area::SquareMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000254, 2);});}},
-    {Unit::Area::SquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12000.0, 2);});}},
-    {Unit::Area::SquareDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000254, 2);});}},
-    {Unit::Area::SquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 2);});}},
-    {Unit::Area::SquareCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00254, 2);});}},
-    {Unit::Area::SquareMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 2);});}},
-    {Unit::Area::SquareMilliinch, [](std::vector<double>& values)->void{}},
-    {Unit::Area::SquareMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(25.4, 2);});}},
-    {Unit::Area::SquareMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 2);});}}
-  }},
-  {Unit::Area::SquareMicrometre, {
-    {Unit::Area::SquareMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1609344000.0, 2);});}},
-    {Unit::Area::SquareKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000000001, 2);});}},
-    {Unit::Area::SquareYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(914400.0, 2);});}},
-    {Unit::Area::SquareMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000001, 2);});}},
-    {Unit::Area::SquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(304800.0, 2);});}},
-    {Unit::Area::SquareDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00001, 2);});}},
-    {Unit::Area::SquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(25400.0, 2);});}},
-    {Unit::Area::SquareCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0001, 2);});}},
-    {Unit::Area::SquareMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 2);});}},
-    {Unit::Area::SquareMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(25.4, 2);});}},
-    {Unit::Area::SquareMicrometre, [](std::vector<double>& values)->void{}},
-    {Unit::Area::SquareMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0254, 2);});}}
-  }},
-  {Unit::Area::SquareMicroinch, {
-    {Unit::Area::SquareMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(63360000000.0, 2);});}},
-    {Unit::Area::SquareKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000000000254, 2);});}},
-    {Unit::Area::SquareYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(36000000.0, 2);});}},
-    {Unit::Area::SquareMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000000254, 2);});}},
-    {Unit::Area::SquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12000000.0, 2);});}},
-    {Unit::Area::SquareDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000000254, 2);});}},
-    {Unit::Area::SquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000001, 2);});}},
-    {Unit::Area::SquareCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00000254, 2);});}},
-    {Unit::Area::SquareMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000254, 2);});}},
-    {Unit::Area::SquareMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 2);});}},
-    {Unit::Area::SquareMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 2);});}},
-    {Unit::Area::SquareMicroinch, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 12> conversion_factors<Unit::Area>{
+  derived_conversion_factor<Unit::Area>(Unit::Length::Mile),
+  derived_conversion_factor<Unit::Area>(Unit::Length::Kilometre),
+  derived_conversion_factor<Unit::Area>(Unit::Length::Yard),
+  derived_conversion_factor<Unit::Area>(Unit::Length::Metre),
+  derived_conversion_factor<Unit::Area>(Unit::Length::Foot),
+  derived_conversion_factor<Unit::Area>(Unit::Length::Decimetre),
+  derived_conversion_factor<Unit::Area>(Unit::Length::Inch),
+  derived_conversion_factor<Unit::Area>(Unit::Length::Centimetre),
+  derived_conversion_factor<Unit::Area>(Unit::Length::Millimetre),
+  derived_conversion_factor<Unit::Area>(Unit::Length::Milliinch),
+  derived_conversion_factor<Unit::Area>(Unit::Length::Micrometre),
+  derived_conversion_factor<Unit::Area>(Unit::Length::Microinch)
 };
 
 } // namespace PhQ
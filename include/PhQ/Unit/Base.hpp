@@ -16,60 +16,327 @@ template <typename Unit> constexpr const Unit standard_unit;
 
 template <typename Unit> constexpr const Dimension::Set dimension;
 
-template <typename Unit> const std::map<Unit, std::map<Unit, std::function<void(std::vector<double>&)>>> conversions;
+/// \brief Whether the physical dimension set of a unit type does not capture its meaning, such as for angles, which are dimensionless; angular speeds, which share their dimension set with frequencies; and absolute temperatures, which share theirs with temperature differences. Generic physical quantities convert to quantities of such unit types only explicitly.
+template <typename Unit> constexpr bool has_ambiguous_dimension{false};
 
-template <typename Unit> double convert(double value, Unit old_unit, Unit new_unit) noexcept {
+/// \brief Affine relation between two units of the same type. A value expressed in the old unit is expressed in the new unit as value * scale + offset.
+/// \details The offset is zero for all units except those of absolute temperature.
+class ConversionFactor {
+
+public:
+
+  constexpr ConversionFactor(double scale = 1.0, double offset = 0.0) noexcept : scale_(scale), offset_(offset) {}
+
+  constexpr double scale() const noexcept {
+    return scale_;
+  }
+
+  constexpr double offset() const noexcept {
+    return offset_;
+  }
+
+  constexpr double operator()(double value) const noexcept {
+    return value * scale_ + offset_;
+  }
+
+  /// \brief Convert a value of another floating-point type, such as float or long double, at the precision of that type: the scale and offset are rounded to that type, so single-precision values are not widened to double precision.
+  template <typename Number, std::enable_if_t<std::is_floating_point<Number>::value, bool> = true> constexpr Number operator()(Number value) const noexcept {
+    return value * static_cast<Number>(scale_) + static_cast<Number>(offset_);
+  }
+
+private:
+
+  double scale_;
+
+  double offset_;
+
+};
+
+/// \brief Conversion factors from each unit of a given type to its standard unit, indexed by the underlying value of the unit enumeration.
+template <typename Unit> constexpr const std::array<ConversionFactor, 0> conversion_factors{};
+
+/// \brief Obtain the conversion factor from one unit to another unit of the same type.
+/// \details For example, PhQ::conversion_factor(PhQ::Unit::Length::Foot, PhQ::Unit::Length::Inch) returns a scale of 12 and an offset of 0.
+template <typename Unit> constexpr ConversionFactor conversion_factor(Unit old_unit, Unit new_unit) noexcept {
+  const ConversionFactor& old_factor{conversion_factors<Unit>[static_cast<std::size_t>(old_unit)]};
+  const ConversionFactor& new_factor{conversion_factors<Unit>[static_cast<std::size_t>(new_unit)]};
+  return {old_factor.scale() / new_factor.scale(), (old_factor.offset() - new_factor.offset()) / new_factor.scale()};
+}
+
+/// \brief Raise a number to an integer power. Unlike std::pow, this can be evaluated at compile time.
+constexpr double integer_power(double base, int_least8_t exponent) noexcept {
+  double result{1.0};
+  for (int_least8_t index = 0; index < exponent; ++index) {
+    result *= base;
+  }
+  for (int_least8_t index = 0; index > exponent; --index) {
+    result /= base;
+  }
+  return result;
+}
+
+/// \brief Exponent to which a base unit type such as PhQ::Unit::Length is raised in the physical dimension set of a derived unit type such as PhQ::Unit::Speed.
+/// \details Dimensionless base unit types such as PhQ::Unit::Angle and PhQ::Unit::Memory have an exponent of 1.
+template <typename DerivedUnit, typename BaseUnit> constexpr int_least8_t base_unit_exponent() noexcept {
+  constexpr Dimension::Set base{dimension<BaseUnit>};
+  constexpr Dimension::Set derived{dimension<DerivedUnit>};
+  if constexpr (base.length().value() != 0) {
+    return derived.length().value() / base.length().value();
+  } else if constexpr (base.mass().value() != 0) {
+    return derived.mass().value() / base.mass().value();
+  } else if constexpr (base.time().value() != 0) {
+    return derived.time().value() / base.time().value();
+  } else if constexpr (base.temperature().value() != 0) {
+    return derived.temperature().value() / base.temperature().value();
+  } else {
+    return 1;
+  }
+}
+
+/// \brief Conversion factor to the standard unit of a derived unit type, composed from the conversion factors of the base units from which the derived unit is built, each raised to its exponent in the physical dimension set of the derived unit type.
+/// \details For example, PhQ::derived_conversion_factor<PhQ::Unit::Pressure>(PhQ::Unit::Length::Inch, PhQ::Unit::Mass::Slinch, PhQ::Unit::Time::Second) returns the conversion factor of pounds per square inch. Base units whose dimension does not appear in the derived unit type contribute nothing. The multiplier accounts for prefixes and named multiples such as the revolution.
+template <typename DerivedUnit, typename... BaseUnits> constexpr ConversionFactor derived_conversion_factor(double multiplier, BaseUnits... base_units) noexcept {
+  return {(multiplier * ... * integer_power(conversion_factors<BaseUnits>[static_cast<std::size_t>(base_units)].scale(), base_unit_exponent<DerivedUnit, BaseUnits>()))};
+}
+
+template <typename DerivedUnit, typename... BaseUnits> constexpr ConversionFactor derived_conversion_factor(BaseUnits... base_units) noexcept {
+  return derived_conversion_factor<DerivedUnit>(1.0, base_units...);
+}
+
+/// \brief Conversion from one unit to another unit of the same type, resolved once and then applied any number of times.
+/// \details Construction looks up the conversion factor; applying the plan is a single multiply-add per value with no lookups. Plans are small and trivially copyable, so they can be stored alongside the data they convert, for example one per column of a table.
+template <typename Unit> class ConversionPlan {
+
+public:
+
+  constexpr ConversionPlan(Unit old_unit, Unit new_unit) noexcept : old_unit_(old_unit), new_unit_(new_unit), factor_(old_unit != new_unit ? conversion_factor(old_unit, new_unit) : ConversionFactor{}) {}
+
+  constexpr ConversionPlan(Unit old_unit, System new_system) noexcept : ConversionPlan(old_unit, unit<Unit>(new_system)) {}
+
+  constexpr Unit old_unit() const noexcept {
+    return old_unit_;
+  }
+
+  constexpr Unit new_unit() const noexcept {
+    return new_unit_;
+  }
+
+  constexpr const ConversionFactor& factor() const noexcept {
+    return factor_;
+  }
+
+  constexpr double operator()(double value) const noexcept {
+    return factor_(value);
+  }
+
+  template <typename Number, std::enable_if_t<std::is_floating_point<Number>::value, bool> = true> constexpr Number operator()(Number value) const noexcept {
+    return factor_(value);
+  }
+
+  /// \brief Convert a contiguous array of values in place.
+  template <typename Number> void operator()(Number* values, std::size_t size) const noexcept {
+    const Number scale{static_cast<Number>(factor_.scale())};
+    const Number offset{static_cast<Number>(factor_.offset())};
+    for (std::size_t index = 0; index < size; ++index) {
+      values[index] = values[index] * scale + offset;
+    }
+  }
+
+  /// \brief Convert a contiguous array of values, writing the results to another contiguous array of the same size. The two arrays may be the same array, but must not otherwise overlap.
+  template <typename Number> void operator()(const Number* old_values, Number* new_values, std::size_t size) const noexcept {
+    const Number scale{static_cast<Number>(factor_.scale())};
+    const Number offset{static_cast<Number>(factor_.offset())};
+    for (std::size_t index = 0; index < size; ++index) {
+      new_values[index] = old_values[index] * scale + offset;
+    }
+  }
+
+  template <typename Number> std::vector<Number> operator()(const std::vector<Number>& values) const noexcept {
+    std::vector<Number> new_values(values.size());
+    operator()(values.data(), new_values.data(), values.size());
+    return new_values;
+  }
+
+  template <typename Number> constexpr Value::BasicVector<Number> operator()(const Value::BasicVector<Number>& values) const noexcept {
+    return {factor_(values.x()), factor_(values.y()), factor_(values.z())};
+  }
+
+  template <typename Number> constexpr Value::BasicSymmetricDyadic<Number> operator()(const Value::BasicSymmetricDyadic<Number>& values) const noexcept {
+    return {factor_(values.xx()), factor_(values.xy()), factor_(values.xz()), factor_(values.yy()), factor_(values.yz()), factor_(values.zz())};
+  }
+
+  template <typename Number> constexpr Value::BasicDyadic<Number> operator()(const Value::BasicDyadic<Number>& values) const noexcept {
+    return {factor_(values.xx()), factor_(values.xy()), factor_(values.xz()), factor_(values.yx()), factor_(values.yy()), factor_(values.yz()), factor_(values.zx()), factor_(values.zy()), factor_(values.zz())};
+  }
+
+private:
+
+  Unit old_unit_;
+
+  Unit new_unit_;
+
+  ConversionFactor factor_;
+
+};
+
+/// \brief Conversion functions between every pair of units of a given type.
+/// \details Deprecated; kept for compatibility. Prefer PhQ::convert or PhQ::ConversionPlan, which read the PhQ::conversion_factors tables directly and never allocate. As a variable template, this map is only built, at program startup, in programs that use it.
+// The static initializer of each instantiation refers to the deprecated variable itself, which must not warn.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+template <typename Unit> [[deprecated("Use PhQ::convert or PhQ::ConversionPlan instead.")]] const std::map<Unit, std::map<Unit, std::function<void(std::vector<double>&)>>> conversions{[]() {
+  std::map<Unit, std::map<Unit, std::function<void(std::vector<double>&)>>> functions;
+  for (std::size_t old_index = 0; old_index < conversion_factors<Unit>.size(); ++old_index) {
+    for (std::size_t new_index = 0; new_index < conversion_factors<Unit>.size(); ++new_index) {
+      const ConversionFactor factor{conversion_factor(static_cast<Unit>(old_index), static_cast<Unit>(new_index))};
+      functions[static_cast<Unit>(old_index)][static_cast<Unit>(new_index)] = [factor](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [factor](double& value)->void{value = factor(value);});};
+    }
+  }
+  return functions;
+}()};
+#pragma GCC diagnostic pop
+
+/// \brief Convert a value from one unit to another unit of the same type. Never allocates memory, and is evaluated at compile time when its arguments are constants.
+template <typename Unit> constexpr double convert(double value, Unit old_unit, Unit new_unit) noexcept {
   if (old_unit != new_unit) {
-    std::vector<double> value_vector{value};
-    conversions<Unit>.find(old_unit)->second.find(new_unit)->second(value_vector);
-    return value_vector[0];
+    return conversion_factor(old_unit, new_unit)(value);
   } else {
     return value;
   }
 }
 
-template <typename Unit> double convert(double value, Unit old_unit, System new_system) noexcept {
+template <typename Unit> constexpr double convert(double value, Unit old_unit, System new_system) noexcept {
   return convert<Unit>(value, old_unit, unit<Unit>(new_system));
 }
 
-template <typename Unit> std::vector<double> convert(const std::vector<double>& values, Unit old_unit, Unit new_unit) noexcept {
+/// \brief Convert a value of another floating-point type, such as float or long double, from one unit to another unit of the same type at the precision of that type.
+template <typename Unit, typename Number, std::enable_if_t<std::is_floating_point<Number>::value, bool> = true> constexpr Number convert(Number value, Unit old_unit, Unit new_unit) noexcept {
   if (old_unit != new_unit) {
-    std::vector<double> new_values{values};
-    conversions<Unit>.find(old_unit)->second.find(new_unit)->second(new_values);
-    return new_values;
+    return conversion_factor(old_unit, new_unit)(value);
   } else {
-    return values;
+    return value;
+  }
+}
+
+template <typename Unit, typename Number, std::enable_if_t<std::is_floating_point<Number>::value, bool> = true> constexpr Number convert(Number value, Unit old_unit, System new_system) noexcept {
+  return convert<Unit>(value, old_unit, unit<Unit>(new_system));
+}
+
+/// \brief Convert a value between two units known at compile time. The conversion factor is a compile-time constant, so the conversion is a single multiply, or a multiply-add for units of absolute temperature.
+/// \details For example, PhQ::convert<PhQ::Unit::Pressure::PoundPerSquareInch, PhQ::Unit::Pressure::Pascal>(14.7) returns 101352.9 Pa.
+template <auto OldUnit, auto NewUnit> constexpr double convert(double value) noexcept {
+  static_assert(std::is_same<decltype(OldUnit), decltype(NewUnit)>::value, "Cannot convert between units of different types.");
+  if constexpr (OldUnit != NewUnit) {
+    constexpr ConversionFactor factor{conversion_factor(OldUnit, NewUnit)};
+    if constexpr (factor.offset() == 0.0) {
+      return value * factor.scale();
+    } else {
+      return factor(value);
+    }
+  } else {
+    return value;
+  }
+}
+
+/// \brief Convert a value of another floating-point type, such as float or long double, between two units known at compile time. The conversion factor is a compile-time constant rounded to that type.
+template <auto OldUnit, auto NewUnit, typename Number, std::enable_if_t<std::is_floating_point<Number>::value, bool> = true> constexpr Number convert(Number value) noexcept {
+  static_assert(std::is_same<decltype(OldUnit), decltype(NewUnit)>::value, "Cannot convert between units of different types.");
+  if constexpr (OldUnit != NewUnit) {
+    constexpr ConversionFactor factor{conversion_factor(OldUnit, NewUnit)};
+    if constexpr (factor.offset() == 0.0) {
+      return value * static_cast<Number>(factor.scale());
+    } else {
+      return factor(value);
+    }
+  } else {
+    return value;
+  }
+}
+
+template <auto OldUnit, auto NewUnit, typename Number> constexpr Value::BasicVector<Number> convert(const Value::BasicVector<Number>& values) noexcept {
+  return {convert<OldUnit, NewUnit>(values.x()), convert<OldUnit, NewUnit>(values.y()), convert<OldUnit, NewUnit>(values.z())};
+}
+
+template <auto OldUnit, auto NewUnit, typename Number> constexpr Value::BasicSymmetricDyadic<Number> convert(const Value::BasicSymmetricDyadic<Number>& values) noexcept {
+  return {convert<OldUnit, NewUnit>(values.xx()), convert<OldUnit, NewUnit>(values.xy()), convert<OldUnit, NewUnit>(values.xz()), convert<OldUnit, NewUnit>(values.yy()), convert<OldUnit, NewUnit>(values.yz()), convert<OldUnit, NewUnit>(values.zz())};
+}
+
+template <auto OldUnit, auto NewUnit, typename Number> constexpr Value::BasicDyadic<Number> convert(const Value::BasicDyadic<Number>& values) noexcept {
+  return {convert<OldUnit, NewUnit>(values.xx()), convert<OldUnit, NewUnit>(values.xy()), convert<OldUnit, NewUnit>(values.xz()), convert<OldUnit, NewUnit>(values.yx()), convert<OldUnit, NewUnit>(values.yy()), convert<OldUnit, NewUnit>(values.yz()), convert<OldUnit, NewUnit>(values.zx()), convert<OldUnit, NewUnit>(values.zy()), convert<OldUnit, NewUnit>(values.zz())};
+}
+
+/// \brief Convert a contiguous array of values in place from one unit to another unit of the same type.
+/// \details The loop performs one multiply-add per value and no other work, so compilers vectorize it, and contract it to fused multiply-add instructions when floating-point contraction is enabled.
+template <typename Unit, typename Number> void convert_in_place(Number* values, std::size_t size, Unit old_unit, Unit new_unit) noexcept {
+  if (old_unit != new_unit) {
+    ConversionPlan<Unit>{old_unit, new_unit}(values, size);
+  }
+}
+
+template <typename Unit, typename Number> void convert_in_place(Number* values, std::size_t size, Unit old_unit, System new_system) noexcept {
+  convert_in_place<Unit>(values, size, old_unit, unit<Unit>(new_system));
+}
+
+/// \brief Convert a contiguous array of values from one unit to another unit of the same type, writing the results to another contiguous array of the same size.
+/// \details The input array is read once and the output array is written once. The two arrays may be the same array, but must not otherwise overlap.
+template <typename Unit, typename Number> void convert(const Number* old_values, Number* new_values, std::size_t size, Unit old_unit, Unit new_unit) noexcept {
+  if (old_unit != new_unit) {
+    ConversionPlan<Unit>{old_unit, new_unit}(old_values, new_values, size);
+  } else if (old_values != new_values) {
+    std::copy(old_values, old_values + size, new_values);
   }
 }
 
-template <typename Unit> std::vector<double> convert(const std::vector<double>& values, Unit old_unit, System new_system) noexcept {
+template <typename Unit, typename Number> void convert(const Number* old_values, Number* new_values, std::size_t size, Unit old_unit, System new_system) noexcept {
+  convert<Unit>(old_values, new_values, size, old_unit, unit<Unit>(new_system));
+}
+
+template <typename Unit, typename Number> std::vector<Number> convert(const std::vector<Number>& values, Unit old_unit, Unit new_unit) noexcept {
+  std::vector<Number> new_values{values};
+  convert_in_place(new_values.data(), new_values.size(), old_unit, new_unit);
+  return new_values;
+}
+
+template <typename Unit, typename Number> std::vector<Number> convert(const std::vector<Number>& values, Unit old_unit, System new_system) noexcept {
   return convert<Unit>(values, old_unit, unit<Unit>(new_system));
 }
 
-template <typename Unit> Value::Vector convert(const Value::Vector& values, Unit old_unit, Unit new_unit) noexcept {
-  const std::vector<double> values_vector{convert(std::vector<double>{values.x(), values.y(), values.z()}, old_unit, new_unit)};
-  return {values_vector[0], values_vector[1], values_vector[2]};
+template <typename Unit, typename Number> constexpr Value::BasicVector<Number> convert(const Value::BasicVector<Number>& values, Unit old_unit, Unit new_unit) noexcept {
+  if (old_unit != new_unit) {
+    const ConversionFactor factor{conversion_factor(old_unit, new_unit)};
+    return {factor(values.x()), factor(values.y()), factor(values.z())};
+  } else {
+    return values;
+  }
 }
 
-template <typename Unit> Value::Vector convert(const Value::Vector& values, Unit old_unit, System new_system) noexcept {
+template <typename Unit, typename Number> Value::BasicVector<Number> convert(const Value::BasicVector<Number>& values, Unit old_unit, System new_system) noexcept {
   return convert(values, old_unit, unit<Unit>(new_system));
 }
 
-template <typename Unit> Value::SymmetricDyadic convert(const Value::SymmetricDyadic& values, Unit old_unit, Unit new_unit) noexcept {
-  const std::vector<double> values_vector{convert(std::vector<double>{values.xx(), values.xy(), values.xz(), values.yy(), values.yz(), values.zz()}, old_unit, new_unit)};
-  return {values_vector[0], values_vector[1], values_vector[2], values_vector[3], values_vector[4], values_vector[5]};
+template <typename Unit, typename Number> constexpr Value::BasicSymmetricDyadic<Number> convert(const Value::BasicSymmetricDyadic<Number>& values, Unit old_unit, Unit new_unit) noexcept {
+  if (old_unit != new_unit) {
+    const ConversionFactor factor{conversion_factor(old_unit, new_unit)};
+    return {factor(values.xx()), factor(values.xy()), factor(values.xz()), factor(values.yy()), factor(values.yz()), factor(values.zz())};
+  } else {
+    return values;
+  }
 }
 
-template <typename Unit> Value::SymmetricDyadic convert(const Value::SymmetricDyadic& values, Unit old_unit, System new_system) noexcept {
+template <typename Unit, typename Number> Value::BasicSymmetricDyadic<Number> convert(const Value::BasicSymmetricDyadic<Number>& values, Unit old_unit, System new_system) noexcept {
   return convert(values, old_unit, unit<Unit>(new_system));
 }
 
-template <typename Unit> Value::Dyadic convert(const Value::Dyadic& values, Unit old_unit, Unit new_unit) noexcept {
-  const std::vector<double> values_vector{convert(std::vector<double>{values.xx(), values.xy(), values.xz(), values.yx(), values.yy(), values.yz(), values.zx(), values.zy(), values.zz()}, old_unit, new_unit)};
-  return {values_vector[0], values_vector[1], values_vector[2], values_vector[3], values_vector[4], values_vector[5], values_vector[6], values_vector[7], values_vector[8]};
+template <typename Unit, typename Number> constexpr Value::BasicDyadic<Number> convert(const Value::BasicDyadic<Number>& values, Unit old_unit, Unit new_unit) noexcept {
+  if (old_unit != new_unit) {
+    const ConversionFactor factor{conversion_factor(old_unit, new_unit)};
+    return {factor(values.xx()), factor(values.xy()), factor(values.xz()), factor(values.yx()), factor(values.yy()), factor(values.yz()), factor(values.zx()), factor(values.zy()), factor(values.zz())};
+  } else {
+    return values;
+  }
 }
 
-template <typename Unit> Value::Dyadic convert(const Value::Dyadic& values, Unit old_unit, System new_system) noexcept {
+template <typename Unit, typename Number> Value::BasicDyadic<Number> convert(const Value::BasicDyadic<Number>& values, Unit old_unit, System new_system) noexcept {
   return convert(values, old_unit, unit<Unit>(new_system));
 }
 
@@ -7,6 +7,8 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -29,7 +31,7 @@ enum class Diffusivity : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::Diffusivity, std::string> abbreviations<Unit::Diffusivity>{
+template <> constexpr const std::array<std::pair<Unit::Diffusivity, std::string_view>, 12> abbreviations<Unit::Diffusivity>{{
   {Unit::Diffusivity::SquareMilePerSecond, "mi^2/s"},
   {Unit::Diffusivity::SquareKilometrePerSecond, "km^2/s"},
   {Unit::Diffusivity::SquareYardPerSecond, "yd^2/s"},
@@ -42,9 +44,11 @@ template <> const std::map<Unit::Diffusivity, std::string> abbreviations<Unit::D
   {Unit::Diffusivity::SquareMilliinchPerSecond, "thou^2/s"},
   {Unit::Diffusivity::SquareMicrometrePerSecond, "μm^2/s"},
   {Unit::Diffusivity::SquareMicroinchPerSecond, "μin^2/s"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::Diffusivity>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::Diffusivity> spellings<Unit::Diffusivity>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::Diffusivity>, 68> spellings<Unit::Diffusivity>{{
   {"mi^2/s", Unit::Diffusivity::SquareMilePerSecond},
   {"mi^2/sec", Unit::Diffusivity::SquareMilePerSecond},
   {"mi2/s", Unit::Diffusivity::SquareMilePerSecond},
@@ -113,195 +117,41 @@ template <> const std::unordered_map<std::string, Unit::Diffusivity> spellings<U
   {"uin^2/sec", Unit::Diffusivity::SquareMicroinchPerSecond},
   {"uin2/s", Unit::Diffusivity::SquareMicroinchPerSecond},
   {"uin2/sec", Unit::Diffusivity::SquareMicroinchPerSecond}
-};
+}};
 
-template <> const std::map<System, Unit::Diffusivity> consistent_units<Unit::Diffusivity>{
+template <> constexpr const std::array<std::pair<System, Unit::Diffusivity>, 4> consistent_units<Unit::Diffusivity>{{
   {System::MetreKilogramSecondKelvin, Unit::Diffusivity::SquareMetrePerSecond},
   {System::MillimetreGramSecondKelvin, Unit::Diffusivity::SquareMillimetrePerSecond},
   {System::FootPoundSecondRankine, Unit::Diffusivity::SquareFootPerSecond},
   {System::InchPoundSecondRankine, Unit::Diffusivity::SquareInchPerSecond}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::Diffusivity>), "The consistent_units table must be listed in the order of its enumeration.");
 
-template <> const std::map<Unit::Diffusivity, System> related_systems<Unit::Diffusivity>{
+template <> constexpr const std::array<std::pair<Unit::Diffusivity, System>, 4> related_systems<Unit::Diffusivity>{{
   {Unit::Diffusivity::SquareMetrePerSecond, System::MetreKilogramSecondKelvin},
   {Unit::Diffusivity::SquareMillimetrePerSecond, System::MillimetreGramSecondKelvin},
   {Unit::Diffusivity::SquareFootPerSecond, System::FootPoundSecondRankine},
-  {Unit::Diffusivity::SquareInchPerSecond, System::InchPoundSecondRankine},
-};
+  {Unit::Diffusivity::SquareInchPerSecond, System::InchPoundSecondRankine}
+}};
 
 template <> constexpr const Unit::Diffusivity standard_unit<Unit::Diffusivity>{Unit::Diffusivity::SquareMetrePerSecond};
 
 template <> constexpr const Dimension::Set dimension<Unit::Diffusivity>{Dimension::Set{Dimension::Length{2}, Dimension::Mass{}, Dimension::Time{-1}}};
 
-template <> const std::map<Unit::Diffusivity, std::map<Unit::Diffusivity, std::function<void(std::vector<double>&)>>> conversions<Unit::Diffusivity>{
-  {Unit::Diffusivity::SquareMilePerSecond, {
-    {Unit::Diffusivity::SquareMilePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Diffusivity::SquareKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1.609344, 2);});}},
-    {Unit::Diffusivity::SquareYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1760.0, 2);});}},
-    {Unit::Diffusivity::SquareMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1609.344, 2);});}},
-    {Unit::Diffusivity::SquareFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(5280.0, 2);});}},
-    {Unit::Diffusivity::SquareDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(16093.44, 2);});}},
-    {Unit::Diffusivity::SquareInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(63360.0, 2);});}},
-    {Unit::Diffusivity::SquareCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(160934.4, 2);});}},
-    {Unit::Diffusivity::SquareMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1609344.0, 2);});}},
-    {Unit::Diffusivity::SquareMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(63360000.0, 2);});}},
-    {Unit::Diffusivity::SquareMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1609344000.0, 2);});}},
-    {Unit::Diffusivity::SquareMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(63360000000.0, 2);});}}
-  }},
-  {Unit::Diffusivity::SquareKilometrePerSecond, {
-    {Unit::Diffusivity::SquareMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1.609344, 2);});}},
-    {Unit::Diffusivity::SquareKilometrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Diffusivity::SquareYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0009144, 2);});}},
-    {Unit::Diffusivity::SquareMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 2);});}},
-    {Unit::Diffusivity::SquareFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0003048, 2);});}},
-    {Unit::Diffusivity::SquareDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10000.0, 2);});}},
-    {Unit::Diffusivity::SquareInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000254, 2);});}},
-    {Unit::Diffusivity::SquareCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100000.0, 2);});}},
-    {Unit::Diffusivity::SquareMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000.0, 2);});}},
-    {Unit::Diffusivity::SquareMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000000254, 2);});}},
-    {Unit::Diffusivity::SquareMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000000.0, 2);});}},
-    {Unit::Diffusivity::SquareMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000000000254, 2);});}}
-  }},
-  {Unit::Diffusivity::SquareYardPerSecond, {
-    {Unit::Diffusivity::SquareMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1760.0, 2);});}},
-    {Unit::Diffusivity::SquareKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0009144, 2);});}},
-    {Unit::Diffusivity::SquareYardPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Diffusivity::SquareMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.9144, 2);});}},
-    {Unit::Diffusivity::SquareFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(3.0, 2);});}},
-    {Unit::Diffusivity::SquareDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(9.144, 2);});}},
-    {Unit::Diffusivity::SquareInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(36.0, 2);});}},
-    {Unit::Diffusivity::SquareCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(91.44, 2);});}},
-    {Unit::Diffusivity::SquareMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(914.4, 2);});}},
-    {Unit::Diffusivity::SquareMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(36000.0, 2);});}},
-    {Unit::Diffusivity::SquareMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(914400.0, 2);});}},
-    {Unit::Diffusivity::SquareMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(36000000.0, 2);});}}
-  }},
-  {Unit::Diffusivity::SquareMetrePerSecond, {
-    {Unit::Diffusivity::SquareMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1609.344, 2);});}},
-    {Unit::Diffusivity::SquareKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 2);});}},
-    {Unit::Diffusivity::SquareYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.9144, 2);});}},
-    {Unit::Diffusivity::SquareMetrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Diffusivity::SquareFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.3048, 2);});}},
-    {Unit::Diffusivity::SquareDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 2);});}},
-    {Unit::Diffusivity::SquareInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0254, 2);});}},
-    {Unit::Diffusivity::SquareCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100.0, 2);});}},
-    {Unit::Diffusivity::SquareMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 2);});}},
-    {Unit::Diffusivity::SquareMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000254, 2);});}},
-    {Unit::Diffusivity::SquareMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000.0, 2);});}},
-    {Unit::Diffusivity::SquareMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000000254, 2);});}}
-  }},
-  {Unit::Diffusivity::SquareFootPerSecond, {
-    {Unit::Diffusivity::SquareMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(5280.0, 2);});}},
-    {Unit::Diffusivity::SquareKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0003048, 2);});}},
-    {Unit::Diffusivity::SquareYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(3.0, 2);});}},
-    {Unit::Diffusivity::SquareMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.3048, 2);});}},
-    {Unit::Diffusivity::SquareFootPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Diffusivity::SquareDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(3.048, 2);});}},
-    {Unit::Diffusivity::SquareInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12.0, 2);});}},
-    {Unit::Diffusivity::SquareCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(30.48, 2);});}},
-    {Unit::Diffusivity::SquareMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(304.8, 2);});}},
-    {Unit::Diffusivity::SquareMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12000.0, 2);});}},
-    {Unit::Diffusivity::SquareMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(304800.0, 2);});}},
-    {Unit::Diffusivity::SquareMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12000000.0, 2);});}}
-  }},
-  {Unit::Diffusivity::SquareDecimetrePerSecond, {
-    {Unit::Diffusivity::SquareMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(16093.44, 2);});}},
-    {Unit::Diffusivity::SquareKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0001, 2);});}},
-    {Unit::Diffusivity::SquareYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(9.144, 2);});}},
-    {Unit::Diffusivity::SquareMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 2);});}},
-    {Unit::Diffusivity::SquareFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(3.048, 2);});}},
-    {Unit::Diffusivity::SquareDecimetrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Diffusivity::SquareInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.254, 2);});}},
-    {Unit::Diffusivity::SquareCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 2);});}},
-    {Unit::Diffusivity::SquareMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100.0, 2);});}},
-    {Unit::Diffusivity::SquareMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.000254, 2);});}},
-    {Unit::Diffusivity::SquareMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100000.0, 2);});}},
-    {Unit::Diffusivity::SquareMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.000000254, 2);});}}
-  }},
-  {Unit::Diffusivity::SquareInchPerSecond, {
-    {Unit::Diffusivity::SquareMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(63360.0, 2);});}},
-    {Unit::Diffusivity::SquareKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000254, 2);});}},
-    {Unit::Diffusivity::SquareYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(36.0, 2);});}},
-    {Unit::Diffusivity::SquareMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 2);});}},
-    {Unit::Diffusivity::SquareFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12.0, 2);});}},
-    {Unit::Diffusivity::SquareDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.254, 2);});}},
-    {Unit::Diffusivity::SquareInchPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Diffusivity::SquareCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(2.54, 2);});}},
-    {Unit::Diffusivity::SquareMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(25.4, 2);});}},
-    {Unit::Diffusivity::SquareMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 2);});}},
-    {Unit::Diffusivity::SquareMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(25400.0, 2);});}},
-    {Unit::Diffusivity::SquareMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000.0, 2);});}}
-  }},
-  {Unit::Diffusivity::SquareCentimetrePerSecond, {
-    {Unit::Diffusivity::SquareMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(160934.4, 2);});}},
-    {Unit::Diffusivity::SquareKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00001, 2);});}},
-    {Unit::Diffusivity::SquareYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(91.44, 2);});}},
-    {Unit::Diffusivity::SquareMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.01, 2);});}},
-    {Unit::Diffusivity::SquareFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(30.48, 2);});}},
-    {Unit::Diffusivity::SquareDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 2);});}},
-    {Unit::Diffusivity::SquareInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(2.54, 2);});}},
-    {Unit::Diffusivity::SquareCentimetrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Diffusivity::SquareMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 2);});}},
-    {Unit::Diffusivity::SquareMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.00254, 2);});}},
-    {Unit::Diffusivity::SquareMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10000.0, 2);});}},
-    {Unit::Diffusivity::SquareMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.00000254, 2);});}}
-  }},
-  {Unit::Diffusivity::SquareMillimetrePerSecond, {
-    {Unit::Diffusivity::SquareMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1609344.0, 2);});}},
-    {Unit::Diffusivity::SquareKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000001, 2);});}},
-    {Unit::Diffusivity::SquareYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(914.4, 2);});}},
-    {Unit::Diffusivity::SquareMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 2);});}},
-    {Unit::Diffusivity::SquareFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(304.8, 2);});}},
-    {Unit::Diffusivity::SquareDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.01, 2);});}},
-    {Unit::Diffusivity::SquareInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(25.4, 2);});}},
-    {Unit::Diffusivity::SquareCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 2);});}},
-    {Unit::Diffusivity::SquareMillimetrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Diffusivity::SquareMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0254, 2);});}},
-    {Unit::Diffusivity::SquareMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 2);});}},
-    {Unit::Diffusivity::SquareMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000254, 2);});}}
-  }},
-  {Unit::Diffusivity::SquareMilliinchPerSecond, {
-    {Unit::Diffusivity::SquareMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(63360000.0, 2);});}},
-    {Unit::Diffusivity::SquareKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000000254, 2);});}},
-    {Unit::Diffusivity::SquareYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(36000.0, 2);});}},
-    {Unit::Diffusivity::SquareMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000254, 2);});}},
-    {Unit::Diffusivity::SquareFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12000.0, 2);});}},
-    {Unit::Diffusivity::SquareDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000254, 2);});}},
-    {Unit::Diffusivity::SquareInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 2);});}},
-    {Unit::Diffusivity::SquareCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00254, 2);});}},
-    {Unit::Diffusivity::SquareMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 2);});}},
-    {Unit::Diffusivity::SquareMilliinchPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Diffusivity::SquareMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(25.4, 2);});}},
-    {Unit::Diffusivity::SquareMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 2);});}}
-  }},
-  {Unit::Diffusivity::SquareMicrometrePerSecond, {
-    {Unit::Diffusivity::SquareMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1609344000.0, 2);});}},
-    {Unit::Diffusivity::SquareKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000000001, 2);});}},
-    {Unit::Diffusivity::SquareYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(914400.0, 2);});}},
-    {Unit::Diffusivity::SquareMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000001, 2);});}},
-    {Unit::Diffusivity::SquareFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(304800.0, 2);});}},
-    {Unit::Diffusivity::SquareDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00001, 2);});}},
-    {Unit::Diffusivity::SquareInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(25400.0, 2);});}},
-    {Unit::Diffusivity::SquareCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0001, 2);});}},
-    {Unit::Diffusivity::SquareMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 2);});}},
-    {Unit::Diffusivity::SquareMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(25.4, 2);});}},
-    {Unit::Diffusivity::SquareMicrometrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Diffusivity::SquareMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0254, 2);});}}
-  }},
-  {Unit::Diffusivity::SquareMicroinchPerSecond, {
-    {Unit::Diffusivity::SquareMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(63360000000.0, 2);});}},
-    {Unit::Diffusivity::SquareKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000000000254, 2);});}},
-    {Unit::Diffusivity::SquareYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(36000000.0, 2);});}},
-    {Unit::Diffusivity::SquareMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000000254, 2);});}},
-    {Unit::Diffusivity::SquareFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12000000.0, 2);});}},
-    {Unit::Diffusivity::SquareDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000000254, 2);});}},
-    {Unit::Diffusivity::SquareInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000001, 2);});}},
-    {Unit::Diffusivity::SquareCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00000254, 2);});}},
-    {Unit::Diffusivity::SquareMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000254, 2);});}},
-    {Unit::Diffusivity::SquareMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 2);});}},
-    {Unit::Diffusivity::SquareMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 2);});}},
-    {Unit::Diffusivity::SquareMicroinchPerSecond, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 12> conversion_factors<Unit::Diffusivity>{
+  derived_conversion_factor<Unit::Diffusivity>(Unit::Length::Mile, Unit::Time::Second),
+  derived_conversion_factor<Unit::Diffusivity>(Unit::Length::Kilometre, Unit::Time::Second),
+  derived_conversion_factor<Unit::Diffusivity>(Unit::Length::Yard, Unit::Time::Second),
+  derived_conversion_factor<Unit::Diffusivity>(Unit::Length::Metre, Unit::Time::Second),
+  derived_conversion_factor<Unit::Diffusivity>(Unit::Length::Foot, Unit::Time::Second),
+  derived_conversion_factor<Unit::Diffusivity>(Unit::Length::Decimetre, Unit::Time::Second),
+  derived_conversion_factor<Unit::Diffusivity>(Unit::Length::Inch, Unit::Time::Second),
+  derived_conversion_factor<Unit::Diffusivity>(Unit::Length::Centimetre, Unit::Time::Second),
+  derived_conversion_factor<Unit::Diffusivity>(Unit::Length::Millimetre, Unit::Time::Second),
+  derived_conversion_factor<Unit::Diffusivity>(Unit::Length::Milliinch, Unit::Time::Second),
+  derived_conversion_factor<Unit::Diffusivity>(Unit::Length::Micrometre, Unit::Time::Second),
+  derived_conversion_factor<Unit::Diffusivity>(Unit::Length::Microinch, Unit::Time::Second)
 };
 
 } // namespace PhQ
@@ -7,6 +7,9 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "Mass.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -23,16 +26,18 @@ enum class DynamicViscosity : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::DynamicViscosity, std::string> abbreviations<Unit::DynamicViscosity>{
+template <> constexpr const std::array<std::pair<Unit::DynamicViscosity, std::string_view>, 6> abbreviations<Unit::DynamicViscosity>{{
   {Unit::DynamicViscosity::PascalSecond, "Pa·s"},
   {Unit::DynamicViscosity::KilopascalSecond, "kPa·s"},
   {Unit::DynamicViscosity::MegapascalSecond, "MPa·s"},
   {Unit::DynamicViscosity::GigapascalSecond, "GPa·s"},
   {Unit::DynamicViscosity::PoundSecondPerSquareFoot, "lbf·s/ft^2"},
   {Unit::DynamicViscosity::PoundSecondPerSquareInch, "lbf·s/in^2"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::DynamicViscosity>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::DynamicViscosity> spellings<Unit::DynamicViscosity>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::DynamicViscosity>, 55> spellings<Unit::DynamicViscosity>{{
   {"Pa·s", Unit::DynamicViscosity::PascalSecond},
   {"Pa*s", Unit::DynamicViscosity::PascalSecond},
   {"N·s/m^2", Unit::DynamicViscosity::PascalSecond},
@@ -88,68 +93,28 @@ template <> const std::unordered_map<std::string, Unit::DynamicViscosity> spelli
   {"lb*s/in2", Unit::DynamicViscosity::PoundSecondPerSquareInch},
   {"psi·s", Unit::DynamicViscosity::PoundSecondPerSquareInch},
   {"psi*s", Unit::DynamicViscosity::PoundSecondPerSquareInch}
-};
+}};
 
-template <> const std::map<System, Unit::DynamicViscosity> consistent_units<Unit::DynamicViscosity>{
+template <> constexpr const std::array<std::pair<System, Unit::DynamicViscosity>, 4> consistent_units<Unit::DynamicViscosity>{{
   {System::MetreKilogramSecondKelvin, Unit::DynamicViscosity::PascalSecond},
   {System::MillimetreGramSecondKelvin, Unit::DynamicViscosity::PascalSecond},
   {System::FootPoundSecondRankine, Unit::DynamicViscosity::PoundSecondPerSquareFoot},
   {System::InchPoundSecondRankine, Unit::DynamicViscosity::PoundSecondPerSquareInch}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::DynamicViscosity>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::DynamicViscosity standard_unit<Unit::DynamicViscosity>{Unit::DynamicViscosity::PascalSecond};
 
 template <> constexpr const Dimension::Set dimension<Unit::DynamicViscosity>{Dimension::Set{Dimension::Length{-1}, Dimension::Mass{1}, Dimension::Time{-1}}};
 
-template <> const std::map<Unit::DynamicViscosity, std::map<Unit::DynamicViscosity, std::function<void(std::vector<double>&)>>> conversions<Unit::DynamicViscosity>{
-  {Unit::DynamicViscosity::PascalSecond, {
-    {Unit::DynamicViscosity::PascalSecond, [](std::vector<double>& values)->void{}},
-    {Unit::DynamicViscosity::KilopascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::DynamicViscosity::MegapascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001;});}},
-    {Unit::DynamicViscosity::GigapascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000000001;});}},
-    {Unit::DynamicViscosity::PoundSecondPerSquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.3048, 2) / (0.45359237 * 9.80665);});}},
-    {Unit::DynamicViscosity::PoundSecondPerSquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 2) / (0.45359237 * 9.80665);});}}
-  }},
-  {Unit::DynamicViscosity::KilopascalSecond, {
-    {Unit::DynamicViscosity::PascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::DynamicViscosity::KilopascalSecond, [](std::vector<double>& values)->void{}},
-    {Unit::DynamicViscosity::MegapascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::DynamicViscosity::GigapascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001;});}},
-    {Unit::DynamicViscosity::PoundSecondPerSquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0 * std::pow(0.3048, 2) / (0.45359237 * 9.80665);});}},
-    {Unit::DynamicViscosity::PoundSecondPerSquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0 * std::pow(0.0254, 2) / (0.45359237 * 9.80665);});}}
-  }},
-  {Unit::DynamicViscosity::MegapascalSecond, {
-    {Unit::DynamicViscosity::PascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0;});}},
-    {Unit::DynamicViscosity::KilopascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::DynamicViscosity::MegapascalSecond, [](std::vector<double>& values)->void{}},
-    {Unit::DynamicViscosity::GigapascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::DynamicViscosity::PoundSecondPerSquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0 * std::pow(0.3048, 2) / (0.45359237 * 9.80665);});}},
-    {Unit::DynamicViscosity::PoundSecondPerSquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0 * std::pow(0.0254, 2) / (0.45359237 * 9.80665);});}}
-  }},
-  {Unit::DynamicViscosity::GigapascalSecond, {
-    {Unit::DynamicViscosity::PascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000000.0;});}},
-    {Unit::DynamicViscosity::KilopascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0;});}},
-    {Unit::DynamicViscosity::MegapascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::DynamicViscosity::GigapascalSecond, [](std::vector<double>& values)->void{}},
-    {Unit::DynamicViscosity::PoundSecondPerSquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000000.0 * std::pow(0.3048, 2) / (0.45359237 * 9.80665);});}},
-    {Unit::DynamicViscosity::PoundSecondPerSquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000000.0 * std::pow(0.0254, 2) / (0.45359237 * 9.80665);});}}
-  }},
-  {Unit::DynamicViscosity::PoundSecondPerSquareFoot, {
-    {Unit::DynamicViscosity::PascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / std::pow(0.3048, 2);});}},
-    {Unit::DynamicViscosity::KilopascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001 * 0.45359237 * 9.80665 / std::pow(0.3048, 2);});}},
-    {Unit::DynamicViscosity::MegapascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001 * 0.45359237 * 9.80665 / std::pow(0.3048, 2);});}},
-    {Unit::DynamicViscosity::GigapascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000000001 * 0.45359237 * 9.80665 / std::pow(0.3048, 2);});}},
-    {Unit::DynamicViscosity::PoundSecondPerSquareFoot, [](std::vector<double>& values)->void{}},
-    {Unit::DynamicViscosity::PoundSecondPerSquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12.0, 2);});}}
-  }},
-  {Unit::DynamicViscosity::PoundSecondPerSquareInch, {
-    {Unit::DynamicViscosity::PascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / std::pow(0.0254, 2);});}},
-    {Unit::DynamicViscosity::KilopascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001 * 0.45359237 * 9.80665 / std::pow(0.0254, 2);});}},
-    {Unit::DynamicViscosity::MegapascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001 * 0.45359237 * 9.80665 / std::pow(0.0254, 2);});}},
-    {Unit::DynamicViscosity::GigapascalSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000000001 * 0.45359237 * 9.80665 / std::pow(0.0254, 2);});}},
-    {Unit::DynamicViscosity::PoundSecondPerSquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12.0, 2);});}},
-    {Unit::DynamicViscosity::PoundSecondPerSquareInch, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 6> conversion_factors<Unit::DynamicViscosity>{
+  ConversionFactor{1.0},
+  ConversionFactor{1000.0},
+  ConversionFactor{1000000.0},
+  ConversionFactor{1000000000.0},
+  derived_conversion_factor<Unit::DynamicViscosity>(Unit::Length::Foot, Unit::Mass::Slug, Unit::Time::Second),
+  derived_conversion_factor<Unit::DynamicViscosity>(Unit::Length::Inch, Unit::Mass::Slinch, Unit::Time::Second)
 };
 
 } // namespace PhQ
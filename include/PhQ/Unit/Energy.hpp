@@ -7,6 +7,9 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "Mass.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -26,7 +29,7 @@ enum class Energy : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::Energy, std::string> abbreviations<Unit::Energy>{
+template <> constexpr const std::array<std::pair<Unit::Energy, std::string_view>, 9> abbreviations<Unit::Energy>{{
   {Unit::Energy::Joule, "J"},
   {Unit::Energy::Millijoule, "mJ"},
   {Unit::Energy::Microjoule, "μJ"},
@@ -36,9 +39,11 @@ template <> const std::map<Unit::Energy, std::string> abbreviations<Unit::Energy
   {Unit::Energy::Gigajoule, "GJ"},
   {Unit::Energy::FootPound, "ft·lbf"},
   {Unit::Energy::InchPound, "in·lbf"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::Energy>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::Energy> spellings<Unit::Energy>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::Energy>, 30> spellings<Unit::Energy>{{
   {"J", Unit::Energy::Joule},
   {"N·m", Unit::Energy::Joule},
   {"N*m", Unit::Energy::Joule},
@@ -69,119 +74,31 @@ template <> const std::unordered_map<std::string, Unit::Energy> spellings<Unit::
   {"in*lbf", Unit::Energy::InchPound},
   {"in·lb", Unit::Energy::InchPound},
   {"in*lb", Unit::Energy::InchPound}
-};
+}};
 
-template <> const std::map<System, Unit::Energy> consistent_units<Unit::Energy>{
+template <> constexpr const std::array<std::pair<System, Unit::Energy>, 4> consistent_units<Unit::Energy>{{
   {System::MetreKilogramSecondKelvin, Unit::Energy::Joule},
   {System::MillimetreGramSecondKelvin, Unit::Energy::Nanojoule},
   {System::FootPoundSecondRankine, Unit::Energy::FootPound},
   {System::InchPoundSecondRankine, Unit::Energy::InchPound}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::Energy>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::Energy standard_unit<Unit::Energy>{Unit::Energy::Joule};
 
 template <> constexpr const Dimension::Set dimension<Unit::Energy>{Dimension::Set{Dimension::Length{2}, Dimension::Mass{1}, Dimension::Time{-2}}};
 
-template <> const std::map<Unit::Energy, std::map<Unit::Energy, std::function<void(std::vector<double>&)>>> conversions<Unit::Energy>{
-  {Unit::Energy::Joule, {
-    {Unit::Energy::Joule, [](std::vector<double>& values)->void{}},
-    {Unit::Energy::Millijoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3;});}},
-    {Unit::Energy::Microjoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6;});}},
-    {Unit::Energy::Nanojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e9;});}},
-    {Unit::Energy::Kilojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3;});}},
-    {Unit::Energy::Megajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-6;});}},
-    {Unit::Energy::Gigajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-9;});}},
-    {Unit::Energy::FootPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::InchPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0254 * 0.45359237 * 9.80665;});}}
-  }},
-  {Unit::Energy::Millijoule, {
-    {Unit::Energy::Joule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3;});}},
-    {Unit::Energy::Millijoule, [](std::vector<double>& values)->void{}},
-    {Unit::Energy::Microjoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3;});}},
-    {Unit::Energy::Nanojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6;});}},
-    {Unit::Energy::Kilojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-6;});}},
-    {Unit::Energy::Megajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-9;});}},
-    {Unit::Energy::Gigajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-12;});}},
-    {Unit::Energy::FootPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e3 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::InchPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e3 * 0.0254 * 0.45359237 * 9.80665;});}}
-  }},
-  {Unit::Energy::Microjoule, {
-    {Unit::Energy::Joule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-6;});}},
-    {Unit::Energy::Millijoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3;});}},
-    {Unit::Energy::Microjoule, [](std::vector<double>& values)->void{}},
-    {Unit::Energy::Nanojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3;});}},
-    {Unit::Energy::Kilojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-9;});}},
-    {Unit::Energy::Megajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-12;});}},
-    {Unit::Energy::Gigajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-15;});}},
-    {Unit::Energy::FootPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e6 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::InchPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e6 * 0.0254 * 0.45359237 * 9.80665;});}}
-  }},
-  {Unit::Energy::Nanojoule, {
-    {Unit::Energy::Joule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-9;});}},
-    {Unit::Energy::Millijoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-6;});}},
-    {Unit::Energy::Microjoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3;});}},
-    {Unit::Energy::Nanojoule, [](std::vector<double>& values)->void{}},
-    {Unit::Energy::Kilojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-12;});}},
-    {Unit::Energy::Megajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-15;});}},
-    {Unit::Energy::Gigajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-18;});}},
-    {Unit::Energy::FootPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e9 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::InchPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e9 * 0.0254 * 0.45359237 * 9.80665;});}}
-  }},
-  {Unit::Energy::Kilojoule, {
-    {Unit::Energy::Joule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3;});}},
-    {Unit::Energy::Millijoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6;});}},
-    {Unit::Energy::Microjoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e9;});}},
-    {Unit::Energy::Nanojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e12;});}},
-    {Unit::Energy::Kilojoule, [](std::vector<double>& values)->void{}},
-    {Unit::Energy::Megajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3;});}},
-    {Unit::Energy::Gigajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-6;});}},
-    {Unit::Energy::FootPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e-3 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::InchPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e-3 * 0.0254 * 0.45359237 * 9.80665;});}}
-  }},
-  {Unit::Energy::Megajoule, {
-    {Unit::Energy::Joule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6;});}},
-    {Unit::Energy::Millijoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e9;});}},
-    {Unit::Energy::Microjoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e12;});}},
-    {Unit::Energy::Nanojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e15;});}},
-    {Unit::Energy::Kilojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3;});}},
-    {Unit::Energy::Megajoule, [](std::vector<double>& values)->void{}},
-    {Unit::Energy::Gigajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3;});}},
-    {Unit::Energy::FootPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e-6 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::InchPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e-6 * 0.0254 * 0.45359237 * 9.80665;});}}
-  }},
-  {Unit::Energy::Gigajoule, {
-    {Unit::Energy::Joule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e9;});}},
-    {Unit::Energy::Millijoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e12;});}},
-    {Unit::Energy::Microjoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e15;});}},
-    {Unit::Energy::Nanojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e18;});}},
-    {Unit::Energy::Kilojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6;});}},
-    {Unit::Energy::Megajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3;});}},
-    {Unit::Energy::Gigajoule, [](std::vector<double>& values)->void{}},
-    {Unit::Energy::FootPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e-9 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::InchPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e-9 * 0.0254 * 0.45359237 * 9.80665;});}}
-  }},
-  {Unit::Energy::FootPound, {
-    {Unit::Energy::Joule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::Millijoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::Microjoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::Nanojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e9 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::Kilojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::Megajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-6 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::Gigajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-9 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::FootPound, [](std::vector<double>& values)->void{}},
-    {Unit::Energy::InchPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12.0;});}}
-  }},
-  {Unit::Energy::InchPound, {
-    {Unit::Energy::Joule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::Millijoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3 * 0.0254 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::Microjoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6 * 0.0254 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::Nanojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e9 * 0.0254 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::Kilojoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3 * 0.0254 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::Megajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-6 * 0.0254 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::Gigajoule, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-9 * 0.0254 * 0.45359237 * 9.80665;});}},
-    {Unit::Energy::FootPound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12.0;});}},
-    {Unit::Energy::InchPound, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 9> conversion_factors<Unit::Energy>{
+  ConversionFactor{1.0},
+  ConversionFactor{0.001},
+  ConversionFactor{0.000001},
+  derived_conversion_factor<Unit::Energy>(Unit::Length::Millimetre, Unit::Mass::Gram, Unit::Time::Second),
+  ConversionFactor{1000.0},
+  ConversionFactor{1000000.0},
+  ConversionFactor{1000000000.0},
+  derived_conversion_factor<Unit::Energy>(Unit::Length::Foot, Unit::Mass::Slug, Unit::Time::Second),
+  derived_conversion_factor<Unit::Energy>(Unit::Length::Inch, Unit::Mass::Slinch, Unit::Time::Second)
 };
 
 } // namespace PhQ
@@ -7,6 +7,9 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "Mass.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -21,14 +24,16 @@ enum class EnergyFlux : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::EnergyFlux, std::string> abbreviations<Unit::EnergyFlux>{
+template <> constexpr const std::array<std::pair<Unit::EnergyFlux, std::string_view>, 4> abbreviations<Unit::EnergyFlux>{{
   {Unit::EnergyFlux::WattPerSquareMetre, "W/m^2"},
   {Unit::EnergyFlux::NanowattPerSquareMillimetre, "nW/mm^2"},
   {Unit::EnergyFlux::FootPoundPerSquareFootPerSecond, "ft·lbf/ft^2/s"},
   {Unit::EnergyFlux::InchPoundPerSquareInchPerSecond, "in·lbf/in^2/s"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::EnergyFlux>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::EnergyFlux> spellings<Unit::EnergyFlux>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::EnergyFlux>, 55> spellings<Unit::EnergyFlux>{{
   {"W/m^2", Unit::EnergyFlux::WattPerSquareMetre},
   {"W/m2", Unit::EnergyFlux::WattPerSquareMetre},
   {"J/(m^2·s)", Unit::EnergyFlux::WattPerSquareMetre},
@@ -84,44 +89,26 @@ template <> const std::unordered_map<std::string, Unit::EnergyFlux> spellings<Un
   {"lbf/in/s", Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
   {"slinch/s^3", Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
   {"slinch/s3", Unit::EnergyFlux::InchPoundPerSquareInchPerSecond}
-};
+}};
 
-template <> const std::map<System, Unit::EnergyFlux> consistent_units<Unit::EnergyFlux>{
+template <> constexpr const std::array<std::pair<System, Unit::EnergyFlux>, 4> consistent_units<Unit::EnergyFlux>{{
   {System::MetreKilogramSecondKelvin, Unit::EnergyFlux::WattPerSquareMetre},
   {System::MillimetreGramSecondKelvin, Unit::EnergyFlux::NanowattPerSquareMillimetre},
   {System::FootPoundSecondRankine, Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
   {System::InchPoundSecondRankine, Unit::EnergyFlux::InchPoundPerSquareInchPerSecond}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::EnergyFlux>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::EnergyFlux standard_unit<Unit::EnergyFlux>{Unit::EnergyFlux::WattPerSquareMetre};
 
 template <> constexpr const Dimension::Set dimension<Unit::EnergyFlux>{Dimension::Set{Dimension::Length{0}, Dimension::Mass{1}, Dimension::Time{-3}}};
 
-template <> const std::map<Unit::EnergyFlux, std::map<Unit::EnergyFlux, std::function<void(std::vector<double>&)>>> conversions<Unit::EnergyFlux>{
-  {Unit::EnergyFlux::WattPerSquareMetre, {
-    {Unit::EnergyFlux::WattPerSquareMetre, [](std::vector<double>& values)->void{}},
-    {Unit::EnergyFlux::NanowattPerSquareMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::EnergyFlux::FootPoundPerSquareFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.3048 / (0.45359237 * 9.80665);});}},
-    {Unit::EnergyFlux::InchPoundPerSquareInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254 / (0.45359237 * 9.80665);});}}
-  }},
-  {Unit::EnergyFlux::NanowattPerSquareMillimetre, {
-    {Unit::EnergyFlux::WattPerSquareMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::EnergyFlux::NanowattPerSquareMillimetre, [](std::vector<double>& values)->void{}},
-    {Unit::EnergyFlux::FootPoundPerSquareFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0003048 / (0.45359237 * 9.80665);});}},
-    {Unit::EnergyFlux::InchPoundPerSquareInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0000254 / (0.45359237 * 9.80665);});}}
-  }},
-  {Unit::EnergyFlux::FootPoundPerSquareFootPerSecond, {
-    {Unit::EnergyFlux::WattPerSquareMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / 0.3048;});}},
-    {Unit::EnergyFlux::NanowattPerSquareMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 453.59237 * 9.80665 / 0.3048;});}},
-    {Unit::EnergyFlux::FootPoundPerSquareFootPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::EnergyFlux::InchPoundPerSquareInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12.0;});}}
-  }},
-  {Unit::EnergyFlux::InchPoundPerSquareInchPerSecond, {
-    {Unit::EnergyFlux::WattPerSquareMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / 0.0254;});}},
-    {Unit::EnergyFlux::NanowattPerSquareMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 453.59237 * 9.80665 / 0.0254;});}},
-    {Unit::EnergyFlux::FootPoundPerSquareFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12.0;});}},
-    {Unit::EnergyFlux::InchPoundPerSquareInchPerSecond, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 4> conversion_factors<Unit::EnergyFlux>{
+  ConversionFactor{1.0},
+  derived_conversion_factor<Unit::EnergyFlux>(Unit::Length::Millimetre, Unit::Mass::Gram, Unit::Time::Second),
+  derived_conversion_factor<Unit::EnergyFlux>(Unit::Length::Foot, Unit::Mass::Slug, Unit::Time::Second),
+  derived_conversion_factor<Unit::EnergyFlux>(Unit::Length::Inch, Unit::Mass::Slinch, Unit::Time::Second)
 };
 
 } // namespace PhQ
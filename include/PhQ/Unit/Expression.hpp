@@ -0,0 +1,409 @@
+// Copyright 2020 Alexandre Coderre-Chabot
+// This file is part of Physical Quantities (PhQ), a C++17 header-only library of physical quantities, physical models, and units of measure for scientific computation.
+// Physical Quantities is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+// You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Acceleration.hpp"
+#include "Angle.hpp"
+#include "AngularAcceleration.hpp"
+#include "AngularSpeed.hpp"
+#include "Area.hpp"
+#include "Diffusivity.hpp"
+#include "DynamicViscosity.hpp"
+#include "Energy.hpp"
+#include "EnergyFlux.hpp"
+#include "Force.hpp"
+#include "Frequency.hpp"
+#include "HeatCapacity.hpp"
+#include "Length.hpp"
+#include "Mass.hpp"
+#include "MassDensity.hpp"
+#include "MassRate.hpp"
+#include "Power.hpp"
+#include "Pressure.hpp"
+#include "SpecificEnergy.hpp"
+#include "SpecificHeatCapacity.hpp"
+#include "SpecificPower.hpp"
+#include "Speed.hpp"
+#include "Temperature.hpp"
+#include "TemperatureGradient.hpp"
+#include "ThermalConductivity.hpp"
+#include "ThermalExpansion.hpp"
+#include "Time.hpp"
+#include "Volume.hpp"
+#include "VolumeRate.hpp"
+
+namespace PhQ {
+
+/// \brief Abbreviation, physical dimension set, and conversion factor of a unit expression such as "kg·m/s^2" or "W/(m·K)". The conversion factor is from the expression to the base units of the metre-kilogram-second-kelvin system, which are the standard units of every unit type.
+class ResolvedUnit {
+
+public:
+
+  explicit constexpr ResolvedUnit(std::string_view abbreviation = {}, const Dimension::Set& dimension_set = {}, const ConversionFactor& factor = {}) noexcept : abbreviation_(abbreviation), dimension_set_(dimension_set), factor_(factor) {}
+
+  constexpr std::string_view abbreviation() const noexcept {
+    return abbreviation_;
+  }
+
+  constexpr const Dimension::Set& dimension() const noexcept {
+    return dimension_set_;
+  }
+
+  constexpr const ConversionFactor& factor() const noexcept {
+    return factor_;
+  }
+
+private:
+
+  std::string_view abbreviation_;
+
+  Dimension::Set dimension_set_;
+
+  ConversionFactor factor_;
+
+};
+
+/// \brief Resolved standard unit of a unit type, such as "m" for PhQ::Unit::Length. Has static storage duration, so it can be referenced for the life of the program.
+template <typename Unit> constexpr const ResolvedUnit standard_resolved_unit{abbreviation(standard_unit<Unit>), dimension<Unit>, ConversionFactor{}};
+
+/// \brief Resolve a single unit symbol, such as "lbf" or "°C", from the spellings of the first of the given unit types that accepts it.
+template <typename... Units> bool resolve_unit_symbol(std::string_view symbol, ResolvedUnit& resolved) noexcept {
+  const auto resolve{[symbol, &resolved](auto unit_type) {
+    using Unit = decltype(unit_type);
+    const std::optional<Unit> unit{parse<Unit>(symbol)};
+    if (unit.has_value()) {
+      resolved = ResolvedUnit{symbol, dimension<Unit>, conversion_factors<Unit>[static_cast<std::size_t>(unit.value())]};
+    }
+    return unit.has_value();
+  }};
+  return (resolve(Units{}) || ...);
+}
+
+/// \brief Recursive-descent parser of unit expressions. Symbols are multiplied with "·" or "*", divided with "/", raised to integer powers with "^", "²", or "³", and grouped with parentheses. Division applies to the next symbol or group only, so "J/kg/K" is a joule per kilogram per kelvin.
+/// \details Symbols are looked up among the spellings of the base unit types first, so "lb" is a pound of mass, and then among those of the derived unit types. An expression that is a single symbol keeps its offset, so "°C" is an absolute temperature. Within any larger expression, only the scale is kept, so "W/(m·°C)" and "W/(m·K)" are the same unit.
+class UnitExpressionParser {
+
+public:
+
+  constexpr explicit UnitExpressionParser(std::string_view text) noexcept : expression_(text), text_(text), symbols_(0), operators_(0), depth_(0) {}
+
+  std::optional<ResolvedUnit> parse() noexcept {
+    double scale{1.0};
+    Dimension::Set dimension_set;
+    double offset{0.0};
+    if (!product(dimension_set, scale, offset)) {
+      return std::nullopt;
+    }
+    skip_whitespace();
+    if (!text_.empty()) {
+      return std::nullopt;
+    }
+    return ResolvedUnit{expression_, dimension_set, {scale, symbols_ == 1 && operators_ == 0 ? offset : 0.0}};
+  }
+
+private:
+
+  static constexpr int_least8_t maximum_depth{16};
+
+  bool product(Dimension::Set& dimension_set, double& scale, double& offset) noexcept {
+    if (!power(dimension_set, scale, offset)) {
+      return false;
+    }
+    while (true) {
+      skip_whitespace();
+      bool divide{false};
+      if (consume("/")) {
+        divide = true;
+      } else if (!consume("·") && !consume("*")) {
+        return true;
+      }
+      ++operators_;
+      Dimension::Set factor_dimension_set;
+      double factor_scale{1.0};
+      if (!power(factor_dimension_set, factor_scale, offset)) {
+        return false;
+      }
+      if (divide) {
+        dimension_set /= factor_dimension_set;
+        scale /= factor_scale;
+      } else {
+        dimension_set *= factor_dimension_set;
+        scale *= factor_scale;
+      }
+    }
+  }
+
+  bool power(Dimension::Set& dimension_set, double& scale, double& offset) noexcept {
+    if (!primary(dimension_set, scale, offset)) {
+      return false;
+    }
+    skip_whitespace();
+    int_least8_t exponent{1};
+    if (consume("²")) {
+      exponent = 2;
+    } else if (consume("³")) {
+      exponent = 3;
+    } else if (consume("^")) {
+      skip_whitespace();
+      const bool parenthesized{consume("(")};
+      const std::from_chars_result result{std::from_chars(text_.data(), text_.data() + text_.size(), exponent)};
+      if (result.ec != std::errc{}) {
+        return false;
+      }
+      text_.remove_prefix(static_cast<std::size_t>(result.ptr - text_.data()));
+      if (parenthesized && !consume(")")) {
+        return false;
+      }
+    } else {
+      return true;
+    }
+    ++operators_;
+    const Dimension::Set base{dimension_set};
+    dimension_set = {};
+    for (int_least8_t index = 0; index < exponent; ++index) {
+      dimension_set *= base;
+    }
+    for (int_least8_t index = 0; index > exponent; --index) {
+      dimension_set /= base;
+    }
+    scale = integer_power(scale, exponent);
+    return true;
+  }
+
+  bool primary(Dimension::Set& dimension_set, double& scale, double& offset) noexcept {
+    skip_whitespace();
+    if (consume("(")) {
+      ++operators_;
+      if (++depth_ > maximum_depth || !product(dimension_set, scale, offset)) {
+        return false;
+      }
+      --depth_;
+      skip_whitespace();
+      return consume(")");
+    }
+    if (!text_.empty() && (std::isdigit(static_cast<unsigned char>(text_.front())) || text_.front() == '.')) {
+      const std::optional<double> number{consume_real_number(text_)};
+      if (!number.has_value()) {
+        return false;
+      }
+      ++operators_;
+      dimension_set = {};
+      scale = number.value();
+      return true;
+    }
+    const std::string_view symbol{text_.substr(0, symbol_size())};
+    if (symbol.empty()) {
+      return false;
+    }
+    text_.remove_prefix(symbol.size());
+    ResolvedUnit resolved;
+    if (!resolve_unit_symbol<Unit::Length, Unit::Mass, Unit::Time, Unit::Temperature, Unit::Angle, Unit::Acceleration, Unit::AngularAcceleration, Unit::AngularSpeed, Unit::Area, Unit::Diffusivity, Unit::DynamicViscosity, Unit::Energy, Unit::EnergyFlux, Unit::Force, Unit::Frequency, Unit::HeatCapacity, Unit::MassDensity, Unit::MassRate, Unit::Power, Unit::Pressure, Unit::SpecificEnergy, Unit::SpecificHeatCapacity, Unit::SpecificPower, Unit::Speed, Unit::TemperatureGradient, Unit::ThermalConductivity, Unit::ThermalExpansion, Unit::Volume, Unit::VolumeRate>(symbol, resolved)) {
+      return false;
+    }
+    ++symbols_;
+    dimension_set = resolved.dimension();
+    scale = resolved.factor().scale();
+    offset = resolved.factor().offset();
+    return true;
+  }
+
+  /// \brief Number of bytes of the symbol at the start of the remaining text, which ends at whitespace, an operator, a parenthesis, or a superscript.
+  std::size_t symbol_size() const noexcept {
+    std::size_t size{0};
+    while (size < text_.size()) {
+      const std::string_view rest{text_.substr(size)};
+      if (is_whitespace(rest.front()) || rest.front() == '*' || rest.front() == '/' || rest.front() == '^' || rest.front() == '(' || rest.front() == ')' || rest.substr(0, 2) == "·" || rest.substr(0, 2) == "²" || rest.substr(0, 2) == "³") {
+        break;
+      }
+      ++size;
+    }
+    return size;
+  }
+
+  void skip_whitespace() noexcept {
+    while (!text_.empty() && is_whitespace(text_.front())) {
+      text_.remove_prefix(1);
+    }
+  }
+
+  bool consume(std::string_view expected) noexcept {
+    if (text_.substr(0, expected.size()) != expected) {
+      return false;
+    }
+    text_.remove_prefix(expected.size());
+    return true;
+  }
+
+  std::string_view expression_;
+
+  std::string_view text_;
+
+  int_least32_t symbols_;
+
+  int_least32_t operators_;
+
+  int_least8_t depth_;
+
+};
+
+/// \brief Thread-safe cache of resolved unit expressions, keyed by their exact text. Expressions that fail to resolve are cached as well, so a repeated unknown expression is rejected without being parsed again.
+/// \details Looking up an expression that is already cached takes a shared lock and a single hash lookup, and allocates nothing. The cache holds at most its capacity of expressions: once it is full, it is emptied before the next new expression is added. Since cached resolutions can therefore be discarded, they are returned by value, and their abbreviation views the text given by the caller. Units that must outlive the call, such as the display units of dynamic quantities, are instead interned in a separate table of at most its intern capacity of units, which is never emptied, so a pointer to an interned unit remains valid for the life of the cache.
+class UnitExpressionCache {
+
+public:
+
+  static constexpr std::size_t capacity{4096};
+
+  static constexpr std::size_t intern_capacity{1024};
+
+  UnitExpressionCache() noexcept = default;
+
+  UnitExpressionCache(const UnitExpressionCache&) = delete;
+
+  UnitExpressionCache& operator=(const UnitExpressionCache&) = delete;
+
+  /// \brief Resolve an expression. The abbreviation of the result views the given expression.
+  std::optional<ResolvedUnit> resolve(std::string_view expression) noexcept {
+    {
+      const std::shared_lock<std::shared_mutex> lock{mutex_};
+      const auto found{entries_.find(expression)};
+      if (found != entries_.end()) {
+        return rebase(found->second, expression);
+      }
+    }
+    const std::unique_lock<std::shared_mutex> lock{mutex_};
+    const auto found{entries_.find(expression)};
+    if (found != entries_.end()) {
+      return rebase(found->second, expression);
+    }
+    if (entries_.size() >= capacity) {
+      entries_.clear();
+      expressions_.clear();
+    }
+    expressions_.emplace_back(expression);
+    const std::string_view key{expressions_.back()};
+    const auto inserted{entries_.emplace(key, UnitExpressionParser{key}.parse()).first};
+    return rebase(inserted->second, expression);
+  }
+
+  /// \brief Intern a resolved unit and return a pointer to the interned copy, whose abbreviation views text owned by the cache, or a null pointer if the intern table is full.
+  const ResolvedUnit* intern(const ResolvedUnit& resolved) noexcept {
+    {
+      const std::shared_lock<std::shared_mutex> lock{mutex_};
+      const auto found{interned_.find(resolved.abbreviation())};
+      if (found != interned_.end()) {
+        return &found->second;
+      }
+    }
+    const std::unique_lock<std::shared_mutex> lock{mutex_};
+    const auto found{interned_.find(resolved.abbreviation())};
+    if (found != interned_.end()) {
+      return &found->second;
+    }
+    if (interned_.size() >= intern_capacity) {
+      return nullptr;
+    }
+    interned_abbreviations_.emplace_back(resolved.abbreviation());
+    const std::string_view key{interned_abbreviations_.back()};
+    return &interned_.emplace(key, ResolvedUnit{key, resolved.dimension(), resolved.factor()}).first->second;
+  }
+
+  /// \brief Number of cached expressions, which never exceeds the capacity.
+  std::size_t size() const noexcept {
+    const std::shared_lock<std::shared_mutex> lock{mutex_};
+    return entries_.size();
+  }
+
+  /// \brief Number of interned units, which never exceeds the intern capacity.
+  std::size_t interned_size() const noexcept {
+    const std::shared_lock<std::shared_mutex> lock{mutex_};
+    return interned_.size();
+  }
+
+private:
+
+  static std::optional<ResolvedUnit> rebase(const std::optional<ResolvedUnit>& resolved, std::string_view expression) noexcept {
+    if (!resolved.has_value()) {
+      return std::nullopt;
+    }
+    return ResolvedUnit{expression, resolved.value().dimension(), resolved.value().factor()};
+  }
+
+  mutable std::shared_mutex mutex_;
+
+  /// \brief Owned copies of the cached expressions. A deque never moves its elements, so the keys of the map can view them.
+  std::deque<std::string> expressions_;
+
+  std::unordered_map<std::string_view, std::optional<ResolvedUnit>> entries_;
+
+  /// \brief Owned copies of the abbreviations of the interned units, which the keys of the intern table and the interned units view.
+  std::deque<std::string> interned_abbreviations_;
+
+  /// \brief Elements of an unordered map are never moved by rehashing, and interned units are never removed, so pointers to them remain valid.
+  std::unordered_map<std::string_view, ResolvedUnit> interned_;
+
+};
+
+/// \brief Cache of unit expressions shared by the whole program.
+UnitExpressionCache& unit_expression_cache() noexcept {
+  static UnitExpressionCache cache;
+  return cache;
+}
+
+/// \brief Resolve a unit expression, such as "kg·m/s^2", "lbf/in^2", or "W/(m·K)", into its physical dimension set and its conversion factor to the base units of the metre-kilogram-second-kelvin system. Returns nothing if the expression is malformed or contains an unknown symbol. Results are cached. The abbreviation of the result views the given expression.
+std::optional<ResolvedUnit> resolve_unit_expression(std::string_view expression) noexcept {
+  return unit_expression_cache().resolve(trim_whitespace(expression));
+}
+
+/// \brief Intern a resolved unit in the shared cache and return a pointer to the interned copy, which remains valid for the life of the program, or a null pointer if the intern table of the cache is full.
+const ResolvedUnit* intern_resolved_unit(const ResolvedUnit& resolved) noexcept {
+  return unit_expression_cache().intern(resolved);
+}
+
+/// \brief Resolve a unit expression and return a pointer to its interned resolution, which remains valid for the life of the program, or a null pointer if the expression does not resolve or the intern table of the cache is full.
+const ResolvedUnit* find_unit_expression(std::string_view expression) noexcept {
+  const std::optional<ResolvedUnit> resolved{resolve_unit_expression(expression)};
+  return resolved.has_value() ? intern_resolved_unit(resolved.value()) : nullptr;
+}
+
+/// \brief Whether the text of a unit starts with a numeric factor, such as "2·m" or "000·m". Readers of quantities reject such units: after a value, as in "5 2·m" or "1 000·m", the factor would silently rescale or garble the value, and in the unit of a sequence it would rescale every value. A reciprocal of unit symbols such as "1/s" is not a numeric factor, but a fraction such as "1/2·m" or "1/(2·s)" is.
+constexpr bool starts_with_numeric_factor(std::string_view unit) noexcept {
+  if (unit.empty() || !((unit.front() >= '0' && unit.front() <= '9') || unit.front() == '.')) {
+    return false;
+  }
+  if (unit.front() == '1') {
+    unit.remove_prefix(1);
+    while (!unit.empty() && (unit.front() == ' ' || unit.front() == '\t')) {
+      unit.remove_prefix(1);
+    }
+    if (unit.empty() || unit.front() != '/') {
+      return true;
+    }
+    unit.remove_prefix(1);
+    while (!unit.empty() && (unit.front() == ' ' || unit.front() == '\t' || unit.front() == '(')) {
+      unit.remove_prefix(1);
+    }
+    return !unit.empty() && ((unit.front() >= '0' && unit.front() <= '9') || unit.front() == '.');
+  }
+  return true;
+}
+
+/// \brief Conversion factor to the standard unit of a unit type from a unit written either as one of its spellings, such as "lbf/in^2" for PhQ::Unit::Pressure, or as a unit expression of the same physical dimension set, such as "kg/(m·s^2)". Returns nothing otherwise.
+/// \details A spelling of the unit type is found with a binary search. Any other text is resolved through the cache of unit expressions, so resolving the same text again, such as a repeated column header, is a single hash lookup.
+template <typename Unit> std::optional<ConversionFactor> resolve_unit(std::string_view expression) noexcept {
+  const std::optional<Unit> unit{parse<Unit>(expression)};
+  if (unit.has_value()) {
+    return {conversion_factors<Unit>[static_cast<std::size_t>(unit.value())]};
+  }
+  const std::optional<ResolvedUnit> resolved{resolve_unit_expression(expression)};
+  if (resolved.has_value() && resolved.value().dimension() == dimension<Unit>) {
+    return {resolved.value().factor()};
+  }
+  return std::nullopt;
+}
+
+} // namespace PhQ
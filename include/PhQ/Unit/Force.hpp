@@ -7,6 +7,9 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "Mass.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -20,13 +23,15 @@ enum class Force : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::Force, std::string> abbreviations<Unit::Force>{
+template <> constexpr const std::array<std::pair<Unit::Force, std::string_view>, 3> abbreviations<Unit::Force>{{
   {Unit::Force::Newton, "N"},
   {Unit::Force::Micronewton, "μN"},
   {Unit::Force::Pound, "lbf"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::Force>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::Force> spellings<Unit::Force>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::Force>, 9> spellings<Unit::Force>{{
   {"N", Unit::Force::Newton},
   {"kg*m/s^2", Unit::Force::Newton},
   {"kg*m/s2", Unit::Force::Newton},
@@ -36,35 +41,25 @@ template <> const std::unordered_map<std::string, Unit::Force> spellings<Unit::F
   {"g*mm/s2", Unit::Force::Micronewton},
   {"lbf", Unit::Force::Pound},
   {"lb", Unit::Force::Pound}
-};
+}};
 
-template <> const std::map<System, Unit::Force> consistent_units<Unit::Force>{
+template <> constexpr const std::array<std::pair<System, Unit::Force>, 4> consistent_units<Unit::Force>{{
   {System::MetreKilogramSecondKelvin, Unit::Force::Newton},
   {System::MillimetreGramSecondKelvin, Unit::Force::Micronewton},
   {System::FootPoundSecondRankine, Unit::Force::Pound},
   {System::InchPoundSecondRankine, Unit::Force::Pound}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::Force>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::Force standard_unit<Unit::Force>{Unit::Force::Newton};
 
 template <> constexpr const Dimension::Set dimension<Unit::Force>{Dimension::Set{Dimension::Length{1}, Dimension::Mass{1}, Dimension::Time{-2}}};
 
-template <> const std::map<Unit::Force, std::map<Unit::Force, std::function<void(std::vector<double>&)>>> conversions<Unit::Force>{
-  {Unit::Force::Newton, {
-    {Unit::Force::Newton, [](std::vector<double>& values)->void{}},
-    {Unit::Force::Micronewton, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0;});}},
-    {Unit::Force::Pound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.45359237 * 9.80665;});}}
-  }},
-  {Unit::Force::Micronewton, {
-    {Unit::Force::Newton, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001;});}},
-    {Unit::Force::Micronewton, [](std::vector<double>& values)->void{}},
-    {Unit::Force::Pound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 453592.37 * 9.80665;});}}
-  }},
-  {Unit::Force::Pound, {
-    {Unit::Force::Newton, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665;});}},
-    {Unit::Force::Micronewton, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 453592.37 * 9.80665;});}},
-    {Unit::Force::Pound, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 3> conversion_factors<Unit::Force>{
+  ConversionFactor{1.0},
+  derived_conversion_factor<Unit::Force>(Unit::Length::Millimetre, Unit::Mass::Gram, Unit::Time::Second),
+  derived_conversion_factor<Unit::Force>(Unit::Length::Foot, Unit::Mass::Slug, Unit::Time::Second)
 };
 
 } // namespace PhQ
@@ -21,58 +21,44 @@ enum class Frequency : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::Frequency, std::string> abbreviations<Unit::Frequency>{
+template <> constexpr const std::array<std::pair<Unit::Frequency, std::string_view>, 4> abbreviations<Unit::Frequency>{{
   {Unit::Frequency::Hertz, "Hz"},
   {Unit::Frequency::Kilohertz, "kHz"},
   {Unit::Frequency::Megahertz, "MHz"},
   {Unit::Frequency::Gigahertz, "GHz"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::Frequency>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::Frequency> spellings<Unit::Frequency>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::Frequency>, 6> spellings<Unit::Frequency>{{
   {"Hz", Unit::Frequency::Hertz},
   {"1/s", Unit::Frequency::Hertz},
   {"/s", Unit::Frequency::Hertz},
   {"kHz", Unit::Frequency::Kilohertz},
   {"MHz", Unit::Frequency::Megahertz},
   {"GHz", Unit::Frequency::Gigahertz}
-};
+}};
 
-template <> const std::map<System, Unit::Frequency> consistent_units<Unit::Frequency>{
+template <> constexpr const std::array<std::pair<System, Unit::Frequency>, 4> consistent_units<Unit::Frequency>{{
   {System::MetreKilogramSecondKelvin, Unit::Frequency::Hertz},
   {System::MillimetreGramSecondKelvin, Unit::Frequency::Hertz},
   {System::FootPoundSecondRankine, Unit::Frequency::Hertz},
   {System::InchPoundSecondRankine, Unit::Frequency::Hertz}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::Frequency>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::Frequency standard_unit<Unit::Frequency>{Unit::Frequency::Hertz};
 
 template <> constexpr const Dimension::Set dimension<Unit::Frequency>{Dimension::Set{Dimension::Length{}, Dimension::Mass{}, Dimension::Time{-1}}};
 
-template <> const std::map<Unit::Frequency, std::map<Unit::Frequency, std::function<void(std::vector<double>&)>>> conversions<Unit::Frequency>{
-  {Unit::Frequency::Hertz, {
-    {Unit::Frequency::Hertz, [](std::vector<double>& values)->void{}},
-    {Unit::Frequency::Kilohertz, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Frequency::Megahertz, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001;});}},
-    {Unit::Frequency::Gigahertz, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000000001;});}}
-  }},
-  {Unit::Frequency::Kilohertz, {
-    {Unit::Frequency::Hertz, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::Frequency::Kilohertz, [](std::vector<double>& values)->void{}},
-    {Unit::Frequency::Megahertz, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Frequency::Gigahertz, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001;});}}
-  }},
-  {Unit::Frequency::Megahertz, {
-    {Unit::Frequency::Hertz, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0;});}},
-    {Unit::Frequency::Kilohertz, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::Frequency::Megahertz, [](std::vector<double>& values)->void{}},
-    {Unit::Frequency::Gigahertz, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}}
-  }},
-  {Unit::Frequency::Gigahertz, {
-    {Unit::Frequency::Hertz, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000000.0;});}},
-    {Unit::Frequency::Kilohertz, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0;});}},
-    {Unit::Frequency::Megahertz, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::Frequency::Gigahertz, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr bool has_ambiguous_dimension<Unit::Frequency>{true};
+
+template <> constexpr const std::array<ConversionFactor, 4> conversion_factors<Unit::Frequency>{
+  ConversionFactor{1.0},
+  ConversionFactor{1000.0},
+  ConversionFactor{1000000.0},
+  ConversionFactor{1000000000.0}
 };
 
 } // namespace PhQ
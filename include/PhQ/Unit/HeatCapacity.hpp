@@ -7,6 +7,10 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "Mass.hpp"
+#include "TemperatureDifference.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -21,14 +25,16 @@ enum class HeatCapacity : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::HeatCapacity, std::string> abbreviations<Unit::HeatCapacity>{
+template <> constexpr const std::array<std::pair<Unit::HeatCapacity, std::string_view>, 4> abbreviations<Unit::HeatCapacity>{{
   {Unit::HeatCapacity::JoulePerKelvin, "J/K"},
   {Unit::HeatCapacity::NanojoulePerKelvin, "nJ/K"},
   {Unit::HeatCapacity::FootPoundPerRankine, "ft·lbf/°R"},
   {Unit::HeatCapacity::InchPoundPerRankine, "in·lbf/°R"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::HeatCapacity>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::HeatCapacity> spellings<Unit::HeatCapacity>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::HeatCapacity>, 40> spellings<Unit::HeatCapacity>{{
   {"J/K", Unit::HeatCapacity::JoulePerKelvin},
   {"N·m/K", Unit::HeatCapacity::JoulePerKelvin},
   {"N*m/K", Unit::HeatCapacity::JoulePerKelvin},
@@ -69,44 +75,26 @@ template <> const std::unordered_map<std::string, Unit::HeatCapacity> spellings<
   {"in·lb/R", Unit::HeatCapacity::InchPoundPerRankine},
   {"in*lb/°R", Unit::HeatCapacity::InchPoundPerRankine},
   {"in*lb/R", Unit::HeatCapacity::InchPoundPerRankine}
-};
+}};
 
-template <> const std::map<System, Unit::HeatCapacity> consistent_units<Unit::HeatCapacity>{
+template <> constexpr const std::array<std::pair<System, Unit::HeatCapacity>, 4> consistent_units<Unit::HeatCapacity>{{
   {System::MetreKilogramSecondKelvin, Unit::HeatCapacity::JoulePerKelvin},
   {System::MillimetreGramSecondKelvin, Unit::HeatCapacity::NanojoulePerKelvin},
   {System::FootPoundSecondRankine, Unit::HeatCapacity::FootPoundPerRankine},
   {System::InchPoundSecondRankine, Unit::HeatCapacity::InchPoundPerRankine}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::HeatCapacity>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::HeatCapacity standard_unit<Unit::HeatCapacity>{Unit::HeatCapacity::JoulePerKelvin};
 
 template <> constexpr const Dimension::Set dimension<Unit::HeatCapacity>{Dimension::Set{Dimension::Length{2}, Dimension::Mass{1}, Dimension::Time{-2}, Dimension::ElectricCurrent{}, Dimension::Temperature{-1}}};
 
-template <> const std::map<Unit::HeatCapacity, std::map<Unit::HeatCapacity, std::function<void(std::vector<double>&)>>> conversions<Unit::HeatCapacity>{
-  {Unit::HeatCapacity::JoulePerKelvin, {
-    {Unit::HeatCapacity::JoulePerKelvin, [](std::vector<double>& values)->void{}},
-    {Unit::HeatCapacity::NanojoulePerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e9;});}},
-    {Unit::HeatCapacity::FootPoundPerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.3048 * 0.45359237 * 9.80665 * 1.8;});}},
-    {Unit::HeatCapacity::InchPoundPerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0254 * 0.45359237 * 9.80665 * 1.8;});}}
-  }},
-  {Unit::HeatCapacity::NanojoulePerKelvin, {
-    {Unit::HeatCapacity::JoulePerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-9;});}},
-    {Unit::HeatCapacity::NanojoulePerKelvin, [](std::vector<double>& values)->void{}},
-    {Unit::HeatCapacity::FootPoundPerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e9 * 0.3048 * 0.45359237 * 9.80665 * 1.8;});}},
-    {Unit::HeatCapacity::InchPoundPerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e9 * 0.0254 * 0.45359237 * 9.80665 * 1.8;});}}
-  }},
-  {Unit::HeatCapacity::FootPoundPerRankine, {
-    {Unit::HeatCapacity::JoulePerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.3048 * 0.45359237 * 9.80665 * 1.8;});}},
-    {Unit::HeatCapacity::NanojoulePerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e9 * 0.3048 * 0.45359237 * 9.80665 * 1.8;});}},
-    {Unit::HeatCapacity::FootPoundPerRankine, [](std::vector<double>& values)->void{}},
-    {Unit::HeatCapacity::InchPoundPerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12.0;});}}
-  }},
-  {Unit::HeatCapacity::InchPoundPerRankine, {
-    {Unit::HeatCapacity::JoulePerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254 * 0.45359237 * 9.80665 * 1.8;});}},
-    {Unit::HeatCapacity::NanojoulePerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e9 * 0.0254 * 0.45359237 * 9.80665 * 1.8;});}},
-    {Unit::HeatCapacity::FootPoundPerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12.0;});}},
-    {Unit::HeatCapacity::InchPoundPerRankine, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 4> conversion_factors<Unit::HeatCapacity>{
+  ConversionFactor{1.0},
+  derived_conversion_factor<Unit::HeatCapacity>(Unit::Length::Millimetre, Unit::Mass::Gram, Unit::Time::Second, Unit::TemperatureDifference::Kelvin),
+  derived_conversion_factor<Unit::HeatCapacity>(Unit::Length::Foot, Unit::Mass::Slug, Unit::Time::Second, Unit::TemperatureDifference::Rankine),
+  derived_conversion_factor<Unit::HeatCapacity>(Unit::Length::Inch, Unit::Mass::Slinch, Unit::Time::Second, Unit::TemperatureDifference::Rankine)
 };
 
 } // namespace PhQ
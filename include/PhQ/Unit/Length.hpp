@@ -29,7 +29,7 @@ enum class Length : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::Length, std::string> abbreviations<Unit::Length>{
+template <> constexpr const std::array<std::pair<Unit::Length, std::string_view>, 12> abbreviations<Unit::Length>{{
   {Unit::Length::Mile, "mi"},
   {Unit::Length::Kilometre, "km"},
   {Unit::Length::Yard, "yd"},
@@ -42,9 +42,11 @@ template <> const std::map<Unit::Length, std::string> abbreviations<Unit::Length
   {Unit::Length::Milliinch, "thou"},
   {Unit::Length::Micrometre, "μm"},
   {Unit::Length::Microinch, "μin"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::Length>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::Length> spellings<Unit::Length>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::Length>, 58> spellings<Unit::Length>{{
   {"mi", Unit::Length::Mile},
   {"mile", Unit::Length::Mile},
   {"miles", Unit::Length::Mile},
@@ -103,195 +105,41 @@ template <> const std::unordered_map<std::string, Unit::Length> spellings<Unit::
   {"uin", Unit::Length::Microinch},
   {"microinch", Unit::Length::Microinch},
   {"microinches", Unit::Length::Microinch}
-};
+}};
 
-template <> const std::map<System, Unit::Length> consistent_units<Unit::Length>{
+template <> constexpr const std::array<std::pair<System, Unit::Length>, 4> consistent_units<Unit::Length>{{
   {System::MetreKilogramSecondKelvin, Unit::Length::Metre},
   {System::MillimetreGramSecondKelvin, Unit::Length::Millimetre},
   {System::FootPoundSecondRankine, Unit::Length::Foot},
   {System::InchPoundSecondRankine, Unit::Length::Inch}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::Length>), "The consistent_units table must be listed in the order of its enumeration.");
 
-template <> const std::map<Unit::Length, System> related_systems<Unit::Length>{
+template <> constexpr const std::array<std::pair<Unit::Length, System>, 4> related_systems<Unit::Length>{{
   {Unit::Length::Metre, System::MetreKilogramSecondKelvin},
   {Unit::Length::Millimetre, System::MillimetreGramSecondKelvin},
   {Unit::Length::Foot, System::FootPoundSecondRankine},
-  {Unit::Length::Inch, System::InchPoundSecondRankine},
-};
+  {Unit::Length::Inch, System::InchPoundSecondRankine}
+}};
 
 template <> constexpr const Unit::Length standard_unit<Unit::Length>{Unit::Length::Metre};
 
 template <> constexpr const Dimension::Set dimension<Unit::Length>{Dimension::Set{Dimension::Length{1}}};
 
-template <> const std::map<Unit::Length, std::map<Unit::Length, std::function<void(std::vector<double>&)>>> conversions<Unit::Length>{
-  {Unit::Length::Mile, {
-    {Unit::Length::Mile, [](std::vector<double>& values)->void{}},
-    {Unit::Length::Kilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.609344;});}},
-    {Unit::Length::Yard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1760.0;});}},
-    {Unit::Length::Metre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1609.344;});}},
-    {Unit::Length::Foot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 5280.0;});}},
-    {Unit::Length::Decimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 16093.44;});}},
-    {Unit::Length::Inch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 63360.0;});}},
-    {Unit::Length::Centimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 160934.4;});}},
-    {Unit::Length::Millimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1609344.0;});}},
-    {Unit::Length::Milliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 63360000.0;});}},
-    {Unit::Length::Micrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1609344000.0;});}},
-    {Unit::Length::Microinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 63360000000.0;});}}
-  }},
-  {Unit::Length::Kilometre, {
-    {Unit::Length::Mile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.609344;});}},
-    {Unit::Length::Kilometre, [](std::vector<double>& values)->void{}},
-    {Unit::Length::Yard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0009144;});}},
-    {Unit::Length::Metre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::Length::Foot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0003048;});}},
-    {Unit::Length::Decimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10000.0;});}},
-    {Unit::Length::Inch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0000254;});}},
-    {Unit::Length::Centimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 100000.0;});}},
-    {Unit::Length::Millimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0;});}},
-    {Unit::Length::Milliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0000000254;});}},
-    {Unit::Length::Micrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000000.0;});}},
-    {Unit::Length::Microinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0000000000254;});}}
-  }},
-  {Unit::Length::Yard, {
-    {Unit::Length::Mile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1760.0;});}},
-    {Unit::Length::Kilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0009144;});}},
-    {Unit::Length::Yard, [](std::vector<double>& values)->void{}},
-    {Unit::Length::Metre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.9144;});}},
-    {Unit::Length::Foot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3.0;});}},
-    {Unit::Length::Decimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 9.144;});}},
-    {Unit::Length::Inch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 36.0;});}},
-    {Unit::Length::Centimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 91.44;});}},
-    {Unit::Length::Millimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 914.4;});}},
-    {Unit::Length::Milliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 36000.0;});}},
-    {Unit::Length::Micrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 914400.0;});}},
-    {Unit::Length::Microinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 36000000.0;});}}
-  }},
-  {Unit::Length::Metre, {
-    {Unit::Length::Mile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1609.344;});}},
-    {Unit::Length::Kilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Length::Yard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.9144;});}},
-    {Unit::Length::Metre, [](std::vector<double>& values)->void{}},
-    {Unit::Length::Foot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.3048;});}},
-    {Unit::Length::Decimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10.0;});}},
-    {Unit::Length::Inch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0254;});}},
-    {Unit::Length::Centimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 100.0;});}},
-    {Unit::Length::Millimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::Length::Milliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0000254;});}},
-    {Unit::Length::Micrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0;});}},
-    {Unit::Length::Microinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0000000254;});}}
-  }},
-  {Unit::Length::Foot, {
-    {Unit::Length::Mile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 5280.0;});}},
-    {Unit::Length::Kilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0003048;});}},
-    {Unit::Length::Yard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 3.0;});}},
-    {Unit::Length::Metre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.3048;});}},
-    {Unit::Length::Foot, [](std::vector<double>& values)->void{}},
-    {Unit::Length::Decimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3.048;});}},
-    {Unit::Length::Inch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12.0;});}},
-    {Unit::Length::Centimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 30.48;});}},
-    {Unit::Length::Millimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 304.8;});}},
-    {Unit::Length::Milliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12000.0;});}},
-    {Unit::Length::Micrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 304800.0;});}},
-    {Unit::Length::Microinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12000000.0;});}}
-  }},
-  {Unit::Length::Decimetre, {
-    {Unit::Length::Mile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 16093.44;});}},
-    {Unit::Length::Kilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0001;});}},
-    {Unit::Length::Yard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 9.144;});}},
-    {Unit::Length::Metre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.1;});}},
-    {Unit::Length::Foot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 3.048;});}},
-    {Unit::Length::Decimetre, [](std::vector<double>& values)->void{}},
-    {Unit::Length::Inch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.254;});}},
-    {Unit::Length::Centimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10.0;});}},
-    {Unit::Length::Millimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 100.0;});}},
-    {Unit::Length::Milliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.000254;});}},
-    {Unit::Length::Micrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 100000.0;});}},
-    {Unit::Length::Microinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.000000254;});}}
-  }},
-  {Unit::Length::Inch, {
-    {Unit::Length::Mile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 63360.0;});}},
-    {Unit::Length::Kilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0000254;});}},
-    {Unit::Length::Yard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 36.0;});}},
-    {Unit::Length::Metre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254;});}},
-    {Unit::Length::Foot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12.0;});}},
-    {Unit::Length::Decimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.254;});}},
-    {Unit::Length::Inch, [](std::vector<double>& values)->void{}},
-    {Unit::Length::Centimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 2.54;});}},
-    {Unit::Length::Millimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 25.4;});}},
-    {Unit::Length::Milliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::Length::Micrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 25400.0;});}},
-    {Unit::Length::Microinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0;});}}
-  }},
-  {Unit::Length::Centimetre, {
-    {Unit::Length::Mile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 160934.4;});}},
-    {Unit::Length::Kilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.00001;});}},
-    {Unit::Length::Yard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 91.44;});}},
-    {Unit::Length::Metre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.01;});}},
-    {Unit::Length::Foot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 30.48;});}},
-    {Unit::Length::Decimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.1;});}},
-    {Unit::Length::Inch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 2.54;});}},
-    {Unit::Length::Centimetre, [](std::vector<double>& values)->void{}},
-    {Unit::Length::Millimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10.0;});}},
-    {Unit::Length::Milliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.00254;});}},
-    {Unit::Length::Micrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10000.0;});}},
-    {Unit::Length::Microinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.00000254;});}}
-  }},
-  {Unit::Length::Millimetre, {
-    {Unit::Length::Mile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1609344.0;});}},
-    {Unit::Length::Kilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001;});}},
-    {Unit::Length::Yard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 914.4;});}},
-    {Unit::Length::Metre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Length::Foot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 304.8;});}},
-    {Unit::Length::Decimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.01;});}},
-    {Unit::Length::Inch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 25.4;});}},
-    {Unit::Length::Centimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.1;});}},
-    {Unit::Length::Millimetre, [](std::vector<double>& values)->void{}},
-    {Unit::Length::Milliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0254;});}},
-    {Unit::Length::Micrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::Length::Microinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0000254;});}}
-  }},
-  {Unit::Length::Milliinch, {
-    {Unit::Length::Mile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 63360000.0;});}},
-    {Unit::Length::Kilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0000000254;});}},
-    {Unit::Length::Yard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 36000.0;});}},
-    {Unit::Length::Metre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0000254;});}},
-    {Unit::Length::Foot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12000.0;});}},
-    {Unit::Length::Decimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000254;});}},
-    {Unit::Length::Inch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Length::Centimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.00254;});}},
-    {Unit::Length::Millimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254;});}},
-    {Unit::Length::Milliinch, [](std::vector<double>& values)->void{}},
-    {Unit::Length::Micrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 25.4;});}},
-    {Unit::Length::Microinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}}
-  }},
-  {Unit::Length::Micrometre, {
-    {Unit::Length::Mile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1609344000.0;});}},
-    {Unit::Length::Kilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000000001;});}},
-    {Unit::Length::Yard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 914400.0;});}},
-    {Unit::Length::Metre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001;});}},
-    {Unit::Length::Foot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 304800.0;});}},
-    {Unit::Length::Decimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.00001;});}},
-    {Unit::Length::Inch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 25400.0;});}},
-    {Unit::Length::Centimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0001;});}},
-    {Unit::Length::Millimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Length::Milliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 25.4;});}},
-    {Unit::Length::Micrometre, [](std::vector<double>& values)->void{}},
-    {Unit::Length::Microinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0254;});}}
-  }},
-  {Unit::Length::Microinch, {
-    {Unit::Length::Mile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 63360000000.0;});}},
-    {Unit::Length::Kilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0000000000254;});}},
-    {Unit::Length::Yard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 36000000.0;});}},
-    {Unit::Length::Metre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0000000254;});}},
-    {Unit::Length::Foot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12000000.0;});}},
-    {Unit::Length::Decimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000000254;});}},
-    {Unit::Length::Inch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001;});}},
-    {Unit::Length::Centimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.00000254;});}},
-    {Unit::Length::Millimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0000254;});}},
-    {Unit::Length::Milliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Length::Micrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254;});}},
-    {Unit::Length::Microinch, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 12> conversion_factors<Unit::Length>{
+  ConversionFactor{1609.344},
+  ConversionFactor{1000.0},
+  ConversionFactor{0.9144},
+  ConversionFactor{1.0},
+  ConversionFactor{0.3048},
+  ConversionFactor{0.1},
+  ConversionFactor{0.0254},
+  ConversionFactor{0.01},
+  ConversionFactor{0.001},
+  ConversionFactor{0.0000254},
+  ConversionFactor{0.000001},
+  ConversionFactor{0.0000000254}
 };
 
 } // namespace PhQ
@@ -22,70 +22,44 @@ enum class Mass : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::Mass, std::string> abbreviations<Unit::Mass>{
+template <> constexpr const std::array<std::pair<Unit::Mass, std::string_view>, 5> abbreviations<Unit::Mass>{{
   {Unit::Mass::Kilogram, "kg"},
   {Unit::Mass::Gram, "g"},
   {Unit::Mass::Slug, "slug"},
   {Unit::Mass::Slinch, "slinch"},
   {Unit::Mass::Pound, "lbm"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::Mass>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::Mass> spellings<Unit::Mass>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::Mass>, 6> spellings<Unit::Mass>{{
   {"kg", Unit::Mass::Kilogram},
   {"g", Unit::Mass::Gram},
   {"slug", Unit::Mass::Slug},
   {"slinch", Unit::Mass::Slinch},
   {"lbm", Unit::Mass::Pound},
   {"lb", Unit::Mass::Pound}
-};
+}};
 
-template <> const std::map<System, Unit::Mass> consistent_units<Unit::Mass>{
+template <> constexpr const std::array<std::pair<System, Unit::Mass>, 4> consistent_units<Unit::Mass>{{
   {System::MetreKilogramSecondKelvin, Unit::Mass::Kilogram},
   {System::MillimetreGramSecondKelvin, Unit::Mass::Gram},
   {System::FootPoundSecondRankine, Unit::Mass::Slug},
   {System::InchPoundSecondRankine, Unit::Mass::Slinch}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::Mass>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::Mass standard_unit<Unit::Mass>{Unit::Mass::Kilogram};
 
 template <> constexpr const Dimension::Set dimension<Unit::Mass>{Dimension::Set{Dimension::Length{0}, Dimension::Mass{1}}};
 
-template <> const std::map<Unit::Mass, std::map<Unit::Mass, std::function<void(std::vector<double>&)>>> conversions<Unit::Mass>{
-  {Unit::Mass::Kilogram, {
-    {Unit::Mass::Kilogram, [](std::vector<double>& values)->void{}},
-    {Unit::Mass::Gram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::Mass::Slug, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.3048 / (0.45359237 * 9.80665);});}},
-    {Unit::Mass::Slinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254 / (0.45359237 * 9.80665);});}},
-    {Unit::Mass::Pound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.45359237;});}}
-  }},
-  {Unit::Mass::Gram, {
-    {Unit::Mass::Kilogram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Mass::Gram, [](std::vector<double>& values)->void{}},
-    {Unit::Mass::Slug, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0003048 / (0.45359237 * 9.80665);});}},
-    {Unit::Mass::Slinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0000254 / (0.45359237 * 9.80665);});}},
-    {Unit::Mass::Pound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 453.59237;});}}
-  }},
-  {Unit::Mass::Slug, {
-    {Unit::Mass::Kilogram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / 0.3048;});}},
-    {Unit::Mass::Gram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 453.59237 * 9.80665 / 0.3048;});}},
-    {Unit::Mass::Slug, [](std::vector<double>& values)->void{}},
-    {Unit::Mass::Slinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12.0;});}},
-    {Unit::Mass::Pound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 9.80665 / 0.3048;});}}
-  }},
-  {Unit::Mass::Slinch, {
-    {Unit::Mass::Kilogram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / 0.0254;});}},
-    {Unit::Mass::Gram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 453.59237 * 9.80665 / 0.0254;});}},
-    {Unit::Mass::Slug, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12.0;});}},
-    {Unit::Mass::Slinch, [](std::vector<double>& values)->void{}},
-    {Unit::Mass::Pound, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 9.80665 / 0.0254;});}}
-  }},
-  {Unit::Mass::Pound, {
-    {Unit::Mass::Kilogram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237;});}},
-    {Unit::Mass::Gram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 453.59237;});}},
-    {Unit::Mass::Slug, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.3048 / 9.80665;});}},
-    {Unit::Mass::Slinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254 / 9.80665;});}},
-    {Unit::Mass::Slinch, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 5> conversion_factors<Unit::Mass>{
+  ConversionFactor{1.0},
+  ConversionFactor{0.001},
+  ConversionFactor{0.45359237 * 9.80665 / 0.3048},
+  ConversionFactor{0.45359237 * 9.80665 / 0.0254},
+  ConversionFactor{0.45359237}
 };
 
 } // namespace PhQ
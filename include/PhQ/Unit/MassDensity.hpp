@@ -7,6 +7,8 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "Mass.hpp"
 
 namespace PhQ {
 
@@ -23,16 +25,18 @@ enum class MassDensity : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::MassDensity, std::string> abbreviations<Unit::MassDensity>{
+template <> constexpr const std::array<std::pair<Unit::MassDensity, std::string_view>, 6> abbreviations<Unit::MassDensity>{{
   {Unit::MassDensity::KilogramPerCubicMetre, "kg/m^3"},
   {Unit::MassDensity::GramPerCubicMillimetre, "g/mm^3"},
   {Unit::MassDensity::SlugPerCubicFoot, "slug/ft^3"},
   {Unit::MassDensity::SlinchPerCubicInch, "slinch/in^3"},
   {Unit::MassDensity::PoundPerCubicFoot, "lbm/ft^3"},
   {Unit::MassDensity::PoundPerCubicInch, "lbm/in^3"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::MassDensity>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::MassDensity> spellings<Unit::MassDensity>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::MassDensity>, 24> spellings<Unit::MassDensity>{{
   {"kg/m^3", Unit::MassDensity::KilogramPerCubicMetre},
   {"kg/m3", Unit::MassDensity::KilogramPerCubicMetre},
   {"kg/m/m/m", Unit::MassDensity::KilogramPerCubicMetre},
@@ -57,68 +61,28 @@ template <> const std::unordered_map<std::string, Unit::MassDensity> spellings<U
   {"lb/in^3", Unit::MassDensity::PoundPerCubicInch},
   {"lb/in3", Unit::MassDensity::PoundPerCubicInch},
   {"lb/in/in/in", Unit::MassDensity::PoundPerCubicInch}
-};
+}};
 
-template <> const std::map<System, Unit::MassDensity> consistent_units<Unit::MassDensity>{
+template <> constexpr const std::array<std::pair<System, Unit::MassDensity>, 4> consistent_units<Unit::MassDensity>{{
   {System::MetreKilogramSecondKelvin, Unit::MassDensity::KilogramPerCubicMetre},
   {System::MillimetreGramSecondKelvin, Unit::MassDensity::GramPerCubicMillimetre},
   {System::FootPoundSecondRankine, Unit::MassDensity::SlugPerCubicFoot},
   {System::InchPoundSecondRankine, Unit::MassDensity::SlinchPerCubicInch}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::MassDensity>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::MassDensity standard_unit<Unit::MassDensity>{Unit::MassDensity::KilogramPerCubicMetre};
 
 template <> constexpr const Dimension::Set dimension<Unit::MassDensity>{Dimension::Set{Dimension::Length{-3}, Dimension::Mass{1}}};
 
-template <> const std::map<Unit::MassDensity, std::map<Unit::MassDensity, std::function<void(std::vector<double>&)>>> conversions<Unit::MassDensity>{
-  {Unit::MassDensity::KilogramPerCubicMetre, {
-    {Unit::MassDensity::KilogramPerCubicMetre, [](std::vector<double>& values)->void{}},
-    {Unit::MassDensity::GramPerCubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1000000.0;});}},
-    {Unit::MassDensity::SlugPerCubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.3048, 4) / (0.45359237 * 9.80665);});}},
-    {Unit::MassDensity::SlinchPerCubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 4) / (0.45359237 * 9.80665);});}},
-    {Unit::MassDensity::PoundPerCubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.3048, 3) / 0.45359237;});}},
-    {Unit::MassDensity::PoundPerCubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 3) / 0.45359237;});}}
-  }},
-  {Unit::MassDensity::GramPerCubicMillimetre, {
-    {Unit::MassDensity::KilogramPerCubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0;});}},
-    {Unit::MassDensity::GramPerCubicMillimetre, [](std::vector<double>& values)->void{}},
-    {Unit::MassDensity::SlugPerCubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0 * std::pow(0.3048, 4) / (0.45359237 * 9.80665);});}},
-    {Unit::MassDensity::SlinchPerCubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0 * std::pow(0.0254, 4) / (0.45359237 * 9.80665);});}},
-    {Unit::MassDensity::PoundPerCubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0 * std::pow(0.3048, 3) / 0.45359237;});}},
-    {Unit::MassDensity::PoundPerCubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0 * std::pow(0.0254, 3) / 0.45359237;});}}
-  }},
-  {Unit::MassDensity::SlugPerCubicFoot, {
-    {Unit::MassDensity::KilogramPerCubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / std::pow(0.3048, 4);});}},
-    {Unit::MassDensity::GramPerCubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / (1000000.0 * std::pow(0.3048, 4));});}},
-    {Unit::MassDensity::SlugPerCubicFoot, [](std::vector<double>& values)->void{}},
-    {Unit::MassDensity::SlinchPerCubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12.0, 4);});}},
-    {Unit::MassDensity::PoundPerCubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 9.80665 / 0.3048;});}},
-    {Unit::MassDensity::PoundPerCubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 9.80665 / (0.3048 * std::pow(12.0, 3));});}}
-  }},
-  {Unit::MassDensity::SlinchPerCubicInch, {
-    {Unit::MassDensity::KilogramPerCubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / std::pow(0.0254, 4);});}},
-    {Unit::MassDensity::GramPerCubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / (1000000.0 * std::pow(0.0254, 4));});}},
-    {Unit::MassDensity::SlugPerCubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12.0, 4);});}},
-    {Unit::MassDensity::SlinchPerCubicInch, [](std::vector<double>& values)->void{}},
-    {Unit::MassDensity::PoundPerCubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 9.80665 * std::pow(12.0, 3) / 0.0254;});}},
-    {Unit::MassDensity::PoundPerCubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 9.80665 / 0.0254;});}}
-  }},
-  {Unit::MassDensity::PoundPerCubicFoot, {
-    {Unit::MassDensity::KilogramPerCubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 / std::pow(0.3048, 3);});}},
-    {Unit::MassDensity::GramPerCubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 / (1000000.0 * std::pow(0.3048, 3));});}},
-    {Unit::MassDensity::SlugPerCubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.3048 / 9.80665;});}},
-    {Unit::MassDensity::SlinchPerCubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254 / (9.80665 * std::pow(12.0, 3));});}},
-    {Unit::MassDensity::PoundPerCubicFoot, [](std::vector<double>& values)->void{}},
-    {Unit::MassDensity::PoundPerCubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12.0, 3);});}}
-  }},
-  {Unit::MassDensity::PoundPerCubicInch, {
-    {Unit::MassDensity::KilogramPerCubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 / std::pow(0.0254, 3);});}},
-    {Unit::MassDensity::GramPerCubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 / (1000000.0 * std::pow(0.0254, 3));});}},
-    {Unit::MassDensity::SlugPerCubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.3048 * std::pow(12.0, 3) / 9.80665;});}},
-    {Unit::MassDensity::SlinchPerCubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254 / 9.80665;});}},
-    {Unit::MassDensity::PoundPerCubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12.0, 3);});}},
-    {Unit::MassDensity::SlinchPerCubicInch, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 6> conversion_factors<Unit::MassDensity>{
+  ConversionFactor{1.0},
+  derived_conversion_factor<Unit::MassDensity>(Unit::Length::Millimetre, Unit::Mass::Gram),
+  derived_conversion_factor<Unit::MassDensity>(Unit::Length::Foot, Unit::Mass::Slug),
+  derived_conversion_factor<Unit::MassDensity>(Unit::Length::Inch, Unit::Mass::Slinch),
+  derived_conversion_factor<Unit::MassDensity>(Unit::Length::Foot, Unit::Mass::Pound),
+  derived_conversion_factor<Unit::MassDensity>(Unit::Length::Inch, Unit::Mass::Pound)
 };
 
 } // namespace PhQ
@@ -7,6 +7,8 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Mass.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -22,15 +24,17 @@ enum class MassRate : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::MassRate, std::string> abbreviations<Unit::MassRate>{
+template <> constexpr const std::array<std::pair<Unit::MassRate, std::string_view>, 5> abbreviations<Unit::MassRate>{{
   {Unit::MassRate::KilogramPerSecond, "kg/s"},
   {Unit::MassRate::GramPerSecond, "g/s"},
   {Unit::MassRate::SlugPerSecond, "slug/s"},
   {Unit::MassRate::SlinchPerSecond, "slinch/s"},
   {Unit::MassRate::PoundPerSecond, "lbm/s"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::MassRate>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::MassRate> spellings<Unit::MassRate>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::MassRate>, 12> spellings<Unit::MassRate>{{
   {"kg/s", Unit::MassRate::KilogramPerSecond},
   {"kg/sec", Unit::MassRate::KilogramPerSecond},
   {"g/s", Unit::MassRate::GramPerSecond},
@@ -43,55 +47,27 @@ template <> const std::unordered_map<std::string, Unit::MassRate> spellings<Unit
   {"lbm/sec", Unit::MassRate::PoundPerSecond},
   {"lb/s", Unit::MassRate::PoundPerSecond},
   {"lb/sec", Unit::MassRate::PoundPerSecond}
-};
+}};
 
-template <> const std::map<System, Unit::MassRate> consistent_units<Unit::MassRate>{
+template <> constexpr const std::array<std::pair<System, Unit::MassRate>, 4> consistent_units<Unit::MassRate>{{
   {System::MetreKilogramSecondKelvin, Unit::MassRate::KilogramPerSecond},
   {System::MillimetreGramSecondKelvin, Unit::MassRate::GramPerSecond},
   {System::FootPoundSecondRankine, Unit::MassRate::SlugPerSecond},
   {System::InchPoundSecondRankine, Unit::MassRate::SlinchPerSecond}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::MassRate>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::MassRate standard_unit<Unit::MassRate>{Unit::MassRate::KilogramPerSecond};
 
 template <> constexpr const Dimension::Set dimension<Unit::MassRate>{Dimension::Set{Dimension::Length{0}, Dimension::Mass{1}, Dimension::Time{-1}}};
 
-template <> const std::map<Unit::MassRate, std::map<Unit::MassRate, std::function<void(std::vector<double>&)>>> conversions<Unit::MassRate>{
-  {Unit::MassRate::KilogramPerSecond, {
-    {Unit::MassRate::KilogramPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::MassRate::GramPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::MassRate::SlugPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.3048 / (0.45359237 * 9.80665);});}},
-    {Unit::MassRate::SlinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254 / (0.45359237 * 9.80665);});}},
-    {Unit::MassRate::PoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.45359237;});}}
-  }},
-  {Unit::MassRate::GramPerSecond, {
-    {Unit::MassRate::KilogramPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::MassRate::GramPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::MassRate::SlugPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0003048 / (0.45359237 * 9.80665);});}},
-    {Unit::MassRate::SlinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0000254 / (0.45359237 * 9.80665);});}},
-    {Unit::MassRate::PoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 453.59237;});}}
-  }},
-  {Unit::MassRate::SlugPerSecond, {
-    {Unit::MassRate::KilogramPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / 0.3048;});}},
-    {Unit::MassRate::GramPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 453.59237 * 9.80665 / 0.3048;});}},
-    {Unit::MassRate::SlugPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::MassRate::SlinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12.0;});}},
-    {Unit::MassRate::PoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 9.80665 / 0.3048;});}}
-  }},
-  {Unit::MassRate::SlinchPerSecond, {
-    {Unit::MassRate::KilogramPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / 0.0254;});}},
-    {Unit::MassRate::GramPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 453.59237 * 9.80665 / 0.0254;});}},
-    {Unit::MassRate::SlugPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12.0;});}},
-    {Unit::MassRate::SlinchPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::MassRate::PoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 9.80665 / 0.0254;});}}
-  }},
-  {Unit::MassRate::PoundPerSecond, {
-    {Unit::MassRate::KilogramPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237;});}},
-    {Unit::MassRate::GramPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 453.59237;});}},
-    {Unit::MassRate::SlugPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.3048 / 9.80665;});}},
-    {Unit::MassRate::SlinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254 / 9.80665;});}},
-    {Unit::MassRate::SlinchPerSecond, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 5> conversion_factors<Unit::MassRate>{
+  derived_conversion_factor<Unit::MassRate>(Unit::Mass::Kilogram, Unit::Time::Second),
+  derived_conversion_factor<Unit::MassRate>(Unit::Mass::Gram, Unit::Time::Second),
+  derived_conversion_factor<Unit::MassRate>(Unit::Mass::Slug, Unit::Time::Second),
+  derived_conversion_factor<Unit::MassRate>(Unit::Mass::Slinch, Unit::Time::Second),
+  derived_conversion_factor<Unit::MassRate>(Unit::Mass::Pound, Unit::Time::Second)
 };
 
 } // namespace PhQ
@@ -27,7 +27,7 @@ enum class Memory : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::Memory, std::string> abbreviations<Unit::Memory>{
+template <> constexpr const std::array<std::pair<Unit::Memory, std::string_view>, 10> abbreviations<Unit::Memory>{{
   {Unit::Memory::Bit, "b"},
   {Unit::Memory::Kilobit, "kb"},
   {Unit::Memory::Megabit, "Mb"},
@@ -38,9 +38,11 @@ template <> const std::map<Unit::Memory, std::string> abbreviations<Unit::Memory
   {Unit::Memory::Megabyte, "MB"},
   {Unit::Memory::Gigabyte, "GB"},
   {Unit::Memory::Terabyte, "TB"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::Memory>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::Memory> spellings<Unit::Memory>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::Memory>, 30> spellings<Unit::Memory>{{
   {"b", Unit::Memory::Bit},
   {"bit", Unit::Memory::Bit},
   {"bits", Unit::Memory::Bit},
@@ -71,140 +73,32 @@ template <> const std::unordered_map<std::string, Unit::Memory> spellings<Unit::
   {"TB", Unit::Memory::Terabyte},
   {"terabyte", Unit::Memory::Terabyte},
   {"terabytes", Unit::Memory::Terabyte}
-};
+}};
 
-template <> const std::map<System, Unit::Memory> consistent_units<Unit::Memory>{
+template <> constexpr const std::array<std::pair<System, Unit::Memory>, 4> consistent_units<Unit::Memory>{{
   {System::MetreKilogramSecondKelvin, Unit::Memory::Byte},
   {System::MillimetreGramSecondKelvin, Unit::Memory::Byte},
   {System::FootPoundSecondRankine, Unit::Memory::Byte},
   {System::InchPoundSecondRankine, Unit::Memory::Byte}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::Memory>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::Memory standard_unit<Unit::Memory>{Unit::Memory::Byte};
 
 template <> constexpr const Dimension::Set dimension<Unit::Memory>{Dimension::Set{}};
 
-template <> const std::map<Unit::Memory, std::map<Unit::Memory, std::function<void(std::vector<double>&)>>> conversions<Unit::Memory>{
-  {Unit::Memory::Bit, {
-    {Unit::Memory::Bit, [](std::vector<double>& values)->void{}},
-    {Unit::Memory::Kilobit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}},
-    {Unit::Memory::Megabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 2);});}},
-    {Unit::Memory::Gigabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 3);});}},
-    {Unit::Memory::Terabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 4);});}},
-    {Unit::Memory::Byte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125;});}},
-    {Unit::Memory::Kilobyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / 1024.0;});}},
-    {Unit::Memory::Megabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / std::pow(1024.0, 2);});}},
-    {Unit::Memory::Gigabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / std::pow(1024.0, 3);});}},
-    {Unit::Memory::Terabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / std::pow(1024.0, 4);});}}
-  }},
-  {Unit::Memory::Kilobit, {
-    {Unit::Memory::Bit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::Memory::Kilobit, [](std::vector<double>& values)->void{}},
-    {Unit::Memory::Megabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}},
-    {Unit::Memory::Gigabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 2);});}},
-    {Unit::Memory::Terabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 3);});}},
-    {Unit::Memory::Byte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * 1024.0;});}},
-    {Unit::Memory::Kilobyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125;});}},
-    {Unit::Memory::Megabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / 1024.0;});}},
-    {Unit::Memory::Gigabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / std::pow(1024.0, 2);});}},
-    {Unit::Memory::Terabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / std::pow(1024.0, 3);});}}
-  }},
-  {Unit::Memory::Megabit, {
-    {Unit::Memory::Bit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 2);});}},
-    {Unit::Memory::Kilobit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::Memory::Megabit, [](std::vector<double>& values)->void{}},
-    {Unit::Memory::Gigabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}},
-    {Unit::Memory::Terabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 2);});}},
-    {Unit::Memory::Byte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * std::pow(1024.0, 2);});}},
-    {Unit::Memory::Kilobyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * 1024.0;});}},
-    {Unit::Memory::Megabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125;});}},
-    {Unit::Memory::Gigabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / 1024.0;});}},
-    {Unit::Memory::Terabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / std::pow(1024.0, 2);});}}
-  }},
-  {Unit::Memory::Gigabit, {
-    {Unit::Memory::Bit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 3);});}},
-    {Unit::Memory::Kilobit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 2);});}},
-    {Unit::Memory::Megabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::Memory::Gigabit, [](std::vector<double>& values)->void{}},
-    {Unit::Memory::Terabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}},
-    {Unit::Memory::Byte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * std::pow(1024.0, 3);});}},
-    {Unit::Memory::Kilobyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * std::pow(1024.0, 2);});}},
-    {Unit::Memory::Megabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * 1024.0;});}},
-    {Unit::Memory::Gigabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125;});}},
-    {Unit::Memory::Terabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / 1024.0;});}}
-  }},
-  {Unit::Memory::Terabit, {
-    {Unit::Memory::Bit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 4);});}},
-    {Unit::Memory::Kilobit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 3);});}},
-    {Unit::Memory::Megabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 2);});}},
-    {Unit::Memory::Gigabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::Memory::Terabit, [](std::vector<double>& values)->void{}},
-    {Unit::Memory::Byte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * std::pow(1024.0, 4);});}},
-    {Unit::Memory::Kilobyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * std::pow(1024.0, 3);});}},
-    {Unit::Memory::Megabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * std::pow(1024.0, 2);});}},
-    {Unit::Memory::Gigabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * 1024.0;});}},
-    {Unit::Memory::Terabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125;});}}
-  }},
-  {Unit::Memory::Byte, {
-    {Unit::Memory::Bit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0;});}},
-    {Unit::Memory::Kilobit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / 1024.0;});}},
-    {Unit::Memory::Megabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / std::pow(1024.0, 2);});}},
-    {Unit::Memory::Gigabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / std::pow(1024.0, 3);});}},
-    {Unit::Memory::Terabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / std::pow(1024.0, 4);});}},
-    {Unit::Memory::Byte, [](std::vector<double>& values)->void{}},
-    {Unit::Memory::Kilobyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}},
-    {Unit::Memory::Megabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 2);});}},
-    {Unit::Memory::Gigabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 3);});}},
-    {Unit::Memory::Terabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 4);});}}
-  }},
-  {Unit::Memory::Kilobyte, {
-    {Unit::Memory::Bit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * 1024.0;});}},
-    {Unit::Memory::Kilobit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0;});}},
-    {Unit::Memory::Megabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / 1024.0;});}},
-    {Unit::Memory::Gigabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / std::pow(1024.0, 2);});}},
-    {Unit::Memory::Terabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / std::pow(1024.0, 3);});}},
-    {Unit::Memory::Byte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::Memory::Kilobyte, [](std::vector<double>& values)->void{}},
-    {Unit::Memory::Megabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}},
-    {Unit::Memory::Gigabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 2);});}},
-    {Unit::Memory::Terabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 3);});}}
-  }},
-  {Unit::Memory::Megabyte, {
-    {Unit::Memory::Bit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * std::pow(1024.0, 2);});}},
-    {Unit::Memory::Kilobit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * 1024.0;});}},
-    {Unit::Memory::Megabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0;});}},
-    {Unit::Memory::Gigabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / 1024.0;});}},
-    {Unit::Memory::Terabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / std::pow(1024.0, 2);});}},
-    {Unit::Memory::Byte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 2);});}},
-    {Unit::Memory::Kilobyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::Memory::Megabyte, [](std::vector<double>& values)->void{}},
-    {Unit::Memory::Gigabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}},
-    {Unit::Memory::Terabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 2);});}}
-  }},
-  {Unit::Memory::Gigabyte, {
-    {Unit::Memory::Bit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * std::pow(1024.0, 3);});}},
-    {Unit::Memory::Kilobit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * std::pow(1024.0, 2);});}},
-    {Unit::Memory::Megabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * 1024.0;});}},
-    {Unit::Memory::Gigabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0;});}},
-    {Unit::Memory::Terabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / 1024.0;});}},
-    {Unit::Memory::Byte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 3);});}},
-    {Unit::Memory::Kilobyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 2);});}},
-    {Unit::Memory::Megabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::Memory::Gigabyte, [](std::vector<double>& values)->void{}},
-    {Unit::Memory::Terabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}}
-  }},
-  {Unit::Memory::Terabyte, {
-    {Unit::Memory::Bit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * std::pow(1024.0, 4);});}},
-    {Unit::Memory::Kilobit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * std::pow(1024.0, 3);});}},
-    {Unit::Memory::Megabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * std::pow(1024.0, 2);});}},
-    {Unit::Memory::Gigabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * 1024.0;});}},
-    {Unit::Memory::Terabit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0;});}},
-    {Unit::Memory::Byte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 4);});}},
-    {Unit::Memory::Kilobyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 3);});}},
-    {Unit::Memory::Megabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 2);});}},
-    {Unit::Memory::Gigabyte, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::Memory::Terabyte, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 10> conversion_factors<Unit::Memory>{
+  ConversionFactor{0.125},
+  ConversionFactor{0.125 * 1024.0},
+  ConversionFactor{0.125 * (1024.0 * 1024.0)},
+  ConversionFactor{0.125 * (1024.0 * 1024.0 * 1024.0)},
+  ConversionFactor{0.125 * (1024.0 * 1024.0 * 1024.0 * 1024.0)},
+  ConversionFactor{1.0},
+  ConversionFactor{1024.0},
+  ConversionFactor{1024.0 * 1024.0},
+  ConversionFactor{1024.0 * 1024.0 * 1024.0},
+  ConversionFactor{1024.0 * 1024.0 * 1024.0 * 1024.0}
 };
 
 } // namespace PhQ
@@ -7,6 +7,8 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Memory.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -27,7 +29,7 @@ enum class MemoryRate : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::MemoryRate, std::string> abbreviations<Unit::MemoryRate>{
+template <> constexpr const std::array<std::pair<Unit::MemoryRate, std::string_view>, 10> abbreviations<Unit::MemoryRate>{{
   {Unit::MemoryRate::BitPerSecond, "b/s"},
   {Unit::MemoryRate::KilobitPerSecond, "kb/s"},
   {Unit::MemoryRate::MegabitPerSecond, "Mb/s"},
@@ -38,9 +40,11 @@ template <> const std::map<Unit::MemoryRate, std::string> abbreviations<Unit::Me
   {Unit::MemoryRate::MegabytePerSecond, "MB/s"},
   {Unit::MemoryRate::GigabytePerSecond, "GB/s"},
   {Unit::MemoryRate::TerabytePerSecond, "TB/s"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::MemoryRate>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::MemoryRate> spellings<Unit::MemoryRate>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::MemoryRate>, 10> spellings<Unit::MemoryRate>{{
   {"b/s", Unit::MemoryRate::BitPerSecond},
   {"kb/s", Unit::MemoryRate::KilobitPerSecond},
   {"Mb/s", Unit::MemoryRate::MegabitPerSecond},
@@ -51,140 +55,32 @@ template <> const std::unordered_map<std::string, Unit::MemoryRate> spellings<Un
   {"MB/s", Unit::MemoryRate::MegabytePerSecond},
   {"GB/s", Unit::MemoryRate::GigabytePerSecond},
   {"TB/s", Unit::MemoryRate::TerabytePerSecond}
-};
+}};
 
-template <> const std::map<System, Unit::MemoryRate> consistent_units<Unit::MemoryRate>{
+template <> constexpr const std::array<std::pair<System, Unit::MemoryRate>, 4> consistent_units<Unit::MemoryRate>{{
   {System::MetreKilogramSecondKelvin, Unit::MemoryRate::BytePerSecond},
   {System::MillimetreGramSecondKelvin, Unit::MemoryRate::BytePerSecond},
   {System::FootPoundSecondRankine, Unit::MemoryRate::BytePerSecond},
   {System::InchPoundSecondRankine, Unit::MemoryRate::BytePerSecond}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::MemoryRate>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::MemoryRate standard_unit<Unit::MemoryRate>{Unit::MemoryRate::BytePerSecond};
 
 template <> constexpr const Dimension::Set dimension<Unit::MemoryRate>{Dimension::Set{Dimension::Length{}, Dimension::Mass{}, Dimension::Time{-1}}};
 
-template <> const std::map<Unit::MemoryRate, std::map<Unit::MemoryRate, std::function<void(std::vector<double>&)>>> conversions<Unit::MemoryRate>{
-  {Unit::MemoryRate::BitPerSecond, {
-    {Unit::MemoryRate::BitPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::MemoryRate::KilobitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}},
-    {Unit::MemoryRate::MegabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::GigabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 3);});}},
-    {Unit::MemoryRate::TerabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 4);});}},
-    {Unit::MemoryRate::BytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125;});}},
-    {Unit::MemoryRate::KilobytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / 1024.0;});}},
-    {Unit::MemoryRate::MegabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::GigabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / std::pow(1024.0, 3);});}},
-    {Unit::MemoryRate::TerabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / std::pow(1024.0, 4);});}}
-  }},
-  {Unit::MemoryRate::KilobitPerSecond, {
-    {Unit::MemoryRate::BitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::MemoryRate::KilobitPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::MemoryRate::MegabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}},
-    {Unit::MemoryRate::GigabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::TerabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 3);});}},
-    {Unit::MemoryRate::BytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * 1024.0;});}},
-    {Unit::MemoryRate::KilobytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125;});}},
-    {Unit::MemoryRate::MegabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / 1024.0;});}},
-    {Unit::MemoryRate::GigabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::TerabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / std::pow(1024.0, 3);});}}
-  }},
-  {Unit::MemoryRate::MegabitPerSecond, {
-    {Unit::MemoryRate::BitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::KilobitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::MemoryRate::MegabitPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::MemoryRate::GigabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}},
-    {Unit::MemoryRate::TerabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::BytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::KilobytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * 1024.0;});}},
-    {Unit::MemoryRate::MegabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125;});}},
-    {Unit::MemoryRate::GigabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / 1024.0;});}},
-    {Unit::MemoryRate::TerabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / std::pow(1024.0, 2);});}}
-  }},
-  {Unit::MemoryRate::GigabitPerSecond, {
-    {Unit::MemoryRate::BitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 3);});}},
-    {Unit::MemoryRate::KilobitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::MegabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::MemoryRate::GigabitPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::MemoryRate::TerabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}},
-    {Unit::MemoryRate::BytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * std::pow(1024.0, 3);});}},
-    {Unit::MemoryRate::KilobytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::MegabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * 1024.0;});}},
-    {Unit::MemoryRate::GigabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125;});}},
-    {Unit::MemoryRate::TerabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 / 1024.0;});}}
-  }},
-  {Unit::MemoryRate::TerabitPerSecond, {
-    {Unit::MemoryRate::BitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 4);});}},
-    {Unit::MemoryRate::KilobitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 3);});}},
-    {Unit::MemoryRate::MegabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::GigabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::MemoryRate::TerabitPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::MemoryRate::BytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * std::pow(1024.0, 4);});}},
-    {Unit::MemoryRate::KilobytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * std::pow(1024.0, 3);});}},
-    {Unit::MemoryRate::MegabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::GigabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125 * 1024.0;});}},
-    {Unit::MemoryRate::TerabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.125;});}}
-  }},
-  {Unit::MemoryRate::BytePerSecond, {
-    {Unit::MemoryRate::BitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0;});}},
-    {Unit::MemoryRate::KilobitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / 1024.0;});}},
-    {Unit::MemoryRate::MegabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::GigabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / std::pow(1024.0, 3);});}},
-    {Unit::MemoryRate::TerabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / std::pow(1024.0, 4);});}},
-    {Unit::MemoryRate::BytePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::MemoryRate::KilobytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}},
-    {Unit::MemoryRate::MegabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::GigabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 3);});}},
-    {Unit::MemoryRate::TerabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 4);});}}
-  }},
-  {Unit::MemoryRate::KilobytePerSecond, {
-    {Unit::MemoryRate::BitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * 1024.0;});}},
-    {Unit::MemoryRate::KilobitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0;});}},
-    {Unit::MemoryRate::MegabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / 1024.0;});}},
-    {Unit::MemoryRate::GigabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::TerabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / std::pow(1024.0, 3);});}},
-    {Unit::MemoryRate::BytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::MemoryRate::KilobytePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::MemoryRate::MegabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}},
-    {Unit::MemoryRate::GigabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::TerabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 3);});}}
-  }},
-  {Unit::MemoryRate::MegabytePerSecond, {
-    {Unit::MemoryRate::BitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::KilobitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * 1024.0;});}},
-    {Unit::MemoryRate::MegabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0;});}},
-    {Unit::MemoryRate::GigabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / 1024.0;});}},
-    {Unit::MemoryRate::TerabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::BytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::KilobytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::MemoryRate::MegabytePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::MemoryRate::GigabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}},
-    {Unit::MemoryRate::TerabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1024.0, 2);});}}
-  }},
-  {Unit::MemoryRate::GigabytePerSecond, {
-    {Unit::MemoryRate::BitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * std::pow(1024.0, 3);});}},
-    {Unit::MemoryRate::KilobitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::MegabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * 1024.0;});}},
-    {Unit::MemoryRate::GigabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0;});}},
-    {Unit::MemoryRate::TerabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 / 1024.0;});}},
-    {Unit::MemoryRate::BytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 3);});}},
-    {Unit::MemoryRate::KilobytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::MegabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::MemoryRate::GigabytePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::MemoryRate::TerabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1024.0;});}}
-  }},
-  {Unit::MemoryRate::TerabytePerSecond, {
-    {Unit::MemoryRate::BitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * std::pow(1024.0, 4);});}},
-    {Unit::MemoryRate::KilobitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * std::pow(1024.0, 3);});}},
-    {Unit::MemoryRate::MegabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::GigabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0 * 1024.0;});}},
-    {Unit::MemoryRate::TerabitPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 8.0;});}},
-    {Unit::MemoryRate::BytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 4);});}},
-    {Unit::MemoryRate::KilobytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 3);});}},
-    {Unit::MemoryRate::MegabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1024.0, 2);});}},
-    {Unit::MemoryRate::GigabytePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1024.0;});}},
-    {Unit::MemoryRate::TerabytePerSecond, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 10> conversion_factors<Unit::MemoryRate>{
+  derived_conversion_factor<Unit::MemoryRate>(Unit::Memory::Bit, Unit::Time::Second),
+  derived_conversion_factor<Unit::MemoryRate>(Unit::Memory::Kilobit, Unit::Time::Second),
+  derived_conversion_factor<Unit::MemoryRate>(Unit::Memory::Megabit, Unit::Time::Second),
+  derived_conversion_factor<Unit::MemoryRate>(Unit::Memory::Gigabit, Unit::Time::Second),
+  derived_conversion_factor<Unit::MemoryRate>(Unit::Memory::Terabit, Unit::Time::Second),
+  derived_conversion_factor<Unit::MemoryRate>(Unit::Memory::Byte, Unit::Time::Second),
+  derived_conversion_factor<Unit::MemoryRate>(Unit::Memory::Kilobyte, Unit::Time::Second),
+  derived_conversion_factor<Unit::MemoryRate>(Unit::Memory::Megabyte, Unit::Time::Second),
+  derived_conversion_factor<Unit::MemoryRate>(Unit::Memory::Gigabyte, Unit::Time::Second),
+  derived_conversion_factor<Unit::MemoryRate>(Unit::Memory::Terabyte, Unit::Time::Second)
 };
 
 } // namespace PhQ
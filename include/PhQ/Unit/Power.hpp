@@ -7,6 +7,9 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "Mass.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -26,7 +29,7 @@ enum class Power : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::Power, std::string> abbreviations<Unit::Power>{
+template <> constexpr const std::array<std::pair<Unit::Power, std::string_view>, 9> abbreviations<Unit::Power>{{
   {Unit::Power::Watt, "W"},
   {Unit::Power::Milliwatt, "mW"},
   {Unit::Power::Microwatt, "μW"},
@@ -36,9 +39,11 @@ template <> const std::map<Unit::Power, std::string> abbreviations<Unit::Power>{
   {Unit::Power::Gigawatt, "GW"},
   {Unit::Power::FootPoundPerSecond, "ft·lbf/s"},
   {Unit::Power::InchPoundPerSecond, "in·lbf/s"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::Power>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::Power> spellings<Unit::Power>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::Power>, 30> spellings<Unit::Power>{{
   {"W", Unit::Power::Watt},
   {"N·m/s", Unit::Power::Watt},
   {"N*m/s", Unit::Power::Watt},
@@ -69,119 +74,31 @@ template <> const std::unordered_map<std::string, Unit::Power> spellings<Unit::P
   {"in*lbf/s", Unit::Power::InchPoundPerSecond},
   {"in·lb/s", Unit::Power::InchPoundPerSecond},
   {"in*lb/s", Unit::Power::InchPoundPerSecond}
-};
+}};
 
-template <> const std::map<System, Unit::Power> consistent_units<Unit::Power>{
+template <> constexpr const std::array<std::pair<System, Unit::Power>, 4> consistent_units<Unit::Power>{{
   {System::MetreKilogramSecondKelvin, Unit::Power::Watt},
   {System::MillimetreGramSecondKelvin, Unit::Power::Nanowatt},
   {System::FootPoundSecondRankine, Unit::Power::FootPoundPerSecond},
   {System::InchPoundSecondRankine, Unit::Power::InchPoundPerSecond}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::Power>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::Power standard_unit<Unit::Power>{Unit::Power::Watt};
 
 template <> constexpr const Dimension::Set dimension<Unit::Power>{Dimension::Set{Dimension::Length{2}, Dimension::Mass{1}, Dimension::Time{-3}}};
 
-template <> const std::map<Unit::Power, std::map<Unit::Power, std::function<void(std::vector<double>&)>>> conversions<Unit::Power>{
-  {Unit::Power::Watt, {
-    {Unit::Power::Watt, [](std::vector<double>& values)->void{}},
-    {Unit::Power::Milliwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3;});}},
-    {Unit::Power::Microwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6;});}},
-    {Unit::Power::Nanowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e9;});}},
-    {Unit::Power::Kilowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3;});}},
-    {Unit::Power::Megawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-6;});}},
-    {Unit::Power::Gigawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-9;});}},
-    {Unit::Power::FootPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::InchPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.0254 * 0.45359237 * 9.80665;});}}
-  }},
-  {Unit::Power::Milliwatt, {
-    {Unit::Power::Watt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3;});}},
-    {Unit::Power::Milliwatt, [](std::vector<double>& values)->void{}},
-    {Unit::Power::Microwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3;});}},
-    {Unit::Power::Nanowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6;});}},
-    {Unit::Power::Kilowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-6;});}},
-    {Unit::Power::Megawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-9;});}},
-    {Unit::Power::Gigawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-12;});}},
-    {Unit::Power::FootPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e3 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::InchPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e3 * 0.0254 * 0.45359237 * 9.80665;});}}
-  }},
-  {Unit::Power::Microwatt, {
-    {Unit::Power::Watt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-6;});}},
-    {Unit::Power::Milliwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3;});}},
-    {Unit::Power::Microwatt, [](std::vector<double>& values)->void{}},
-    {Unit::Power::Nanowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3;});}},
-    {Unit::Power::Kilowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-9;});}},
-    {Unit::Power::Megawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-12;});}},
-    {Unit::Power::Gigawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-15;});}},
-    {Unit::Power::FootPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e6 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::InchPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e6 * 0.0254 * 0.45359237 * 9.80665;});}}
-  }},
-  {Unit::Power::Nanowatt, {
-    {Unit::Power::Watt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-9;});}},
-    {Unit::Power::Milliwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-6;});}},
-    {Unit::Power::Microwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3;});}},
-    {Unit::Power::Nanowatt, [](std::vector<double>& values)->void{}},
-    {Unit::Power::Kilowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-12;});}},
-    {Unit::Power::Megawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-15;});}},
-    {Unit::Power::Gigawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-18;});}},
-    {Unit::Power::FootPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e9 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::InchPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e9 * 0.0254 * 0.45359237 * 9.80665;});}}
-  }},
-  {Unit::Power::Kilowatt, {
-    {Unit::Power::Watt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3;});}},
-    {Unit::Power::Milliwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6;});}},
-    {Unit::Power::Microwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e9;});}},
-    {Unit::Power::Nanowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e12;});}},
-    {Unit::Power::Kilowatt, [](std::vector<double>& values)->void{}},
-    {Unit::Power::Megawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3;});}},
-    {Unit::Power::Gigawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-6;});}},
-    {Unit::Power::FootPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e-3 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::InchPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e-3 * 0.0254 * 0.45359237 * 9.80665;});}}
-  }},
-  {Unit::Power::Megawatt, {
-    {Unit::Power::Watt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6;});}},
-    {Unit::Power::Milliwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e9;});}},
-    {Unit::Power::Microwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e12;});}},
-    {Unit::Power::Nanowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e15;});}},
-    {Unit::Power::Kilowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3;});}},
-    {Unit::Power::Megawatt, [](std::vector<double>& values)->void{}},
-    {Unit::Power::Gigawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3;});}},
-    {Unit::Power::FootPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e-6 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::InchPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e-6 * 0.0254 * 0.45359237 * 9.80665;});}}
-  }},
-  {Unit::Power::Gigawatt, {
-    {Unit::Power::Watt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e9;});}},
-    {Unit::Power::Milliwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e12;});}},
-    {Unit::Power::Microwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e15;});}},
-    {Unit::Power::Nanowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e18;});}},
-    {Unit::Power::Kilowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6;});}},
-    {Unit::Power::Megawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3;});}},
-    {Unit::Power::Gigawatt, [](std::vector<double>& values)->void{}},
-    {Unit::Power::FootPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e-9 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::InchPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e-9 * 0.0254 * 0.45359237 * 9.80665;});}}
-  }},
-  {Unit::Power::FootPoundPerSecond, {
-    {Unit::Power::Watt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::Milliwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::Microwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::Nanowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e9 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::Kilowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::Megawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-6 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::Gigawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-9 * 0.3048 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::FootPoundPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::Power::InchPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12.0;});}}
-  }},
-  {Unit::Power::InchPoundPerSecond, {
-    {Unit::Power::Watt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0254 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::Milliwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e3 * 0.0254 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::Microwatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6 * 0.0254 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::Nanowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e9 * 0.0254 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::Kilowatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-3 * 0.0254 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::Megawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-6 * 0.0254 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::Gigawatt, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-9 * 0.0254 * 0.45359237 * 9.80665;});}},
-    {Unit::Power::FootPoundPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12.0;});}},
-    {Unit::Power::InchPoundPerSecond, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 9> conversion_factors<Unit::Power>{
+  ConversionFactor{1.0},
+  ConversionFactor{0.001},
+  ConversionFactor{0.000001},
+  derived_conversion_factor<Unit::Power>(Unit::Length::Millimetre, Unit::Mass::Gram, Unit::Time::Second),
+  ConversionFactor{1000.0},
+  ConversionFactor{1000000.0},
+  ConversionFactor{1000000000.0},
+  derived_conversion_factor<Unit::Power>(Unit::Length::Foot, Unit::Mass::Slug, Unit::Time::Second),
+  derived_conversion_factor<Unit::Power>(Unit::Length::Inch, Unit::Mass::Slinch, Unit::Time::Second)
 };
 
 } // namespace PhQ
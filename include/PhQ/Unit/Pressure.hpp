@@ -7,6 +7,9 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "Mass.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -25,7 +28,7 @@ enum class Pressure : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::Pressure, std::string> abbreviations<Unit::Pressure>{
+template <> constexpr const std::array<std::pair<Unit::Pressure, std::string_view>, 8> abbreviations<Unit::Pressure>{{
   {Unit::Pressure::Pascal, "Pa"},
   {Unit::Pressure::Kilopascal, "kPa"},
   {Unit::Pressure::Megapascal, "MPa"},
@@ -34,9 +37,11 @@ template <> const std::map<Unit::Pressure, std::string> abbreviations<Unit::Pres
   {Unit::Pressure::Atmosphere, "atm"},
   {Unit::Pressure::PoundPerSquareFoot, "lbf/ft^2"},
   {Unit::Pressure::PoundPerSquareInch, "lbf/in^2"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::Pressure>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::Pressure> spellings<Unit::Pressure>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::Pressure>, 35> spellings<Unit::Pressure>{{
   {"Pa", Unit::Pressure::Pascal},
   {"N/m^2", Unit::Pressure::Pascal},
   {"N/m2", Unit::Pressure::Pascal},
@@ -72,101 +77,30 @@ template <> const std::unordered_map<std::string, Unit::Pressure> spellings<Unit
   {"lb/in^2", Unit::Pressure::PoundPerSquareInch},
   {"lb/in2", Unit::Pressure::PoundPerSquareInch},
   {"psi", Unit::Pressure::PoundPerSquareInch}
-};
+}};
 
-template <> const std::map<System, Unit::Pressure> consistent_units<Unit::Pressure>{
+template <> constexpr const std::array<std::pair<System, Unit::Pressure>, 4> consistent_units<Unit::Pressure>{{
   {System::MetreKilogramSecondKelvin, Unit::Pressure::Pascal},
   {System::MillimetreGramSecondKelvin, Unit::Pressure::Pascal},
   {System::FootPoundSecondRankine, Unit::Pressure::PoundPerSquareFoot},
   {System::InchPoundSecondRankine, Unit::Pressure::PoundPerSquareInch}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::Pressure>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::Pressure standard_unit<Unit::Pressure>{Unit::Pressure::Pascal};
 
 template <> constexpr const Dimension::Set dimension<Unit::Pressure>{Dimension::Set{Dimension::Length{-1}, Dimension::Mass{1}, Dimension::Time{-2}}};
 
-template <> const std::map<Unit::Pressure, std::map<Unit::Pressure, std::function<void(std::vector<double>&)>>> conversions<Unit::Pressure>{
-  {Unit::Pressure::Pascal, {
-    {Unit::Pressure::Pascal, [](std::vector<double>& values)->void{}},
-    {Unit::Pressure::Kilopascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Pressure::Megapascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001;});}},
-    {Unit::Pressure::Gigapascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000000001;});}},
-    {Unit::Pressure::Bar, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.00001;});}},
-    {Unit::Pressure::Atmosphere, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 101325.0;});}},
-    {Unit::Pressure::PoundPerSquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.3048, 2) / (0.45359237 * 9.80665);});}},
-    {Unit::Pressure::PoundPerSquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 2) / (0.45359237 * 9.80665);});}}
-  }},
-  {Unit::Pressure::Kilopascal, {
-    {Unit::Pressure::Pascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::Pressure::Kilopascal, [](std::vector<double>& values)->void{}},
-    {Unit::Pressure::Megapascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Pressure::Gigapascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001;});}},
-    {Unit::Pressure::Bar, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.01;});}},
-    {Unit::Pressure::Atmosphere, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 101.325;});}},
-    {Unit::Pressure::PoundPerSquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0 * std::pow(0.3048, 2) / (0.45359237 * 9.80665);});}},
-    {Unit::Pressure::PoundPerSquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0 * std::pow(0.0254, 2) / (0.45359237 * 9.80665);});}}
-  }},
-  {Unit::Pressure::Megapascal, {
-    {Unit::Pressure::Pascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0;});}},
-    {Unit::Pressure::Kilopascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::Pressure::Megapascal, [](std::vector<double>& values)->void{}},
-    {Unit::Pressure::Gigapascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::Pressure::Bar, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10.0;});}},
-    {Unit::Pressure::Atmosphere, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.101325;});}},
-    {Unit::Pressure::PoundPerSquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0 * std::pow(0.3048, 2) / (0.45359237 * 9.80665);});}},
-    {Unit::Pressure::PoundPerSquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0 * std::pow(0.0254, 2) / (0.45359237 * 9.80665);});}}
-  }},
-  {Unit::Pressure::Gigapascal, {
-    {Unit::Pressure::Pascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000000.0;});}},
-    {Unit::Pressure::Kilopascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000.0;});}},
-    {Unit::Pressure::Megapascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::Pressure::Gigapascal, [](std::vector<double>& values)->void{}},
-
-    {Unit::Pressure::Bar, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 10000.0;});}},
-    {Unit::Pressure::Atmosphere, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.000101325;});}},
-    {Unit::Pressure::PoundPerSquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000000.0 * std::pow(0.3048, 2) / (0.45359237 * 9.80665);});}},
-    {Unit::Pressure::PoundPerSquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000000000.0 * std::pow(0.0254, 2) / (0.45359237 * 9.80665);});}}
-  }},
-  {Unit::Pressure::Bar, {
-    {Unit::Pressure::Pascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 100000.0;});}},
-    {Unit::Pressure::Kilopascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 100.0;});}},
-    {Unit::Pressure::Megapascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.1;});}},
-    {Unit::Pressure::Gigapascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.0001;});}},
-    {Unit::Pressure::Bar, [](std::vector<double>& values)->void{}},
-    {Unit::Pressure::Atmosphere, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.01325;});}},
-    {Unit::Pressure::PoundPerSquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 100000.0 * std::pow(0.3048, 2) / (0.45359237 * 9.80665);});}},
-    {Unit::Pressure::PoundPerSquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 100000.0 * std::pow(0.0254, 2) / (0.45359237 * 9.80665);});}}
-  }},
-  {Unit::Pressure::Atmosphere, {
-    {Unit::Pressure::Pascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 101325.0;});}},
-    {Unit::Pressure::Kilopascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 101.325;});}},
-    {Unit::Pressure::Megapascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.101325;});}},
-    {Unit::Pressure::Gigapascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000101325;});}},
-    {Unit::Pressure::Bar, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.01325;});}},
-    {Unit::Pressure::Atmosphere, [](std::vector<double>& values)->void{}},
-    {Unit::Pressure::PoundPerSquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 101325.0 * std::pow(0.3048, 2) / (0.45359237 * 9.80665);});}},
-    {Unit::Pressure::PoundPerSquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 101325.0 * std::pow(0.0254, 2) / (0.45359237 * 9.80665);});}}
-  }},
-  {Unit::Pressure::PoundPerSquareFoot, {
-    {Unit::Pressure::Pascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / std::pow(0.3048, 2);});}},
-    {Unit::Pressure::Kilopascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001 * 0.45359237 * 9.80665 / std::pow(0.3048, 2);});}},
-    {Unit::Pressure::Megapascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001 * 0.45359237 * 9.80665 / std::pow(0.3048, 2);});}},
-    {Unit::Pressure::Gigapascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000000001 * 0.45359237 * 9.80665 / std::pow(0.3048, 2);});}},
-    {Unit::Pressure::Bar, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.00001 * 0.45359237 * 9.80665 / std::pow(0.3048, 2);});}},
-    {Unit::Pressure::Atmosphere, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / (std::pow(0.3048, 2) * 101325.0);});}},
-    {Unit::Pressure::PoundPerSquareFoot, [](std::vector<double>& values)->void{}},
-    {Unit::Pressure::PoundPerSquareInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12.0, 2);});}}
-  }},
-  {Unit::Pressure::PoundPerSquareInch, {
-    {Unit::Pressure::Pascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / std::pow(0.0254, 2);});}},
-    {Unit::Pressure::Kilopascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001 * 0.45359237 * 9.80665 / std::pow(0.0254, 2);});}},
-    {Unit::Pressure::Megapascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000001 * 0.45359237 * 9.80665 / std::pow(0.0254, 2);});}},
-    {Unit::Pressure::Gigapascal, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.000000001 * 0.45359237 * 9.80665 / std::pow(0.0254, 2);});}},
-    {Unit::Pressure::Bar, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.00001 * 0.45359237 * 9.80665 / std::pow(0.0254, 2);});}},
-    {Unit::Pressure::Atmosphere, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 / (std::pow(0.0254, 2) * 101325.0);});}},
-    {Unit::Pressure::PoundPerSquareFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12.0, 2);});}},
-    {Unit::Pressure::PoundPerSquareInch, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 8> conversion_factors<Unit::Pressure>{
+  ConversionFactor{1.0},
+  ConversionFactor{1000.0},
+  ConversionFactor{1000000.0},
+  ConversionFactor{1000000000.0},
+  ConversionFactor{100000.0},
+  ConversionFactor{101325.0},
+  derived_conversion_factor<Unit::Pressure>(Unit::Length::Foot, Unit::Mass::Slug, Unit::Time::Second),
+  derived_conversion_factor<Unit::Pressure>(Unit::Length::Inch, Unit::Mass::Slinch, Unit::Time::Second)
 };
 
 } // namespace PhQ
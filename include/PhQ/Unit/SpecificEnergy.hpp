@@ -7,6 +7,9 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "Mass.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -21,14 +24,16 @@ enum class SpecificEnergy : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::SpecificEnergy, std::string> abbreviations<Unit::SpecificEnergy>{
+template <> constexpr const std::array<std::pair<Unit::SpecificEnergy, std::string_view>, 4> abbreviations<Unit::SpecificEnergy>{{
   {Unit::SpecificEnergy::JoulePerKilogram, "J/kg"},
   {Unit::SpecificEnergy::NanojoulePerGram, "nJ/g"},
   {Unit::SpecificEnergy::FootPoundPerSlug, "ft·lbf/slug"},
   {Unit::SpecificEnergy::InchPoundPerSlinch, "in·lbf/slinch"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::SpecificEnergy>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::SpecificEnergy> spellings<Unit::SpecificEnergy>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::SpecificEnergy>, 38> spellings<Unit::SpecificEnergy>{{
   {"J/kg", Unit::SpecificEnergy::JoulePerKilogram},
   {"N·m/kg", Unit::SpecificEnergy::JoulePerKilogram},
   {"N*m/kg", Unit::SpecificEnergy::JoulePerKilogram},
@@ -67,51 +72,33 @@ template <> const std::unordered_map<std::string, Unit::SpecificEnergy> spelling
   {"lb*in/slinch", Unit::SpecificEnergy::InchPoundPerSlinch},
   {"in^2/s^2", Unit::SpecificEnergy::InchPoundPerSlinch},
   {"in2/s2", Unit::SpecificEnergy::InchPoundPerSlinch}
-};
+}};
 
-template <> const std::map<System, Unit::SpecificEnergy> consistent_units<Unit::SpecificEnergy>{
+template <> constexpr const std::array<std::pair<System, Unit::SpecificEnergy>, 4> consistent_units<Unit::SpecificEnergy>{{
   {System::MetreKilogramSecondKelvin, Unit::SpecificEnergy::JoulePerKilogram},
   {System::MillimetreGramSecondKelvin, Unit::SpecificEnergy::NanojoulePerGram},
   {System::FootPoundSecondRankine, Unit::SpecificEnergy::FootPoundPerSlug},
   {System::InchPoundSecondRankine, Unit::SpecificEnergy::InchPoundPerSlinch}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::SpecificEnergy>), "The consistent_units table must be listed in the order of its enumeration.");
 
-template <> const std::map<Unit::SpecificEnergy, System> related_systems<Unit::SpecificEnergy>{
+template <> constexpr const std::array<std::pair<Unit::SpecificEnergy, System>, 4> related_systems<Unit::SpecificEnergy>{{
   {Unit::SpecificEnergy::JoulePerKilogram, System::MetreKilogramSecondKelvin},
   {Unit::SpecificEnergy::NanojoulePerGram, System::MillimetreGramSecondKelvin},
   {Unit::SpecificEnergy::FootPoundPerSlug, System::FootPoundSecondRankine},
-  {Unit::SpecificEnergy::InchPoundPerSlinch, System::InchPoundSecondRankine},
-};
+  {Unit::SpecificEnergy::InchPoundPerSlinch, System::InchPoundSecondRankine}
+}};
 
 template <> constexpr const Unit::SpecificEnergy standard_unit<Unit::SpecificEnergy>{Unit::SpecificEnergy::JoulePerKilogram};
 
 template <> constexpr const Dimension::Set dimension<Unit::SpecificEnergy>{Dimension::Set{Dimension::Length{2}, Dimension::Mass{}, Dimension::Time{-2}}};
 
-template <> const std::map<Unit::SpecificEnergy, std::map<Unit::SpecificEnergy, std::function<void(std::vector<double>&)>>> conversions<Unit::SpecificEnergy>{
-  {Unit::SpecificEnergy::JoulePerKilogram, {
-    {Unit::SpecificEnergy::JoulePerKilogram, [](std::vector<double>& values)->void{}},
-    {Unit::SpecificEnergy::NanojoulePerGram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 2);});}},
-    {Unit::SpecificEnergy::FootPoundPerSlug, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.3048, 2);});}},
-    {Unit::SpecificEnergy::InchPoundPerSlinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0254, 2);});}}
-  }},
-  {Unit::SpecificEnergy::NanojoulePerGram, {
-    {Unit::SpecificEnergy::JoulePerKilogram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 2);});}},
-    {Unit::SpecificEnergy::NanojoulePerGram, [](std::vector<double>& values)->void{}},
-    {Unit::SpecificEnergy::FootPoundPerSlug, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(304.8, 2);});}},
-    {Unit::SpecificEnergy::InchPoundPerSlinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(25.4, 2);});}}
-  }},
-  {Unit::SpecificEnergy::FootPoundPerSlug, {
-    {Unit::SpecificEnergy::JoulePerKilogram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.3048, 2);});}},
-    {Unit::SpecificEnergy::NanojoulePerGram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(304.8, 2);});}},
-    {Unit::SpecificEnergy::FootPoundPerSlug, [](std::vector<double>& values)->void{}},
-    {Unit::SpecificEnergy::InchPoundPerSlinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12.0, 2);});}}
-  }},
-  {Unit::SpecificEnergy::InchPoundPerSlinch, {
-    {Unit::SpecificEnergy::JoulePerKilogram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 2);});}},
-    {Unit::SpecificEnergy::NanojoulePerGram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(25.4, 2);});}},
-    {Unit::SpecificEnergy::FootPoundPerSlug, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12.0, 2);});}},
-    {Unit::SpecificEnergy::InchPoundPerSlinch, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 4> conversion_factors<Unit::SpecificEnergy>{
+  ConversionFactor{1.0},
+  derived_conversion_factor<Unit::SpecificEnergy>(Unit::Length::Millimetre, Unit::Mass::Gram, Unit::Time::Second),
+  derived_conversion_factor<Unit::SpecificEnergy>(Unit::Length::Foot, Unit::Mass::Slug, Unit::Time::Second),
+  derived_conversion_factor<Unit::SpecificEnergy>(Unit::Length::Inch, Unit::Mass::Slinch, Unit::Time::Second)
 };
 
 } // namespace PhQ
@@ -7,6 +7,10 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "Mass.hpp"
+#include "TemperatureDifference.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -21,14 +25,16 @@ enum class SpecificHeatCapacity : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::SpecificHeatCapacity, std::string> abbreviations<Unit::SpecificHeatCapacity>{
+template <> constexpr const std::array<std::pair<Unit::SpecificHeatCapacity, std::string_view>, 4> abbreviations<Unit::SpecificHeatCapacity>{{
   {Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin, "J/kg/K"},
   {Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin, "nJ/g/K"},
   {Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine, "ft·lbf/slug/°R"},
   {Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine, "in·lbf/slinch/°R"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::SpecificHeatCapacity>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::SpecificHeatCapacity> spellings<Unit::SpecificHeatCapacity>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::SpecificHeatCapacity>, 130> spellings<Unit::SpecificHeatCapacity>{{
   {"J/kg/K", Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin},
   {"J/(kg·K)", Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin},
   {"J/(kg*K)", Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin},
@@ -115,38 +121,38 @@ template <> const std::unordered_map<std::string, Unit::SpecificHeatCapacity> sp
   {"ft2/s2/R", Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine},
   {"ft2/(s2·R)", Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine},
   {"ft2/(s2*R)", Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine},
-  {"in·lbf/slug/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"in·lbf/(slug·°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"in·lbf/slug/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"in·lbf/(slug·R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"in*lbf/slug/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"in*lbf/(slug*°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"in*lbf/slug/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"in*lbf/(slug*R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lbf·in/slug/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lbf·in/(slug·°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lbf·in/slug/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lbf·in/(slug·R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lbf*in/slug/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lbf*in/(slug*°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lbf*in/slug/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lbf*in/(slug*R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"in·lb/slug/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"in·lb/(slug·°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"in·lb/slug/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"in·lb/(slug·R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"in*lb/slug/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"in*lb/(slug*°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"in*lb/slug/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"in*lb/(slug*R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lb·in/slug/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lb·in/(slug·°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lb·in/slug/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lb·in/(slug·R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lb*in/slug/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lb*in/(slug*°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lb*in/slug/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-  {"lb*in/(slug*R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in·lbf/slinch/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in·lbf/(slinch·°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in·lbf/slinch/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in·lbf/(slinch·R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in*lbf/slinch/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in*lbf/(slinch*°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in*lbf/slinch/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in*lbf/(slinch*R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lbf·in/slinch/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lbf·in/(slinch·°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lbf·in/slinch/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lbf·in/(slinch·R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lbf*in/slinch/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lbf*in/(slinch*°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lbf*in/slinch/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lbf*in/(slinch*R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in·lb/slinch/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in·lb/(slinch·°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in·lb/slinch/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in·lb/(slinch·R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in*lb/slinch/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in*lb/(slinch*°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in*lb/slinch/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"in*lb/(slinch*R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lb·in/slinch/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lb·in/(slinch·°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lb·in/slinch/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lb·in/(slinch·R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lb*in/slinch/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lb*in/(slinch*°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lb*in/slinch/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+  {"lb*in/(slinch*R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
   {"in^2/s^2/°R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
   {"in^2/(s^2·°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
   {"in^2/(s^2*°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
@@ -159,51 +165,33 @@ template <> const std::unordered_map<std::string, Unit::SpecificHeatCapacity> sp
   {"in2/s2/R", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
   {"in2/(s2·R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
   {"in2/(s2*R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine}
-};
+}};
 
-template <> const std::map<System, Unit::SpecificHeatCapacity> consistent_units<Unit::SpecificHeatCapacity>{
+template <> constexpr const std::array<std::pair<System, Unit::SpecificHeatCapacity>, 4> consistent_units<Unit::SpecificHeatCapacity>{{
   {System::MetreKilogramSecondKelvin, Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin},
   {System::MillimetreGramSecondKelvin, Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin},
   {System::FootPoundSecondRankine, Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine},
   {System::InchPoundSecondRankine, Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::SpecificHeatCapacity>), "The consistent_units table must be listed in the order of its enumeration.");
 
-template <> const std::map<Unit::SpecificHeatCapacity, System> related_systems<Unit::SpecificHeatCapacity>{
+template <> constexpr const std::array<std::pair<Unit::SpecificHeatCapacity, System>, 4> related_systems<Unit::SpecificHeatCapacity>{{
   {Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin, System::MetreKilogramSecondKelvin},
   {Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin, System::MillimetreGramSecondKelvin},
   {Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine, System::FootPoundSecondRankine},
-  {Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine, System::InchPoundSecondRankine},
-};
+  {Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine, System::InchPoundSecondRankine}
+}};
 
 template <> constexpr const Unit::SpecificHeatCapacity standard_unit<Unit::SpecificHeatCapacity>{Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin};
 
 template <> constexpr const Dimension::Set dimension<Unit::SpecificHeatCapacity>{Dimension::Set{Dimension::Length{2}, Dimension::Mass{}, Dimension::Time{-2}, Dimension::ElectricCurrent{}, Dimension::Temperature{-1}}};
 
-template <> const std::map<Unit::SpecificHeatCapacity, std::map<Unit::SpecificHeatCapacity, std::function<void(std::vector<double>&)>>> conversions<Unit::SpecificHeatCapacity>{
-  {Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin, {
-    {Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin, [](std::vector<double>& values)->void{}},
-    {Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 2);});}},
-    {Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.3048, 2) * 1.8;});}},
-    {Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0254, 2) * 1.8;});}}
-  }},
-  {Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin, {
-    {Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 2);});}},
-    {Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin, [](std::vector<double>& values)->void{}},
-    {Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(304.8, 2) * 1.8;});}},
-    {Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(25.4, 2) * 1.8;});}}
-  }},
-  {Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine, {
-    {Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.3048, 2) * 1.8;});}},
-    {Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(304.8, 2) * 1.8;});}},
-    {Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine, [](std::vector<double>& values)->void{}},
-    {Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12.0, 2);});}}
-  }},
-  {Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine, {
-    {Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 2) * 1.8;});}},
-    {Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(25.4, 2) * 1.8;});}},
-    {Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12.0, 2);});}},
-    {Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 4> conversion_factors<Unit::SpecificHeatCapacity>{
+  ConversionFactor{1.0},
+  derived_conversion_factor<Unit::SpecificHeatCapacity>(Unit::Length::Millimetre, Unit::Mass::Gram, Unit::Time::Second, Unit::TemperatureDifference::Kelvin),
+  derived_conversion_factor<Unit::SpecificHeatCapacity>(Unit::Length::Foot, Unit::Mass::Slug, Unit::Time::Second, Unit::TemperatureDifference::Rankine),
+  derived_conversion_factor<Unit::SpecificHeatCapacity>(Unit::Length::Inch, Unit::Mass::Slinch, Unit::Time::Second, Unit::TemperatureDifference::Rankine)
 };
 
 } // namespace PhQ
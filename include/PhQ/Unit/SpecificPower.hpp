@@ -7,6 +7,9 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "Mass.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -21,14 +24,16 @@ enum class SpecificPower : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::SpecificPower, std::string> abbreviations<Unit::SpecificPower>{
+template <> constexpr const std::array<std::pair<Unit::SpecificPower, std::string_view>, 4> abbreviations<Unit::SpecificPower>{{
   {Unit::SpecificPower::WattPerKilogram, "W/kg"},
   {Unit::SpecificPower::NanowattPerGram, "nW/g"},
   {Unit::SpecificPower::FootPoundPerSlugPerSecond, "ft·lbf/slug/s"},
   {Unit::SpecificPower::InchPoundPerSlinchPerSecond, "in·lbf/slinch/s"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::SpecificPower>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::SpecificPower> spellings<Unit::SpecificPower>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::SpecificPower>, 122> spellings<Unit::SpecificPower>{{
   {"W/kg", Unit::SpecificPower::WattPerKilogram},
   {"N·m/kg/s", Unit::SpecificPower::WattPerKilogram},
   {"N*m/kg/s", Unit::SpecificPower::WattPerKilogram},
@@ -151,51 +156,33 @@ template <> const std::unordered_map<std::string, Unit::SpecificPower> spellings
   {"lb*in/(s*slinch)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
   {"in^2/s^3", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
   {"in2/s3", Unit::SpecificPower::InchPoundPerSlinchPerSecond}
-};
+}};
 
-template <> const std::map<System, Unit::SpecificPower> consistent_units<Unit::SpecificPower>{
+template <> constexpr const std::array<std::pair<System, Unit::SpecificPower>, 4> consistent_units<Unit::SpecificPower>{{
   {System::MetreKilogramSecondKelvin, Unit::SpecificPower::WattPerKilogram},
   {System::MillimetreGramSecondKelvin, Unit::SpecificPower::NanowattPerGram},
   {System::FootPoundSecondRankine, Unit::SpecificPower::FootPoundPerSlugPerSecond},
   {System::InchPoundSecondRankine, Unit::SpecificPower::InchPoundPerSlinchPerSecond}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::SpecificPower>), "The consistent_units table must be listed in the order of its enumeration.");
 
-template <> const std::map<Unit::SpecificPower, System> related_systems<Unit::SpecificPower>{
+template <> constexpr const std::array<std::pair<Unit::SpecificPower, System>, 4> related_systems<Unit::SpecificPower>{{
   {Unit::SpecificPower::WattPerKilogram, System::MetreKilogramSecondKelvin},
   {Unit::SpecificPower::NanowattPerGram, System::MillimetreGramSecondKelvin},
   {Unit::SpecificPower::FootPoundPerSlugPerSecond, System::FootPoundSecondRankine},
-  {Unit::SpecificPower::InchPoundPerSlinchPerSecond, System::InchPoundSecondRankine},
-};
+  {Unit::SpecificPower::InchPoundPerSlinchPerSecond, System::InchPoundSecondRankine}
+}};
 
 template <> constexpr const Unit::SpecificPower standard_unit<Unit::SpecificPower>{Unit::SpecificPower::WattPerKilogram};
 
 template <> constexpr const Dimension::Set dimension<Unit::SpecificPower>{Dimension::Set{Dimension::Length{2}, Dimension::Mass{}, Dimension::Time{-3}}};
 
-template <> const std::map<Unit::SpecificPower, std::map<Unit::SpecificPower, std::function<void(std::vector<double>&)>>> conversions<Unit::SpecificPower>{
-  {Unit::SpecificPower::WattPerKilogram, {
-    {Unit::SpecificPower::WattPerKilogram, [](std::vector<double>& values)->void{}},
-    {Unit::SpecificPower::NanowattPerGram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 2);});}},
-    {Unit::SpecificPower::FootPoundPerSlugPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.3048, 2);});}},
-    {Unit::SpecificPower::InchPoundPerSlinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0254, 2);});}}
-  }},
-  {Unit::SpecificPower::NanowattPerGram, {
-    {Unit::SpecificPower::WattPerKilogram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 2);});}},
-    {Unit::SpecificPower::NanowattPerGram, [](std::vector<double>& values)->void{}},
-    {Unit::SpecificPower::FootPoundPerSlugPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(304.8, 2);});}},
-    {Unit::SpecificPower::InchPoundPerSlinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(25.4, 2);});}}
-  }},
-  {Unit::SpecificPower::FootPoundPerSlugPerSecond, {
-    {Unit::SpecificPower::WattPerKilogram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.3048, 2);});}},
-    {Unit::SpecificPower::NanowattPerGram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(304.8, 2);});}},
-    {Unit::SpecificPower::FootPoundPerSlugPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::SpecificPower::InchPoundPerSlinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12.0, 2);});}}
-  }},
-  {Unit::SpecificPower::InchPoundPerSlinchPerSecond, {
-    {Unit::SpecificPower::WattPerKilogram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 2);});}},
-    {Unit::SpecificPower::NanowattPerGram, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(25.4, 2);});}},
-    {Unit::SpecificPower::FootPoundPerSlugPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12.0, 2);});}},
-    {Unit::SpecificPower::InchPoundPerSlinchPerSecond, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 4> conversion_factors<Unit::SpecificPower>{
+  ConversionFactor{1.0},
+  derived_conversion_factor<Unit::SpecificPower>(Unit::Length::Millimetre, Unit::Mass::Gram, Unit::Time::Second),
+  derived_conversion_factor<Unit::SpecificPower>(Unit::Length::Foot, Unit::Mass::Slug, Unit::Time::Second),
+  derived_conversion_factor<Unit::SpecificPower>(Unit::Length::Inch, Unit::Mass::Slinch, Unit::Time::Second)
 };
 
 } // namespace PhQ
@@ -21,14 +21,16 @@ enum class Temperature : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::Temperature, std::string> abbreviations<Unit::Temperature>{
+template <> constexpr const std::array<std::pair<Unit::Temperature, std::string_view>, 4> abbreviations<Unit::Temperature>{{
   {Unit::Temperature::Kelvin, "K"},
   {Unit::Temperature::Celsius, "°C"},
   {Unit::Temperature::Rankine, "°R"},
   {Unit::Temperature::Fahrenheit, "°F"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::Temperature>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::Temperature> spellings<Unit::Temperature>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::Temperature>, 12> spellings<Unit::Temperature>{{
   {"K", Unit::Temperature::Kelvin},
   {"°K", Unit::Temperature::Kelvin},
   {"degK", Unit::Temperature::Kelvin},
@@ -41,44 +43,28 @@ template <> const std::unordered_map<std::string, Unit::Temperature> spellings<U
   {"°F", Unit::Temperature::Fahrenheit},
   {"F", Unit::Temperature::Fahrenheit},
   {"degF", Unit::Temperature::Fahrenheit}
-};
+}};
 
-template <> const std::map<System, Unit::Temperature> consistent_units<Unit::Temperature>{
+template <> constexpr const std::array<std::pair<System, Unit::Temperature>, 4> consistent_units<Unit::Temperature>{{
   {System::MetreKilogramSecondKelvin, Unit::Temperature::Kelvin},
   {System::MillimetreGramSecondKelvin, Unit::Temperature::Kelvin},
   {System::FootPoundSecondRankine, Unit::Temperature::Rankine},
   {System::InchPoundSecondRankine, Unit::Temperature::Rankine}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::Temperature>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::Temperature standard_unit<Unit::Temperature>{Unit::Temperature::Kelvin};
 
 template <> constexpr const Dimension::Set dimension<Unit::Temperature>{Dimension::Set{Dimension::Length{}, Dimension::Mass{}, Dimension::Time{}, Dimension::ElectricCurrent{}, Dimension::Temperature{1}}};
 
-template <> const std::map<Unit::Temperature, std::map<Unit::Temperature, std::function<void(std::vector<double>&)>>> conversions<Unit::Temperature>{
-  {Unit::Temperature::Kelvin, {
-    {Unit::Temperature::Kelvin, [](std::vector<double>& values)->void{}},
-    {Unit::Temperature::Celsius, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value -= 273.15;});}},
-    {Unit::Temperature::Rankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8;});}},
-    {Unit::Temperature::Fahrenheit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value = (value * 1.8) - 459.67;});}}
-  }},
-  {Unit::Temperature::Celsius, {
-    {Unit::Temperature::Kelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value += 273.15;});}},
-    {Unit::Temperature::Celsius, [](std::vector<double>& values)->void{}},
-    {Unit::Temperature::Rankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value = (value + 273.15) * 1.8;});}},
-    {Unit::Temperature::Fahrenheit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value = (value * 1.8) + 32.0;});}}
-  }},
-  {Unit::Temperature::Rankine, {
-    {Unit::Temperature::Kelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8;});}},
-    {Unit::Temperature::Celsius, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value = (value - 491.67) / 1.8;});}},
-    {Unit::Temperature::Rankine, [](std::vector<double>& values)->void{}},
-    {Unit::Temperature::Fahrenheit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value -= 459.67;});}}
-  }},
-  {Unit::Temperature::Fahrenheit, {
-    {Unit::Temperature::Kelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value = (value + 459.67) / 1.8;});}},
-    {Unit::Temperature::Celsius, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value = (value - 32.0) / 1.8;});}},
-    {Unit::Temperature::Rankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value += 459.67;});}},
-    {Unit::Temperature::Fahrenheit, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr bool has_ambiguous_dimension<Unit::Temperature>{true};
+
+template <> constexpr const std::array<ConversionFactor, 4> conversion_factors<Unit::Temperature>{
+  ConversionFactor{1.0},
+  ConversionFactor{1.0, 273.15},
+  ConversionFactor{1.0 / 1.8},
+  ConversionFactor{1.0 / 1.8, 459.67 / 1.8}
 };
 
 } // namespace PhQ
@@ -21,14 +21,16 @@ enum class TemperatureDifference : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::TemperatureDifference, std::string> abbreviations<Unit::TemperatureDifference>{
+template <> constexpr const std::array<std::pair<Unit::TemperatureDifference, std::string_view>, 4> abbreviations<Unit::TemperatureDifference>{{
   {Unit::TemperatureDifference::Kelvin, "K"},
   {Unit::TemperatureDifference::Celsius, "°C"},
   {Unit::TemperatureDifference::Rankine, "°R"},
   {Unit::TemperatureDifference::Fahrenheit, "°F"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::TemperatureDifference>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::TemperatureDifference> spellings<Unit::TemperatureDifference>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::TemperatureDifference>, 12> spellings<Unit::TemperatureDifference>{{
   {"K", Unit::TemperatureDifference::Kelvin},
   {"°K", Unit::TemperatureDifference::Kelvin},
   {"degK", Unit::TemperatureDifference::Kelvin},
@@ -41,44 +43,28 @@ template <> const std::unordered_map<std::string, Unit::TemperatureDifference> s
   {"°F", Unit::TemperatureDifference::Fahrenheit},
   {"F", Unit::TemperatureDifference::Fahrenheit},
   {"degF", Unit::TemperatureDifference::Fahrenheit}
-};
+}};
 
-template <> const std::map<System, Unit::TemperatureDifference> consistent_units<Unit::TemperatureDifference>{
+template <> constexpr const std::array<std::pair<System, Unit::TemperatureDifference>, 4> consistent_units<Unit::TemperatureDifference>{{
   {System::MetreKilogramSecondKelvin, Unit::TemperatureDifference::Kelvin},
   {System::MillimetreGramSecondKelvin, Unit::TemperatureDifference::Kelvin},
   {System::FootPoundSecondRankine, Unit::TemperatureDifference::Rankine},
   {System::InchPoundSecondRankine, Unit::TemperatureDifference::Rankine}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::TemperatureDifference>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::TemperatureDifference standard_unit<Unit::TemperatureDifference>{Unit::TemperatureDifference::Kelvin};
 
 template <> constexpr const Dimension::Set dimension<Unit::TemperatureDifference>{Dimension::Set{Dimension::Length{}, Dimension::Mass{}, Dimension::Time{}, Dimension::ElectricCurrent{}, Dimension::Temperature{1}}};
 
-template <> const std::map<Unit::TemperatureDifference, std::map<Unit::TemperatureDifference, std::function<void(std::vector<double>&)>>> conversions<Unit::TemperatureDifference>{
-  {Unit::TemperatureDifference::Kelvin, {
-    {Unit::TemperatureDifference::Kelvin, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureDifference::Celsius, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureDifference::Rankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8;});}},
-    {Unit::TemperatureDifference::Fahrenheit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8;});}}
-  }},
-  {Unit::TemperatureDifference::Celsius, {
-    {Unit::TemperatureDifference::Kelvin, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureDifference::Celsius, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureDifference::Rankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8;});}},
-    {Unit::TemperatureDifference::Fahrenheit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8;});}}
-  }},
-  {Unit::TemperatureDifference::Rankine, {
-    {Unit::TemperatureDifference::Kelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8;});}},
-    {Unit::TemperatureDifference::Celsius, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8;});}},
-    {Unit::TemperatureDifference::Rankine, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureDifference::Fahrenheit, [](std::vector<double>& values)->void{}}
-  }},
-  {Unit::TemperatureDifference::Fahrenheit, {
-    {Unit::TemperatureDifference::Kelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8;});}},
-    {Unit::TemperatureDifference::Celsius, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8;});}},
-    {Unit::TemperatureDifference::Rankine, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureDifference::Fahrenheit, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr bool has_ambiguous_dimension<Unit::TemperatureDifference>{true};
+
+template <> constexpr const std::array<ConversionFactor, 4> conversion_factors<Unit::TemperatureDifference>{
+  ConversionFactor{1.0},
+  ConversionFactor{1.0},
+  ConversionFactor{1.0 / 1.8},
+  ConversionFactor{1.0 / 1.8}
 };
 
 } // namespace PhQ
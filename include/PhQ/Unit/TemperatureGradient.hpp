@@ -7,6 +7,8 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "TemperatureDifference.hpp"
 
 namespace PhQ {
 
@@ -25,18 +27,20 @@ enum class TemperatureGradient : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::TemperatureGradient, std::string> abbreviations<Unit::TemperatureGradient>{
+template <> constexpr const std::array<std::pair<Unit::TemperatureGradient, std::string_view>, 8> abbreviations<Unit::TemperatureGradient>{{
   {Unit::TemperatureGradient::KelvinPerMetre, "K/m"},
-  {Unit::TemperatureGradient::CelsiusPerMetre, "°C/m"},
   {Unit::TemperatureGradient::KelvinPerMillimetre, "K/mm"},
+  {Unit::TemperatureGradient::CelsiusPerMetre, "°C/m"},
   {Unit::TemperatureGradient::CelsiusPerMillimetre, "°C/mm"},
   {Unit::TemperatureGradient::RankinePerFoot, "°R/ft"},
-  {Unit::TemperatureGradient::FahrenheitPerFoot, "°F/ft"},
   {Unit::TemperatureGradient::RankinePerInch, "°R/in"},
+  {Unit::TemperatureGradient::FahrenheitPerFoot, "°F/ft"},
   {Unit::TemperatureGradient::FahrenheitPerInch, "°F/in"}
-};
+}};
 
-template <> const std::unordered_map<std::string, Unit::TemperatureGradient> spellings<Unit::TemperatureGradient>{
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::TemperatureGradient>), "The abbreviations table must be listed in the order of its enumeration.");
+
+template <> constexpr const std::array<std::pair<std::string_view, Unit::TemperatureGradient>, 24> spellings<Unit::TemperatureGradient>{{
   {"K/m", Unit::TemperatureGradient::KelvinPerMetre},
   {"°K/m", Unit::TemperatureGradient::KelvinPerMetre},
   {"degK/m", Unit::TemperatureGradient::KelvinPerMetre},
@@ -61,100 +65,30 @@ template <> const std::unordered_map<std::string, Unit::TemperatureGradient> spe
   {"°F/in", Unit::TemperatureGradient::FahrenheitPerInch},
   {"F/in", Unit::TemperatureGradient::FahrenheitPerInch},
   {"degF/in", Unit::TemperatureGradient::FahrenheitPerInch}
-};
+}};
 
-template <> const std::map<System, Unit::TemperatureGradient> consistent_units<Unit::TemperatureGradient>{
+template <> constexpr const std::array<std::pair<System, Unit::TemperatureGradient>, 4> consistent_units<Unit::TemperatureGradient>{{
   {System::MetreKilogramSecondKelvin, Unit::TemperatureGradient::KelvinPerMetre},
   {System::MillimetreGramSecondKelvin, Unit::TemperatureGradient::KelvinPerMillimetre},
   {System::FootPoundSecondRankine, Unit::TemperatureGradient::RankinePerFoot},
   {System::InchPoundSecondRankine, Unit::TemperatureGradient::RankinePerInch}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::TemperatureGradient>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::TemperatureGradient standard_unit<Unit::TemperatureGradient>{Unit::TemperatureGradient::KelvinPerMetre};
 
 template <> constexpr const Dimension::Set dimension<Unit::TemperatureGradient>{Dimension::Set{Dimension::Length{-1}, Dimension::Mass{}, Dimension::Time{}, Dimension::ElectricCurrent{}, Dimension::Temperature{1}}};
 
-template <> const std::map<Unit::TemperatureGradient, std::map<Unit::TemperatureGradient, std::function<void(std::vector<double>&)>>> conversions<Unit::TemperatureGradient>{
-  {Unit::TemperatureGradient::KelvinPerMetre, {
-    {Unit::TemperatureGradient::KelvinPerMetre, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::CelsiusPerMetre, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::KelvinPerMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::TemperatureGradient::CelsiusPerMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::TemperatureGradient::RankinePerFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 0.3048;});}},
-    {Unit::TemperatureGradient::FahrenheitPerFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 0.3048;});}},
-    {Unit::TemperatureGradient::RankinePerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 0.0254;});}},
-    {Unit::TemperatureGradient::FahrenheitPerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 0.0254;});}}
-  }},
-  {Unit::TemperatureGradient::CelsiusPerMetre, {
-    {Unit::TemperatureGradient::KelvinPerMetre, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::CelsiusPerMetre, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::KelvinPerMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::TemperatureGradient::CelsiusPerMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.001;});}},
-    {Unit::TemperatureGradient::RankinePerFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 0.3048;});}},
-    {Unit::TemperatureGradient::FahrenheitPerFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 0.3048;});}},
-    {Unit::TemperatureGradient::RankinePerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 0.0254;});}},
-    {Unit::TemperatureGradient::FahrenheitPerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 0.0254;});}}
-  }},
-  {Unit::TemperatureGradient::KelvinPerMillimetre, {
-    {Unit::TemperatureGradient::KelvinPerMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::TemperatureGradient::CelsiusPerMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::TemperatureGradient::KelvinPerMillimetre, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::CelsiusPerMillimetre, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::RankinePerFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 304.8;});}},
-    {Unit::TemperatureGradient::FahrenheitPerFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 304.8;});}},
-    {Unit::TemperatureGradient::RankinePerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 25.4;});}},
-    {Unit::TemperatureGradient::FahrenheitPerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 25.4;});}}
-  }},
-  {Unit::TemperatureGradient::CelsiusPerMillimetre, {
-    {Unit::TemperatureGradient::KelvinPerMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::TemperatureGradient::CelsiusPerMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1000.0;});}},
-    {Unit::TemperatureGradient::KelvinPerMillimetre, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::CelsiusPerMillimetre, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::RankinePerFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 304.8;});}},
-    {Unit::TemperatureGradient::FahrenheitPerFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 304.8;});}},
-    {Unit::TemperatureGradient::RankinePerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 25.4;});}},
-    {Unit::TemperatureGradient::FahrenheitPerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8 * 25.4;});}}
-  }},
-  {Unit::TemperatureGradient::RankinePerFoot, {
-    {Unit::TemperatureGradient::KelvinPerMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 0.3048;});}},
-    {Unit::TemperatureGradient::CelsiusPerMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 0.3048;});}},
-    {Unit::TemperatureGradient::KelvinPerMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 304.8;});}},
-    {Unit::TemperatureGradient::CelsiusPerMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 304.8;});}},
-    {Unit::TemperatureGradient::RankinePerFoot, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::FahrenheitPerFoot, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::RankinePerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12.0;});}},
-    {Unit::TemperatureGradient::FahrenheitPerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12.0;});}}
-  }},
-  {Unit::TemperatureGradient::FahrenheitPerFoot, {
-    {Unit::TemperatureGradient::KelvinPerMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 0.3048;});}},
-    {Unit::TemperatureGradient::CelsiusPerMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 0.3048;});}},
-    {Unit::TemperatureGradient::KelvinPerMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 304.8;});}},
-    {Unit::TemperatureGradient::CelsiusPerMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 304.8;});}},
-    {Unit::TemperatureGradient::RankinePerFoot, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::FahrenheitPerFoot, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::RankinePerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12.0;});}},
-    {Unit::TemperatureGradient::FahrenheitPerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 12.0;});}}
-  }},
-  {Unit::TemperatureGradient::RankinePerInch, {
-    {Unit::TemperatureGradient::KelvinPerMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 0.0254;});}},
-    {Unit::TemperatureGradient::CelsiusPerMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 0.0254;});}},
-    {Unit::TemperatureGradient::KelvinPerMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 25.4;});}},
-    {Unit::TemperatureGradient::CelsiusPerMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 25.4;});}},
-    {Unit::TemperatureGradient::RankinePerFoot, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::FahrenheitPerFoot, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::RankinePerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12.0;});}},
-    {Unit::TemperatureGradient::FahrenheitPerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12.0;});}}
-  }},
-  {Unit::TemperatureGradient::FahrenheitPerInch, {
-    {Unit::TemperatureGradient::KelvinPerMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 0.0254;});}},
-    {Unit::TemperatureGradient::CelsiusPerMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 0.0254;});}},
-    {Unit::TemperatureGradient::KelvinPerMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 25.4;});}},
-    {Unit::TemperatureGradient::CelsiusPerMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8 * 25.4;});}},
-    {Unit::TemperatureGradient::RankinePerFoot, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::FahrenheitPerFoot, [](std::vector<double>& values)->void{}},
-    {Unit::TemperatureGradient::RankinePerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12.0;});}},
-    {Unit::TemperatureGradient::FahrenheitPerInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 12.0;});}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 8> conversion_factors<Unit::TemperatureGradient>{
+  derived_conversion_factor<Unit::TemperatureGradient>(Unit::TemperatureDifference::Kelvin, Unit::Length::Metre),
+  derived_conversion_factor<Unit::TemperatureGradient>(Unit::TemperatureDifference::Kelvin, Unit::Length::Millimetre),
+  derived_conversion_factor<Unit::TemperatureGradient>(Unit::TemperatureDifference::Celsius, Unit::Length::Metre),
+  derived_conversion_factor<Unit::TemperatureGradient>(Unit::TemperatureDifference::Celsius, Unit::Length::Millimetre),
+  derived_conversion_factor<Unit::TemperatureGradient>(Unit::TemperatureDifference::Rankine, Unit::Length::Foot),
+  derived_conversion_factor<Unit::TemperatureGradient>(Unit::TemperatureDifference::Rankine, Unit::Length::Inch),
+  derived_conversion_factor<Unit::TemperatureGradient>(Unit::TemperatureDifference::Fahrenheit, Unit::Length::Foot),
+  derived_conversion_factor<Unit::TemperatureGradient>(Unit::TemperatureDifference::Fahrenheit, Unit::Length::Inch)
 };
 
 } // namespace PhQ
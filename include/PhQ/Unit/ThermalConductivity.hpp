@@ -7,6 +7,10 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "Mass.hpp"
+#include "TemperatureDifference.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -20,13 +24,15 @@ enum class ThermalConductivity : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::ThermalConductivity, std::string> abbreviations<Unit::ThermalConductivity>{
+template <> constexpr const std::array<std::pair<Unit::ThermalConductivity, std::string_view>, 3> abbreviations<Unit::ThermalConductivity>{{
   {Unit::ThermalConductivity::WattPerMetrePerKelvin, "W/m/K"},
   {Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin, "nW/mm/K"},
   {Unit::ThermalConductivity::PoundPerSecondPerRankine, "lbf/s/°R"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::ThermalConductivity>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::ThermalConductivity> spellings<Unit::ThermalConductivity>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::ThermalConductivity>, 120> spellings<Unit::ThermalConductivity>{{
   {"W/m/K", Unit::ThermalConductivity::WattPerMetrePerKelvin},
   {"W/m/°K", Unit::ThermalConductivity::WattPerMetrePerKelvin},
   {"W/m/degK", Unit::ThermalConductivity::WattPerMetrePerKelvin},
@@ -147,21 +153,23 @@ template <> const std::unordered_map<std::string, Unit::ThermalConductivity> spe
   {"lb/(s*°F)", Unit::ThermalConductivity::PoundPerSecondPerRankine},
   {"lb/(s*F)", Unit::ThermalConductivity::PoundPerSecondPerRankine},
   {"lb/(s*degF)", Unit::ThermalConductivity::PoundPerSecondPerRankine}
-};
+}};
 
-template <> const std::map<System, Unit::ThermalConductivity> consistent_units<Unit::ThermalConductivity>{
+template <> constexpr const std::array<std::pair<System, Unit::ThermalConductivity>, 4> consistent_units<Unit::ThermalConductivity>{{
   {System::MetreKilogramSecondKelvin, Unit::ThermalConductivity::WattPerMetrePerKelvin},
   {System::MillimetreGramSecondKelvin, Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
   {System::FootPoundSecondRankine, Unit::ThermalConductivity::PoundPerSecondPerRankine},
   {System::InchPoundSecondRankine, Unit::ThermalConductivity::PoundPerSecondPerRankine}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::ThermalConductivity>), "The consistent_units table must be listed in the order of its enumeration.");
 
-template <> const std::map<Unit::ThermalConductivity, System> related_systems<Unit::ThermalConductivity>{
+template <> constexpr const std::array<std::pair<Unit::ThermalConductivity, System>, 4> related_systems<Unit::ThermalConductivity>{{
   {Unit::ThermalConductivity::WattPerMetrePerKelvin, System::MetreKilogramSecondKelvin},
   {Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin, System::MillimetreGramSecondKelvin},
   {Unit::ThermalConductivity::PoundPerSecondPerRankine, System::FootPoundSecondRankine},
-  {Unit::ThermalConductivity::PoundPerSecondPerRankine, System::InchPoundSecondRankine},
-};
+  {Unit::ThermalConductivity::PoundPerSecondPerRankine, System::InchPoundSecondRankine}
+}};
 
 template <> constexpr const Unit::ThermalConductivity standard_unit<Unit::ThermalConductivity>{Unit::ThermalConductivity::WattPerMetrePerKelvin};
 
@@ -171,22 +179,10 @@ template <> constexpr const Unit::ThermalConductivity standard_unit<Unit::Therma
 
 template <> constexpr const Dimension::Set dimension<Unit::ThermalConductivity>{Dimension::Set{Dimension::Length{1}, Dimension::Mass{1}, Dimension::Time{-3}, Dimension::ElectricCurrent{}, Dimension::Temperature{-1}}};
 
-template <> const std::map<Unit::ThermalConductivity, std::map<Unit::ThermalConductivity, std::function<void(std::vector<double>&)>>> conversions<Unit::ThermalConductivity>{
-  {Unit::ThermalConductivity::WattPerMetrePerKelvin, {
-    {Unit::ThermalConductivity::WattPerMetrePerKelvin, [](std::vector<double>& values)->void{}},
-    {Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6;});}},
-    {Unit::ThermalConductivity::PoundPerSecondPerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 0.45359237 * 9.80665 * 9.0 / 5.0;});}}
-  }},
-  {Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin, {
-    {Unit::ThermalConductivity::WattPerMetrePerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e-6;});}},
-    {Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin, [](std::vector<double>& values)->void{}},
-    {Unit::ThermalConductivity::PoundPerSecondPerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.0e6 * 0.45359237 * 9.80665 * 9.0 / 5.0;});}}
-  }},
-  {Unit::ThermalConductivity::PoundPerSecondPerRankine, {
-    {Unit::ThermalConductivity::WattPerMetrePerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 0.45359237 * 9.80665 * 9.0 / 5.0;});}},
-    {Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.0e6 * 0.45359237 * 9.80665 * 9.0 / 5.0;});}},
-    {Unit::ThermalConductivity::PoundPerSecondPerRankine, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 3> conversion_factors<Unit::ThermalConductivity>{
+  ConversionFactor{1.0},
+  derived_conversion_factor<Unit::ThermalConductivity>(Unit::Length::Millimetre, Unit::Mass::Gram, Unit::Time::Second, Unit::TemperatureDifference::Kelvin),
+  derived_conversion_factor<Unit::ThermalConductivity>(Unit::Length::Foot, Unit::Mass::Slug, Unit::Time::Second, Unit::TemperatureDifference::Rankine)
 };
 
 } // namespace PhQ
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "Base.hpp"
+#include "TemperatureDifference.hpp"
 
 namespace PhQ {
 
@@ -21,14 +22,16 @@ enum class ThermalExpansion : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::ThermalExpansion, std::string> abbreviations<Unit::ThermalExpansion>{
+template <> constexpr const std::array<std::pair<Unit::ThermalExpansion, std::string_view>, 4> abbreviations<Unit::ThermalExpansion>{{
   {Unit::ThermalExpansion::PerKelvin, "1/K"},
   {Unit::ThermalExpansion::PerCelsius, "1/°C"},
   {Unit::ThermalExpansion::PerRankine, "1/°R"},
   {Unit::ThermalExpansion::PerFahrenheit, "1/°F"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::ThermalExpansion>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::ThermalExpansion> spellings<Unit::ThermalExpansion>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::ThermalExpansion>, 24> spellings<Unit::ThermalExpansion>{{
   {"1/K", Unit::ThermalExpansion::PerKelvin},
   {"1/°K", Unit::ThermalExpansion::PerKelvin},
   {"1/degK", Unit::ThermalExpansion::PerKelvin},
@@ -53,44 +56,26 @@ template <> const std::unordered_map<std::string, Unit::ThermalExpansion> spelli
   {"/°F", Unit::ThermalExpansion::PerFahrenheit},
   {"/F", Unit::ThermalExpansion::PerFahrenheit},
   {"/degF", Unit::ThermalExpansion::PerFahrenheit}
-};
+}};
 
-template <> const std::map<System, Unit::ThermalExpansion> consistent_units<Unit::ThermalExpansion>{
+template <> constexpr const std::array<std::pair<System, Unit::ThermalExpansion>, 4> consistent_units<Unit::ThermalExpansion>{{
   {System::MetreKilogramSecondKelvin, Unit::ThermalExpansion::PerKelvin},
   {System::MillimetreGramSecondKelvin, Unit::ThermalExpansion::PerKelvin},
   {System::FootPoundSecondRankine, Unit::ThermalExpansion::PerRankine},
   {System::InchPoundSecondRankine, Unit::ThermalExpansion::PerRankine}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::ThermalExpansion>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::ThermalExpansion standard_unit<Unit::ThermalExpansion>{Unit::ThermalExpansion::PerKelvin};
 
 template <> constexpr const Dimension::Set dimension<Unit::ThermalExpansion>{Dimension::Set{Dimension::Length{}, Dimension::Mass{}, Dimension::Time{}, Dimension::ElectricCurrent{}, Dimension::Temperature{-1}}};
 
-template <> const std::map<Unit::ThermalExpansion, std::map<Unit::ThermalExpansion, std::function<void(std::vector<double>&)>>> conversions<Unit::ThermalExpansion>{
-  {Unit::ThermalExpansion::PerKelvin, {
-    {Unit::ThermalExpansion::PerKelvin, [](std::vector<double>& values)->void{}},
-    {Unit::ThermalExpansion::PerCelsius, [](std::vector<double>& values)->void{}},
-    {Unit::ThermalExpansion::PerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8;});}},
-    {Unit::ThermalExpansion::PerFahrenheit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8;});}}
-  }},
-  {Unit::ThermalExpansion::PerCelsius, {
-    {Unit::ThermalExpansion::PerKelvin, [](std::vector<double>& values)->void{}},
-    {Unit::ThermalExpansion::PerCelsius, [](std::vector<double>& values)->void{}},
-    {Unit::ThermalExpansion::PerRankine, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8;});}},
-    {Unit::ThermalExpansion::PerFahrenheit, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 1.8;});}}
-  }},
-  {Unit::ThermalExpansion::PerRankine, {
-    {Unit::ThermalExpansion::PerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8;});}},
-    {Unit::ThermalExpansion::PerCelsius, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8;});}},
-    {Unit::ThermalExpansion::PerRankine, [](std::vector<double>& values)->void{}},
-    {Unit::ThermalExpansion::PerFahrenheit, [](std::vector<double>& values)->void{}}
-  }},
-  {Unit::ThermalExpansion::PerFahrenheit, {
-    {Unit::ThermalExpansion::PerKelvin, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8;});}},
-    {Unit::ThermalExpansion::PerCelsius, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 1.8;});}},
-    {Unit::ThermalExpansion::PerRankine, [](std::vector<double>& values)->void{}},
-    {Unit::ThermalExpansion::PerFahrenheit, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 4> conversion_factors<Unit::ThermalExpansion>{
+  derived_conversion_factor<Unit::ThermalExpansion>(Unit::TemperatureDifference::Kelvin),
+  derived_conversion_factor<Unit::ThermalExpansion>(Unit::TemperatureDifference::Celsius),
+  derived_conversion_factor<Unit::ThermalExpansion>(Unit::TemperatureDifference::Rankine),
+  derived_conversion_factor<Unit::ThermalExpansion>(Unit::TemperatureDifference::Fahrenheit)
 };
 
 } // namespace PhQ
@@ -20,13 +20,15 @@ enum class Time : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::Time, std::string> abbreviations<Unit::Time>{
+template <> constexpr const std::array<std::pair<Unit::Time, std::string_view>, 3> abbreviations<Unit::Time>{{
   {Unit::Time::Second, "s"},
   {Unit::Time::Minute, "min"},
   {Unit::Time::Hour, "hr"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::Time>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::Time> spellings<Unit::Time>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::Time>, 13> spellings<Unit::Time>{{
   {"s", Unit::Time::Second},
   {"sec", Unit::Time::Second},
   {"secs", Unit::Time::Second},
@@ -40,35 +42,25 @@ template <> const std::unordered_map<std::string, Unit::Time> spellings<Unit::Ti
   {"hrs", Unit::Time::Hour},
   {"hour", Unit::Time::Hour},
   {"hours", Unit::Time::Hour}
-};
+}};
 
-template <> const std::map<System, Unit::Time> consistent_units<Unit::Time>{
+template <> constexpr const std::array<std::pair<System, Unit::Time>, 4> consistent_units<Unit::Time>{{
   {System::MetreKilogramSecondKelvin, Unit::Time::Second},
   {System::MillimetreGramSecondKelvin, Unit::Time::Second},
   {System::FootPoundSecondRankine, Unit::Time::Second},
   {System::InchPoundSecondRankine, Unit::Time::Second}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::Time>), "The consistent_units table must be listed in the order of its enumeration.");
 
 template <> constexpr const Unit::Time standard_unit<Unit::Time>{Unit::Time::Second};
 
 template <> constexpr const Dimension::Set dimension<Unit::Time>{Dimension::Set{Dimension::Length{}, Dimension::Mass{}, Dimension::Time{1}}};
 
-template <> const std::map<Unit::Time, std::map<Unit::Time, std::function<void(std::vector<double>&)>>> conversions<Unit::Time>{
-  {Unit::Time::Second, {
-    {Unit::Time::Second, [](std::vector<double>& values)->void{}},
-    {Unit::Time::Minute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 60.0;});}},
-    {Unit::Time::Hour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 3600.0;});}}
-  }},
-  {Unit::Time::Minute, {
-    {Unit::Time::Second, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 60.0;});}},
-    {Unit::Time::Minute, [](std::vector<double>& values)->void{}},
-    {Unit::Time::Hour, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= 60.0;});}}
-  }},
-  {Unit::Time::Hour, {
-    {Unit::Time::Second, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 3600.0;});}},
-    {Unit::Time::Minute, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= 60.0;});}},
-    {Unit::Time::Hour, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 3> conversion_factors<Unit::Time>{
+  ConversionFactor{1.0},
+  ConversionFactor{60.0},
+  ConversionFactor{3600.0}
 };
 
 } // namespace PhQ
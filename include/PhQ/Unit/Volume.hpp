@@ -7,6 +7,7 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
 
 namespace PhQ {
 
@@ -31,7 +32,7 @@ enum class Volume : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::Volume, std::string> abbreviations<Unit::Volume>{
+template <> constexpr const std::array<std::pair<Unit::Volume, std::string_view>, 14> abbreviations<Unit::Volume>{{
   {Unit::Volume::CubicMile, "mi^3"},
   {Unit::Volume::CubicKilometre, "km^3"},
   {Unit::Volume::CubicYard, "yd^3"},
@@ -46,9 +47,11 @@ template <> const std::map<Unit::Volume, std::string> abbreviations<Unit::Volume
   {Unit::Volume::CubicMilliinch, "thou^3"},
   {Unit::Volume::CubicMicrometre, "μm^3"},
   {Unit::Volume::CubicMicroinch, "μin^3"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::Volume>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::Volume> spellings<Unit::Volume>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::Volume>, 36> spellings<Unit::Volume>{{
   {"mi^3", Unit::Volume::CubicMile},
   {"mi3", Unit::Volume::CubicMile},
   {"km^3", Unit::Volume::CubicKilometre},
@@ -85,251 +88,43 @@ template <> const std::unordered_map<std::string, Unit::Volume> spellings<Unit::
   {"μin3", Unit::Volume::CubicMicroinch},
   {"uin^3", Unit::Volume::CubicMicroinch},
   {"uin3", Unit::Volume::CubicMicroinch}
-};
+}};
 
-template <> const std::map<System, Unit::Volume> consistent_units<Unit::Volume>{
+template <> constexpr const std::array<std::pair<System, Unit::Volume>, 4> consistent_units<Unit::Volume>{{
   {System::MetreKilogramSecondKelvin, Unit::Volume::CubicMetre},
   {System::MillimetreGramSecondKelvin, Unit::Volume::CubicMillimetre},
   {System::FootPoundSecondRankine, Unit::Volume::CubicFoot},
   {System::InchPoundSecondRankine, Unit::Volume::CubicInch}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::Volume>), "The consistent_units table must be listed in the order of its enumeration.");
 
-template <> const std::map<Unit::Volume, System> related_systems<Unit::Volume>{
+template <> constexpr const std::array<std::pair<Unit::Volume, System>, 4> related_systems<Unit::Volume>{{
   {Unit::Volume::CubicMetre, System::MetreKilogramSecondKelvin},
   {Unit::Volume::CubicMillimetre, System::MillimetreGramSecondKelvin},
   {Unit::Volume::CubicFoot, System::FootPoundSecondRankine},
-  {Unit::Volume::CubicInch, System::InchPoundSecondRankine},
-};
+  {Unit::Volume::CubicInch, System::InchPoundSecondRankine}
+}};
 
 template <> constexpr const Unit::Volume standard_unit<Unit::Volume>{Unit::Volume::CubicMetre};
 
 template <> constexpr const Dimension::Set dimension<Unit::Volume>{Dimension::Set{Dimension::Length{3}}};
 
-template <> const std::map<Unit::Volume, std::map<Unit::Volume, std::function<void(std::vector<double>&)>>> conversions<Unit::Volume>{
-  {Unit::Volume::CubicMile, {
-    {Unit::Volume::CubicMile, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::CubicKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1.609344, 3);});}},
-    {Unit::Volume::CubicYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1760.0, 3);});}},
-    {Unit::Volume::CubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1609.344, 3);});}},
-    {Unit::Volume::CubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(5280.0, 3);});}},
-    {Unit::Volume::CubicDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(16093.44, 3);});}},
-    {Unit::Volume::Litre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(16093.44, 3);});}},
-    {Unit::Volume::CubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(63360.0, 3);});}},
-    {Unit::Volume::CubicCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(160934.4, 3);});}},
-    {Unit::Volume::Millilitre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(160934.4, 3);});}},
-    {Unit::Volume::CubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1609344.0, 3);});}},
-    {Unit::Volume::CubicMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(63360000.0, 3);});}},
-    {Unit::Volume::CubicMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1609344000.0, 3);});}},
-    {Unit::Volume::CubicMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(63360000000.0, 3);});}}
-  }},
-  {Unit::Volume::CubicKilometre, {
-    {Unit::Volume::CubicMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1.609344, 3);});}},
-    {Unit::Volume::CubicKilometre, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::CubicYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0009144, 3);});}},
-    {Unit::Volume::CubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 3);});}},
-    {Unit::Volume::CubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0003048, 3);});}},
-    {Unit::Volume::CubicDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10000.0, 3);});}},
-    {Unit::Volume::Litre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10000.0, 3);});}},
-    {Unit::Volume::CubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000254, 3);});}},
-    {Unit::Volume::CubicCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100000.0, 3);});}},
-    {Unit::Volume::Millilitre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100000.0, 3);});}},
-    {Unit::Volume::CubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000.0, 3);});}},
-    {Unit::Volume::CubicMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000000254, 3);});}},
-    {Unit::Volume::CubicMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000000.0, 3);});}},
-    {Unit::Volume::CubicMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000000000254, 3);});}}
-  }},
-  {Unit::Volume::CubicYard, {
-    {Unit::Volume::CubicMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1760.0, 3);});}},
-    {Unit::Volume::CubicKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0009144, 3);});}},
-    {Unit::Volume::CubicYard, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::CubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.9144, 3);});}},
-    {Unit::Volume::CubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(3.0, 3);});}},
-    {Unit::Volume::CubicDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(9.144, 3);});}},
-    {Unit::Volume::Litre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(9.144, 3);});}},
-    {Unit::Volume::CubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(36.0, 3);});}},
-    {Unit::Volume::CubicCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(91.44, 3);});}},
-    {Unit::Volume::Millilitre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(91.44, 3);});}},
-    {Unit::Volume::CubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(914.4, 3);});}},
-    {Unit::Volume::CubicMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(36000.0, 3);});}},
-    {Unit::Volume::CubicMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(914400.0, 3);});}},
-    {Unit::Volume::CubicMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(36000000.0, 3);});}}
-  }},
-  {Unit::Volume::CubicMetre, {
-    {Unit::Volume::CubicMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1609.344, 3);});}},
-    {Unit::Volume::CubicKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 3);});}},
-    {Unit::Volume::CubicYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.9144, 3);});}},
-    {Unit::Volume::CubicMetre, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::CubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.3048, 3);});}},
-    {Unit::Volume::CubicDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::Volume::Litre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::Volume::CubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0254, 3);});}},
-    {Unit::Volume::CubicCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100.0, 3);});}},
-    {Unit::Volume::Millilitre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100.0, 3);});}},
-    {Unit::Volume::CubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 3);});}},
-    {Unit::Volume::CubicMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000254, 3);});}},
-    {Unit::Volume::CubicMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000.0, 3);});}},
-    {Unit::Volume::CubicMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000000254, 3);});}}
-  }},
-  {Unit::Volume::CubicFoot, {
-    {Unit::Volume::CubicMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(5280.0, 3);});}},
-    {Unit::Volume::CubicKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0003048, 3);});}},
-    {Unit::Volume::CubicYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(3.0, 3);});}},
-    {Unit::Volume::CubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.3048, 3);});}},
-    {Unit::Volume::CubicFoot, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::CubicDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(3.048, 3);});}},
-    {Unit::Volume::Litre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(3.048, 3);});}},
-    {Unit::Volume::CubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12.0, 3);});}},
-    {Unit::Volume::CubicCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(30.48, 3);});}},
-    {Unit::Volume::Millilitre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(30.48, 3);});}},
-    {Unit::Volume::CubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(304.8, 3);});}},
-    {Unit::Volume::CubicMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12000.0, 3);});}},
-    {Unit::Volume::CubicMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(304800.0, 3);});}},
-    {Unit::Volume::CubicMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12000000.0, 3);});}}
-  }},
-  {Unit::Volume::CubicDecimetre, {
-    {Unit::Volume::CubicMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(16093.44, 3);});}},
-    {Unit::Volume::CubicKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0001, 3);});}},
-    {Unit::Volume::CubicYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(9.144, 3);});}},
-    {Unit::Volume::CubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::Volume::CubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(3.048, 3);});}},
-    {Unit::Volume::CubicDecimetre, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::Litre, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::CubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.254, 3);});}},
-    {Unit::Volume::CubicCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::Volume::Millilitre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::Volume::CubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100.0, 3);});}},
-    {Unit::Volume::CubicMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.000254, 3);});}},
-    {Unit::Volume::CubicMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100000.0, 3);});}},
-    {Unit::Volume::CubicMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.000000254, 3);});}}
-  }},
-  {Unit::Volume::Litre, {
-    {Unit::Volume::CubicMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(16093.44, 3);});}},
-    {Unit::Volume::CubicKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0001, 3);});}},
-    {Unit::Volume::CubicYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(9.144, 3);});}},
-    {Unit::Volume::CubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::Volume::CubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(3.048, 3);});}},
-    {Unit::Volume::CubicDecimetre, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::Litre, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::CubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.254, 3);});}},
-    {Unit::Volume::CubicCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::Volume::Millilitre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::Volume::CubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100.0, 3);});}},
-    {Unit::Volume::CubicMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.000254, 3);});}},
-    {Unit::Volume::CubicMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100000.0, 3);});}},
-    {Unit::Volume::CubicMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.000000254, 3);});}}
-  }},
-  {Unit::Volume::CubicInch, {
-    {Unit::Volume::CubicMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(63360.0, 3);});}},
-    {Unit::Volume::CubicKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000254, 3);});}},
-    {Unit::Volume::CubicYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(36.0, 3);});}},
-    {Unit::Volume::CubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 3);});}},
-    {Unit::Volume::CubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12.0, 3);});}},
-    {Unit::Volume::CubicDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.254, 3);});}},
-    {Unit::Volume::Litre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.254, 3);});}},
-    {Unit::Volume::CubicInch, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::CubicCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(2.54, 3);});}},
-    {Unit::Volume::Millilitre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(2.54, 3);});}},
-    {Unit::Volume::CubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(25.4, 3);});}},
-    {Unit::Volume::CubicMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 3);});}},
-    {Unit::Volume::CubicMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(25400.0, 3);});}},
-    {Unit::Volume::CubicMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000.0, 3);});}}
-  }},
-  {Unit::Volume::CubicCentimetre, {
-    {Unit::Volume::CubicMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(160934.4, 3);});}},
-    {Unit::Volume::CubicKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00001, 3);});}},
-    {Unit::Volume::CubicYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(91.44, 3);});}},
-    {Unit::Volume::CubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.01, 3);});}},
-    {Unit::Volume::CubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(30.48, 3);});}},
-    {Unit::Volume::CubicDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::Volume::Litre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::Volume::CubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(2.54, 3);});}},
-    {Unit::Volume::CubicCentimetre, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::Millilitre, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::CubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::Volume::CubicMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.00254, 3);});}},
-    {Unit::Volume::CubicMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10000.0, 3);});}},
-    {Unit::Volume::CubicMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.00000254, 3);});}}
-  }},
-  {Unit::Volume::Millilitre, {
-    {Unit::Volume::CubicMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(160934.4, 3);});}},
-    {Unit::Volume::CubicKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00001, 3);});}},
-    {Unit::Volume::CubicYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(91.44, 3);});}},
-    {Unit::Volume::CubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.01, 3);});}},
-    {Unit::Volume::CubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(30.48, 3);});}},
-    {Unit::Volume::CubicDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::Volume::Litre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::Volume::CubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(2.54, 3);});}},
-    {Unit::Volume::CubicCentimetre, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::Millilitre, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::CubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::Volume::CubicMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.00254, 3);});}},
-    {Unit::Volume::CubicMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10000.0, 3);});}},
-    {Unit::Volume::CubicMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.00000254, 3);});}}
-  }},
-  {Unit::Volume::CubicMillimetre, {
-    {Unit::Volume::CubicMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1609344.0, 3);});}},
-    {Unit::Volume::CubicKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000001, 3);});}},
-    {Unit::Volume::CubicYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(914.4, 3);});}},
-    {Unit::Volume::CubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 3);});}},
-    {Unit::Volume::CubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(304.8, 3);});}},
-    {Unit::Volume::CubicDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.01, 3);});}},
-    {Unit::Volume::Litre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.01, 3);});}},
-    {Unit::Volume::CubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(25.4, 3);});}},
-    {Unit::Volume::CubicCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::Volume::Millilitre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::Volume::CubicMillimetre, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::CubicMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0254, 3);});}},
-    {Unit::Volume::CubicMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 3);});}},
-    {Unit::Volume::CubicMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000254, 3);});}}
-  }},
-  {Unit::Volume::CubicMilliinch, {
-    {Unit::Volume::CubicMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(63360000.0, 3);});}},
-    {Unit::Volume::CubicKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000000254, 3);});}},
-    {Unit::Volume::CubicYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(36000.0, 3);});}},
-    {Unit::Volume::CubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000254, 3);});}},
-    {Unit::Volume::CubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12000.0, 3);});}},
-    {Unit::Volume::CubicDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000254, 3);});}},
-    {Unit::Volume::Litre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000254, 3);});}},
-    {Unit::Volume::CubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 3);});}},
-    {Unit::Volume::CubicCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00254, 3);});}},
-    {Unit::Volume::Millilitre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00254, 3);});}},
-    {Unit::Volume::CubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 3);});}},
-    {Unit::Volume::CubicMilliinch, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::CubicMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(25.4, 3);});}},
-    {Unit::Volume::CubicMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 3);});}}
-  }},
-  {Unit::Volume::CubicMicrometre, {
-    {Unit::Volume::CubicMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1609344000.0, 3);});}},
-    {Unit::Volume::CubicKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000000001, 3);});}},
-    {Unit::Volume::CubicYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(914400.0, 3);});}},
-    {Unit::Volume::CubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000001, 3);});}},
-    {Unit::Volume::CubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(304800.0, 3);});}},
-    {Unit::Volume::CubicDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00001, 3);});}},
-    {Unit::Volume::Litre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00001, 3);});}},
-    {Unit::Volume::CubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(25400.0, 3);});}},
-    {Unit::Volume::CubicCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0001, 3);});}},
-    {Unit::Volume::Millilitre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0001, 3);});}},
-    {Unit::Volume::CubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 3);});}},
-    {Unit::Volume::CubicMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(25.4, 3);});}},
-    {Unit::Volume::CubicMicrometre, [](std::vector<double>& values)->void{}},
-    {Unit::Volume::CubicMicroinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0254, 3);});}}
-  }},
-  {Unit::Volume::CubicMicroinch, {
-    {Unit::Volume::CubicMile, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(63360000000.0, 3);});}},
-    {Unit::Volume::CubicKilometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000000000254, 3);});}},
-    {Unit::Volume::CubicYard, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(36000000.0, 3);});}},
-    {Unit::Volume::CubicMetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000000254, 3);});}},
-    {Unit::Volume::CubicFoot, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12000000.0, 3);});}},
-    {Unit::Volume::CubicDecimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000000254, 3);});}},
-    {Unit::Volume::Litre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000000254, 3);});}},
-    {Unit::Volume::CubicInch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000001, 3);});}},
-    {Unit::Volume::CubicCentimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00000254, 3);});}},
-    {Unit::Volume::Millilitre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00000254, 3);});}},
-    {Unit::Volume::CubicMillimetre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000254, 3);});}},
-    {Unit::Volume::CubicMilliinch, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 3);});}},
-    {Unit::Volume::CubicMicrometre, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 3);});}},
-    {Unit::Volume::CubicMicroinch, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 14> conversion_factors<Unit::Volume>{
+  derived_conversion_factor<Unit::Volume>(Unit::Length::Mile),
+  derived_conversion_factor<Unit::Volume>(Unit::Length::Kilometre),
+  derived_conversion_factor<Unit::Volume>(Unit::Length::Yard),
+  derived_conversion_factor<Unit::Volume>(Unit::Length::Metre),
+  derived_conversion_factor<Unit::Volume>(Unit::Length::Foot),
+  derived_conversion_factor<Unit::Volume>(Unit::Length::Decimetre),
+  derived_conversion_factor<Unit::Volume>(Unit::Length::Decimetre),
+  derived_conversion_factor<Unit::Volume>(Unit::Length::Inch),
+  derived_conversion_factor<Unit::Volume>(Unit::Length::Centimetre),
+  derived_conversion_factor<Unit::Volume>(Unit::Length::Centimetre),
+  derived_conversion_factor<Unit::Volume>(Unit::Length::Millimetre),
+  derived_conversion_factor<Unit::Volume>(Unit::Length::Milliinch),
+  derived_conversion_factor<Unit::Volume>(Unit::Length::Micrometre),
+  derived_conversion_factor<Unit::Volume>(Unit::Length::Microinch)
 };
 
 } // namespace PhQ
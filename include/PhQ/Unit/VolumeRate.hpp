@@ -7,6 +7,8 @@
 #pragma once
 
 #include "Base.hpp"
+#include "Length.hpp"
+#include "Time.hpp"
 
 namespace PhQ {
 
@@ -31,7 +33,7 @@ enum class VolumeRate : uint_least8_t {
 
 } // namespace Unit
 
-template <> const std::map<Unit::VolumeRate, std::string> abbreviations<Unit::VolumeRate>{
+template <> constexpr const std::array<std::pair<Unit::VolumeRate, std::string_view>, 14> abbreviations<Unit::VolumeRate>{{
   {Unit::VolumeRate::CubicMilePerSecond, "mi^3/s"},
   {Unit::VolumeRate::CubicKilometrePerSecond, "km^3/s"},
   {Unit::VolumeRate::CubicYardPerSecond, "yd^3/s"},
@@ -46,9 +48,11 @@ template <> const std::map<Unit::VolumeRate, std::string> abbreviations<Unit::Vo
   {Unit::VolumeRate::CubicMilliinchPerSecond, "thou^3/s"},
   {Unit::VolumeRate::CubicMicrometrePerSecond, "μm^3/s"},
   {Unit::VolumeRate::CubicMicroinchPerSecond, "μin^3/s"}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(abbreviations<Unit::VolumeRate>), "The abbreviations table must be listed in the order of its enumeration.");
 
-template <> const std::unordered_map<std::string, Unit::VolumeRate> spellings<Unit::VolumeRate>{
+template <> constexpr const std::array<std::pair<std::string_view, Unit::VolumeRate>, 72> spellings<Unit::VolumeRate>{{
   {"mi^3/s", Unit::VolumeRate::CubicMilePerSecond},
   {"mi^3/sec", Unit::VolumeRate::CubicMilePerSecond},
   {"mi3/s", Unit::VolumeRate::CubicMilePerSecond},
@@ -121,251 +125,43 @@ template <> const std::unordered_map<std::string, Unit::VolumeRate> spellings<Un
   {"uin^3/sec", Unit::VolumeRate::CubicMicroinchPerSecond},
   {"uin3/s", Unit::VolumeRate::CubicMicroinchPerSecond},
   {"uin3/sec", Unit::VolumeRate::CubicMicroinchPerSecond}
-};
+}};
 
-template <> const std::map<System, Unit::VolumeRate> consistent_units<Unit::VolumeRate>{
+template <> constexpr const std::array<std::pair<System, Unit::VolumeRate>, 4> consistent_units<Unit::VolumeRate>{{
   {System::MetreKilogramSecondKelvin, Unit::VolumeRate::CubicMetrePerSecond},
   {System::MillimetreGramSecondKelvin, Unit::VolumeRate::CubicMillimetrePerSecond},
   {System::FootPoundSecondRankine, Unit::VolumeRate::CubicFootPerSecond},
   {System::InchPoundSecondRankine, Unit::VolumeRate::CubicInchPerSecond}
-};
+}};
+
+static_assert(is_indexed_by_enumeration(consistent_units<Unit::VolumeRate>), "The consistent_units table must be listed in the order of its enumeration.");
 
-template <> const std::map<Unit::VolumeRate, System> related_systems<Unit::VolumeRate>{
+template <> constexpr const std::array<std::pair<Unit::VolumeRate, System>, 4> related_systems<Unit::VolumeRate>{{
   {Unit::VolumeRate::CubicMetrePerSecond, System::MetreKilogramSecondKelvin},
   {Unit::VolumeRate::CubicMillimetrePerSecond, System::MillimetreGramSecondKelvin},
   {Unit::VolumeRate::CubicFootPerSecond, System::FootPoundSecondRankine},
-  {Unit::VolumeRate::CubicInchPerSecond, System::InchPoundSecondRankine},
-};
+  {Unit::VolumeRate::CubicInchPerSecond, System::InchPoundSecondRankine}
+}};
 
 template <> constexpr const Unit::VolumeRate standard_unit<Unit::VolumeRate>{Unit::VolumeRate::CubicMetrePerSecond};
 
 template <> constexpr const Dimension::Set dimension<Unit::VolumeRate>{Dimension::Set{Dimension::Length{3}, Dimension::Mass{}, Dimension::Time{-1}}};
 
-template <> const std::map<Unit::VolumeRate, std::map<Unit::VolumeRate, std::function<void(std::vector<double>&)>>> conversions<Unit::VolumeRate>{
-  {Unit::VolumeRate::CubicMilePerSecond, {
-    {Unit::VolumeRate::CubicMilePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::CubicKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1.609344, 3);});}},
-    {Unit::VolumeRate::CubicYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1760.0, 3);});}},
-    {Unit::VolumeRate::CubicMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1609.344, 3);});}},
-    {Unit::VolumeRate::CubicFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(5280.0, 3);});}},
-    {Unit::VolumeRate::CubicDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(16093.44, 3);});}},
-    {Unit::VolumeRate::LitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(16093.44, 3);});}},
-    {Unit::VolumeRate::CubicInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(63360.0, 3);});}},
-    {Unit::VolumeRate::CubicCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(160934.4, 3);});}},
-    {Unit::VolumeRate::MillilitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(160934.4, 3);});}},
-    {Unit::VolumeRate::CubicMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1609344.0, 3);});}},
-    {Unit::VolumeRate::CubicMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(63360000.0, 3);});}},
-    {Unit::VolumeRate::CubicMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1609344000.0, 3);});}},
-    {Unit::VolumeRate::CubicMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(63360000000.0, 3);});}}
-  }},
-  {Unit::VolumeRate::CubicKilometrePerSecond, {
-    {Unit::VolumeRate::CubicMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1.609344, 3);});}},
-    {Unit::VolumeRate::CubicKilometrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::CubicYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0009144, 3);});}},
-    {Unit::VolumeRate::CubicMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 3);});}},
-    {Unit::VolumeRate::CubicFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0003048, 3);});}},
-    {Unit::VolumeRate::CubicDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10000.0, 3);});}},
-    {Unit::VolumeRate::LitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10000.0, 3);});}},
-    {Unit::VolumeRate::CubicInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000254, 3);});}},
-    {Unit::VolumeRate::CubicCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100000.0, 3);});}},
-    {Unit::VolumeRate::MillilitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100000.0, 3);});}},
-    {Unit::VolumeRate::CubicMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000.0, 3);});}},
-    {Unit::VolumeRate::CubicMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000000254, 3);});}},
-    {Unit::VolumeRate::CubicMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000000.0, 3);});}},
-    {Unit::VolumeRate::CubicMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000000000254, 3);});}}
-  }},
-  {Unit::VolumeRate::CubicYardPerSecond, {
-    {Unit::VolumeRate::CubicMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1760.0, 3);});}},
-    {Unit::VolumeRate::CubicKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0009144, 3);});}},
-    {Unit::VolumeRate::CubicYardPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::CubicMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.9144, 3);});}},
-    {Unit::VolumeRate::CubicFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(3.0, 3);});}},
-    {Unit::VolumeRate::CubicDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(9.144, 3);});}},
-    {Unit::VolumeRate::LitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(9.144, 3);});}},
-    {Unit::VolumeRate::CubicInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(36.0, 3);});}},
-    {Unit::VolumeRate::CubicCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(91.44, 3);});}},
-    {Unit::VolumeRate::MillilitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(91.44, 3);});}},
-    {Unit::VolumeRate::CubicMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(914.4, 3);});}},
-    {Unit::VolumeRate::CubicMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(36000.0, 3);});}},
-    {Unit::VolumeRate::CubicMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(914400.0, 3);});}},
-    {Unit::VolumeRate::CubicMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(36000000.0, 3);});}}
-  }},
-  {Unit::VolumeRate::CubicMetrePerSecond, {
-    {Unit::VolumeRate::CubicMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1609.344, 3);});}},
-    {Unit::VolumeRate::CubicKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 3);});}},
-    {Unit::VolumeRate::CubicYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.9144, 3);});}},
-    {Unit::VolumeRate::CubicMetrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::CubicFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.3048, 3);});}},
-    {Unit::VolumeRate::CubicDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::VolumeRate::LitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::VolumeRate::CubicInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0254, 3);});}},
-    {Unit::VolumeRate::CubicCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100.0, 3);});}},
-    {Unit::VolumeRate::MillilitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100.0, 3);});}},
-    {Unit::VolumeRate::CubicMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 3);});}},
-    {Unit::VolumeRate::CubicMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000254, 3);});}},
-    {Unit::VolumeRate::CubicMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000.0, 3);});}},
-    {Unit::VolumeRate::CubicMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000000254, 3);});}}
-  }},
-  {Unit::VolumeRate::CubicFootPerSecond, {
-    {Unit::VolumeRate::CubicMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(5280.0, 3);});}},
-    {Unit::VolumeRate::CubicKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0003048, 3);});}},
-    {Unit::VolumeRate::CubicYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(3.0, 3);});}},
-    {Unit::VolumeRate::CubicMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.3048, 3);});}},
-    {Unit::VolumeRate::CubicFootPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::CubicDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(3.048, 3);});}},
-    {Unit::VolumeRate::LitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(3.048, 3);});}},
-    {Unit::VolumeRate::CubicInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12.0, 3);});}},
-    {Unit::VolumeRate::CubicCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(30.48, 3);});}},
-    {Unit::VolumeRate::MillilitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(30.48, 3);});}},
-    {Unit::VolumeRate::CubicMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(304.8, 3);});}},
-    {Unit::VolumeRate::CubicMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12000.0, 3);});}},
-    {Unit::VolumeRate::CubicMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(304800.0, 3);});}},
-    {Unit::VolumeRate::CubicMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(12000000.0, 3);});}}
-  }},
-  {Unit::VolumeRate::CubicDecimetrePerSecond, {
-    {Unit::VolumeRate::CubicMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(16093.44, 3);});}},
-    {Unit::VolumeRate::CubicKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0001, 3);});}},
-    {Unit::VolumeRate::CubicYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(9.144, 3);});}},
-    {Unit::VolumeRate::CubicMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::VolumeRate::CubicFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(3.048, 3);});}},
-    {Unit::VolumeRate::CubicDecimetrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::LitrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::CubicInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.254, 3);});}},
-    {Unit::VolumeRate::CubicCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::VolumeRate::MillilitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::VolumeRate::CubicMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100.0, 3);});}},
-    {Unit::VolumeRate::CubicMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.000254, 3);});}},
-    {Unit::VolumeRate::CubicMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100000.0, 3);});}},
-    {Unit::VolumeRate::CubicMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.000000254, 3);});}}
-  }},
-  {Unit::VolumeRate::LitrePerSecond, {
-    {Unit::VolumeRate::CubicMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(16093.44, 3);});}},
-    {Unit::VolumeRate::CubicKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0001, 3);});}},
-    {Unit::VolumeRate::CubicYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(9.144, 3);});}},
-    {Unit::VolumeRate::CubicMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::VolumeRate::CubicFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(3.048, 3);});}},
-    {Unit::VolumeRate::CubicDecimetrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::LitrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::CubicInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.254, 3);});}},
-    {Unit::VolumeRate::CubicCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::VolumeRate::MillilitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::VolumeRate::CubicMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100.0, 3);});}},
-    {Unit::VolumeRate::CubicMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.000254, 3);});}},
-    {Unit::VolumeRate::CubicMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(100000.0, 3);});}},
-    {Unit::VolumeRate::CubicMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.000000254, 3);});}}
-  }},
-  {Unit::VolumeRate::CubicInchPerSecond, {
-    {Unit::VolumeRate::CubicMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(63360.0, 3);});}},
-    {Unit::VolumeRate::CubicKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000254, 3);});}},
-    {Unit::VolumeRate::CubicYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(36.0, 3);});}},
-    {Unit::VolumeRate::CubicMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 3);});}},
-    {Unit::VolumeRate::CubicFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12.0, 3);});}},
-    {Unit::VolumeRate::CubicDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.254, 3);});}},
-    {Unit::VolumeRate::LitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.254, 3);});}},
-    {Unit::VolumeRate::CubicInchPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::CubicCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(2.54, 3);});}},
-    {Unit::VolumeRate::MillilitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(2.54, 3);});}},
-    {Unit::VolumeRate::CubicMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(25.4, 3);});}},
-    {Unit::VolumeRate::CubicMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 3);});}},
-    {Unit::VolumeRate::CubicMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(25400.0, 3);});}},
-    {Unit::VolumeRate::CubicMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000000.0, 3);});}}
-  }},
-  {Unit::VolumeRate::CubicCentimetrePerSecond, {
-    {Unit::VolumeRate::CubicMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(160934.4, 3);});}},
-    {Unit::VolumeRate::CubicKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00001, 3);});}},
-    {Unit::VolumeRate::CubicYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(91.44, 3);});}},
-    {Unit::VolumeRate::CubicMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.01, 3);});}},
-    {Unit::VolumeRate::CubicFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(30.48, 3);});}},
-    {Unit::VolumeRate::CubicDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::VolumeRate::LitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::VolumeRate::CubicInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(2.54, 3);});}},
-    {Unit::VolumeRate::CubicCentimetrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::MillilitrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::CubicMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::VolumeRate::CubicMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.00254, 3);});}},
-    {Unit::VolumeRate::CubicMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10000.0, 3);});}},
-    {Unit::VolumeRate::CubicMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.00000254, 3);});}}
-  }},
-  {Unit::VolumeRate::MillilitrePerSecond, {
-    {Unit::VolumeRate::CubicMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(160934.4, 3);});}},
-    {Unit::VolumeRate::CubicKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00001, 3);});}},
-    {Unit::VolumeRate::CubicYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(91.44, 3);});}},
-    {Unit::VolumeRate::CubicMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.01, 3);});}},
-    {Unit::VolumeRate::CubicFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(30.48, 3);});}},
-    {Unit::VolumeRate::CubicDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::VolumeRate::LitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::VolumeRate::CubicInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(2.54, 3);});}},
-    {Unit::VolumeRate::CubicCentimetrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::MillilitrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::CubicMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10.0, 3);});}},
-    {Unit::VolumeRate::CubicMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.00254, 3);});}},
-    {Unit::VolumeRate::CubicMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(10000.0, 3);});}},
-    {Unit::VolumeRate::CubicMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.00000254, 3);});}}
-  }},
-  {Unit::VolumeRate::CubicMillimetrePerSecond, {
-    {Unit::VolumeRate::CubicMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1609344.0, 3);});}},
-    {Unit::VolumeRate::CubicKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000001, 3);});}},
-    {Unit::VolumeRate::CubicYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(914.4, 3);});}},
-    {Unit::VolumeRate::CubicMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 3);});}},
-    {Unit::VolumeRate::CubicFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(304.8, 3);});}},
-    {Unit::VolumeRate::CubicDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.01, 3);});}},
-    {Unit::VolumeRate::LitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.01, 3);});}},
-    {Unit::VolumeRate::CubicInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(25.4, 3);});}},
-    {Unit::VolumeRate::CubicCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::VolumeRate::MillilitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.1, 3);});}},
-    {Unit::VolumeRate::CubicMillimetrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::CubicMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0254, 3);});}},
-    {Unit::VolumeRate::CubicMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 3);});}},
-    {Unit::VolumeRate::CubicMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0000254, 3);});}}
-  }},
-  {Unit::VolumeRate::CubicMilliinchPerSecond, {
-    {Unit::VolumeRate::CubicMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(63360000.0, 3);});}},
-    {Unit::VolumeRate::CubicKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000000254, 3);});}},
-    {Unit::VolumeRate::CubicYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(36000.0, 3);});}},
-    {Unit::VolumeRate::CubicMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000254, 3);});}},
-    {Unit::VolumeRate::CubicFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12000.0, 3);});}},
-    {Unit::VolumeRate::CubicDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000254, 3);});}},
-    {Unit::VolumeRate::LitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000254, 3);});}},
-    {Unit::VolumeRate::CubicInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 3);});}},
-    {Unit::VolumeRate::CubicCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00254, 3);});}},
-    {Unit::VolumeRate::MillilitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00254, 3);});}},
-    {Unit::VolumeRate::CubicMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 3);});}},
-    {Unit::VolumeRate::CubicMilliinchPerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::CubicMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(25.4, 3);});}},
-    {Unit::VolumeRate::CubicMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(1000.0, 3);});}}
-  }},
-  {Unit::VolumeRate::CubicMicrometrePerSecond, {
-    {Unit::VolumeRate::CubicMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(1609344000.0, 3);});}},
-    {Unit::VolumeRate::CubicKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000000001, 3);});}},
-    {Unit::VolumeRate::CubicYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(914400.0, 3);});}},
-    {Unit::VolumeRate::CubicMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000001, 3);});}},
-    {Unit::VolumeRate::CubicFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(304800.0, 3);});}},
-    {Unit::VolumeRate::CubicDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00001, 3);});}},
-    {Unit::VolumeRate::LitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00001, 3);});}},
-    {Unit::VolumeRate::CubicInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(25400.0, 3);});}},
-    {Unit::VolumeRate::CubicCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0001, 3);});}},
-    {Unit::VolumeRate::MillilitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0001, 3);});}},
-    {Unit::VolumeRate::CubicMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 3);});}},
-    {Unit::VolumeRate::CubicMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(25.4, 3);});}},
-    {Unit::VolumeRate::CubicMicrometrePerSecond, [](std::vector<double>& values)->void{}},
-    {Unit::VolumeRate::CubicMicroinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(0.0254, 3);});}}
-  }},
-  {Unit::VolumeRate::CubicMicroinchPerSecond, {
-    {Unit::VolumeRate::CubicMilePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(63360000000.0, 3);});}},
-    {Unit::VolumeRate::CubicKilometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000000000254, 3);});}},
-    {Unit::VolumeRate::CubicYardPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(36000000.0, 3);});}},
-    {Unit::VolumeRate::CubicMetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000000254, 3);});}},
-    {Unit::VolumeRate::CubicFootPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value /= std::pow(12000000.0, 3);});}},
-    {Unit::VolumeRate::CubicDecimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000000254, 3);});}},
-    {Unit::VolumeRate::LitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000000254, 3);});}},
-    {Unit::VolumeRate::CubicInchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.000001, 3);});}},
-    {Unit::VolumeRate::CubicCentimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00000254, 3);});}},
-    {Unit::VolumeRate::MillilitrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.00000254, 3);});}},
-    {Unit::VolumeRate::CubicMillimetrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0000254, 3);});}},
-    {Unit::VolumeRate::CubicMilliinchPerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.001, 3);});}},
-    {Unit::VolumeRate::CubicMicrometrePerSecond, [](std::vector<double>& values)->void{std::for_each(values.begin(), values.end(), [](double& value)->void{value *= std::pow(0.0254, 3);});}},
-    {Unit::VolumeRate::CubicMicroinchPerSecond, [](std::vector<double>& values)->void{}}
-  }}
+template <> constexpr const std::array<ConversionFactor, 14> conversion_factors<Unit::VolumeRate>{
+  derived_conversion_factor<Unit::VolumeRate>(Unit::Length::Mile, Unit::Time::Second),
+  derived_conversion_factor<Unit::VolumeRate>(Unit::Length::Kilometre, Unit::Time::Second),
+  derived_conversion_factor<Unit::VolumeRate>(Unit::Length::Yard, Unit::Time::Second),
+  derived_conversion_factor<Unit::VolumeRate>(Unit::Length::Metre, Unit::Time::Second),
+  derived_conversion_factor<Unit::VolumeRate>(Unit::Length::Foot, Unit::Time::Second),
+  derived_conversion_factor<Unit::VolumeRate>(Unit::Length::Decimetre, Unit::Time::Second),
+  derived_conversion_factor<Unit::VolumeRate>(Unit::Length::Decimetre, Unit::Time::Second),
+  derived_conversion_factor<Unit::VolumeRate>(Unit::Length::Inch, Unit::Time::Second),
+  derived_conversion_factor<Unit::VolumeRate>(Unit::Length::Centimetre, Unit::Time::Second),
+  derived_conversion_factor<Unit::VolumeRate>(Unit::Length::Centimetre, Unit::Time::Second),
+  derived_conversion_factor<Unit::VolumeRate>(Unit::Length::Millimetre, Unit::Time::Second),
+  derived_conversion_factor<Unit::VolumeRate>(Unit::Length::Milliinch, Unit::Time::Second),
+  derived_conversion_factor<Unit::VolumeRate>(Unit::Length::Micrometre, Unit::Time::Second),
+  derived_conversion_factor<Unit::VolumeRate>(Unit::Length::Microinch, Unit::Time::Second)
 };
 
 } // namespace PhQ
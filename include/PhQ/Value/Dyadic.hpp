@@ -12,51 +12,55 @@ namespace PhQ {
 
 namespace Value {
 
-class Dyadic {
+/// \brief Three-dimensional dyadic tensor whose components are of a given numeric type, such as float, double, or long double. PhQ::Value::Dyadic is the double-precision dyadic tensor used throughout the library.
+template <typename Number> class BasicDyadic {
 
 public:
 
-  constexpr Dyadic() noexcept : xx_(), xy_(), xz_(), yx_(), yy_(), yz_(), zx_(), zy_(), zz_() {}
+  constexpr BasicDyadic() noexcept : xx_(), xy_(), xz_(), yx_(), yy_(), yz_(), zx_(), zy_(), zz_() {}
 
-  constexpr Dyadic(double xx, double xy, double xz, double yx, double yy, double yz, double zx, double zy, double zz) noexcept : xx_(xx), xy_(xy), xz_(xz), yx_(yx), yy_(yy), yz_(yz), zx_(zx), zy_(zy), zz_(zz) {}
+  constexpr BasicDyadic(Number xx, Number xy, Number xz, Number yx, Number yy, Number yz, Number zx, Number zy, Number zz) noexcept : xx_(xx), xy_(xy), xz_(xz), yx_(yx), yy_(yy), yz_(yz), zx_(zx), zy_(zy), zz_(zz) {}
 
-  constexpr Dyadic(const std::array<double, 9>& xx_xy_xz_yx_yy_yz_zx_zy_zz) noexcept : xx_(xx_xy_xz_yx_yy_yz_zx_zy_zz[0]), xy_(xx_xy_xz_yx_yy_yz_zx_zy_zz[1]), xz_(xx_xy_xz_yx_yy_yz_zx_zy_zz[2]), yx_(xx_xy_xz_yx_yy_yz_zx_zy_zz[3]), yy_(xx_xy_xz_yx_yy_yz_zx_zy_zz[4]), yz_(xx_xy_xz_yx_yy_yz_zx_zy_zz[5]), zx_(xx_xy_xz_yx_yy_yz_zx_zy_zz[6]), zy_(xx_xy_xz_yx_yy_yz_zx_zy_zz[7]), zz_(xx_xy_xz_yx_yy_yz_zx_zy_zz[8]) {}
+  constexpr BasicDyadic(const std::array<Number, 9>& xx_xy_xz_yx_yy_yz_zx_zy_zz) noexcept : xx_(xx_xy_xz_yx_yy_yz_zx_zy_zz[0]), xy_(xx_xy_xz_yx_yy_yz_zx_zy_zz[1]), xz_(xx_xy_xz_yx_yy_yz_zx_zy_zz[2]), yx_(xx_xy_xz_yx_yy_yz_zx_zy_zz[3]), yy_(xx_xy_xz_yx_yy_yz_zx_zy_zz[4]), yz_(xx_xy_xz_yx_yy_yz_zx_zy_zz[5]), zx_(xx_xy_xz_yx_yy_yz_zx_zy_zz[6]), zy_(xx_xy_xz_yx_yy_yz_zx_zy_zz[7]), zz_(xx_xy_xz_yx_yy_yz_zx_zy_zz[8]) {}
 
-  constexpr Dyadic(const SymmetricDyadic& symmetric_dyadic) noexcept : xx_(symmetric_dyadic.xx()), xy_(symmetric_dyadic.xy()), xz_(symmetric_dyadic.xz()), yx_(symmetric_dyadic.yx()), yy_(symmetric_dyadic.yy()), yz_(symmetric_dyadic.yz()), zx_(symmetric_dyadic.zx()), zy_(symmetric_dyadic.zy()), zz_(symmetric_dyadic.zz()) {}
+  /// \brief Explicit conversion from a dyadic tensor of another numeric type, such as widening from single precision to double precision or narrowing from double precision to single precision.
+  template <typename OtherNumber> explicit constexpr BasicDyadic(const BasicDyadic<OtherNumber>& dyadic) noexcept : xx_(static_cast<Number>(dyadic.xx())), xy_(static_cast<Number>(dyadic.xy())), xz_(static_cast<Number>(dyadic.xz())), yx_(static_cast<Number>(dyadic.yx())), yy_(static_cast<Number>(dyadic.yy())), yz_(static_cast<Number>(dyadic.yz())), zx_(static_cast<Number>(dyadic.zx())), zy_(static_cast<Number>(dyadic.zy())), zz_(static_cast<Number>(dyadic.zz())) {}
 
-  constexpr double xx() const noexcept {
+  constexpr BasicDyadic(const BasicSymmetricDyadic<Number>& symmetric_dyadic) noexcept : xx_(symmetric_dyadic.xx()), xy_(symmetric_dyadic.xy()), xz_(symmetric_dyadic.xz()), yx_(symmetric_dyadic.yx()), yy_(symmetric_dyadic.yy()), yz_(symmetric_dyadic.yz()), zx_(symmetric_dyadic.zx()), zy_(symmetric_dyadic.zy()), zz_(symmetric_dyadic.zz()) {}
+
+  constexpr Number xx() const noexcept {
     return xx_;
   }
 
-  constexpr double xy() const noexcept {
+  constexpr Number xy() const noexcept {
     return xy_;
   }
 
-  constexpr double xz() const noexcept {
+  constexpr Number xz() const noexcept {
     return xz_;
   }
 
-  constexpr double yx() const noexcept {
+  constexpr Number yx() const noexcept {
     return yx_;
   }
 
-  constexpr double yy() const noexcept {
+  constexpr Number yy() const noexcept {
     return yy_;
   }
 
-  constexpr double yz() const noexcept {
+  constexpr Number yz() const noexcept {
     return yz_;
   }
 
-  constexpr double zx() const noexcept {
+  constexpr Number zx() const noexcept {
     return zx_;
   }
 
-  constexpr double zy() const noexcept {
+  constexpr Number zy() const noexcept {
     return zy_;
   }
 
-  constexpr double zz() const noexcept {
+  constexpr Number zz() const noexcept {
     return zz_;
   }
 
@@ -64,40 +68,40 @@ public:
     return xy_ == yx_ && xz_ == zx_ && yz_ == zy_;
   }
 
-  constexpr double trace() const noexcept {
+  constexpr Number trace() const noexcept {
     return xx_ + yy_ + zz_;
   }
 
-  constexpr double determinant() const noexcept {
+  constexpr Number determinant() const noexcept {
     return
       xx_ * (yy_ * zz_ - yz_ * zy_) +
       xy_ * (yz_ * zx_ - yx_ * zz_) +
       xz_ * (yx_ * zy_ - yy_ * zx_);
   }
 
-  constexpr Dyadic transpose() const noexcept {
+  constexpr BasicDyadic transpose() const noexcept {
     return {xx_, yx_, zx_, xy_, yy_, zy_, xz_, yz_, zz_};
   }
 
-  constexpr Dyadic cofactors() const noexcept {
-    const double cofactor_xx{yy_ * zz_ - yz_ * zy_};
-    const double cofactor_xy{yz_ * zx_ - yx_ * zz_};
-    const double cofactor_xz{yx_ * zy_ - yy_ * zx_};
-    const double cofactor_yx{xz_ * zy_ - xy_ * zz_};
-    const double cofactor_yy{xx_ * zz_ - xz_ * zx_};
-    const double cofactor_yz{xy_ * zx_ - xx_ * zy_};
-    const double cofactor_zx{xy_ * yz_ - xz_ * yy_};
-    const double cofactor_zy{xz_ * yx_ - xx_ * yz_};
-    const double cofactor_zz{xx_ * yy_ - xy_ * yx_};
+  constexpr BasicDyadic cofactors() const noexcept {
+    const Number cofactor_xx{yy_ * zz_ - yz_ * zy_};
+    const Number cofactor_xy{yz_ * zx_ - yx_ * zz_};
+    const Number cofactor_xz{yx_ * zy_ - yy_ * zx_};
+    const Number cofactor_yx{xz_ * zy_ - xy_ * zz_};
+    const Number cofactor_yy{xx_ * zz_ - xz_ * zx_};
+    const Number cofactor_yz{xy_ * zx_ - xx_ * zy_};
+    const Number cofactor_zx{xy_ * yz_ - xz_ * yy_};
+    const Number cofactor_zy{xz_ * yx_ - xx_ * yz_};
+    const Number cofactor_zz{xx_ * yy_ - xy_ * yx_};
     return {cofactor_xx, cofactor_xy, cofactor_xz, cofactor_yx, cofactor_yy, cofactor_yz, cofactor_zx, cofactor_zy, cofactor_zz};
   }
 
-  constexpr Dyadic adjugate() const noexcept {
+  constexpr BasicDyadic adjugate() const noexcept {
     return cofactors().transpose();
   }
 
-  Dyadic inverse() const {
-    const double determinant_{determinant()};
+  BasicDyadic inverse() const {
+    const Number determinant_{determinant()};
     if (determinant_ != 0.0) {
       return adjugate() / determinant_;
     } else {
@@ -106,58 +110,118 @@ public:
   }
 
   std::string print() const noexcept {
-    return
-      "(" + PhQ::number_to_string(xx_) + ", " +
-      PhQ::number_to_string(xy_) + ", " +
-      PhQ::number_to_string(xz_) + "; " +
-      PhQ::number_to_string(yx_) + ", " +
-      PhQ::number_to_string(yy_) + ", " +
-      PhQ::number_to_string(yz_) + "; " +
-      PhQ::number_to_string(zx_) + ", " +
-      PhQ::number_to_string(zy_) + ", " +
-      PhQ::number_to_string(zz_) + ")";
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    PhQ::append(output, "(");
+    PhQ::append_number(output, xx_);
+    PhQ::append(output, ", ");
+    PhQ::append_number(output, xy_);
+    PhQ::append(output, ", ");
+    PhQ::append_number(output, xz_);
+    PhQ::append(output, "; ");
+    PhQ::append_number(output, yx_);
+    PhQ::append(output, ", ");
+    PhQ::append_number(output, yy_);
+    PhQ::append(output, ", ");
+    PhQ::append_number(output, yz_);
+    PhQ::append(output, "; ");
+    PhQ::append_number(output, zx_);
+    PhQ::append(output, ", ");
+    PhQ::append_number(output, zy_);
+    PhQ::append(output, ", ");
+    PhQ::append_number(output, zz_);
+    PhQ::append(output, ")");
   }
 
   std::string yaml() const noexcept {
-    return
-      "{xx: " + PhQ::number_to_string(xx_) +
-      " , xy: " + PhQ::number_to_string(xy_) +
-      " , xz: " + PhQ::number_to_string(xz_) +
-      " , yx: " + PhQ::number_to_string(yx_) +
-      " , yy: " + PhQ::number_to_string(yy_) +
-      " , yz: " + PhQ::number_to_string(yz_) +
-      " , zx: " + PhQ::number_to_string(zx_) +
-      " , zy: " + PhQ::number_to_string(zy_) +
-      " , zz: " + PhQ::number_to_string(zz_) + "}";
+    std::string text;
+    yaml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void yaml(Sink& output) const noexcept {
+    PhQ::append(output, "{xx: ");
+    PhQ::append_number(output, xx_);
+    PhQ::append(output, " , xy: ");
+    PhQ::append_number(output, xy_);
+    PhQ::append(output, " , xz: ");
+    PhQ::append_number(output, xz_);
+    PhQ::append(output, " , yx: ");
+    PhQ::append_number(output, yx_);
+    PhQ::append(output, " , yy: ");
+    PhQ::append_number(output, yy_);
+    PhQ::append(output, " , yz: ");
+    PhQ::append_number(output, yz_);
+    PhQ::append(output, " , zx: ");
+    PhQ::append_number(output, zx_);
+    PhQ::append(output, " , zy: ");
+    PhQ::append_number(output, zy_);
+    PhQ::append(output, " , zz: ");
+    PhQ::append_number(output, zz_);
+    PhQ::append(output, "}");
   }
 
   std::string json() const noexcept {
-    return
-      "{\"xx\": " + PhQ::number_to_string(xx_) +
-      " , \"xy\": " + PhQ::number_to_string(xy_) +
-      " , \"xz\": " + PhQ::number_to_string(xz_) +
-      " , \"yx\": " + PhQ::number_to_string(yx_) +
-      " , \"yy\": " + PhQ::number_to_string(yy_) +
-      " , \"yz\": " + PhQ::number_to_string(yz_) +
-      " , \"zx\": " + PhQ::number_to_string(zx_) +
-      " , \"zy\": " + PhQ::number_to_string(zy_) +
-      " , \"zz\": " + PhQ::number_to_string(zz_) + "}";
+    std::string text;
+    json(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void json(Sink& output) const noexcept {
+    PhQ::append(output, "{\"xx\": ");
+    PhQ::append_number(output, xx_);
+    PhQ::append(output, " , \"xy\": ");
+    PhQ::append_number(output, xy_);
+    PhQ::append(output, " , \"xz\": ");
+    PhQ::append_number(output, xz_);
+    PhQ::append(output, " , \"yx\": ");
+    PhQ::append_number(output, yx_);
+    PhQ::append(output, " , \"yy\": ");
+    PhQ::append_number(output, yy_);
+    PhQ::append(output, " , \"yz\": ");
+    PhQ::append_number(output, yz_);
+    PhQ::append(output, " , \"zx\": ");
+    PhQ::append_number(output, zx_);
+    PhQ::append(output, " , \"zy\": ");
+    PhQ::append_number(output, zy_);
+    PhQ::append(output, " , \"zz\": ");
+    PhQ::append_number(output, zz_);
+    PhQ::append(output, "}");
   }
 
   std::string xml() const noexcept {
-    return
-      "<xx>" + PhQ::number_to_string(xx_) +
-      "</xx><xy>" + PhQ::number_to_string(xy_) +
-      "</xy><xz>" + PhQ::number_to_string(xz_) +
-      "</xz><yx>" + PhQ::number_to_string(yx_) +
-      "</yx><yy>" + PhQ::number_to_string(yy_) +
-      "</yy><yz>" + PhQ::number_to_string(yz_) +
-      "</yz><zx>" + PhQ::number_to_string(zx_) +
-      "</zx><zy>" + PhQ::number_to_string(zy_) +
-      "</zy><zz>" + PhQ::number_to_string(zz_) + "</zz>";
-  }
-
-  constexpr bool operator==(const Dyadic& dyadic) const noexcept {
+    std::string text;
+    xml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void xml(Sink& output) const noexcept {
+    PhQ::append(output, "<xx>");
+    PhQ::append_number(output, xx_);
+    PhQ::append(output, "</xx><xy>");
+    PhQ::append_number(output, xy_);
+    PhQ::append(output, "</xy><xz>");
+    PhQ::append_number(output, xz_);
+    PhQ::append(output, "</xz><yx>");
+    PhQ::append_number(output, yx_);
+    PhQ::append(output, "</yx><yy>");
+    PhQ::append_number(output, yy_);
+    PhQ::append(output, "</yy><yz>");
+    PhQ::append_number(output, yz_);
+    PhQ::append(output, "</yz><zx>");
+    PhQ::append_number(output, zx_);
+    PhQ::append(output, "</zx><zy>");
+    PhQ::append_number(output, zy_);
+    PhQ::append(output, "</zy><zz>");
+    PhQ::append_number(output, zz_);
+    PhQ::append(output, "</zz>");
+  }
+
+  constexpr bool operator==(const BasicDyadic& dyadic) const noexcept {
     return
       xx_ == dyadic.xx_ &&
       xy_ == dyadic.xy_ &&
@@ -170,7 +234,7 @@ public:
       zz_ == dyadic.zz_;
   }
 
-  constexpr bool operator!=(const Dyadic& dyadic) const noexcept {
+  constexpr bool operator!=(const BasicDyadic& dyadic) const noexcept {
     return
       xx_ != dyadic.xx_ ||
       xy_ != dyadic.xy_ ||
@@ -183,7 +247,7 @@ public:
       zz_ != dyadic.zz_;
   }
 
-  constexpr Dyadic operator+(const Dyadic& dyadic) const noexcept {
+  constexpr BasicDyadic operator+(const BasicDyadic& dyadic) const noexcept {
     return {
       xx_ + dyadic.xx_,
       xy_ + dyadic.xy_,
@@ -197,7 +261,7 @@ public:
     };
   }
 
-  constexpr void operator+=(const Dyadic& dyadic) noexcept {
+  constexpr void operator+=(const BasicDyadic& dyadic) noexcept {
     xx_ += dyadic.xx_;
     xy_ += dyadic.xy_;
     xz_ += dyadic.xz_;
@@ -209,7 +273,7 @@ public:
     zz_ += dyadic.zz_;
   }
 
-  constexpr Dyadic operator-(const Dyadic& dyadic) const noexcept {
+  constexpr BasicDyadic operator-(const BasicDyadic& dyadic) const noexcept {
     return {
       xx_ - dyadic.xx_,
       xy_ - dyadic.xy_,
@@ -223,7 +287,7 @@ public:
     };
   }
 
-  constexpr void operator-=(const Dyadic& dyadic) noexcept {
+  constexpr void operator-=(const BasicDyadic& dyadic) noexcept {
     xx_ -= dyadic.xx_;
     xy_ -= dyadic.xy_;
     xz_ -= dyadic.xz_;
@@ -235,11 +299,11 @@ public:
     zz_ -= dyadic.zz_;
   }
 
-  constexpr Dyadic operator*(double real) const noexcept {
+  constexpr BasicDyadic operator*(Number real) const noexcept {
     return {xx_ * real, xy_ * real, xz_ * real, yx_ * real, yy_ * real, yz_ * real, zx_ * real, zy_ * real, zz_ * real};
   }
 
-  constexpr Vector operator*(const Vector& vector) const noexcept {
+  constexpr BasicVector<Number> operator*(const BasicVector<Number>& vector) const noexcept {
     return {
       xx_ * vector.x() + xy_ * vector.y() + xz_ * vector.z(),
       yx_ * vector.x() + yy_ * vector.y() + yz_ * vector.z(),
@@ -247,7 +311,7 @@ public:
     };
   }
 
-  constexpr Dyadic operator*(const SymmetricDyadic& symmetric_dyadic) const noexcept {
+  constexpr BasicDyadic operator*(const BasicSymmetricDyadic<Number>& symmetric_dyadic) const noexcept {
     return {
       xx_ * symmetric_dyadic.xx() + xy_ * symmetric_dyadic.yx() + xz_ * symmetric_dyadic.zx(),
       xx_ * symmetric_dyadic.xy() + xy_ * symmetric_dyadic.yy() + xz_ * symmetric_dyadic.zy(),
@@ -261,7 +325,7 @@ public:
     };
   }
 
-  constexpr Dyadic operator*(const Dyadic& dyadic) const noexcept {
+  constexpr BasicDyadic operator*(const BasicDyadic& dyadic) const noexcept {
     return {
       xx_ * dyadic.xx_ + xy_ * dyadic.yx_ + xz_ * dyadic.zx_,
       xx_ * dyadic.xy_ + xy_ * dyadic.yy_ + xz_ * dyadic.zy_,
@@ -275,7 +339,7 @@ public:
     };
   }
 
-  constexpr void operator*=(double real) noexcept {
+  constexpr void operator*=(Number real) noexcept {
     xx_ *= real;
     xy_ *= real;
     xz_ *= real;
@@ -287,11 +351,11 @@ public:
     zz_ *= real;
   }
 
-  constexpr Dyadic operator/(double real) const noexcept {
+  constexpr BasicDyadic operator/(Number real) const noexcept {
     return {xx_ / real, xy_ / real, xz_ / real, yx_ / real, yy_ / real, yz_ / real, zx_ / real, zy_ / real, zz_ / real};
   }
 
-  constexpr void operator/=(double real) noexcept {
+  constexpr void operator/=(Number real) noexcept {
     xx_ /= real;
     xy_ /= real;
     xz_ /= real;
@@ -305,27 +369,27 @@ public:
 
 protected:
 
-  double xx_;
+  Number xx_;
 
-  double xy_;
+  Number xy_;
 
-  double xz_;
+  Number xz_;
 
-  double yx_;
+  Number yx_;
 
-  double yy_;
+  Number yy_;
 
-  double yz_;
+  Number yz_;
 
-  double zx_;
+  Number zx_;
 
-  double zy_;
+  Number zy_;
 
-  double zz_;
+  Number zz_;
 
 };
 
-constexpr Dyadic Vector::dyadic(const Vector& vector) const noexcept {
+template <typename Number> constexpr BasicDyadic<Number> BasicVector<Number>::dyadic(const BasicVector& vector) const noexcept {
   return {
     x_ * vector.x_, x_ * vector.y_, x_ * vector.z_,
     y_ * vector.x_, y_ * vector.y_, y_ * vector.z_,
@@ -333,7 +397,7 @@ constexpr Dyadic Vector::dyadic(const Vector& vector) const noexcept {
   };
 }
 
-constexpr Dyadic SymmetricDyadic::operator*(const SymmetricDyadic& symmetric_dyadic) const noexcept {
+template <typename Number> constexpr BasicDyadic<Number> BasicSymmetricDyadic<Number>::operator*(const BasicSymmetricDyadic& symmetric_dyadic) const noexcept {
   return {
     xx_ * symmetric_dyadic.xx_ + xy_ * symmetric_dyadic.xy_ + xz_ * symmetric_dyadic.xz_,
     xx_ * symmetric_dyadic.xy_ + xy_ * symmetric_dyadic.yy_ + xz_ * symmetric_dyadic.yz_,
@@ -347,7 +411,7 @@ constexpr Dyadic SymmetricDyadic::operator*(const SymmetricDyadic& symmetric_dya
   };
 }
 
-constexpr Dyadic SymmetricDyadic::operator*(const Dyadic& dyadic) const noexcept {
+template <typename Number> constexpr BasicDyadic<Number> BasicSymmetricDyadic<Number>::operator*(const BasicDyadic<Number>& dyadic) const noexcept {
   return {
     xx_ * dyadic.xx() + xy_ * dyadic.yx() + xz_ * dyadic.zx(),
     xx_ * dyadic.xy() + xy_ * dyadic.yy() + xz_ * dyadic.zy(),
@@ -379,11 +443,14 @@ constexpr Value::Dyadic Direction::dyadic(const Value::Vector& vector) const noe
   };
 }
 
-constexpr Value::Dyadic Value::Vector::dyadic(const Direction& direction) const noexcept {
+template <typename Number> constexpr Value::BasicDyadic<Number> Value::BasicVector<Number>::dyadic(const Direction& direction) const noexcept {
+  const Number x{static_cast<Number>(direction.x())};
+  const Number y{static_cast<Number>(direction.y())};
+  const Number z{static_cast<Number>(direction.z())};
   return {
-    x_ * direction.x(), x_ * direction.y(), x_ * direction.z(),
-    y_ * direction.x(), y_ * direction.y(), y_ * direction.z(),
-    z_ * direction.x(), z_ * direction.y(), z_ * direction.z()
+    x_ * x, x_ * y, x_ * z,
+    y_ * x, y_ * y, y_ * z,
+    z_ * x, z_ * y, z_ * z
   };
 }
 
@@ -423,31 +490,42 @@ template <> constexpr bool sort(const Value::Dyadic& dyadic_1, const Value::Dyad
   }
 }
 
+template <> struct Deserializer<Value::Dyadic> {
+  static bool read(TextReader& reader, Value::Dyadic& dyadic) noexcept {
+    std::array<double, 9> components;
+    if (!reader.components({"xx", "xy", "xz", "yx", "yy", "yz", "zx", "zy", "zz"}, components)) {
+      return false;
+    }
+    dyadic = Value::Dyadic{components};
+    return true;
+  }
+};
+
 } // namespace PhQ
 
-constexpr PhQ::Value::Dyadic operator*(double real, const PhQ::Value::Dyadic& dyadic) noexcept {
+template <typename Number> constexpr PhQ::Value::BasicDyadic<Number> operator*(PhQ::NonDeduced<Number> real, const PhQ::Value::BasicDyadic<Number>& dyadic) noexcept {
   return {dyadic * real};
 }
 
-std::ostream& operator<<(std::ostream& output_stream, const PhQ::Value::Dyadic& dyadic) noexcept {
-  output_stream << dyadic.print();
+template <typename Number> std::ostream& operator<<(std::ostream& output_stream, const PhQ::Value::BasicDyadic<Number>& dyadic) noexcept {
+  dyadic.print(output_stream);
   return output_stream;
 }
 
 namespace std {
 
-template <> struct hash<PhQ::Value::Dyadic> {
-  size_t operator()(const PhQ::Value::Dyadic& dyadic) const {
+template <typename Number> struct hash<PhQ::Value::BasicDyadic<Number>> {
+  size_t operator()(const PhQ::Value::BasicDyadic<Number>& dyadic) const {
     return
-      hash<double>()(dyadic.xx())
-      ^ hash<double>()(dyadic.xy())
-      ^ hash<double>()(dyadic.xz())
-      ^ hash<double>()(dyadic.yx())
-      ^ hash<double>()(dyadic.yy())
-      ^ hash<double>()(dyadic.yz())
-      ^ hash<double>()(dyadic.zx())
-      ^ hash<double>()(dyadic.zy())
-      ^ hash<double>()(dyadic.zz());
+      hash<Number>()(dyadic.xx())
+      ^ hash<Number>()(dyadic.xy())
+      ^ hash<Number>()(dyadic.xz())
+      ^ hash<Number>()(dyadic.yx())
+      ^ hash<Number>()(dyadic.yy())
+      ^ hash<Number>()(dyadic.yz())
+      ^ hash<Number>()(dyadic.zx())
+      ^ hash<Number>()(dyadic.zy())
+      ^ hash<Number>()(dyadic.zz());
   }
 };
 
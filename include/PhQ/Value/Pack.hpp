@@ -0,0 +1,730 @@
+// Copyright 2020 Alexandre Coderre-Chabot
+// This file is part of Physical Quantities (PhQ), a C++17 header-only library of physical quantities, physical models, and units of measure for scientific computation.
+// Physical Quantities is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+// You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Dyadic.hpp"
+
+namespace PhQ {
+
+/// \brief Number of doubles in the widest SIMD register of the target architecture: 8 with AVX-512, 4 with AVX, 2 with SSE2 or NEON, and 1 otherwise.
+#if defined(__AVX512F__)
+constexpr const std::size_t native_pack_width{8};
+#elif defined(__AVX__)
+constexpr const std::size_t native_pack_width{4};
+#elif defined(__SSE2__) || defined(__ARM_NEON)
+constexpr const std::size_t native_pack_width{2};
+#else
+constexpr const std::size_t native_pack_width{1};
+#endif
+
+/// \brief Number of values of a given floating-point type in the widest SIMD register of the target architecture, such as 16 floats with AVX-512. At least 1.
+template <typename Number> constexpr const std::size_t native_pack_width_of{native_pack_width * sizeof(double) / sizeof(Number) > 0 ? native_pack_width * sizeof(double) / sizeof(Number) : 1};
+
+namespace Value {
+
+/// \brief Pack of a fixed number of lanes, each holding a floating-point number of a given type, double by default, that are operated on together. Each operation is a loop over the lanes with no dependency between them, which the compiler maps to a single SIMD instruction when the width matches a register of the target architecture, such as 4 with AVX2 or 8 with AVX-512. A pack of width 1 is the scalar fallback.
+/// \details Each lane of every pack type computes exactly the same operations in the same order as the corresponding scalar class, so the results are bit-identical to those of the scalar classes unless fast-math or floating-point contraction lets the compiler reorder or fuse them differently in the two cases.
+template <std::size_t Width, typename Number = double> class alignas(Width * sizeof(Number)) ScalarPack {
+
+  static_assert(Width > 0 && (Width & (Width - 1)) == 0, "PhQ::Value::ScalarPack requires a width that is a power of 2.");
+
+public:
+
+  static constexpr std::size_t width{Width};
+
+  constexpr ScalarPack() noexcept : lanes_() {}
+
+  /// \brief Broadcast a number to every lane.
+  constexpr ScalarPack(Number value) noexcept : lanes_() {
+    for (std::size_t lane = 0; lane < Width; ++lane) {
+      lanes_[lane] = value;
+    }
+  }
+
+  constexpr ScalarPack(const std::array<Number, Width>& lanes) noexcept : lanes_(lanes) {}
+
+  /// \brief Load the numbers at a given index of a contiguous array.
+  static ScalarPack load(const Number* values, std::size_t index) noexcept {
+    ScalarPack pack;
+    for (std::size_t lane = 0; lane < Width; ++lane) {
+      pack.lanes_[lane] = values[index + lane];
+    }
+    return pack;
+  }
+
+  void store(Number* values, std::size_t index) const noexcept {
+    for (std::size_t lane = 0; lane < Width; ++lane) {
+      values[index + lane] = lanes_[lane];
+    }
+  }
+
+  constexpr Number operator[](std::size_t lane) const noexcept {
+    return lanes_[lane];
+  }
+
+  constexpr bool operator==(const ScalarPack& pack) const noexcept {
+    return lanes_ == pack.lanes_;
+  }
+
+  constexpr bool operator!=(const ScalarPack& pack) const noexcept {
+    return lanes_ != pack.lanes_;
+  }
+
+  constexpr ScalarPack operator-() const noexcept {
+    return apply([](Number value) { return -value; });
+  }
+
+  constexpr ScalarPack operator+(const ScalarPack& pack) const noexcept {
+    return apply(pack, [](Number value1, Number value2) { return value1 + value2; });
+  }
+
+  constexpr void operator+=(const ScalarPack& pack) noexcept {
+    *this = *this + pack;
+  }
+
+  constexpr ScalarPack operator-(const ScalarPack& pack) const noexcept {
+    return apply(pack, [](Number value1, Number value2) { return value1 - value2; });
+  }
+
+  constexpr void operator-=(const ScalarPack& pack) noexcept {
+    *this = *this - pack;
+  }
+
+  constexpr ScalarPack operator*(const ScalarPack& pack) const noexcept {
+    return apply(pack, [](Number value1, Number value2) { return value1 * value2; });
+  }
+
+  constexpr void operator*=(const ScalarPack& pack) noexcept {
+    *this = *this * pack;
+  }
+
+  constexpr ScalarPack operator/(const ScalarPack& pack) const noexcept {
+    return apply(pack, [](Number value1, Number value2) { return value1 / value2; });
+  }
+
+  constexpr void operator/=(const ScalarPack& pack) noexcept {
+    *this = *this / pack;
+  }
+
+  /// \brief Whether any lane equals a number, such as a zero determinant.
+  constexpr bool any_equal(Number value) const noexcept {
+    bool found{false};
+    for (std::size_t lane = 0; lane < Width; ++lane) {
+      found = found || lanes_[lane] == value;
+    }
+    return found;
+  }
+
+  /// \brief Apply a function to every lane.
+  template <typename Function> constexpr ScalarPack apply(Function function) const noexcept {
+    ScalarPack result;
+    for (std::size_t lane = 0; lane < Width; ++lane) {
+      result.lanes_[lane] = function(lanes_[lane]);
+    }
+    return result;
+  }
+
+  /// \brief Apply a function to every pair of lanes of this pack and another.
+  template <typename Function> constexpr ScalarPack apply(const ScalarPack& pack, Function function) const noexcept {
+    ScalarPack result;
+    for (std::size_t lane = 0; lane < Width; ++lane) {
+      result.lanes_[lane] = function(lanes_[lane], pack.lanes_[lane]);
+    }
+    return result;
+  }
+
+private:
+
+  std::array<Number, Width> lanes_;
+
+};
+
+template <std::size_t Width, typename Number> ScalarPack<Width, Number> sqrt(const ScalarPack<Width, Number>& pack) noexcept {
+  return pack.apply([](Number value) { return std::sqrt(value); });
+}
+
+// Forward declaration.
+template <std::size_t Width, typename Number = double> class DyadicPack;
+
+/// \brief Pack of three-dimensional Euclidean vectors that mirrors PhQ::Value::Vector, with each of the x, y, and z components held in a PhQ::Value::ScalarPack.
+template <std::size_t Width, typename Number = double> class VectorPack {
+
+public:
+
+  static constexpr std::size_t width{Width};
+
+  constexpr VectorPack() noexcept : x_(), y_(), z_() {}
+
+  constexpr VectorPack(const ScalarPack<Width, Number>& x, const ScalarPack<Width, Number>& y, const ScalarPack<Width, Number>& z) noexcept : x_(x), y_(y), z_(z) {}
+
+  /// \brief Broadcast a vector to every lane.
+  constexpr VectorPack(const BasicVector<Number>& vector) noexcept : x_(vector.x()), y_(vector.y()), z_(vector.z()) {}
+
+  constexpr VectorPack(const ScalarPack<Width, Number>& value, const Direction& direction) noexcept : x_(value * static_cast<Number>(direction.x())), y_(value * static_cast<Number>(direction.y())), z_(value * static_cast<Number>(direction.z())) {}
+
+  /// \brief Load the vectors at a given index of three component arrays, such as those of a PhQ::QuantityArray.
+  static VectorPack load(const std::array<const Number*, 3>& components, std::size_t index) noexcept {
+    return {ScalarPack<Width, Number>::load(components[0], index), ScalarPack<Width, Number>::load(components[1], index), ScalarPack<Width, Number>::load(components[2], index)};
+  }
+
+  void store(const std::array<Number*, 3>& components, std::size_t index) const noexcept {
+    x_.store(components[0], index);
+    y_.store(components[1], index);
+    z_.store(components[2], index);
+  }
+
+  /// \brief Vector held in one lane.
+  constexpr BasicVector<Number> lane(std::size_t lane) const noexcept {
+    return {x_[lane], y_[lane], z_[lane]};
+  }
+
+  constexpr const ScalarPack<Width, Number>& x() const noexcept {
+    return x_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& y() const noexcept {
+    return y_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& z() const noexcept {
+    return z_;
+  }
+
+  ScalarPack<Width, Number> magnitude() const noexcept {
+    return sqrt(x_ * x_ + y_ * y_ + z_ * z_);
+  }
+
+  constexpr ScalarPack<Width, Number> dot(const Direction& direction) const noexcept {
+    return x_ * static_cast<Number>(direction.x()) + y_ * static_cast<Number>(direction.y()) + z_ * static_cast<Number>(direction.z());
+  }
+
+  constexpr ScalarPack<Width, Number> dot(const VectorPack& vector) const noexcept {
+    return x_ * vector.x_ + y_ * vector.y_ + z_ * vector.z_;
+  }
+
+  constexpr VectorPack cross(const Direction& direction) const noexcept {
+    return {
+      y_ * static_cast<Number>(direction.z()) - z_ * static_cast<Number>(direction.y()),
+      z_ * static_cast<Number>(direction.x()) - x_ * static_cast<Number>(direction.z()),
+      x_ * static_cast<Number>(direction.y()) - y_ * static_cast<Number>(direction.x())
+    };
+  }
+
+  constexpr VectorPack cross(const VectorPack& vector) const noexcept {
+    return {
+      y_ * vector.z_ - z_ * vector.y_,
+      z_ * vector.x_ - x_ * vector.z_,
+      x_ * vector.y_ - y_ * vector.x_
+    };
+  }
+
+  constexpr DyadicPack<Width, Number> dyadic(const Direction& direction) const noexcept;
+
+  constexpr DyadicPack<Width, Number> dyadic(const VectorPack& vector) const noexcept;
+
+  constexpr bool operator==(const VectorPack& vector) const noexcept {
+    return x_ == vector.x_ && y_ == vector.y_ && z_ == vector.z_;
+  }
+
+  constexpr bool operator!=(const VectorPack& vector) const noexcept {
+    return x_ != vector.x_ || y_ != vector.y_ || z_ != vector.z_;
+  }
+
+  constexpr VectorPack operator+(const VectorPack& vector) const noexcept {
+    return {x_ + vector.x_, y_ + vector.y_, z_ + vector.z_};
+  }
+
+  constexpr void operator+=(const VectorPack& vector) noexcept {
+    x_ += vector.x_;
+    y_ += vector.y_;
+    z_ += vector.z_;
+  }
+
+  constexpr VectorPack operator-(const VectorPack& vector) const noexcept {
+    return {x_ - vector.x_, y_ - vector.y_, z_ - vector.z_};
+  }
+
+  constexpr void operator-=(const VectorPack& vector) noexcept {
+    x_ -= vector.x_;
+    y_ -= vector.y_;
+    z_ -= vector.z_;
+  }
+
+  constexpr VectorPack operator*(const ScalarPack<Width, Number>& real) const noexcept {
+    return {x_ * real, y_ * real, z_ * real};
+  }
+
+  constexpr void operator*=(const ScalarPack<Width, Number>& real) noexcept {
+    x_ *= real;
+    y_ *= real;
+    z_ *= real;
+  }
+
+  constexpr VectorPack operator/(const ScalarPack<Width, Number>& real) const noexcept {
+    return {x_ / real, y_ / real, z_ / real};
+  }
+
+  constexpr void operator/=(const ScalarPack<Width, Number>& real) noexcept {
+    x_ /= real;
+    y_ /= real;
+    z_ /= real;
+  }
+
+private:
+
+  ScalarPack<Width, Number> x_;
+
+  ScalarPack<Width, Number> y_;
+
+  ScalarPack<Width, Number> z_;
+
+};
+
+/// \brief Pack of three-dimensional symmetric dyadic tensors that mirrors PhQ::Value::SymmetricDyadic, with each of the xx, xy, xz, yy, yz, and zz components held in a PhQ::Value::ScalarPack.
+template <std::size_t Width, typename Number = double> class SymmetricDyadicPack {
+
+public:
+
+  static constexpr std::size_t width{Width};
+
+  constexpr SymmetricDyadicPack() noexcept : xx_(), xy_(), xz_(), yy_(), yz_(), zz_() {}
+
+  constexpr SymmetricDyadicPack(const ScalarPack<Width, Number>& xx, const ScalarPack<Width, Number>& xy, const ScalarPack<Width, Number>& xz, const ScalarPack<Width, Number>& yy, const ScalarPack<Width, Number>& yz, const ScalarPack<Width, Number>& zz) noexcept : xx_(xx), xy_(xy), xz_(xz), yy_(yy), yz_(yz), zz_(zz) {}
+
+  /// \brief Broadcast a symmetric dyadic tensor to every lane.
+  constexpr SymmetricDyadicPack(const BasicSymmetricDyadic<Number>& symmetric_dyadic) noexcept : xx_(symmetric_dyadic.xx()), xy_(symmetric_dyadic.xy()), xz_(symmetric_dyadic.xz()), yy_(symmetric_dyadic.yy()), yz_(symmetric_dyadic.yz()), zz_(symmetric_dyadic.zz()) {}
+
+  /// \brief Load the symmetric dyadic tensors at a given index of six component arrays, such as those of a PhQ::QuantityArray.
+  static SymmetricDyadicPack load(const std::array<const Number*, 6>& components, std::size_t index) noexcept {
+    return {ScalarPack<Width, Number>::load(components[0], index), ScalarPack<Width, Number>::load(components[1], index), ScalarPack<Width, Number>::load(components[2], index), ScalarPack<Width, Number>::load(components[3], index), ScalarPack<Width, Number>::load(components[4], index), ScalarPack<Width, Number>::load(components[5], index)};
+  }
+
+  void store(const std::array<Number*, 6>& components, std::size_t index) const noexcept {
+    xx_.store(components[0], index);
+    xy_.store(components[1], index);
+    xz_.store(components[2], index);
+    yy_.store(components[3], index);
+    yz_.store(components[4], index);
+    zz_.store(components[5], index);
+  }
+
+  /// \brief Symmetric dyadic tensor held in one lane.
+  constexpr BasicSymmetricDyadic<Number> lane(std::size_t lane) const noexcept {
+    return {xx_[lane], xy_[lane], xz_[lane], yy_[lane], yz_[lane], zz_[lane]};
+  }
+
+  constexpr const ScalarPack<Width, Number>& xx() const noexcept {
+    return xx_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& xy() const noexcept {
+    return xy_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& xz() const noexcept {
+    return xz_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& yx() const noexcept {
+    return xy_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& yy() const noexcept {
+    return yy_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& yz() const noexcept {
+    return yz_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& zx() const noexcept {
+    return xz_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& zy() const noexcept {
+    return yz_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& zz() const noexcept {
+    return zz_;
+  }
+
+  constexpr ScalarPack<Width, Number> trace() const noexcept {
+    return xx_ + yy_ + zz_;
+  }
+
+  constexpr ScalarPack<Width, Number> determinant() const noexcept {
+    return
+      xx_ * (yy_ * zz_ - yz_ * yz_) +
+      xy_ * (xz_ * yz_ - xy_ * zz_) +
+      xz_ * (xy_ * yz_ - xz_ * yy_);
+  }
+
+  constexpr SymmetricDyadicPack transpose() const noexcept {
+    return *this;
+  }
+
+  constexpr SymmetricDyadicPack cofactors() const noexcept {
+    const ScalarPack<Width, Number> cofactor_xx{yy_ * zz_ - yz_ * yz_};
+    const ScalarPack<Width, Number> cofactor_xy{xz_ * yz_ - xy_ * zz_};
+    const ScalarPack<Width, Number> cofactor_xz{xy_ * yz_ - xz_ * yy_};
+    const ScalarPack<Width, Number> cofactor_yy{xx_ * zz_ - xz_ * xz_};
+    const ScalarPack<Width, Number> cofactor_yz{xy_ * xz_ - xx_ * yz_};
+    const ScalarPack<Width, Number> cofactor_zz{xx_ * yy_ - xy_ * xy_};
+    return {cofactor_xx, cofactor_xy, cofactor_xz, cofactor_yy, cofactor_yz, cofactor_zz};
+  }
+
+  constexpr SymmetricDyadicPack adjugate() const noexcept {
+    return cofactors().transpose();
+  }
+
+  /// \brief Inverses of the symmetric dyadic tensors of every lane. Throws if the determinant of any lane is 0.
+  SymmetricDyadicPack inverse() const {
+    const ScalarPack<Width, Number> determinant_{determinant()};
+    if (determinant_.any_equal(0.0)) {
+      throw std::runtime_error{"Cannot compute the inverse of a pack of symmetric dyadic tensors because the determinant of one of them is 0."};
+    }
+    return adjugate() / determinant_;
+  }
+
+  constexpr bool operator==(const SymmetricDyadicPack& symmetric_dyadic) const noexcept {
+    return xx_ == symmetric_dyadic.xx_ && xy_ == symmetric_dyadic.xy_ && xz_ == symmetric_dyadic.xz_ && yy_ == symmetric_dyadic.yy_ && yz_ == symmetric_dyadic.yz_ && zz_ == symmetric_dyadic.zz_;
+  }
+
+  constexpr bool operator!=(const SymmetricDyadicPack& symmetric_dyadic) const noexcept {
+    return !(*this == symmetric_dyadic);
+  }
+
+  constexpr SymmetricDyadicPack operator+(const SymmetricDyadicPack& symmetric_dyadic) const noexcept {
+    return {xx_ + symmetric_dyadic.xx_, xy_ + symmetric_dyadic.xy_, xz_ + symmetric_dyadic.xz_, yy_ + symmetric_dyadic.yy_, yz_ + symmetric_dyadic.yz_, zz_ + symmetric_dyadic.zz_};
+  }
+
+  constexpr void operator+=(const SymmetricDyadicPack& symmetric_dyadic) noexcept {
+    *this = *this + symmetric_dyadic;
+  }
+
+  constexpr SymmetricDyadicPack operator-(const SymmetricDyadicPack& symmetric_dyadic) const noexcept {
+    return {xx_ - symmetric_dyadic.xx_, xy_ - symmetric_dyadic.xy_, xz_ - symmetric_dyadic.xz_, yy_ - symmetric_dyadic.yy_, yz_ - symmetric_dyadic.yz_, zz_ - symmetric_dyadic.zz_};
+  }
+
+  constexpr void operator-=(const SymmetricDyadicPack& symmetric_dyadic) noexcept {
+    *this = *this - symmetric_dyadic;
+  }
+
+  constexpr SymmetricDyadicPack operator*(const ScalarPack<Width, Number>& real) const noexcept {
+    return {xx_ * real, xy_ * real, xz_ * real, yy_ * real, yz_ * real, zz_ * real};
+  }
+
+  constexpr VectorPack<Width, Number> operator*(const VectorPack<Width, Number>& vector) const noexcept {
+    return {
+      xx_ * vector.x() + xy_ * vector.y() + xz_ * vector.z(),
+      xy_ * vector.x() + yy_ * vector.y() + yz_ * vector.z(),
+      xz_ * vector.x() + yz_ * vector.y() + zz_ * vector.z()
+    };
+  }
+
+  constexpr VectorPack<Width, Number> operator*(const Direction& direction) const noexcept {
+    return {
+      xx_ * static_cast<Number>(direction.x()) + xy_ * static_cast<Number>(direction.y()) + xz_ * static_cast<Number>(direction.z()),
+      xy_ * static_cast<Number>(direction.x()) + yy_ * static_cast<Number>(direction.y()) + yz_ * static_cast<Number>(direction.z()),
+      xz_ * static_cast<Number>(direction.x()) + yz_ * static_cast<Number>(direction.y()) + zz_ * static_cast<Number>(direction.z())
+    };
+  }
+
+  constexpr DyadicPack<Width, Number> operator*(const SymmetricDyadicPack& symmetric_dyadic) const noexcept;
+
+  constexpr void operator*=(const ScalarPack<Width, Number>& real) noexcept {
+    *this = *this * real;
+  }
+
+  constexpr SymmetricDyadicPack operator/(const ScalarPack<Width, Number>& real) const noexcept {
+    return {xx_ / real, xy_ / real, xz_ / real, yy_ / real, yz_ / real, zz_ / real};
+  }
+
+  constexpr void operator/=(const ScalarPack<Width, Number>& real) noexcept {
+    *this = *this / real;
+  }
+
+private:
+
+  ScalarPack<Width, Number> xx_;
+
+  ScalarPack<Width, Number> xy_;
+
+  ScalarPack<Width, Number> xz_;
+
+  ScalarPack<Width, Number> yy_;
+
+  ScalarPack<Width, Number> yz_;
+
+  ScalarPack<Width, Number> zz_;
+
+};
+
+/// \brief Pack of three-dimensional dyadic tensors that mirrors PhQ::Value::Dyadic, with each of the nine components held in a PhQ::Value::ScalarPack.
+template <std::size_t Width, typename Number> class DyadicPack {
+
+public:
+
+  static constexpr std::size_t width{Width};
+
+  constexpr DyadicPack() noexcept : xx_(), xy_(), xz_(), yx_(), yy_(), yz_(), zx_(), zy_(), zz_() {}
+
+  constexpr DyadicPack(const ScalarPack<Width, Number>& xx, const ScalarPack<Width, Number>& xy, const ScalarPack<Width, Number>& xz, const ScalarPack<Width, Number>& yx, const ScalarPack<Width, Number>& yy, const ScalarPack<Width, Number>& yz, const ScalarPack<Width, Number>& zx, const ScalarPack<Width, Number>& zy, const ScalarPack<Width, Number>& zz) noexcept : xx_(xx), xy_(xy), xz_(xz), yx_(yx), yy_(yy), yz_(yz), zx_(zx), zy_(zy), zz_(zz) {}
+
+  /// \brief Broadcast a dyadic tensor to every lane.
+  constexpr DyadicPack(const BasicDyadic<Number>& dyadic) noexcept : xx_(dyadic.xx()), xy_(dyadic.xy()), xz_(dyadic.xz()), yx_(dyadic.yx()), yy_(dyadic.yy()), yz_(dyadic.yz()), zx_(dyadic.zx()), zy_(dyadic.zy()), zz_(dyadic.zz()) {}
+
+  constexpr DyadicPack(const SymmetricDyadicPack<Width, Number>& symmetric_dyadic) noexcept : xx_(symmetric_dyadic.xx()), xy_(symmetric_dyadic.xy()), xz_(symmetric_dyadic.xz()), yx_(symmetric_dyadic.yx()), yy_(symmetric_dyadic.yy()), yz_(symmetric_dyadic.yz()), zx_(symmetric_dyadic.zx()), zy_(symmetric_dyadic.zy()), zz_(symmetric_dyadic.zz()) {}
+
+  /// \brief Load the dyadic tensors at a given index of nine component arrays, such as those of a PhQ::QuantityArray.
+  static DyadicPack load(const std::array<const Number*, 9>& components, std::size_t index) noexcept {
+    return {ScalarPack<Width, Number>::load(components[0], index), ScalarPack<Width, Number>::load(components[1], index), ScalarPack<Width, Number>::load(components[2], index), ScalarPack<Width, Number>::load(components[3], index), ScalarPack<Width, Number>::load(components[4], index), ScalarPack<Width, Number>::load(components[5], index), ScalarPack<Width, Number>::load(components[6], index), ScalarPack<Width, Number>::load(components[7], index), ScalarPack<Width, Number>::load(components[8], index)};
+  }
+
+  void store(const std::array<Number*, 9>& components, std::size_t index) const noexcept {
+    xx_.store(components[0], index);
+    xy_.store(components[1], index);
+    xz_.store(components[2], index);
+    yx_.store(components[3], index);
+    yy_.store(components[4], index);
+    yz_.store(components[5], index);
+    zx_.store(components[6], index);
+    zy_.store(components[7], index);
+    zz_.store(components[8], index);
+  }
+
+  /// \brief Dyadic tensor held in one lane.
+  constexpr BasicDyadic<Number> lane(std::size_t lane) const noexcept {
+    return {xx_[lane], xy_[lane], xz_[lane], yx_[lane], yy_[lane], yz_[lane], zx_[lane], zy_[lane], zz_[lane]};
+  }
+
+  constexpr const ScalarPack<Width, Number>& xx() const noexcept {
+    return xx_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& xy() const noexcept {
+    return xy_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& xz() const noexcept {
+    return xz_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& yx() const noexcept {
+    return yx_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& yy() const noexcept {
+    return yy_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& yz() const noexcept {
+    return yz_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& zx() const noexcept {
+    return zx_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& zy() const noexcept {
+    return zy_;
+  }
+
+  constexpr const ScalarPack<Width, Number>& zz() const noexcept {
+    return zz_;
+  }
+
+  constexpr ScalarPack<Width, Number> trace() const noexcept {
+    return xx_ + yy_ + zz_;
+  }
+
+  constexpr ScalarPack<Width, Number> determinant() const noexcept {
+    return
+      xx_ * (yy_ * zz_ - yz_ * zy_) +
+      xy_ * (yz_ * zx_ - yx_ * zz_) +
+      xz_ * (yx_ * zy_ - yy_ * zx_);
+  }
+
+  constexpr DyadicPack transpose() const noexcept {
+    return {xx_, yx_, zx_, xy_, yy_, zy_, xz_, yz_, zz_};
+  }
+
+  constexpr DyadicPack cofactors() const noexcept {
+    const ScalarPack<Width, Number> cofactor_xx{yy_ * zz_ - yz_ * zy_};
+    const ScalarPack<Width, Number> cofactor_xy{yz_ * zx_ - yx_ * zz_};
+    const ScalarPack<Width, Number> cofactor_xz{yx_ * zy_ - yy_ * zx_};
+    const ScalarPack<Width, Number> cofactor_yx{xz_ * zy_ - xy_ * zz_};
+    const ScalarPack<Width, Number> cofactor_yy{xx_ * zz_ - xz_ * zx_};
+    const ScalarPack<Width, Number> cofactor_yz{xy_ * zx_ - xx_ * zy_};
+    const ScalarPack<Width, Number> cofactor_zx{xy_ * yz_ - xz_ * yy_};
+    const ScalarPack<Width, Number> cofactor_zy{xz_ * yx_ - xx_ * yz_};
+    const ScalarPack<Width, Number> cofactor_zz{xx_ * yy_ - xy_ * yx_};
+    return {cofactor_xx, cofactor_xy, cofactor_xz, cofactor_yx, cofactor_yy, cofactor_yz, cofactor_zx, cofactor_zy, cofactor_zz};
+  }
+
+  constexpr DyadicPack adjugate() const noexcept {
+    return cofactors().transpose();
+  }
+
+  /// \brief Inverses of the dyadic tensors of every lane. Throws if the determinant of any lane is 0.
+  DyadicPack inverse() const {
+    const ScalarPack<Width, Number> determinant_{determinant()};
+    if (determinant_.any_equal(0.0)) {
+      throw std::runtime_error{"Cannot compute the inverse of a pack of dyadic tensors because the determinant of one of them is 0."};
+    }
+    return adjugate() / determinant_;
+  }
+
+  constexpr bool operator==(const DyadicPack& dyadic) const noexcept {
+    return xx_ == dyadic.xx_ && xy_ == dyadic.xy_ && xz_ == dyadic.xz_ && yx_ == dyadic.yx_ && yy_ == dyadic.yy_ && yz_ == dyadic.yz_ && zx_ == dyadic.zx_ && zy_ == dyadic.zy_ && zz_ == dyadic.zz_;
+  }
+
+  constexpr bool operator!=(const DyadicPack& dyadic) const noexcept {
+    return !(*this == dyadic);
+  }
+
+  constexpr DyadicPack operator+(const DyadicPack& dyadic) const noexcept {
+    return {xx_ + dyadic.xx_, xy_ + dyadic.xy_, xz_ + dyadic.xz_, yx_ + dyadic.yx_, yy_ + dyadic.yy_, yz_ + dyadic.yz_, zx_ + dyadic.zx_, zy_ + dyadic.zy_, zz_ + dyadic.zz_};
+  }
+
+  constexpr void operator+=(const DyadicPack& dyadic) noexcept {
+    *this = *this + dyadic;
+  }
+
+  constexpr DyadicPack operator-(const DyadicPack& dyadic) const noexcept {
+    return {xx_ - dyadic.xx_, xy_ - dyadic.xy_, xz_ - dyadic.xz_, yx_ - dyadic.yx_, yy_ - dyadic.yy_, yz_ - dyadic.yz_, zx_ - dyadic.zx_, zy_ - dyadic.zy_, zz_ - dyadic.zz_};
+  }
+
+  constexpr void operator-=(const DyadicPack& dyadic) noexcept {
+    *this = *this - dyadic;
+  }
+
+  constexpr DyadicPack operator*(const ScalarPack<Width, Number>& real) const noexcept {
+    return {xx_ * real, xy_ * real, xz_ * real, yx_ * real, yy_ * real, yz_ * real, zx_ * real, zy_ * real, zz_ * real};
+  }
+
+  constexpr VectorPack<Width, Number> operator*(const VectorPack<Width, Number>& vector) const noexcept {
+    return {
+      xx_ * vector.x() + xy_ * vector.y() + xz_ * vector.z(),
+      yx_ * vector.x() + yy_ * vector.y() + yz_ * vector.z(),
+      zx_ * vector.x() + zy_ * vector.y() + zz_ * vector.z()
+    };
+  }
+
+  constexpr VectorPack<Width, Number> operator*(const Direction& direction) const noexcept {
+    return {
+      xx_ * static_cast<Number>(direction.x()) + xy_ * static_cast<Number>(direction.y()) + xz_ * static_cast<Number>(direction.z()),
+      yx_ * static_cast<Number>(direction.x()) + yy_ * static_cast<Number>(direction.y()) + yz_ * static_cast<Number>(direction.z()),
+      zx_ * static_cast<Number>(direction.x()) + zy_ * static_cast<Number>(direction.y()) + zz_ * static_cast<Number>(direction.z())
+    };
+  }
+
+  constexpr DyadicPack operator*(const DyadicPack& dyadic) const noexcept {
+    return {
+      xx_ * dyadic.xx_ + xy_ * dyadic.yx_ + xz_ * dyadic.zx_,
+      xx_ * dyadic.xy_ + xy_ * dyadic.yy_ + xz_ * dyadic.zy_,
+      xx_ * dyadic.xz_ + xy_ * dyadic.yz_ + xz_ * dyadic.zz_,
+      yx_ * dyadic.xx_ + yy_ * dyadic.yx_ + yz_ * dyadic.zx_,
+      yx_ * dyadic.xy_ + yy_ * dyadic.yy_ + yz_ * dyadic.zy_,
+      yx_ * dyadic.xz_ + yy_ * dyadic.yz_ + yz_ * dyadic.zz_,
+      zx_ * dyadic.xx_ + zy_ * dyadic.yx_ + zz_ * dyadic.zx_,
+      zx_ * dyadic.xy_ + zy_ * dyadic.yy_ + zz_ * dyadic.zy_,
+      zx_ * dyadic.xz_ + zy_ * dyadic.yz_ + zz_ * dyadic.zz_
+    };
+  }
+
+  constexpr void operator*=(const ScalarPack<Width, Number>& real) noexcept {
+    *this = *this * real;
+  }
+
+  constexpr DyadicPack operator/(const ScalarPack<Width, Number>& real) const noexcept {
+    return {xx_ / real, xy_ / real, xz_ / real, yx_ / real, yy_ / real, yz_ / real, zx_ / real, zy_ / real, zz_ / real};
+  }
+
+  constexpr void operator/=(const ScalarPack<Width, Number>& real) noexcept {
+    *this = *this / real;
+  }
+
+private:
+
+  ScalarPack<Width, Number> xx_;
+
+  ScalarPack<Width, Number> xy_;
+
+  ScalarPack<Width, Number> xz_;
+
+  ScalarPack<Width, Number> yx_;
+
+  ScalarPack<Width, Number> yy_;
+
+  ScalarPack<Width, Number> yz_;
+
+  ScalarPack<Width, Number> zx_;
+
+  ScalarPack<Width, Number> zy_;
+
+  ScalarPack<Width, Number> zz_;
+
+};
+
+template <std::size_t Width, typename Number> constexpr DyadicPack<Width, Number> VectorPack<Width, Number>::dyadic(const Direction& direction) const noexcept {
+  return {
+    x_ * static_cast<Number>(direction.x()), x_ * static_cast<Number>(direction.y()), x_ * static_cast<Number>(direction.z()),
+    y_ * static_cast<Number>(direction.x()), y_ * static_cast<Number>(direction.y()), y_ * static_cast<Number>(direction.z()),
+    z_ * static_cast<Number>(direction.x()), z_ * static_cast<Number>(direction.y()), z_ * static_cast<Number>(direction.z())
+  };
+}
+
+template <std::size_t Width, typename Number> constexpr DyadicPack<Width, Number> VectorPack<Width, Number>::dyadic(const VectorPack& vector) const noexcept {
+  return {
+    x_ * vector.x_, x_ * vector.y_, x_ * vector.z_,
+    y_ * vector.x_, y_ * vector.y_, y_ * vector.z_,
+    z_ * vector.x_, z_ * vector.y_, z_ * vector.z_
+  };
+}
+
+template <std::size_t Width, typename Number> constexpr DyadicPack<Width, Number> SymmetricDyadicPack<Width, Number>::operator*(const SymmetricDyadicPack& symmetric_dyadic) const noexcept {
+  return {
+    xx_ * symmetric_dyadic.xx_ + xy_ * symmetric_dyadic.xy_ + xz_ * symmetric_dyadic.xz_,
+    xx_ * symmetric_dyadic.xy_ + xy_ * symmetric_dyadic.yy_ + xz_ * symmetric_dyadic.yz_,
+    xx_ * symmetric_dyadic.xz_ + xy_ * symmetric_dyadic.yz_ + xz_ * symmetric_dyadic.zz_,
+    xy_ * symmetric_dyadic.xx_ + yy_ * symmetric_dyadic.xy_ + yz_ * symmetric_dyadic.xz_,
+    xy_ * symmetric_dyadic.xy_ + yy_ * symmetric_dyadic.yy_ + yz_ * symmetric_dyadic.yz_,
+    xy_ * symmetric_dyadic.xz_ + yy_ * symmetric_dyadic.yz_ + yz_ * symmetric_dyadic.zz_,
+    xz_ * symmetric_dyadic.xx_ + yz_ * symmetric_dyadic.xy_ + zz_ * symmetric_dyadic.xz_,
+    xz_ * symmetric_dyadic.xy_ + yz_ * symmetric_dyadic.yy_ + zz_ * symmetric_dyadic.yz_,
+    xz_ * symmetric_dyadic.xz_ + yz_ * symmetric_dyadic.yz_ + zz_ * symmetric_dyadic.zz_
+  };
+}
+
+} // namespace Value
+
+/// \brief Call a kernel on every run of a given number of consecutive indices in [0, size), and then on each remaining index one at a time. The kernel is called as kernel(index, width), where width is a std::integral_constant holding either the pack width or 1, so that a single generic kernel serves for both the packed body and the scalar remainder.
+template <std::size_t Width, typename Kernel> void for_each_pack(std::size_t size, Kernel&& kernel) {
+  const std::size_t packed_size{size - size % Width};
+  for (std::size_t index = 0; index < packed_size; index += Width) {
+    kernel(index, std::integral_constant<std::size_t, Width>{});
+  }
+  for (std::size_t index = packed_size; index < size; ++index) {
+    kernel(index, std::integral_constant<std::size_t, 1>{});
+  }
+}
+
+} // namespace PhQ
+
+template <std::size_t Width, typename Number> constexpr PhQ::Value::VectorPack<Width, Number> operator*(const PhQ::Value::ScalarPack<Width, Number>& real, const PhQ::Value::VectorPack<Width, Number>& vector) noexcept {
+  return vector * real;
+}
+
+template <std::size_t Width, typename Number> constexpr PhQ::Value::SymmetricDyadicPack<Width, Number> operator*(const PhQ::Value::ScalarPack<Width, Number>& real, const PhQ::Value::SymmetricDyadicPack<Width, Number>& symmetric_dyadic) noexcept {
+  return symmetric_dyadic * real;
+}
+
+template <std::size_t Width, typename Number> constexpr PhQ::Value::DyadicPack<Width, Number> operator*(const PhQ::Value::ScalarPack<Width, Number>& real, const PhQ::Value::DyadicPack<Width, Number>& dyadic) noexcept {
+  return dyadic * real;
+}
@@ -12,49 +12,53 @@ namespace PhQ {
 
 namespace Value {
 
-class SymmetricDyadic {
+/// \brief Three-dimensional symmetric dyadic tensor whose components are of a given numeric type, such as float, double, or long double. PhQ::Value::SymmetricDyadic is the double-precision symmetric dyadic tensor used throughout the library.
+template <typename Number> class BasicSymmetricDyadic {
 
 public:
 
-  constexpr SymmetricDyadic() noexcept : xx_(), xy_(), xz_(), yy_(), yz_(), zz_() {}
+  constexpr BasicSymmetricDyadic() noexcept : xx_(), xy_(), xz_(), yy_(), yz_(), zz_() {}
 
-  constexpr SymmetricDyadic(double xx, double xy, double xz, double yy, double yz, double zz) noexcept : xx_(xx), xy_(xy), xz_(xz), yy_(yy), yz_(yz), zz_(zz) {}
+  constexpr BasicSymmetricDyadic(Number xx, Number xy, Number xz, Number yy, Number yz, Number zz) noexcept : xx_(xx), xy_(xy), xz_(xz), yy_(yy), yz_(yz), zz_(zz) {}
 
-  constexpr SymmetricDyadic(const std::array<double, 6>& xx_xy_xz_yy_yz_zz) noexcept : xx_(xx_xy_xz_yy_yz_zz[0]), xy_(xx_xy_xz_yy_yz_zz[1]), xz_(xx_xy_xz_yy_yz_zz[2]), yy_(xx_xy_xz_yy_yz_zz[3]), yz_(xx_xy_xz_yy_yz_zz[4]), zz_(xx_xy_xz_yy_yz_zz[5]) {}
+  constexpr BasicSymmetricDyadic(const std::array<Number, 6>& xx_xy_xz_yy_yz_zz) noexcept : xx_(xx_xy_xz_yy_yz_zz[0]), xy_(xx_xy_xz_yy_yz_zz[1]), xz_(xx_xy_xz_yy_yz_zz[2]), yy_(xx_xy_xz_yy_yz_zz[3]), yz_(xx_xy_xz_yy_yz_zz[4]), zz_(xx_xy_xz_yy_yz_zz[5]) {}
 
-  constexpr double xx() const noexcept {
+  /// \brief Explicit conversion from a symmetric dyadic tensor of another numeric type, such as widening from single precision to double precision or narrowing from double precision to single precision.
+  template <typename OtherNumber> explicit constexpr BasicSymmetricDyadic(const BasicSymmetricDyadic<OtherNumber>& symmetric_dyadic) noexcept : xx_(static_cast<Number>(symmetric_dyadic.xx())), xy_(static_cast<Number>(symmetric_dyadic.xy())), xz_(static_cast<Number>(symmetric_dyadic.xz())), yy_(static_cast<Number>(symmetric_dyadic.yy())), yz_(static_cast<Number>(symmetric_dyadic.yz())), zz_(static_cast<Number>(symmetric_dyadic.zz())) {}
+
+  constexpr Number xx() const noexcept {
     return xx_;
   }
 
-  constexpr double xy() const noexcept {
+  constexpr Number xy() const noexcept {
     return xy_;
   }
 
-  constexpr double xz() const noexcept {
+  constexpr Number xz() const noexcept {
     return xz_;
   }
 
-  constexpr double yx() const noexcept {
+  constexpr Number yx() const noexcept {
     return xy_;
   }
 
-  constexpr double yy() const noexcept {
+  constexpr Number yy() const noexcept {
     return yy_;
   }
 
-  constexpr double yz() const noexcept {
+  constexpr Number yz() const noexcept {
     return yz_;
   }
 
-  constexpr double zx() const noexcept {
+  constexpr Number zx() const noexcept {
     return xz_;
   }
 
-  constexpr double zy() const noexcept {
+  constexpr Number zy() const noexcept {
     return yz_;
   }
 
-  constexpr double zz() const noexcept {
+  constexpr Number zz() const noexcept {
     return zz_;
   }
 
@@ -62,37 +66,37 @@ public:
     return true;
   }
 
-  constexpr double trace() const noexcept {
+  constexpr Number trace() const noexcept {
     return xx_ + yy_ + zz_;
   }
 
-  constexpr double determinant() const noexcept {
+  constexpr Number determinant() const noexcept {
     return
       xx_ * (yy_ * zz_ - yz_ * yz_) +
       xy_ * (xz_ * yz_ - xy_ * zz_) +
       xz_ * (xy_ * yz_ - xz_ * yy_);
   }
 
-  constexpr SymmetricDyadic transpose() const noexcept {
+  constexpr BasicSymmetricDyadic transpose() const noexcept {
     return *this;
   }
 
-  constexpr SymmetricDyadic cofactors() const noexcept {
-    const double cofactor_xx{yy_ * zz_ - yz_ * yz_};
-    const double cofactor_xy{xz_ * yz_ - xy_ * zz_};
-    const double cofactor_xz{xy_ * yz_ - xz_ * yy_};
-    const double cofactor_yy{xx_ * zz_ - xz_ * xz_};
-    const double cofactor_yz{xy_ * xz_ - xx_ * yz_};
-    const double cofactor_zz{xx_ * yy_ - xy_ * xy_};
+  constexpr BasicSymmetricDyadic cofactors() const noexcept {
+    const Number cofactor_xx{yy_ * zz_ - yz_ * yz_};
+    const Number cofactor_xy{xz_ * yz_ - xy_ * zz_};
+    const Number cofactor_xz{xy_ * yz_ - xz_ * yy_};
+    const Number cofactor_yy{xx_ * zz_ - xz_ * xz_};
+    const Number cofactor_yz{xy_ * xz_ - xx_ * yz_};
+    const Number cofactor_zz{xx_ * yy_ - xy_ * xy_};
     return {cofactor_xx, cofactor_xy, cofactor_xz, cofactor_yy, cofactor_yz, cofactor_zz};
   }
 
-  constexpr SymmetricDyadic adjugate() const noexcept {
+  constexpr BasicSymmetricDyadic adjugate() const noexcept {
     return cofactors().transpose();
   }
 
-  constexpr SymmetricDyadic inverse() const {
-    const double determinant_{determinant()};
+  constexpr BasicSymmetricDyadic inverse() const {
+    const Number determinant_{determinant()};
     if (determinant_ != 0.0) {
       return adjugate() / determinant_;
     } else {
@@ -101,46 +105,94 @@ public:
   }
 
   std::string print() const noexcept {
-    return
-      "(" + PhQ::number_to_string(xx_) + ", " +
-      PhQ::number_to_string(xy_) + ", " +
-      PhQ::number_to_string(xz_) + "; " +
-      PhQ::number_to_string(yy_) + ", " +
-      PhQ::number_to_string(yz_) + "; " +
-      PhQ::number_to_string(zz_) + ")";
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    PhQ::append(output, "(");
+    PhQ::append_number(output, xx_);
+    PhQ::append(output, ", ");
+    PhQ::append_number(output, xy_);
+    PhQ::append(output, ", ");
+    PhQ::append_number(output, xz_);
+    PhQ::append(output, "; ");
+    PhQ::append_number(output, yy_);
+    PhQ::append(output, ", ");
+    PhQ::append_number(output, yz_);
+    PhQ::append(output, "; ");
+    PhQ::append_number(output, zz_);
+    PhQ::append(output, ")");
   }
 
   std::string yaml() const noexcept {
-    return
-      "{xx: " + PhQ::number_to_string(xx_) +
-      " , xy: " + PhQ::number_to_string(xy_) +
-      " , xz: " + PhQ::number_to_string(xz_) +
-      " , yy: " + PhQ::number_to_string(yy_) +
-      " , yz: " + PhQ::number_to_string(yz_) +
-      " , zz: " + PhQ::number_to_string(zz_) + "}";
+    std::string text;
+    yaml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void yaml(Sink& output) const noexcept {
+    PhQ::append(output, "{xx: ");
+    PhQ::append_number(output, xx_);
+    PhQ::append(output, " , xy: ");
+    PhQ::append_number(output, xy_);
+    PhQ::append(output, " , xz: ");
+    PhQ::append_number(output, xz_);
+    PhQ::append(output, " , yy: ");
+    PhQ::append_number(output, yy_);
+    PhQ::append(output, " , yz: ");
+    PhQ::append_number(output, yz_);
+    PhQ::append(output, " , zz: ");
+    PhQ::append_number(output, zz_);
+    PhQ::append(output, "}");
   }
 
   std::string json() const noexcept {
-    return
-      "{\"xx\": " + PhQ::number_to_string(xx_) +
-      " , \"xy\": " + PhQ::number_to_string(xy_) +
-      " , \"xz\": " + PhQ::number_to_string(xz_) +
-      " , \"yy\": " + PhQ::number_to_string(yy_) +
-      " , \"yz\": " + PhQ::number_to_string(yz_) +
-      " , \"zz\": " + PhQ::number_to_string(zz_) + "}";
+    std::string text;
+    json(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void json(Sink& output) const noexcept {
+    PhQ::append(output, "{\"xx\": ");
+    PhQ::append_number(output, xx_);
+    PhQ::append(output, " , \"xy\": ");
+    PhQ::append_number(output, xy_);
+    PhQ::append(output, " , \"xz\": ");
+    PhQ::append_number(output, xz_);
+    PhQ::append(output, " , \"yy\": ");
+    PhQ::append_number(output, yy_);
+    PhQ::append(output, " , \"yz\": ");
+    PhQ::append_number(output, yz_);
+    PhQ::append(output, " , \"zz\": ");
+    PhQ::append_number(output, zz_);
+    PhQ::append(output, "}");
   }
 
   std::string xml() const noexcept {
-    return
-      "<xx>" + PhQ::number_to_string(xx_) +
-      "</xx><xy>" + PhQ::number_to_string(xy_) +
-      "</xy><xz>" + PhQ::number_to_string(xz_) +
-      "</xz><yy>" + PhQ::number_to_string(yy_) +
-      "</yy><yz>" + PhQ::number_to_string(yz_) +
-      "</yz><zz>" + PhQ::number_to_string(zz_) + "</zz>";
-  }
-
-  constexpr bool operator==(const SymmetricDyadic& symmetric_dyadic) const noexcept {
+    std::string text;
+    xml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void xml(Sink& output) const noexcept {
+    PhQ::append(output, "<xx>");
+    PhQ::append_number(output, xx_);
+    PhQ::append(output, "</xx><xy>");
+    PhQ::append_number(output, xy_);
+    PhQ::append(output, "</xy><xz>");
+    PhQ::append_number(output, xz_);
+    PhQ::append(output, "</xz><yy>");
+    PhQ::append_number(output, yy_);
+    PhQ::append(output, "</yy><yz>");
+    PhQ::append_number(output, yz_);
+    PhQ::append(output, "</yz><zz>");
+    PhQ::append_number(output, zz_);
+    PhQ::append(output, "</zz>");
+  }
+
+  constexpr bool operator==(const BasicSymmetricDyadic& symmetric_dyadic) const noexcept {
     return
       xx_ == symmetric_dyadic.xx_ &&
       xy_ == symmetric_dyadic.xy_ &&
@@ -150,7 +202,7 @@ public:
       zz_ == symmetric_dyadic.zz_;
   }
 
-  constexpr bool operator!=(const SymmetricDyadic& symmetric_dyadic) const noexcept {
+  constexpr bool operator!=(const BasicSymmetricDyadic& symmetric_dyadic) const noexcept {
     return
       xx_ != symmetric_dyadic.xx_ ||
       xy_ != symmetric_dyadic.xy_ ||
@@ -160,7 +212,7 @@ public:
       zz_ != symmetric_dyadic.zz_;
   }
 
-  constexpr SymmetricDyadic operator+(const SymmetricDyadic& symmetric_dyadic) const noexcept {
+  constexpr BasicSymmetricDyadic operator+(const BasicSymmetricDyadic& symmetric_dyadic) const noexcept {
     return {
       xx_ + symmetric_dyadic.xx_,
       xy_ + symmetric_dyadic.xy_,
@@ -171,7 +223,7 @@ public:
     };
   }
 
-  constexpr void operator+=(const SymmetricDyadic& symmetric_dyadic) noexcept {
+  constexpr void operator+=(const BasicSymmetricDyadic& symmetric_dyadic) noexcept {
     xx_ += symmetric_dyadic.xx_;
     xy_ += symmetric_dyadic.xy_;
     xz_ += symmetric_dyadic.xz_;
@@ -180,7 +232,7 @@ public:
     zz_ += symmetric_dyadic.zz_;
   }
 
-  constexpr SymmetricDyadic operator-(const SymmetricDyadic& symmetric_dyadic) const noexcept {
+  constexpr BasicSymmetricDyadic operator-(const BasicSymmetricDyadic& symmetric_dyadic) const noexcept {
     return {
       xx_ - symmetric_dyadic.xx_,
       xy_ - symmetric_dyadic.xy_,
@@ -191,7 +243,7 @@ public:
     };
   }
 
-  constexpr void operator-=(const SymmetricDyadic& symmetric_dyadic) noexcept {
+  constexpr void operator-=(const BasicSymmetricDyadic& symmetric_dyadic) noexcept {
     xx_ -= symmetric_dyadic.xx_;
     xy_ -= symmetric_dyadic.xy_;
     xz_ -= symmetric_dyadic.xz_;
@@ -200,11 +252,11 @@ public:
     zz_ -= symmetric_dyadic.zz_;
   }
 
-  constexpr SymmetricDyadic operator*(double real) const noexcept {
+  constexpr BasicSymmetricDyadic operator*(Number real) const noexcept {
     return {xx_ * real, xy_ * real, xz_ * real, yy_ * real, yz_ * real, zz_ * real};
   }
 
-  constexpr Vector operator*(const Vector& vector) const noexcept {
+  constexpr BasicVector<Number> operator*(const BasicVector<Number>& vector) const noexcept {
     return {
       xx_ * vector.x() + xy_ * vector.y() + xz_ * vector.z(),
       xy_ * vector.x() + yy_ * vector.y() + yz_ * vector.z(),
@@ -212,19 +264,19 @@ public:
     };
   }
 
-  constexpr Vector operator*(const Direction& direction) const noexcept {
+  constexpr BasicVector<Number> operator*(const Direction& direction) const noexcept {
     return {
-      xx_ * direction.x() + xy_ * direction.y() + xz_ * direction.z(),
-      xy_ * direction.x() + yy_ * direction.y() + yz_ * direction.z(),
-      xz_ * direction.x() + yz_ * direction.y() + zz_ * direction.z()
+      xx_ * static_cast<Number>(direction.x()) + xy_ * static_cast<Number>(direction.y()) + xz_ * static_cast<Number>(direction.z()),
+      xy_ * static_cast<Number>(direction.x()) + yy_ * static_cast<Number>(direction.y()) + yz_ * static_cast<Number>(direction.z()),
+      xz_ * static_cast<Number>(direction.x()) + yz_ * static_cast<Number>(direction.y()) + zz_ * static_cast<Number>(direction.z())
     };
   }
 
-  constexpr Dyadic operator*(const SymmetricDyadic& symmetric_dyadic) const noexcept;
+  constexpr BasicDyadic<Number> operator*(const BasicSymmetricDyadic& symmetric_dyadic) const noexcept;
 
-  constexpr Dyadic operator*(const Dyadic& dyadic) const noexcept;
+  constexpr BasicDyadic<Number> operator*(const BasicDyadic<Number>& dyadic) const noexcept;
 
-  constexpr void operator*=(double real) noexcept {
+  constexpr void operator*=(Number real) noexcept {
     xx_ *= real;
     xy_ *= real;
     xz_ *= real;
@@ -233,11 +285,11 @@ public:
     zz_ *= real;
   }
 
-  constexpr SymmetricDyadic operator/(double real) const noexcept {
+  constexpr BasicSymmetricDyadic operator/(Number real) const noexcept {
     return {xx_ / real, xy_ / real, xz_ / real, yy_ / real, yz_ / real, zz_ / real};
   }
 
-  constexpr void operator/=(double real) noexcept {
+  constexpr void operator/=(Number real) noexcept {
     xx_ /= real;
     xy_ /= real;
     xz_ /= real;
@@ -248,17 +300,17 @@ public:
 
 protected:
 
-  double xx_;
+  Number xx_;
 
-  double xy_;
+  Number xy_;
 
-  double xz_;
+  Number xz_;
 
-  double yy_;
+  Number yy_;
 
-  double yz_;
+  Number yz_;
 
-  double zz_;
+  Number zz_;
 
 };
 
@@ -288,28 +340,39 @@ template <> constexpr bool sort(const Value::SymmetricDyadic& symmetric_dyadic_1
   }
 }
 
+template <> struct Deserializer<Value::SymmetricDyadic> {
+  static bool read(TextReader& reader, Value::SymmetricDyadic& symmetric_dyadic) noexcept {
+    std::array<double, 6> components;
+    if (!reader.components({"xx", "xy", "xz", "yy", "yz", "zz"}, components)) {
+      return false;
+    }
+    symmetric_dyadic = Value::SymmetricDyadic{components};
+    return true;
+  }
+};
+
 } // namespace PhQ
 
-constexpr PhQ::Value::SymmetricDyadic operator*(double real, const PhQ::Value::SymmetricDyadic& symmetric_dyadic) noexcept {
+template <typename Number> constexpr PhQ::Value::BasicSymmetricDyadic<Number> operator*(PhQ::NonDeduced<Number> real, const PhQ::Value::BasicSymmetricDyadic<Number>& symmetric_dyadic) noexcept {
   return {symmetric_dyadic * real};
 }
 
-std::ostream& operator<<(std::ostream& output_stream, const PhQ::Value::SymmetricDyadic& symmetric_dyadic) noexcept {
-  output_stream << symmetric_dyadic.print();
+template <typename Number> std::ostream& operator<<(std::ostream& output_stream, const PhQ::Value::BasicSymmetricDyadic<Number>& symmetric_dyadic) noexcept {
+  symmetric_dyadic.print(output_stream);
   return output_stream;
 }
 
 namespace std {
 
-template <> struct hash<PhQ::Value::SymmetricDyadic> {
-  size_t operator()(const PhQ::Value::SymmetricDyadic& symmetric_dyadic) const {
+template <typename Number> struct hash<PhQ::Value::BasicSymmetricDyadic<Number>> {
+  size_t operator()(const PhQ::Value::BasicSymmetricDyadic<Number>& symmetric_dyadic) const {
     return
-      hash<double>()(symmetric_dyadic.xx())
-      ^ hash<double>()(symmetric_dyadic.xy())
-      ^ hash<double>()(symmetric_dyadic.xz())
-      ^ hash<double>()(symmetric_dyadic.yy())
-      ^ hash<double>()(symmetric_dyadic.yz())
-      ^ hash<double>()(symmetric_dyadic.zz());
+      hash<Number>()(symmetric_dyadic.xx())
+      ^ hash<Number>()(symmetric_dyadic.xy())
+      ^ hash<Number>()(symmetric_dyadic.xz())
+      ^ hash<Number>()(symmetric_dyadic.yy())
+      ^ hash<Number>()(symmetric_dyadic.yz())
+      ^ hash<Number>()(symmetric_dyadic.zz());
   }
 };
 
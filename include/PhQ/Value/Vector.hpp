@@ -12,55 +12,59 @@ namespace PhQ {
 
 namespace Value {
 
-class Vector {
+/// \brief Three-dimensional Euclidean vector whose components are of a given numeric type, such as float, double, or long double. PhQ::Value::Vector is the double-precision vector used throughout the library.
+template <typename Number> class BasicVector {
 
 public:
 
-  constexpr Vector() noexcept : x_(), y_(), z_() {}
+  constexpr BasicVector() noexcept : x_(), y_(), z_() {}
 
-  constexpr Vector(double x, double y, double z) noexcept : x_(x), y_(y), z_(z) {}
+  constexpr BasicVector(Number x, Number y, Number z) noexcept : x_(x), y_(y), z_(z) {}
 
-  constexpr Vector(const std::array<double, 3>& x_y_z) noexcept : x_(x_y_z[0]), y_(x_y_z[1]), z_(x_y_z[2]) {}
+  constexpr BasicVector(const std::array<Number, 3>& x_y_z) noexcept : x_(x_y_z[0]), y_(x_y_z[1]), z_(x_y_z[2]) {}
 
-  constexpr Vector(double value, const Direction& direction) noexcept : x_(value * direction.x()), y_(value * direction.y()), z_(value * direction.z()) {}
+  /// \brief Explicit conversion from a vector of another numeric type, such as widening a single-precision vector to double precision or narrowing a double-precision vector to single precision.
+  template <typename OtherNumber> explicit constexpr BasicVector(const BasicVector<OtherNumber>& vector) noexcept : x_(static_cast<Number>(vector.x())), y_(static_cast<Number>(vector.y())), z_(static_cast<Number>(vector.z())) {}
 
-  constexpr double x() const noexcept {
+  constexpr BasicVector(Number value, const Direction& direction) noexcept : x_(value * static_cast<Number>(direction.x())), y_(value * static_cast<Number>(direction.y())), z_(value * static_cast<Number>(direction.z())) {}
+
+  constexpr Number x() const noexcept {
     return x_;
   }
 
-  constexpr double y() const noexcept {
+  constexpr Number y() const noexcept {
     return y_;
   }
 
-  constexpr double z() const noexcept {
+  constexpr Number z() const noexcept {
     return z_;
   }
 
-  constexpr double magnitude() const noexcept {
-    return std::sqrt(std::pow(x_, 2) + std::pow(y_, 2) + std::pow(z_, 2));
+  constexpr Number magnitude() const noexcept {
+    return std::sqrt(x_ * x_ + y_ * y_ + z_ * z_);
   }
 
   constexpr Direction direction() const {
-    return {*this};
+    return {x_, y_, z_};
   }
 
-  constexpr double dot(const Direction& direction) const noexcept {
-    return x_ * direction.x() + y_ * direction.y() + z_ * direction.z();
+  constexpr Number dot(const Direction& direction) const noexcept {
+    return x_ * static_cast<Number>(direction.x()) + y_ * static_cast<Number>(direction.y()) + z_ * static_cast<Number>(direction.z());
   }
 
-  constexpr double dot(const Vector& vector) const noexcept {
+  constexpr Number dot(const BasicVector& vector) const noexcept {
     return x_ * vector.x_ + y_ * vector.y_ + z_ * vector.z_;
   }
 
-  constexpr Vector cross(const Direction& direction) const noexcept {
+  constexpr BasicVector cross(const Direction& direction) const noexcept {
     return {
-      y_ * direction.z() - z_ * direction.y(),
-      z_ * direction.x() - x_ * direction.z(),
-      x_ * direction.y() - y_ * direction.x()
+      y_ * static_cast<Number>(direction.z()) - z_ * static_cast<Number>(direction.y()),
+      z_ * static_cast<Number>(direction.x()) - x_ * static_cast<Number>(direction.z()),
+      x_ * static_cast<Number>(direction.y()) - y_ * static_cast<Number>(direction.x())
     };
   }
 
-  constexpr Vector cross(const Vector& vector) const noexcept {
+  constexpr BasicVector cross(const BasicVector& vector) const noexcept {
     return {
       y_ * vector.z_ - z_ * vector.y_,
       z_ * vector.x_ - x_ * vector.z_,
@@ -68,85 +72,121 @@ public:
     };
   }
 
-  constexpr Dyadic dyadic(const Direction& direction) const noexcept;
+  constexpr BasicDyadic<Number> dyadic(const Direction& direction) const noexcept;
 
-  constexpr Dyadic dyadic(const Vector& vector) const noexcept;
+  constexpr BasicDyadic<Number> dyadic(const BasicVector& vector) const noexcept;
 
   constexpr Angle angle(const Direction& direction) const noexcept;
 
-  constexpr Angle angle(const Vector& vector) const noexcept;
+  constexpr Angle angle(const BasicVector& vector) const noexcept;
 
   std::string print() const noexcept {
-    return
-      "(" + PhQ::number_to_string(x_) + ", " +
-      PhQ::number_to_string(y_) + ", " +
-      PhQ::number_to_string(z_) + ")";
+    std::string text;
+    print(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void print(Sink& output) const noexcept {
+    PhQ::append(output, "(");
+    PhQ::append_number(output, x_);
+    PhQ::append(output, ", ");
+    PhQ::append_number(output, y_);
+    PhQ::append(output, ", ");
+    PhQ::append_number(output, z_);
+    PhQ::append(output, ")");
   }
 
   std::string yaml() const noexcept {
-    return
-      "{x:" + PhQ::number_to_string(x_) +
-      " , y:" + PhQ::number_to_string(y_) +
-      " , z:" + PhQ::number_to_string(z_) + "}";
+    std::string text;
+    yaml(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void yaml(Sink& output) const noexcept {
+    PhQ::append(output, "{x:");
+    PhQ::append_number(output, x_);
+    PhQ::append(output, " , y:");
+    PhQ::append_number(output, y_);
+    PhQ::append(output, " , z:");
+    PhQ::append_number(output, z_);
+    PhQ::append(output, "}");
   }
 
   std::string json() const noexcept {
-    return
-      "{\"x\": " + PhQ::number_to_string(x_) +
-      " , \"y\": " + PhQ::number_to_string(y_) +
-      " , \"z\": " + PhQ::number_to_string(z_) + "}";
+    std::string text;
+    json(text);
+    return text;
+  }
+
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void json(Sink& output) const noexcept {
+    PhQ::append(output, "{\"x\": ");
+    PhQ::append_number(output, x_);
+    PhQ::append(output, " , \"y\": ");
+    PhQ::append_number(output, y_);
+    PhQ::append(output, " , \"z\": ");
+    PhQ::append_number(output, z_);
+    PhQ::append(output, "}");
   }
 
   std::string xml() const noexcept {
-    return
-      "<x>" + PhQ::number_to_string(x_) +
-      "</x><y>" + PhQ::number_to_string(y_) +
-      "</y><z>" + PhQ::number_to_string(z_) + "</z>";
+    std::string text;
+    xml(text);
+    return text;
   }
 
-  constexpr bool operator==(const Vector& vector) const noexcept {
+  template <typename Sink, std::enable_if_t<PhQ::is_text_sink<Sink>, bool> = true> void xml(Sink& output) const noexcept {
+    PhQ::append(output, "<x>");
+    PhQ::append_number(output, x_);
+    PhQ::append(output, "</x><y>");
+    PhQ::append_number(output, y_);
+    PhQ::append(output, "</y><z>");
+    PhQ::append_number(output, z_);
+    PhQ::append(output, "</z>");
+  }
+
+  constexpr bool operator==(const BasicVector& vector) const noexcept {
     return x_ == vector.x_ && y_ == vector.y_ && z_ == vector.z_;
   }
 
-  constexpr bool operator!=(const Vector& vector) const noexcept {
+  constexpr bool operator!=(const BasicVector& vector) const noexcept {
     return x_ != vector.x_ || y_ != vector.y_ || z_ != vector.z_;
   }
 
-  constexpr Vector operator+(const Vector& vector) const noexcept {
+  constexpr BasicVector operator+(const BasicVector& vector) const noexcept {
     return {x_ + vector.x_, y_ + vector.y_, z_ + vector.z_};
   }
 
-  constexpr void operator+=(const Vector& vector) noexcept {
+  constexpr void operator+=(const BasicVector& vector) noexcept {
     x_ += vector.x_;
     y_ += vector.y_;
     z_ += vector.z_;
   }
 
-  constexpr Vector operator-(const Vector& vector) const noexcept {
+  constexpr BasicVector operator-(const BasicVector& vector) const noexcept {
     return {x_ - vector.x_, y_ - vector.y_, z_ - vector.z_};
   }
 
-  constexpr void operator-=(const Vector& vector) noexcept {
+  constexpr void operator-=(const BasicVector& vector) noexcept {
     x_ -= vector.x_;
     y_ -= vector.y_;
     z_ -= vector.z_;
   }
 
-  constexpr Vector operator*(double real) const noexcept {
+  constexpr BasicVector operator*(Number real) const noexcept {
     return {x_ * real, y_ * real, z_ * real};
   }
 
-  constexpr void operator*=(double real) noexcept {
+  constexpr void operator*=(Number real) noexcept {
     x_ *= real;
     y_ *= real;
     z_ *= real;
   }
 
-  constexpr Vector operator/(double real) const noexcept {
+  constexpr BasicVector operator/(Number real) const noexcept {
     return {x_ / real, y_ / real, z_ / real};
   }
 
-  constexpr void operator/=(double real) noexcept {
+  constexpr void operator/=(Number real) noexcept {
     x_ /= real;
     y_ /= real;
     z_ /= real;
@@ -154,11 +194,11 @@ public:
 
 protected:
 
-  double x_;
+  Number x_;
 
-  double y_;
+  Number y_;
 
-  double z_;
+  Number z_;
 
 };
 
@@ -190,22 +230,33 @@ constexpr Value::Vector Direction::cross(const Value::Vector& vector) const noex
   };
 }
 
+template <> struct Deserializer<Value::Vector> {
+  static bool read(TextReader& reader, Value::Vector& vector) noexcept {
+    std::array<double, 3> components;
+    if (!reader.components({"x", "y", "z"}, components)) {
+      return false;
+    }
+    vector = Value::Vector{components};
+    return true;
+  }
+};
+
 } // namespace PhQ
 
-constexpr PhQ::Value::Vector operator*(double real, const PhQ::Value::Vector& vector) noexcept {
+template <typename Number> constexpr PhQ::Value::BasicVector<Number> operator*(PhQ::NonDeduced<Number> real, const PhQ::Value::BasicVector<Number>& vector) noexcept {
   return {vector * real};
 }
 
-std::ostream& operator<<(std::ostream& output_stream, const PhQ::Value::Vector& vector) noexcept {
-  output_stream << vector.print();
+template <typename Number> std::ostream& operator<<(std::ostream& output_stream, const PhQ::Value::BasicVector<Number>& vector) noexcept {
+  vector.print(output_stream);
   return output_stream;
 }
 
 namespace std {
 
-template <> struct hash<PhQ::Value::Vector> {
-  size_t operator()(const PhQ::Value::Vector& vector) const {
-    return hash<double>()(vector.x()) ^ hash<double>()(vector.y()) ^ hash<double>()(vector.z());
+template <typename Number> struct hash<PhQ::Value::BasicVector<Number>> {
+  size_t operator()(const PhQ::Value::BasicVector<Number>& vector) const {
+    return hash<Number>()(vector.x()) ^ hash<Number>()(vector.y()) ^ hash<Number>()(vector.z());
   }
 };
 
@@ -14,54 +14,58 @@ namespace PhQ {
 // Forward declaration.
 class Acceleration;
 
-class Velocity : public DimensionalVectorQuantity<Unit::Speed> {
+/// \brief Velocity, whose components are stored as a given number type. PhQ::Velocity is the double-precision velocity used throughout the library; a PhQ::BasicVelocity<float> halves the memory of a large field of velocities. Relations with other physical quantities, such as the product of a velocity and a duration, are defined for PhQ::Velocity.
+template <typename Number> class BasicVelocity : public DimensionalVectorQuantity<Unit::Speed, Number> {
 
 public:
 
-  constexpr Velocity() noexcept : DimensionalVectorQuantity<Unit::Speed>() {}
+  constexpr BasicVelocity() noexcept : DimensionalVectorQuantity<Unit::Speed, Number>() {}
 
-  constexpr Velocity(const Value::Vector& value, Unit::Speed unit) noexcept : DimensionalVectorQuantity<Unit::Speed>(value, unit) {}
+  constexpr BasicVelocity(const Value::BasicVector<Number>& value, Unit::Speed unit) noexcept : DimensionalVectorQuantity<Unit::Speed, Number>(value, unit) {}
 
-  constexpr Velocity(const Speed& speed, const Direction& direction) noexcept : Velocity({speed.value() * direction.x(), speed.value() * direction.y(), speed.value() * direction.z()}) {}
+  /// \brief Explicit conversion from a velocity stored as another number type, such as widening single precision to double precision or narrowing double precision to single precision.
+  template <typename OtherNumber, std::enable_if_t<!std::is_same<OtherNumber, Number>::value, bool> = true> explicit constexpr BasicVelocity(const BasicVelocity<OtherNumber>& velocity) noexcept : BasicVelocity(Value::BasicVector<Number>{velocity.value()}) {}
 
-  constexpr Velocity(const Displacement& displacement, const Duration& duration) noexcept : Velocity(displacement.value() / duration.value()) {}
+  constexpr BasicVelocity(const Speed& speed, const Direction& direction) noexcept : BasicVelocity({speed.value() * direction.x(), speed.value() * direction.y(), speed.value() * direction.z()}) {}
 
-  constexpr Velocity(const Displacement& displacement, const Frequency& frequency) noexcept : Velocity(displacement.value() * frequency.value()) {}
+  constexpr BasicVelocity(const Displacement& displacement, const Duration& duration) noexcept : BasicVelocity(displacement.value() / duration.value()) {}
 
-  constexpr Velocity(const Acceleration& acceleration, const Duration& duration) noexcept;
+  constexpr BasicVelocity(const Displacement& displacement, const Frequency& frequency) noexcept : BasicVelocity(displacement.value() * frequency.value()) {}
 
-  constexpr Velocity(const Acceleration& acceleration, const Frequency& frequency) noexcept;
+  constexpr BasicVelocity(const Acceleration& acceleration, const Duration& duration) noexcept;
+
+  constexpr BasicVelocity(const Acceleration& acceleration, const Frequency& frequency) noexcept;
 
   constexpr Speed magnitude() const noexcept {
     return {*this};
   }
 
-  constexpr Angle angle(const Velocity& velocity) const noexcept {
+  constexpr Angle angle(const BasicVelocity& velocity) const noexcept {
     return {*this, velocity};
   }
 
-  constexpr bool operator==(const Velocity& velocity) const noexcept {
-    return value_ == velocity.value_;
+  constexpr bool operator==(const BasicVelocity& velocity) const noexcept {
+    return this->value_ == velocity.value_;
   }
 
-  constexpr bool operator!=(const Velocity& velocity) const noexcept {
-    return value_ != velocity.value_;
+  constexpr bool operator!=(const BasicVelocity& velocity) const noexcept {
+    return this->value_ != velocity.value_;
   }
 
-  constexpr Velocity operator+(const Velocity& velocity) const noexcept {
-    return {value_ + velocity.value_};
+  constexpr BasicVelocity operator+(const BasicVelocity& velocity) const noexcept {
+    return {this->value_ + velocity.value_};
   }
 
-  constexpr void operator+=(const Velocity& velocity) noexcept {
-    value_ += velocity.value_;
+  constexpr void operator+=(const BasicVelocity& velocity) noexcept {
+    this->value_ += velocity.value_;
   }
 
-  constexpr Velocity operator-(const Velocity& velocity) const noexcept {
-    return {value_ - velocity.value_};
+  constexpr BasicVelocity operator-(const BasicVelocity& velocity) const noexcept {
+    return {this->value_ - velocity.value_};
   }
 
-  constexpr void operator-=(const Velocity& velocity) noexcept {
-    value_ -= velocity.value_;
+  constexpr void operator-=(const BasicVelocity& velocity) noexcept {
+    this->value_ -= velocity.value_;
   }
 
   constexpr Displacement operator*(const Duration& duration) const noexcept {
@@ -78,10 +82,12 @@ public:
 
 protected:
 
-  constexpr Velocity(const Value::Vector& value) noexcept : DimensionalVectorQuantity<Unit::Speed>(value) {}
+  constexpr BasicVelocity(const Value::BasicVector<Number>& value) noexcept : DimensionalVectorQuantity<Unit::Speed, Number>(value) {}
 
 };
 
+using Velocity = BasicVelocity<double>;
+
 template <> constexpr bool sort(const Velocity& velocity_1, const Velocity& velocity_2) noexcept {
   return sort(velocity_1.value(), velocity_2.value());
 }
@@ -120,9 +126,9 @@ constexpr Velocity Displacement::operator/(const Duration& duration) const noexc
 
 namespace std {
 
-template <> struct hash<PhQ::Velocity> {
-  size_t operator()(const PhQ::Velocity& velocity) const {
-    return hash<PhQ::Value::Vector>()(velocity.value());
+template <typename Number> struct hash<PhQ::BasicVelocity<Number>> {
+  size_t operator()(const PhQ::BasicVelocity<Number>& velocity) const {
+    return hash<PhQ::Value::BasicVector<Number>>()(velocity.value());
   }
 };
 
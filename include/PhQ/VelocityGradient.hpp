@@ -57,7 +57,7 @@ template <> constexpr bool sort(const VelocityGradient& velocity_gradient_1, con
   return sort(velocity_gradient_1.value(), velocity_gradient_2.value());
 }
 
-constexpr StrainRate::StrainRate(const VelocityGradient& velocity_gradient) noexcept : StrainRate({value_.xx(), 0.5 * (value_.xy() + value_.yx()), 0.5 * (value_.xz() + value_.zx()), value_.yy(), 0.5 * (value_.yz() + value_.zy()), value_.zz()}) {}
+template <typename Number> constexpr BasicStrainRate<Number>::BasicStrainRate(const VelocityGradient& velocity_gradient) noexcept : BasicStrainRate({velocity_gradient.value().xx(), 0.5 * (velocity_gradient.value().xy() + velocity_gradient.value().yx()), 0.5 * (velocity_gradient.value().xz() + velocity_gradient.value().zx()), velocity_gradient.value().yy(), 0.5 * (velocity_gradient.value().yz() + velocity_gradient.value().zy()), velocity_gradient.value().zz()}) {}
 
 } // namespace PhQ
 
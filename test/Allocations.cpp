@@ -0,0 +1,150 @@
+// Copyright 2020 Alexandre Coderre-Chabot
+// This file is part of Physical Quantities (PhQ), a C++17 header-only library of physical quantities, physical models, and units of measure for scientific computation.
+// Physical Quantities is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+// You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
+
+#include <iostream>
+
+#include "../include/PhQ/Frequency.hpp"
+#include "../include/PhQ/ReynoldsNumber.hpp"
+#include "../include/PhQ/Speed.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/Temperature.hpp"
+#include "../include/PhQ/Velocity.hpp"
+
+std::size_t allocation_count{0};
+
+void* operator new(std::size_t size) {
+  ++allocation_count;
+  void* pointer{std::malloc(size)};
+  if (pointer == nullptr) {
+    throw std::bad_alloc{};
+  }
+  return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t size) noexcept {
+  std::free(pointer);
+}
+
+static_assert(PhQ::convert(1.0, PhQ::Unit::Length::Kilometre, PhQ::Unit::Length::Metre) == 1000.0);
+static_assert(PhQ::convert(0.0, PhQ::Unit::Temperature::Celsius, PhQ::Unit::Temperature::Kelvin) == 273.15);
+static_assert(PhQ::Temperature{0.0, PhQ::Unit::Temperature::Celsius}.value() == 273.15);
+static_assert(PhQ::Temperature{273.15, PhQ::Unit::Temperature::Kelvin}.value(PhQ::Unit::Temperature::Celsius) == 0.0);
+static_assert(noexcept(PhQ::convert(1.0, PhQ::Unit::Pressure::Bar, PhQ::Unit::Pressure::Pascal)));
+
+int main(int argc, char *argv[]) {
+  const std::size_t startup_allocations{allocation_count};
+  std::cout << "Allocations before main: " << startup_allocations << std::endl;
+  if (startup_allocations != 0) {
+    return EXIT_FAILURE;
+  }
+
+  volatile double input{1.5};
+  double sum{0.0};
+
+  const std::size_t initial_allocation_count{allocation_count};
+  for (std::size_t index = 0; index < 1000; ++index) {
+    const PhQ::Temperature temperature{input, PhQ::Unit::Temperature::Fahrenheit};
+    sum += temperature.value(PhQ::Unit::Temperature::Celsius);
+    sum += temperature.value(PhQ::System::FootPoundSecondRankine);
+    const PhQ::Velocity velocity{{input, 2.0 * input, 3.0 * input}, PhQ::Unit::Speed::MilePerSecond};
+    sum += velocity.value(PhQ::Unit::Speed::KilometrePerSecond).x();
+    const PhQ::Stress stress{{input, 0.0, 0.0, input, 0.0, input}, PhQ::Unit::Pressure::PoundPerSquareInch};
+    sum += stress.value(PhQ::Unit::Pressure::Kilopascal).xx();
+    sum += PhQ::convert(input, PhQ::Unit::Length::Foot, PhQ::Unit::Length::Inch);
+  }
+  const std::size_t allocations{allocation_count - initial_allocation_count};
+
+  const std::string_view records{"12.5 km/s\n  300 m/s \n\n-4e2ft/s\n+0.5 mi/sec"};
+  const std::size_t initial_parse_allocation_count{allocation_count};
+  double speed_sum{0.0};
+  std::size_t speed_count{0};
+  const bool parsed{PhQ::parse_quantities<PhQ::Speed>(records, [&](const PhQ::Speed& speed) { speed_sum += speed.value(); ++speed_count; })};
+  const std::optional<PhQ::Temperature> temperature{PhQ::parse_quantity<PhQ::Temperature>("300 K")};
+  const std::optional<PhQ::ReynoldsNumber> reynolds_number{PhQ::parse_quantity<PhQ::ReynoldsNumber>(" 2300 ")};
+  const std::size_t parse_allocations{allocation_count - initial_parse_allocation_count};
+
+  std::cout << "Parsed speeds: " << speed_count << ", sum: " << PhQ::number_to_string(speed_sum) << " m/s" << std::endl;
+  std::cout << "Parse allocations: " << parse_allocations << std::endl;
+  if (!parsed || speed_count != 4 || std::abs(speed_sum - (12500.0 + 300.0 - 400.0 * 0.3048 + 0.5 * 1609.344)) > 1.0e-9 || parse_allocations != 0) {
+    return EXIT_FAILURE;
+  }
+  if (!temperature.has_value() || temperature.value().value() != 300.0 || !reynolds_number.has_value() || reynolds_number.value().value() != 2300.0) {
+    return EXIT_FAILURE;
+  }
+  for (const std::string_view malformed : {"", "km/s", "12.5", "12.5 km/", "12.5 km/s extra", "inf m/s", "+-1 m/s", "1e999 m/s", "5 2·m/s", "1 000·m/s", "2 .5·m/s", "5 1/2·m/s", "5 1/0.5·m/s", "5 1/(2·s)·m"}) {
+    if (PhQ::parse_quantity<PhQ::Speed>(malformed).has_value()) {
+      std::cout << "Malformed text was parsed: \"" << malformed << "\"" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  const std::optional<PhQ::Speed> compound_speed{PhQ::parse_quantity<PhQ::Speed>("36 km·hr^-1")};
+  if (!compound_speed.has_value() || std::abs(compound_speed.value().value() - 10.0) > 1.0e-12) {
+    std::cout << "Unit expression was not parsed: \"36 km·hr^-1\"" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::optional<PhQ::Frequency> reciprocal_frequency{PhQ::parse_quantity<PhQ::Frequency>("60 1/min")};
+  if (!reciprocal_frequency.has_value() || std::abs(reciprocal_frequency.value().value() - 1.0) > 1.0e-12) {
+    std::cout << "Reciprocal unit was not parsed: \"60 1/min\"" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::array<char, PhQ::number_to_chars_buffer_size> buffer;
+  const std::size_t initial_format_allocation_count{allocation_count};
+  const std::string_view banded{buffer.data(), static_cast<std::size_t>(PhQ::number_to_chars(buffer.data(), buffer.data() + buffer.size(), -123.456789).ptr - buffer.data())};
+  const bool banded_matches{banded == "-123.4568"};
+  const std::string_view shortest{buffer.data(), static_cast<std::size_t>(PhQ::number_to_chars(buffer.data(), buffer.data() + buffer.size(), 0.1, true).ptr - buffer.data())};
+  const bool shortest_matches{shortest == "0.1"};
+  const std::size_t format_allocations{allocation_count - initial_format_allocation_count};
+  std::cout << "Format allocations: " << format_allocations << std::endl;
+  if (!banded_matches || !shortest_matches || format_allocations != 0) {
+    return EXIT_FAILURE;
+  }
+  if (PhQ::number_to_string(12345.678) != "1.234568e+04" || PhQ::number_to_string(0.0) != "0" || PhQ::number_to_string(1.0 / 3.0, true) != "0.3333333333333333") {
+    return EXIT_FAILURE;
+  }
+
+  const PhQ::Stress serialized_stress{{1.5, -2.25, 3.0e5, 1.0e-4, 5.0, 6.0}, PhQ::Unit::Pressure::PoundPerSquareInch};
+  const std::string expected_json{serialized_stress.json(PhQ::Unit::Pressure::Kilopascal)};
+  std::string reused_text;
+  reused_text.reserve(4096);
+  std::array<char, 4096> characters;
+  PhQ::TextBuffer text_buffer{characters};
+  const std::size_t initial_serialize_allocation_count{allocation_count};
+  bool serialized_matches{true};
+  for (std::size_t index = 0; index < 10; ++index) {
+    reused_text.clear();
+    text_buffer.clear();
+    serialized_stress.json(reused_text, PhQ::Unit::Pressure::Kilopascal);
+    serialized_stress.json(text_buffer, PhQ::Unit::Pressure::Kilopascal);
+    serialized_matches = serialized_matches && reused_text == expected_json && text_buffer.view() == expected_json;
+  }
+  const std::size_t serialize_allocations{allocation_count - initial_serialize_allocation_count};
+  std::cout << "Serialize allocations: " << serialize_allocations << std::endl;
+  if (!serialized_matches || serialize_allocations != 0) {
+    return EXIT_FAILURE;
+  }
+  std::array<char, 8> small_characters;
+  PhQ::TextBuffer small_text_buffer{small_characters};
+  serialized_stress.print(small_text_buffer);
+  if (!small_text_buffer.truncated() || small_text_buffer.view() != serialized_stress.print().substr(0, 8)) {
+    return EXIT_FAILURE;
+  }
+
+  std::vector<PhQ::Speed> speeds;
+  if (PhQ::parse_quantities<PhQ::Speed>("1 m/s;2 m/s;x m/s;4 m/s", speeds, ';') || speeds.size() != 2) {
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Sum: " << PhQ::number_to_string(sum) << std::endl;
+  std::cout << "Allocations: " << allocations << std::endl;
+  if (allocations != 0) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
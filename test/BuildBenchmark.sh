@@ -0,0 +1,44 @@
+#!/usr/bin/env bash
+# Copyright 2020 Alexandre Coderre-Chabot
+# This file is part of Physical Quantities (PhQ), a C++17 header-only library of physical quantities, physical models, and units of measure for scientific computation.
+# Physical Quantities is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+# Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+# You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
+
+# Compares the build time and the binary sizes of the testing executables between two revisions of the library.
+# Each revision is checked out into a temporary worktree, configured with testing enabled, and built from scratch on a single job so that the timings are comparable.
+# Usage, from anywhere in the repository: test/BuildBenchmark.sh [base revision] [head revision]
+# The revisions default to HEAD~1 and HEAD.
+
+set -euo pipefail
+
+base="${1:-HEAD~1}"
+head="${2:-HEAD}"
+repository="$(git rev-parse --show-toplevel)"
+workspace="$(mktemp -d)"
+trap 'git -C "${repository}" worktree remove --force "${workspace}/base" >/dev/null 2>&1 || true; git -C "${repository}" worktree remove --force "${workspace}/head" >/dev/null 2>&1 || true; rm -rf "${workspace}"' EXIT
+
+# Builds a revision in a given directory and prints its build time in seconds.
+build() {
+  local revision="$1"
+  local directory="$2"
+  git -C "${repository}" worktree add --detach --quiet "${directory}" "${revision}"
+  cmake -S "${directory}" -B "${directory}/build" -DBUILD_TESTING=ON >/dev/null
+  local start end
+  start="$(date +%s%N)"
+  cmake --build "${directory}/build" -j1 >/dev/null
+  end="$(date +%s%N)"
+  awk -v nanoseconds="$((end - start))" 'BEGIN { printf "%.1f", nanoseconds / 1e9 }'
+}
+
+base_time="$(build "${base}" "${workspace}/base")"
+head_time="$(build "${head}" "${workspace}/head")"
+
+printf "%-28s %14s %14s\n" "" "$(git -C "${repository}" rev-parse --short "${base}")" "$(git -C "${repository}" rev-parse --short "${head}")"
+printf "%-28s %13ss %13ss\n" "build time" "${base_time}" "${head_time}"
+for binary in "${workspace}/head/build/bin/"*; do
+  name="$(basename "${binary}")"
+  if [ -f "${workspace}/base/build/bin/${name}" ]; then
+    printf "%-28s %12d B %12d B\n" "${name}" "$(stat -c %s "${workspace}/base/build/bin/${name}")" "$(stat -c %s "${binary}")"
+  fi
+done
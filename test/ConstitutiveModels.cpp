@@ -4,6 +4,8 @@
 // Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
 // You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
 
+#include <iostream>
+
 #include "../include/PhQ/ConstitutiveModel/CompressibleNewtonianFluid.hpp"
 #include "../include/PhQ/ConstitutiveModel/ElasticIsotropicSolid.hpp"
 #include "../include/PhQ/ConstitutiveModel/IncompressibleNewtonianFluid.hpp"
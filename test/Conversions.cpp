@@ -4,6 +4,8 @@
 // Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
 // You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
 
+#include <iostream>
+
 #include "../include/PhQ/Unit/Acceleration.hpp"
 #include "../include/PhQ/Unit/Angle.hpp"
 #include "../include/PhQ/Unit/AngularAcceleration.hpp"
@@ -13,6 +15,7 @@
 #include "../include/PhQ/Unit/DynamicViscosity.hpp"
 #include "../include/PhQ/Unit/Energy.hpp"
 #include "../include/PhQ/Unit/EnergyFlux.hpp"
+#include "../include/PhQ/Unit/Expression.hpp"
 #include "../include/PhQ/Unit/Force.hpp"
 #include "../include/PhQ/Unit/Frequency.hpp"
 #include "../include/PhQ/Unit/HeatCapacity.hpp"
@@ -39,12 +42,67 @@
 
 const std::string test_separator{"----------------------------------------"};
 
+static_assert(std::is_trivially_copyable<PhQ::ConversionPlan<PhQ::Unit::Length>>::value);
+
+static_assert(PhQ::base_unit_exponent<PhQ::Unit::Pressure, PhQ::Unit::Length>() == -1);
+static_assert(PhQ::base_unit_exponent<PhQ::Unit::Pressure, PhQ::Unit::Time>() == -2);
+static_assert(PhQ::base_unit_exponent<PhQ::Unit::AngularSpeed, PhQ::Unit::Angle>() == 1);
+static_assert(PhQ::derived_conversion_factor<PhQ::Unit::Area>(PhQ::Unit::Length::Kilometre).scale() == 1000000.0);
+static_assert(PhQ::derived_conversion_factor<PhQ::Unit::Frequency>(PhQ::Unit::Time::Minute).scale() == 1.0 / 60.0);
+
+static_assert(PhQ::unit<PhQ::Unit::Pressure>(PhQ::System::InchPoundSecondRankine) == PhQ::Unit::Pressure::PoundPerSquareInch);
+static_assert(PhQ::system(PhQ::Unit::Length::Millimetre) == PhQ::System::MillimetreGramSecondKelvin);
+static_assert(!PhQ::system(PhQ::Unit::Length::Mile).has_value());
+static_assert(PhQ::abbreviations<PhQ::Unit::Speed>[static_cast<std::size_t>(PhQ::Unit::Speed::FootPerSecond)].second == "ft/s");
+static_assert(PhQ::abbreviation(PhQ::Unit::Pressure::PoundPerSquareInch) == "lbf/in^2");
+static_assert(PhQ::parse<PhQ::Unit::Speed>("km/s") == PhQ::Unit::Speed::KilometrePerSecond);
+static_assert(!PhQ::parse<PhQ::Unit::Speed>("KM/S").has_value());
+static_assert(PhQ::parse_case_insensitive<PhQ::Unit::Speed>("KM/S") == PhQ::Unit::Speed::KilometrePerSecond);
+static_assert(PhQ::parse_case_insensitive<PhQ::Unit::Memory>("Mb") == PhQ::Unit::Memory::Megabit);
+static_assert(PhQ::parse_case_insensitive<PhQ::Unit::Memory>("MB") == PhQ::Unit::Memory::Megabyte);
+static_assert(!PhQ::parse_case_insensitive<PhQ::Unit::Memory>("mb").has_value());
+static_assert(!PhQ::parse_case_insensitive<PhQ::Unit::Power>("mw").has_value());
+static_assert(PhQ::parse_case_insensitive<PhQ::Unit::Power>("KW") == PhQ::Unit::Power::Kilowatt);
+static_assert(PhQ::parse<PhQ::System>("ft·lbf·s·°R") == PhQ::System::FootPoundSecondRankine);
+static_assert(!PhQ::parse<PhQ::Unit::Length>("").has_value());
+
 template <typename Unit> void test_conversions(const std::string& name, double value, const std::set<Unit>& units) {
   std::cout << test_separator << std::endl;
   std::cout << name << ":" << std::endl;
+  for (const std::pair<std::string_view, Unit>& spelling : PhQ::spellings<Unit>) {
+    if (PhQ::parse<Unit>(spelling.first) != spelling.second && std::find_if(PhQ::spellings<Unit>.cbegin(), PhQ::spellings<Unit>.cend(), [&spelling](const std::pair<std::string_view, Unit>& other) { return other.first == spelling.first; })->second == spelling.second) {
+      std::cerr << "The spelling " << spelling.first << " does not parse to its unit." << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+  }
   for (const Unit& unit1 : units) {
+    if (PhQ::abbreviations<Unit>[static_cast<std::size_t>(unit1)].first != unit1 || PhQ::parse<Unit>(PhQ::abbreviation(unit1)) != unit1 || PhQ::parse_case_insensitive<Unit>(PhQ::abbreviation(unit1)) != unit1) {
+      std::cerr << "The abbreviation " << PhQ::abbreviation(unit1) << " is not listed in the order of its enumeration or does not parse back to its unit." << std::endl;
+      std::exit(EXIT_FAILURE);
+    }
     for (const Unit& unit2 : units) {
       std::cout << PhQ::number_to_string(value) << " " << PhQ::abbreviation(unit1) << " = " << PhQ::number_to_string(PhQ::convert(value, unit1, unit2)) << " " << PhQ::abbreviation(unit2) << std::endl;
+      const double round_trip{PhQ::convert(PhQ::convert(value, unit1, unit2), unit2, unit1)};
+      if (std::abs(round_trip - value) > 1.0e-12 * std::abs(value)) {
+        std::cerr << "Round trip from " << PhQ::abbreviation(unit1) << " to " << PhQ::abbreviation(unit2) << " returned " << PhQ::number_to_string(round_trip) << " instead of " << PhQ::number_to_string(value) << "." << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      const std::array<double, 3> old_values{value, 2.0 * value, -value};
+      std::array<double, 3> new_values;
+      PhQ::convert(old_values.data(), new_values.data(), old_values.size(), unit1, unit2);
+      std::array<double, 3> in_place_values{old_values};
+      PhQ::convert_in_place(in_place_values.data(), in_place_values.size(), unit1, unit2);
+      const PhQ::ConversionPlan<Unit> plan{unit1, unit2};
+      std::array<double, 3> plan_values;
+      plan(old_values.data(), plan_values.data(), old_values.size());
+      for (std::size_t index = 0; index < old_values.size(); ++index) {
+        const double expected{PhQ::convert(old_values[index], unit1, unit2)};
+        const double tolerance{1.0e-15 * std::abs(expected)};
+        if (std::abs(new_values[index] - expected) > tolerance || std::abs(in_place_values[index] - expected) > tolerance || std::abs(plan_values[index] - expected) > tolerance || std::abs(plan(old_values[index]) - expected) > tolerance) {
+          std::cerr << "Bulk conversion from " << PhQ::abbreviation(unit1) << " to " << PhQ::abbreviation(unit2) << " differs from scalar conversion." << std::endl;
+          std::exit(EXIT_FAILURE);
+        }
+      }
     }
   }
 }
@@ -443,6 +501,85 @@ void test_volume_rate() noexcept {
   });
 }
 
+/// \brief Print the description of a check that failed and record the failure.
+void check(bool& passed, bool condition, std::string_view description) noexcept {
+  if (!condition) {
+    std::cerr << "Failed: " << description << std::endl;
+    passed = false;
+  }
+}
+
+/// \brief Resolve a unit expression for a unit type and check the converted value of 1 in that expression against an expected value in the standard unit.
+template <typename Unit> void check_unit_expression(bool& passed, std::string_view expression, std::optional<double> expected) noexcept {
+  const std::optional<PhQ::ConversionFactor> factor{PhQ::resolve_unit<Unit>(expression)};
+  std::cout << expression << " = ";
+  if (factor.has_value()) {
+    std::cout << PhQ::number_to_string(factor.value()(1.0)) << " " << PhQ::abbreviation(PhQ::standard_unit<Unit>) << std::endl;
+  } else {
+    std::cout << "(rejected)" << std::endl;
+  }
+  check(passed, factor.has_value() == expected.has_value() && (!expected.has_value() || std::abs(factor.value()(1.0) - expected.value()) <= 1.0e-12 * std::abs(expected.value())), expression);
+}
+
+bool test_unit_expressions() noexcept {
+  std::cout << test_separator << std::endl;
+  std::cout << "Unit Expressions:" << std::endl;
+  bool passed{true};
+  check_unit_expression<PhQ::Unit::Force>(passed, "kg·m/s^2", 1.0);
+  check_unit_expression<PhQ::Unit::Force>(passed, "g * cm / s²", 1.0e-5);
+  check_unit_expression<PhQ::Unit::Pressure>(passed, "lbf/in^2", 0.45359237 * 9.80665 / (0.0254 * 0.0254));
+  check_unit_expression<PhQ::Unit::Pressure>(passed, "lbf/ft^2", 0.45359237 * 9.80665 / (0.3048 * 0.3048));
+  check_unit_expression<PhQ::Unit::Pressure>(passed, "kN/mm^2", 1.0e9);
+  check_unit_expression<PhQ::Unit::ThermalConductivity>(passed, "W/(m·K)", 1.0);
+  check_unit_expression<PhQ::Unit::ThermalConductivity>(passed, "W/(m·°C)", 1.0);
+  check_unit_expression<PhQ::Unit::SpecificHeatCapacity>(passed, "J/(lb·°F)", 1.8 / 0.45359237);
+  check_unit_expression<PhQ::Unit::SpecificEnergy>(passed, "m^2·s^(-2)", 1.0);
+  check_unit_expression<PhQ::Unit::Speed>(passed, "km/hr", 1000.0 / 3600.0);
+  check_unit_expression<PhQ::Unit::Frequency>(passed, "1/min", 1.0 / 60.0);
+  check_unit_expression<PhQ::Unit::Temperature>(passed, "°C", 274.15);
+  check_unit_expression<PhQ::Unit::Pressure>(passed, "m/s", std::nullopt);
+  check_unit_expression<PhQ::Unit::Length>(passed, "furlong", std::nullopt);
+  check_unit_expression<PhQ::Unit::Force>(passed, "kg·m/s^", std::nullopt);
+  check_unit_expression<PhQ::Unit::Force>(passed, "(kg·m/s^2", std::nullopt);
+
+  constexpr std::size_t count{1000000};
+  const std::size_t initial_cache_size{PhQ::unit_expression_cache().size()};
+  const std::chrono::high_resolution_clock::time_point start{std::chrono::high_resolution_clock::now()};
+  double sum{0.0};
+  for (std::size_t index = 0; index < count; ++index) {
+    sum += PhQ::resolve_unit<PhQ::Unit::Pressure>("N/mm²").value_or(PhQ::ConversionFactor{0.0})(1.0e-6);
+  }
+  const auto duration{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start)};
+  std::cout << "Resolved " << count << " repeated unit expressions in " << duration.count() << " microseconds, caching " << PhQ::unit_expression_cache().size() - initial_cache_size << " new expressions." << std::endl;
+  check(passed, std::abs(sum - static_cast<double>(count)) < 1.0e-6 * static_cast<double>(count) && PhQ::unit_expression_cache().size() - initial_cache_size == 1, "repeated unit expression resolved once");
+
+  constexpr std::size_t distinct_count{10000};
+  std::size_t maximum_cache_size{0};
+  std::size_t maximum_interned_size{0};
+  for (std::size_t index = 0; index < distinct_count; ++index) {
+    const std::string expression{std::to_string(index + 1) + "·m"};
+    const std::optional<PhQ::ResolvedUnit> resolved{PhQ::resolve_unit_expression(expression)};
+    check(passed, resolved.has_value() && resolved.value().factor().scale() == static_cast<double>(index + 1) && resolved.value().abbreviation() == expression, expression);
+    const PhQ::ResolvedUnit* const interned{PhQ::find_unit_expression(expression)};
+    check(passed, interned == nullptr ? index >= PhQ::UnitExpressionCache::intern_capacity : interned->factor().scale() == static_cast<double>(index + 1), "interned " + expression);
+    maximum_cache_size = std::max(maximum_cache_size, PhQ::unit_expression_cache().size());
+    maximum_interned_size = std::max(maximum_interned_size, PhQ::unit_expression_cache().interned_size());
+  }
+  std::cout << "Resolved " << distinct_count << " distinct unit expressions, caching at most " << maximum_cache_size << " expressions and interning at most " << maximum_interned_size << " units." << std::endl;
+  check(passed, maximum_cache_size <= PhQ::UnitExpressionCache::capacity && maximum_interned_size <= PhQ::UnitExpressionCache::intern_capacity, "bounds of the unit expression cache");
+  return passed;
+}
+
+/// \brief Check that the deprecated map of conversion functions still converts as PhQ::convert does.
+bool test_deprecated_conversions() noexcept {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+  std::vector<double> values{1.0, 2.5};
+  PhQ::conversions<PhQ::Unit::Length>.at(PhQ::Unit::Length::Foot).at(PhQ::Unit::Length::Inch)(values);
+#pragma GCC diagnostic pop
+  return values[0] == PhQ::convert(1.0, PhQ::Unit::Length::Foot, PhQ::Unit::Length::Inch) && values[1] == PhQ::convert(2.5, PhQ::Unit::Length::Foot, PhQ::Unit::Length::Inch);
+}
+
 int main(int argc, char *argv[]) {
   test_acceleration();
   test_angle();
@@ -476,6 +613,7 @@ int main(int argc, char *argv[]) {
   test_time();
   test_volume();
   test_volume_rate();
+  const bool unit_expressions_passed{test_unit_expressions()};
   std::cout << test_separator << std::endl;
-  return EXIT_SUCCESS;
+  return unit_expressions_passed && test_deprecated_conversions() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -4,8 +4,20 @@
 // Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
 // You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
 
+#include <iostream>
+
 #include "../include/PhQ/Dimension/Set.hpp"
 
+static_assert(sizeof(PhQ::Dimension::Set) == sizeof(uint_least64_t));
+static_assert(PhQ::Dimension::Set{{1}, {0}, {-1}} * PhQ::Dimension::Set{{0}, {0}, {-1}} == PhQ::Dimension::Set{{1}, {0}, {-2}});
+static_assert(PhQ::Dimension::Set{{1}, {1}, {-2}} / PhQ::Dimension::Set{{2}} == PhQ::Dimension::Set{{-1}, {1}, {-2}});
+static_assert(PhQ::Dimension::Set{{-128}, {127}}.length().value() == -128 && PhQ::Dimension::Set{{-128}, {127}}.mass().value() == 127);
+static_assert(PhQ::Dimension::Set{{-1}, {5}} < PhQ::Dimension::Set{{0}, {-5}});
+static_assert(sizeof(PhQ::Dimension::Length) == sizeof(int_least8_t) && !std::is_polymorphic<PhQ::Dimension::Length>::value);
+static_assert(PhQ::Dimension::Set{}.time().abbreviation() == "T" && PhQ::Dimension::Set{}.time().label() == "time");
+static_assert(PhQ::Dimension::Set{{0}, {0}, {-3}} < PhQ::Dimension::Set{{0}, {0}, {-2}});
+static_assert(PhQ::Dimension::Set::from_packed(PhQ::Dimension::Set{{2}, {-1}}.packed()) == PhQ::Dimension::Set{{2}, {-1}});
+
 int main(int argc, char *argv[]) {
 
   PhQ::Dimension::Set dimension_set_1;
@@ -26,5 +38,11 @@ int main(int argc, char *argv[]) {
   std::cout << "- JSON: " << dimension_set_3.json() << std::endl;
   std::cout << "- XML: " << dimension_set_3.xml() << std::endl;
 
+  const PhQ::Dimension::Set dimension_set_4{dimension_set_2 * dimension_set_3 / dimension_set_2};
+  std::cout << "Dimension Set 2 * Dimension Set 3 / Dimension Set 2: " << dimension_set_4 << std::endl;
+  if (dimension_set_4 != dimension_set_3 || std::hash<PhQ::Dimension::Set>()(dimension_set_4) != std::hash<PhQ::Dimension::Set>()(dimension_set_3)) {
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
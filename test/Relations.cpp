@@ -4,12 +4,16 @@
 // Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
 // You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
 
+#include <iostream>
+
 #include "../include/PhQ/Acceleration.hpp"
 #include "../include/PhQ/AngularSpeed.hpp"
 #include "../include/PhQ/AreaVector.hpp"
 #include "../include/PhQ/BulkDynamicViscosity.hpp"
 #include "../include/PhQ/DisplacementGradient.hpp"
 #include "../include/PhQ/DynamicViscosity.hpp"
+#include "../include/PhQ/ForceMagnitude.hpp"
+#include "../include/PhQ/Frequency.hpp"
 #include "../include/PhQ/HeatFlux.hpp"
 #include "../include/PhQ/IsentropicBulkModulus.hpp"
 #include "../include/PhQ/IsothermalBulkModulus.hpp"
@@ -20,6 +24,7 @@
 #include "../include/PhQ/PoissonRatio.hpp"
 #include "../include/PhQ/Position.hpp"
 #include "../include/PhQ/PrandtlNumber.hpp"
+#include "../include/PhQ/Power.hpp"
 #include "../include/PhQ/PWaveModulus.hpp"
 #include "../include/PhQ/ReynoldsNumber.hpp"
 #include "../include/PhQ/ShearModulus.hpp"
@@ -27,17 +32,489 @@
 #include "../include/PhQ/SpecificPower.hpp"
 #include "../include/PhQ/StrainRate.hpp"
 #include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/Temperature.hpp"
 #include "../include/PhQ/TemperatureGradient.hpp"
 #include "../include/PhQ/ThermalConductivity.hpp"
 #include "../include/PhQ/ThermalDiffusivity.hpp"
 #include "../include/PhQ/TotalKinematicPressure.hpp"
 #include "../include/PhQ/Traction.hpp"
+#include "../include/PhQ/Velocity.hpp"
 #include "../include/PhQ/VelocityGradient.hpp"
 #include "../include/PhQ/VolumeRate.hpp"
 #include "../include/PhQ/VolumetricThermalExpansionCoefficient.hpp"
 #include "../include/PhQ/YoungModulus.hpp"
+#include "../include/PhQ/Quantity/Array.hpp"
+#include "../include/PhQ/Quantity/Dynamic.hpp"
+#include "../include/PhQ/Quantity/Lazy.hpp"
+#include "../include/PhQ/Quantity/View.hpp"
+
+static_assert(PhQ::convert<PhQ::Unit::Length::Kilometre, PhQ::Unit::Length::Metre>(1.5) == 1500.0);
+static_assert(PhQ::convert<PhQ::Unit::Temperature::Celsius, PhQ::Unit::Temperature::Kelvin>(0.0) == 273.15);
+static_assert(PhQ::make<PhQ::StaticPressure, PhQ::Unit::Pressure::Kilopascal>(101.325).value() == 101325.0);
+static_assert(PhQ::make<PhQ::Velocity, PhQ::Unit::Speed::KilometrePerSecond>(PhQ::Value::Vector{1.0, 2.0, 3.0}).value().z() == 3000.0);
+
+template <typename Quantity, std::size_t Size> constexpr bool is_packed() noexcept {
+  return sizeof(Quantity) == Size * sizeof(double) && std::is_standard_layout<Quantity>::value && std::is_trivially_copyable<Quantity>::value;
+}
+
+static_assert(is_packed<PhQ::Length, 1>());
+static_assert(is_packed<PhQ::Temperature, 1>());
+static_assert(is_packed<PhQ::DynamicViscosity, 1>());
+static_assert(is_packed<PhQ::ReynoldsNumber, 1>());
+static_assert(is_packed<PhQ::Position, 3>());
+static_assert(is_packed<PhQ::Velocity, 3>());
+static_assert(is_packed<PhQ::HeatFlux, 3>());
+static_assert(is_packed<PhQ::Stress, 6>());
+static_assert(is_packed<PhQ::StrainRate, 6>());
+static_assert(is_packed<PhQ::Strain, 6>());
+static_assert(is_packed<PhQ::VelocityGradient, 9>());
+static_assert(is_packed<PhQ::DisplacementGradient, 9>());
+static_assert(is_packed<PhQ::GenericScalarQuantity<(PhQ::dimension<PhQ::Unit::Mass> * PhQ::dimension<PhQ::Unit::Speed>).packed()>, 1>());
+
+static_assert(std::is_same<decltype(PhQ::Length{} * PhQ::Length{}), PhQ::Area>::value);
+static_assert(std::is_same<decltype(PhQ::Length{} / PhQ::Length{}), double>::value);
+static_assert(PhQ::ForceMagnitude{PhQ::MassRate{2.0, PhQ::Unit::MassRate::KilogramPerSecond} * PhQ::Speed{300.0, PhQ::Unit::Speed::MetrePerSecond}}.value() == 600.0);
+static_assert(std::is_convertible<decltype(PhQ::MassRate{} * PhQ::Speed{}), PhQ::ForceMagnitude>::value);
+static_assert(!std::is_convertible<decltype(PhQ::AngularSpeed{} * PhQ::Length{} / PhQ::Length{}), PhQ::Frequency>::value && !std::is_convertible<PhQ::GenericScalarQuantity<PhQ::dimension<PhQ::Unit::Temperature>.packed()>, PhQ::Temperature>::value);
+static_assert(PhQ::Frequency{PhQ::GenericScalarQuantity<PhQ::dimension<PhQ::Unit::Frequency>.packed()>{2.0}}.value() == 2.0);
+static_assert(PhQ::DynamicViscosity{PhQ::Mass{6.0, PhQ::Unit::Mass::Kilogram} / (PhQ::Length{2.0, PhQ::Unit::Length::Metre} * PhQ::Duration{3.0, PhQ::Unit::Time::Second})}.value() == 1.0);
+static_assert(PhQ::Force{PhQ::MassRate{2.0, PhQ::Unit::MassRate::KilogramPerSecond} * PhQ::Velocity{{300.0, 0.0, -30.0}, PhQ::Unit::Speed::MetrePerSecond}}.value() == PhQ::Value::Vector{600.0, 0.0, -60.0});
+static_assert(PhQ::Acceleration{PhQ::VelocityGradient{{1.0, 0.0, 0.0, 0.0, 2.0, 0.0, 0.0, 0.0, 4.0}, PhQ::Unit::Frequency::Hertz} * PhQ::Velocity{{3.0, 3.0, 3.0}, PhQ::Unit::Speed::MetrePerSecond}}.value() == PhQ::Value::Vector{3.0, 6.0, 12.0});
+static_assert(PhQ::Stress{PhQ::Stress{{4.0, 0.0, 0.0, 8.0, 0.0, 2.0}, PhQ::Unit::Pressure::Pascal} / PhQ::Length{2.0, PhQ::Unit::Length::Metre} * PhQ::Length{2.0, PhQ::Unit::Length::Metre}}.value() == PhQ::Value::SymmetricDyadic{4.0, 0.0, 0.0, 8.0, 0.0, 2.0});
+static_assert(std::is_same<decltype(PhQ::Stress{} / PhQ::Length{}), PhQ::GenericSymmetricDyadicQuantity<(PhQ::dimension<PhQ::Unit::Pressure> / PhQ::dimension<PhQ::Unit::Length>).packed()>>::value);
+static_assert(std::is_same<decltype(PhQ::Velocity{} / PhQ::Speed{}), PhQ::Value::Vector>::value);
+static_assert(std::is_same<decltype(PhQ::Velocity{} * PhQ::Duration{}), PhQ::Displacement>::value);
+static_assert(sizeof(PhQ::Value::BasicVector<float>) == 3 * sizeof(float));
+static_assert(sizeof(PhQ::Value::BasicDyadic<float>) == 9 * sizeof(float));
+static_assert(PhQ::Value::BasicVector<float>{PhQ::Value::Vector{0.1, 0.2, 0.3}}.y() == 0.2f);
+static_assert(PhQ::convert<PhQ::Unit::Length::Kilometre, PhQ::Unit::Length::Metre>(1.5f) == 1500.0f);
+static_assert(std::is_same<decltype(PhQ::convert<PhQ::Unit::Length::Kilometre, PhQ::Unit::Length::Metre>(1.5f)), float>::value);
+static_assert(std::is_same<decltype(2.0 * PhQ::Value::BasicSymmetricDyadic<float>{}), PhQ::Value::BasicSymmetricDyadic<float>>::value);
+static_assert(std::is_same<decltype((PhQ::lazy(PhQ::Acceleration{}) + PhQ::Acceleration{}) * PhQ::Duration{}), PhQ::LazyScale<PhQ::LazySum<PhQ::LazyValue<PhQ::Acceleration>, PhQ::LazyValue<PhQ::Acceleration>, false>, PhQ::Duration, false>>::value);
+static_assert(std::is_same<decltype(PhQ::lazy(PhQ::Velocity{}) + PhQ::Duration{} * PhQ::lazy(PhQ::Acceleration{}))::Type, PhQ::Velocity>::value);
+static_assert((PhQ::lazy(PhQ::Value::Vector{1.0, 2.0, 3.0}) * 2.0 - PhQ::Value::Vector{0.5, 0.5, 0.5}).evaluate() == PhQ::Value::Vector{1.5, 3.5, 5.5});
+static_assert(PhQ::has_raw_layout<PhQ::Velocity> && PhQ::has_raw_layout<PhQ::Stress> && PhQ::has_raw_layout<PhQ::VelocityGradient> && PhQ::has_raw_layout<PhQ::ReynoldsNumber>);
+static_assert(PhQ::component_index<PhQ::Stress>("xy") == 1 && PhQ::component_index<PhQ::Stress>("yx") == 6);
+static_assert(sizeof(PhQ::DynamicQuantity) == 3 * sizeof(double));
+static_assert(PhQ::DynamicQuantity{PhQ::Length{2.5, PhQ::Unit::Length::Millimetre}}.to<PhQ::Length>().value().value() == 0.0025);
+static_assert(!PhQ::DynamicQuantity{PhQ::Length{2.5, PhQ::Unit::Length::Metre}}.to<PhQ::Mass>().has_value());
+static_assert((PhQ::DynamicQuantity{PhQ::Length{2.0, PhQ::Unit::Length::Metre}} * PhQ::DynamicQuantity{PhQ::Length{3.0, PhQ::Unit::Length::Metre}}).to<PhQ::Area>().value().value() == 6.0);
+
+/// \brief Print the description of a check that failed and record the failure.
+void check(bool& passed, bool condition, std::string_view description) noexcept {
+  if (!condition) {
+    std::cerr << "Failed: " << description << std::endl;
+    passed = false;
+  }
+}
+
+/// \brief Whether a lane of a pack matches the corresponding scalar result. In the build without fast-math or contraction into fused multiply-adds, they must be bit-identical; otherwise, they must agree to the precision of the number type.
+template <typename Number> bool matches(Number packed, Number scalar) noexcept {
+#if defined(PHQ_STRICT_FLOATING_POINT)
+#if defined(__FAST_MATH__)
+#error "PHQ_STRICT_FLOATING_POINT requires a build without fast-math."
+#endif
+  return packed == scalar;
+#else
+  const Number tolerance{std::is_same<Number, float>::value ? static_cast<Number>(1.0e-6) : static_cast<Number>(1.0e-12)};
+  return std::abs(packed - scalar) <= tolerance * std::max(static_cast<Number>(1), std::abs(scalar));
+#endif
+}
+
+/// \brief Check the conversions, arithmetic, and dimension checks of dynamic quantities and dynamic columns. Returns whether every check passed.
+bool test_dynamic_quantities() noexcept {
+  bool passed{true};
+  const PhQ::Power power{PhQ::Power{2.0, PhQ::Unit::Power::Kilowatt}};
+  const PhQ::DynamicQuantity dynamic_power{power};
+  check(passed, dynamic_power.to<PhQ::Power>() == power, "round trip of a power through a dynamic quantity");
+  check(passed, dynamic_power.print() == power.print(), "print of a dynamic power");
+  const PhQ::DynamicQuantity duration{PhQ::parse_dynamic_quantity("30 min").value()};
+  const PhQ::DynamicQuantity energy{dynamic_power * duration};
+  check(passed, energy.to<PhQ::Energy>().has_value() && std::abs(energy.to<PhQ::Energy>().value().value() - 3.6e6) < 1.0e-6, "product of a power and a duration");
+  check(passed, (energy / duration).dimension() == dynamic_power.dimension(), "quotient of an energy and a duration");
+  PhQ::DynamicQuantity kilowatt_hours{energy};
+  check(passed, kilowatt_hours.display_in("kW·hr") && std::abs(kilowatt_hours.display_value() - 1.0) < 1.0e-12, "display of an energy in kilowatt-hours");
+  check(passed, !kilowatt_hours.display_in("kW"), "rejection of a display unit of another dimension set");
+  check(passed, PhQ::make_dynamic_quantity(500.0, "W").value() + dynamic_power == PhQ::DynamicQuantity{PhQ::Power{2500.0, PhQ::Unit::Power::Watt}}, "sum of two powers");
+  check(passed, !PhQ::make_dynamic_quantity(1.0, "furlongs").has_value(), "rejection of an unknown unit");
+  bool threw{false};
+  try {
+    static_cast<void>(dynamic_power + duration);
+  } catch (const std::runtime_error& error) {
+    std::cout << error.what() << std::endl;
+    threw = true;
+  }
+  check(passed, threw, "rejection of the sum of a power and a duration");
+  const PhQ::ForceMagnitude force{PhQ::DynamicQuantity{PhQ::MassRate{2.0, PhQ::Unit::MassRate::KilogramPerSecond} * PhQ::Speed{3.0, PhQ::Unit::Speed::MetrePerSecond}}.to<PhQ::ForceMagnitude>().value()};
+  check(passed, force.value() == 6.0, "conversion of a generic scalar quantity through a dynamic quantity");
+  std::cout << "Dynamic quantities: " << dynamic_power << ", " << duration << ", " << energy << " = " << kilowatt_hours << std::endl;
+
+  constexpr std::size_t count{1000000};
+  std::vector<double> newtons(count);
+  std::vector<double> kilometres_per_hour(count);
+  for (std::size_t index = 0; index < count; ++index) {
+    newtons[index] = 1.0 + static_cast<double>(index % 100) * 0.01;
+    kilometres_per_hour[index] = 230.0 + static_cast<double>(index % 7);
+  }
+  const PhQ::DynamicColumn forces{PhQ::make_dynamic_column(newtons, "N").value()};
+  const PhQ::DynamicColumn speeds{PhQ::make_dynamic_column(kilometres_per_hour, "km/hr").value()};
+  const std::chrono::high_resolution_clock::time_point start{std::chrono::high_resolution_clock::now()};
+  const PhQ::DynamicColumn powers{forces * speeds + forces * speeds};
+  const auto duration_columns{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start)};
+  const std::optional<std::vector<PhQ::Power>> typed_powers{powers.to<PhQ::Power>()};
+  check(passed, typed_powers.has_value() && typed_powers.value().size() == count && std::abs(typed_powers.value()[count - 1].value() - 2.0 * forces.values()[count - 1] * speeds.values()[count - 1]) < 1.0e-6, "element-wise product and sum of two columns");
+  check(passed, !powers.to<PhQ::Energy>().has_value(), "rejection of a column of another dimension set");
+  threw = false;
+  try {
+    static_cast<void>(forces + speeds);
+  } catch (const std::runtime_error& error) {
+    std::cout << error.what() << std::endl;
+    threw = true;
+  }
+  check(passed, threw, "rejection of the sum of a column of forces and a column of speeds");
+  const PhQ::DynamicColumn round_trip{typed_powers.value()};
+  check(passed, round_trip.values() == powers.values() && round_trip.dimension() == powers.dimension(), "round trip of a column of powers");
+  std::cout << "Multiplied and added columns of " << count << " dynamic quantities in " << duration_columns.count() << " microseconds." << std::endl;
+  return passed;
+}
+
+/// \brief Check the element access and bulk operations of quantity arrays against the same operations on a std::vector of quantities, and compare their runtimes. Returns whether every check passed.
+bool test_quantity_arrays() noexcept {
+  bool passed{true};
+  constexpr std::size_t count{1000000};
+  std::vector<PhQ::Velocity> velocities;
+  velocities.reserve(count);
+  for (std::size_t index = 0; index < count; ++index) {
+    velocities.emplace_back(PhQ::Value::Vector{1.0 + static_cast<double>(index % 13), -2.0 + static_cast<double>(index % 7), 0.5 * static_cast<double>(index % 5)}, PhQ::Unit::Speed::MetrePerSecond);
+  }
+  PhQ::QuantityArray<PhQ::Velocity> array{velocities};
+  check(passed, array.size() == count && array.get(count - 1) == velocities[count - 1], "conversion of a vector of velocities to a quantity array");
+  check(passed, reinterpret_cast<std::uintptr_t>(array.component(1)) % PhQ::array_alignment == 0, "alignment of the components of a quantity array");
+
+  std::vector<PhQ::Speed> speeds(count);
+  PhQ::QuantityArray<PhQ::Speed> array_speeds{count};
+  std::chrono::high_resolution_clock::time_point start{std::chrono::high_resolution_clock::now()};
+  for (std::size_t index = 0; index < count; ++index) {
+    speeds[index] = velocities[index].magnitude();
+  }
+  const auto duration_vector{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start)};
+  start = std::chrono::high_resolution_clock::now();
+  array.magnitude(array_speeds);
+  const auto duration_array{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start)};
+  bool magnitudes_match{true};
+  for (std::size_t index = 0; index < count; ++index) {
+    magnitudes_match = magnitudes_match && std::abs(array_speeds.get(index).value() - speeds[index].value()) <= 1.0e-12 * speeds[index].value();
+  }
+  check(passed, magnitudes_match, "magnitudes of a quantity array");
+
+  PhQ::QuantityArray<PhQ::Velocity> scaled_array{array};
+  scaled_array *= 2.0;
+  scaled_array += array;
+  const PhQ::QuantityArray<PhQ::Velocity> tripled_array{array * 3.0};
+  check(passed, scaled_array.get(count - 1) == tripled_array.get(count - 1) && (tripled_array - array).get(7) == PhQ::Velocity{velocities[7].value() * 2.0, PhQ::Unit::Speed::MetrePerSecond}, "scaled and summed quantity arrays");
+
+  const PhQ::QuantityArray<PhQ::Direction> directions{array.direction()};
+  const PhQ::QuantityArray<PhQ::Velocity> rebuilt{array.magnitude() * directions};
+  check(passed, std::abs(rebuilt.get(12345).value().y() - velocities[12345].value().y()) < 1.0e-12 && std::abs(directions.get(12345).dot(velocities[12345].direction()) - 1.0) < 1.0e-12, "directions and magnitudes of a quantity array");
+  check(passed, std::abs(array.dot(directions).get(12345).value() - velocities[12345].magnitude().value()) < 1.0e-12, "projections of a quantity array onto its directions");
+  check(passed, std::abs(array.cross(directions).get(12345).value().magnitude()) < 1.0e-12, "cross products of a quantity array with its directions");
+  static_assert(decltype(array.dot(array).get(0))::dimension_set == PhQ::dimension<PhQ::Unit::Speed> * PhQ::dimension<PhQ::Unit::Speed>);
+  bool mismatch_throws{false};
+  try {
+    static_cast<void>(array + PhQ::QuantityArray<PhQ::Velocity>{3});
+  } catch (const std::runtime_error& error) {
+    std::cout << error.what() << std::endl;
+    mismatch_throws = true;
+  }
+  check(passed, mismatch_throws, "rejection of the sum of quantity arrays of different sizes");
+
+  array[0] = PhQ::Velocity{{3.0, 4.0, 0.0}, PhQ::Unit::Speed::MetrePerSecond};
+  array[1] = array[0];
+  check(passed, array.component(0)[1] == 3.0 && array.get(1).magnitude().value() == 5.0, "writes through element proxies");
+  std::cout << "Computed the magnitudes of " << count << " velocities in " << duration_vector.count() << " microseconds as a std::vector and in " << duration_array.count() << " microseconds as a PhQ::QuantityArray." << std::endl;
+  return passed;
+}
+
+/// \brief Check every lane of packs of vectors, symmetric dyadic tensors, and dyadic tensors against the scalar classes, and compare the runtimes of packed and scalar cross products. Returns whether every check passed.
+bool test_value_packs() noexcept {
+  bool passed{true};
+
+  constexpr std::size_t width{PhQ::native_pack_width};
+  const PhQ::Direction direction{1.0, -2.0, 2.0};
+  PhQ::QuantityArray<PhQ::VelocityGradient> gradients;
+  for (std::size_t index = 0; index < 11; ++index) {
+    const double real{static_cast<double>(index)};
+    gradients.push_back(PhQ::VelocityGradient{{2.0 + real, -1.0, 0.5 * real, 3.0, 1.0 - real, 0.25, -0.5, real * real, 4.0}, PhQ::Unit::Frequency::Hertz});
+  }
+  bool dyadics_match{true};
+  PhQ::QuantityArray<PhQ::VelocityGradient> inverses{gradients.size()};
+  PhQ::for_each_pack<width>(gradients.size(), [&](std::size_t index, auto lanes) {
+    const auto pack{gradients.load<lanes()>(index)};
+    const auto inverse{pack.inverse()};
+    const auto product{pack * inverse.transpose()};
+    const auto determinant{pack.determinant()};
+    const auto vector{pack * direction};
+    inverses.store(index, inverse);
+    for (std::size_t lane = 0; lane < lanes(); ++lane) {
+      const PhQ::Value::Dyadic scalar{gradients.get(index + lane).value()};
+      const PhQ::Value::Dyadic scalar_product{scalar * scalar.inverse().transpose()};
+      for (std::size_t component = 0; component < 9; ++component) {
+        dyadics_match = dyadics_match && matches(PhQ::components(product.lane(lane))[component], PhQ::components(scalar_product)[component]);
+      }
+      dyadics_match = dyadics_match && matches(determinant[lane], scalar.determinant()) && matches(vector.lane(lane).y(), (scalar * PhQ::Value::Vector{direction.x(), direction.y(), direction.z()}).y());
+    }
+  });
+  check(passed, dyadics_match, "packs of dyadic tensors");
+  check(passed, matches(inverses.get(10).value().zy(), gradients.get(10).value().inverse().zy()), "storage of packs of dyadic tensors in a quantity array");
+
+  PhQ::QuantityArray<PhQ::Stress> stresses;
+  for (std::size_t index = 0; index < 6; ++index) {
+    const double real{static_cast<double>(index)};
+    stresses.push_back(PhQ::Stress{{10.0 + real, 2.0, -1.0, 8.0 - real, 0.5 * real, 6.0}, PhQ::Unit::Pressure::Pascal});
+  }
+  bool symmetric_dyadics_match{true};
+  PhQ::for_each_pack<4>(stresses.size(), [&](std::size_t index, auto lanes) {
+    const auto pack{stresses.load<lanes()>(index)};
+    const auto cofactors{pack.cofactors()};
+    const auto product{pack * pack.inverse()};
+    for (std::size_t lane = 0; lane < lanes(); ++lane) {
+      const PhQ::Value::SymmetricDyadic scalar{stresses.get(index + lane).value()};
+      symmetric_dyadics_match = symmetric_dyadics_match && matches(cofactors.lane(lane).yz(), scalar.cofactors().yz()) && matches(product.lane(lane).zx(), (scalar * scalar.inverse()).zx()) && matches(pack.trace()[lane], scalar.trace());
+    }
+  });
+  check(passed, symmetric_dyadics_match, "packs of symmetric dyadic tensors");
+  bool singular_throws{false};
+  try {
+    PhQ::Value::SymmetricDyadicPack<2>{PhQ::Value::SymmetricDyadic{}}.inverse();
+  } catch (const std::runtime_error&) {
+    singular_throws = true;
+  }
+  check(passed, singular_throws, "inverse of a pack of singular symmetric dyadic tensors");
+
+  constexpr std::size_t count{1 << 20};
+  PhQ::QuantityArray<PhQ::Velocity> velocities{count};
+  for (std::size_t index = 0; index < count; ++index) {
+    velocities.set(index, PhQ::Velocity{{1.0 + static_cast<double>(index % 13), -2.0 + static_cast<double>(index % 7), 0.5 * static_cast<double>(index % 5)}, PhQ::Unit::Speed::MetrePerSecond});
+  }
+  PhQ::QuantityArray<PhQ::Velocity> cross_scalar{count};
+  PhQ::QuantityArray<PhQ::Velocity> cross_packed{count};
+  std::chrono::high_resolution_clock::time_point start{std::chrono::high_resolution_clock::now()};
+  for (std::size_t index = 0; index < count; ++index) {
+    cross_scalar.set(index, PhQ::Velocity{velocities.get(index).value().cross(direction), PhQ::Unit::Speed::MetrePerSecond});
+  }
+  const auto duration_scalar{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start)};
+  start = std::chrono::high_resolution_clock::now();
+  PhQ::for_each_pack<width>(count, [&](std::size_t index, auto lanes) {
+    cross_packed.store(index, velocities.load<lanes()>(index).cross(direction));
+  });
+  const auto duration_packed{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start)};
+  bool vectors_match{true};
+  for (std::size_t index = 0; index < count; ++index) {
+    for (std::size_t component = 0; component < 3; ++component) {
+      vectors_match = vectors_match && matches(cross_packed.component(component)[index], cross_scalar.component(component)[index]);
+    }
+  }
+  check(passed, vectors_match, "packs of vectors");
+  std::cout << "Computed the cross products of " << count << " velocities and a direction in " << duration_scalar.count() << " microseconds one at a time and in " << duration_packed.count() << " microseconds in packs of " << width << "." << std::endl;
+
+  return passed;
+}
+
+/// \brief Check single-precision values, unit conversions, quantity arrays, and packs against their double-precision counterparts. Returns whether every check passed.
+bool test_numeric_types() noexcept {
+  bool passed{true};
+  const PhQ::Value::Dyadic dyadic{2.0, -1.0, 0.5, 3.0, 1.0, 0.25, -0.5, 4.0, 4.0};
+  const PhQ::Value::BasicDyadic<float> narrowed{dyadic};
+  const PhQ::Value::Dyadic widened{narrowed.inverse()};
+  check(passed, std::abs(widened.zy() - dyadic.inverse().zy()) <= 1.0e-6 * std::abs(dyadic.inverse().zy()), "inverse of a single-precision dyadic tensor");
+  const PhQ::Value::BasicVector<float> vector{1.0f, -2.0f, 2.0f};
+  check(passed, vector.magnitude() == 3.0f && vector.dot(PhQ::Direction{0.0, 0.0, 1.0}) == 2.0f && (narrowed * vector).x() == 4.0f + 1.0f, "single-precision vectors");
+  check(passed, PhQ::convert(1.0f, PhQ::Unit::Length::Foot, PhQ::Unit::Length::Metre) == 0.3048f && PhQ::convert(2.5L, PhQ::Unit::Length::Kilometre, PhQ::Unit::Length::Metre) == 2500.0L, "unit conversions in single and extended precision");
+  check(passed, PhQ::convert(PhQ::Value::BasicVector<float>{0.0f, 100.0f, -40.0f}, PhQ::Unit::Temperature::Celsius, PhQ::Unit::Temperature::Kelvin) == PhQ::Value::BasicVector<float>{273.15f, 373.15f, 233.15f}, "unit conversions of single-precision vectors");
+  std::vector<float> lengths{1.0f, 2.5f};
+  PhQ::convert_in_place(lengths.data(), lengths.size(), PhQ::Unit::Length::Kilometre, PhQ::Unit::Length::Metre);
+  check(passed, lengths[1] == 2500.0f, "unit conversions of arrays of single-precision values");
+  const PhQ::BasicVelocity<float> single_velocity{{1.0f, -2.0f, 2.0f}, PhQ::Unit::Speed::KilometrePerSecond};
+  static_assert(sizeof(PhQ::BasicVelocity<float>) == 3 * sizeof(float) && sizeof(PhQ::BasicTemperature<float>) == sizeof(float) && sizeof(PhQ::BasicStrainRate<float>) == 6 * sizeof(float));
+  check(passed, single_velocity.value().y() == -2000.0f && (single_velocity + single_velocity).value().z() == 4000.0f && PhQ::Velocity{single_velocity} == PhQ::Velocity{{1000.0, -2000.0, 2000.0}, PhQ::Unit::Speed::MetrePerSecond} && single_velocity.print() == PhQ::Velocity{single_velocity}.print(), "single-precision velocities");
+  const PhQ::BasicTemperature<float> single_temperature{PhQ::BasicTemperature<float>{PhQ::Temperature{20.0, PhQ::Unit::Temperature::Celsius}}};
+  check(passed, single_temperature == PhQ::BasicTemperature<float>{293.15f, PhQ::Unit::Temperature::Kelvin} && single_temperature < PhQ::BasicTemperature<float>{300.0f, PhQ::Unit::Temperature::Kelvin}, "single-precision temperatures");
+  const PhQ::BasicStrainRate<float> single_strain_rate{{1.0f, 0.5f, 0.0f, 2.0f, 0.0f, 3.0f}, PhQ::Unit::Frequency::Hertz};
+  check(passed, (single_strain_rate + single_strain_rate).value().yy() == 4.0f && PhQ::StrainRate{single_strain_rate}.value().xy() == 0.5, "single-precision strain rates");
+  PhQ::QuantityArray<PhQ::BasicVelocity<float>> single_velocity_array{2};
+  single_velocity_array.set(1, single_velocity);
+  check(passed, single_velocity_array.get(1) == single_velocity, "quantity arrays of single-precision quantities");
+  std::vector<PhQ::BasicStrainRate<float>> single_strain_rates{single_strain_rate, single_strain_rate};
+  float single_buffer[3]{0.25f, 0.5f, 0.75f};
+  check(passed, PhQ::view(single_strain_rates).component(1)[1] == 0.5f && PhQ::view<PhQ::BasicVelocity<float>>(single_buffer, 1).get(0).value().z() == 0.75f, "views of single-precision quantities");
+
+  constexpr std::size_t count{1 << 20};
+  PhQ::QuantityArray<PhQ::Velocity> velocities{count};
+  for (std::size_t index = 0; index < count; ++index) {
+    velocities.set(index, PhQ::Velocity{{1.0 + static_cast<double>(index % 13), -2.0 + static_cast<double>(index % 7), 0.5 * static_cast<double>(index % 5)}, PhQ::Unit::Speed::MetrePerSecond});
+  }
+  const PhQ::QuantityArray<PhQ::Velocity, float> single_velocities{velocities};
+  check(passed, single_velocities.get(count - 1) == velocities.get(count - 1) && PhQ::QuantityArray<PhQ::Velocity>{single_velocities}.get(12) == velocities.get(12), "conversions between quantity arrays of different precisions");
+  PhQ::QuantityArray<PhQ::Speed> speeds;
+  PhQ::QuantityArray<PhQ::Speed, float> single_speeds;
+  velocities.magnitude(speeds);
+  single_velocities.magnitude(single_speeds);
+  std::chrono::high_resolution_clock::time_point start{std::chrono::high_resolution_clock::now()};
+  velocities.magnitude(speeds);
+  const auto duration_double{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start)};
+  start = std::chrono::high_resolution_clock::now();
+  single_velocities.magnitude(single_speeds);
+  const auto duration_float{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start)};
+  bool magnitudes_match{true};
+  for (std::size_t index = 0; index < count; ++index) {
+    magnitudes_match = magnitudes_match && std::abs(single_speeds.get(index).value() - speeds.get(index).value()) <= 1.0e-6 * speeds.get(index).value();
+  }
+  check(passed, magnitudes_match, "magnitudes of a single-precision quantity array");
+  std::cout << "Computed the magnitudes of " << count << " velocities in " << duration_double.count() << " microseconds in double precision and in " << duration_float.count() << " microseconds in single precision." << std::endl;
+
+  constexpr std::size_t width{PhQ::native_pack_width_of<float>};
+  constexpr std::size_t varied_count{100000};
+  PhQ::QuantityArray<PhQ::Velocity, float> varied_velocities{varied_count};
+  for (std::size_t index = 0; index < varied_count; ++index) {
+    const double real{static_cast<double>(index)};
+    varied_velocities.set(index, PhQ::Velocity{{std::sin(real) * 1.0e3, std::cos(0.7 * real) * 0.1, std::sin(1.3 * real + 0.5)}, PhQ::Unit::Speed::MetrePerSecond});
+  }
+  bool packs_match{true};
+  PhQ::for_each_pack<width>(varied_count, [&](std::size_t index, auto lanes) {
+    const PhQ::Value::VectorPack<lanes(), float> pack{varied_velocities.load<lanes()>(index)};
+    const auto magnitudes{pack.magnitude()};
+    for (std::size_t lane = 0; lane < lanes(); ++lane) {
+      const PhQ::Value::BasicVector<float> scalar{varied_velocities.get(index + lane).value()};
+      packs_match = packs_match && matches(magnitudes[lane], scalar.magnitude()) && pack.lane(lane) == scalar;
+    }
+  });
+  check(passed, packs_match, "single-precision packs of vectors");
+
+  return passed;
+}
+
+/// \brief Check lazy expressions of values, quantities, and quantity arrays against the same eager expressions, and compare the runtimes of a lazy and an eager update of an array of velocities. Returns whether every check passed.
+bool test_lazy_expressions() noexcept {
+  bool passed{true};
+  const PhQ::Value::SymmetricDyadic strain{0.010, -0.002, -0.003, 0.008, -0.004, -0.006};
+  const PhQ::Value::SymmetricDyadic lazy_stress{(PhQ::lazy(strain) * (2.0 * 26.0e9) + PhQ::Value::SymmetricDyadic{1.0e6, 0.0, 0.0, 1.0e6, 0.0, 1.0e6}).evaluate()};
+  check(passed, lazy_stress == 2.0 * 26.0e9 * strain + PhQ::Value::SymmetricDyadic{1.0e6, 0.0, 0.0, 1.0e6, 0.0, 1.0e6}, "lazy expression of symmetric dyadic tensors");
+  const PhQ::Velocity velocity{{1.0, 2.0, 3.0}, PhQ::Unit::Speed::MetrePerSecond};
+  const PhQ::Acceleration acceleration_1{{0.0, 0.0, -9.81}, PhQ::Unit::Acceleration::MetrePerSquareSecond};
+  const PhQ::Acceleration acceleration_2{{2.0, -1.0, 0.5}, PhQ::Unit::Acceleration::MetrePerSquareSecond};
+  const PhQ::Duration duration{0.01, PhQ::Unit::Time::Second};
+  check(passed, (PhQ::lazy(velocity) + duration * (PhQ::lazy(acceleration_1) + acceleration_2)).evaluate() == velocity + (acceleration_1 + acceleration_2) * duration, "lazy expression of vector quantities");
+  check(passed, (-PhQ::lazy(velocity) / 2.0).evaluate() == PhQ::Velocity{velocity.value() / -2.0, PhQ::Unit::Speed::MetrePerSecond}, "lazy negation and division");
+
+  constexpr std::size_t count{1 << 20};
+  PhQ::QuantityArray<PhQ::Velocity> velocities{count};
+  PhQ::QuantityArray<PhQ::Acceleration> accelerations_1{count};
+  PhQ::QuantityArray<PhQ::Acceleration> accelerations_2{count};
+  for (std::size_t index = 0; index < count; ++index) {
+    const double real{static_cast<double>(index % 17)};
+    velocities.set(index, PhQ::Velocity{{real, -real, 0.5 * real}, PhQ::Unit::Speed::MetrePerSecond});
+    accelerations_1.set(index, PhQ::Acceleration{{0.0, 0.0, -9.81}, PhQ::Unit::Acceleration::MetrePerSquareSecond});
+    accelerations_2.set(index, PhQ::Acceleration{{real, 1.0, -real}, PhQ::Unit::Acceleration::MetrePerSquareSecond});
+  }
+  PhQ::QuantityArray<PhQ::Velocity> eager_velocities{velocities};
+  PhQ::QuantityArray<PhQ::Velocity> lazy_velocities{velocities};
+  std::chrono::high_resolution_clock::time_point start{std::chrono::high_resolution_clock::now()};
+  for (std::size_t index = 0; index < count; ++index) {
+    eager_velocities.set(index, eager_velocities.get(index) + (accelerations_1.get(index) + accelerations_2.get(index)) * duration);
+  }
+  const auto duration_eager{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start)};
+  start = std::chrono::high_resolution_clock::now();
+  lazy_velocities = PhQ::lazy(lazy_velocities) + duration * (PhQ::lazy(accelerations_1) + PhQ::lazy(accelerations_2));
+  const auto duration_lazy{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start)};
+  bool arrays_match{true};
+  for (std::size_t component = 0; component < 3; ++component) {
+    for (std::size_t index = 0; index < count; ++index) {
+      arrays_match = arrays_match && std::abs(lazy_velocities.component(component)[index] - eager_velocities.component(component)[index]) <= 1.0e-12;
+    }
+  }
+  check(passed, arrays_match, "lazy expression of quantity arrays");
+  const PhQ::QuantityArray<PhQ::Velocity> differences{PhQ::lazy(lazy_velocities) - velocities};
+  check(passed, differences.size() == count && (differences.get(3) - (accelerations_1.get(3) + accelerations_2.get(3)) * duration).magnitude() <= PhQ::Speed{1.0e-12, PhQ::Unit::Speed::MetrePerSecond}, "quantity array created from a lazy expression");
+  PhQ::QuantityArray<PhQ::Velocity> broadcast{4};
+  broadcast = PhQ::lazy(velocity) * 2.0;
+  check(passed, broadcast.size() == 4 && broadcast.get(3) == PhQ::Velocity{velocity.value() * 2.0, PhQ::Unit::Speed::MetrePerSecond}, "assignment of a lazy expression without quantity arrays to every element");
+  bool mismatch_throws{true};
+  try {
+    static_cast<void>(PhQ::QuantityArray<PhQ::Velocity>{PhQ::lazy(velocities) + PhQ::lazy(broadcast)});
+    mismatch_throws = false;
+  } catch (const std::runtime_error& error) {
+    std::cout << error.what() << std::endl;
+  }
+  try {
+    broadcast = PhQ::lazy(velocities) * 2.0;
+    mismatch_throws = false;
+  } catch (const std::runtime_error& error) {
+    std::cout << error.what() << std::endl;
+  }
+  check(passed, mismatch_throws && broadcast.size() == 4, "rejection of lazy expressions of quantity arrays of different sizes");
+  std::cout << "Updated " << count << " velocities in " << duration_eager.count() << " microseconds element by element and in " << duration_lazy.count() << " microseconds with a lazy expression." << std::endl;
+
+  return passed;
+}
+
+/// \brief Check raw views of contiguous containers of quantities, of buffers of real numbers, and of quantity arrays. Returns whether every check passed.
+bool test_raw_views() noexcept {
+  bool passed{true};
+  std::vector<PhQ::Velocity> velocities;
+  for (std::size_t index = 0; index < 4; ++index) {
+    const double real{static_cast<double>(index)};
+    velocities.push_back(PhQ::Velocity{{real, 2.0 * real, -real}, PhQ::Unit::Speed::MetrePerSecond});
+  }
+  const PhQ::RawView<double> values{PhQ::view(velocities).values()};
+  check(passed, values.size() == 12 && values.contiguous() && values.data() == reinterpret_cast<double*>(velocities.data()) && values[7] == 4.0, "raw view of a vector of velocities");
+  values[9] = 5.0;
+  check(passed, velocities[3].value().x() == 5.0, "write through a raw view of a vector of velocities");
+  const PhQ::RawView<const double> y_components{PhQ::view(std::as_const(velocities)).component(1)};
+  check(passed, y_components.size() == 4 && y_components.stride() == 3 && y_components[2] == 4.0, "strided view of the y components of a vector of velocities");
+
+  std::vector<PhQ::Stress> stresses{3, PhQ::Stress{{1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, PhQ::Unit::Pressure::Kilopascal}};
+  const PhQ::RawView<double> xy_components{PhQ::view(stresses).component(PhQ::component_index<PhQ::Stress>("xy"))};
+  for (std::size_t index = 0; index < xy_components.size(); ++index) {
+    xy_components[index] *= static_cast<double>(index);
+  }
+  check(passed, xy_components.stride() == 6 && stresses[2].value().xy() == 4000.0 && stresses[2].value().yx() == 4000.0 && stresses[2].value().xz() == 3000.0, "strided view of the xy components of a vector of stresses");
+
+  std::vector<double> solution{1.0, 0.0, 0.0, 0.0, 2.0, 0.0};
+  const PhQ::BufferView<PhQ::Velocity> solved{PhQ::view<PhQ::Velocity>(solution.data(), 2)};
+  check(passed, solved.size() == 2 && solved.get(1) == PhQ::Velocity{{0.0, 2.0, 0.0}, PhQ::Unit::Speed::MetrePerSecond}, "velocities viewed from a buffer of real numbers");
+  solved[0] += PhQ::Velocity{{0.0, 0.0, 3.0}, PhQ::Unit::Speed::MetrePerSecond};
+  solved.set(1, PhQ::Velocity{{0.0, 4.0, 0.0}, PhQ::Unit::Speed::MetrePerSecond});
+  check(passed, solution[2] == 3.0 && solution[4] == 4.0 && solved.values().data() == solution.data(), "write through velocities viewed from a buffer of real numbers");
+  std::vector<double> buffer{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  const PhQ::BufferView<PhQ::Velocity> copied{PhQ::view<PhQ::Velocity>(buffer.data(), 2)};
+  copied[0] = copied[1];
+  check(passed, buffer == std::vector<double>{4.0, 5.0, 6.0, 4.0, 5.0, 6.0}, "copy between velocities viewed from a buffer of real numbers");
+  const PhQ::BufferView<const PhQ::Velocity> read_only{PhQ::view<PhQ::Velocity>(std::as_const(solution).data(), 2)};
+  check(passed, read_only[0] == PhQ::Velocity{{1.0, 0.0, 3.0}, PhQ::Unit::Speed::MetrePerSecond} && read_only.component(1)[1] == 4.0, "read-only velocities viewed from a buffer of real numbers");
+  PhQ::Speed total;
+  for (const PhQ::Velocity& velocity : solved) {
+    total += velocity.magnitude();
+  }
+  check(passed, total == PhQ::Speed{4.0 + std::sqrt(10.0), PhQ::Unit::Speed::MetrePerSecond}, "iteration over velocities viewed from a buffer of real numbers");
+
+  PhQ::QuantityArray<PhQ::Stress> stress_array{stresses};
+  const PhQ::RawView<double> xy_array{PhQ::view(stress_array, 1)};
+  check(passed, xy_array.contiguous() && xy_array.size() == 3 && xy_array[1] == 2000.0 && xy_array.data() == stress_array.component(1), "contiguous view of the xy components of a quantity array of stresses");
+
+  return passed;
+}
 
 int main(int argc, char *argv[]) {
+
+  if (!test_dynamic_quantities() || !test_quantity_arrays() || !test_value_packs() || !test_numeric_types() || !test_lazy_expressions() || !test_raw_views()) {
+    return EXIT_FAILURE;
+  }
+
+  const PhQ::Mass mass{10.0, PhQ::Unit::Mass::Kilogram};
+  const PhQ::Speed speed{3.0, PhQ::Unit::Speed::MetrePerSecond};
+  std::cout << "Momentum of " << mass << " at " << speed << ": " << mass * speed << std::endl;
+  const PhQ::ForceMagnitude thrust{PhQ::MassRate{2.0, PhQ::Unit::MassRate::SlugPerSecond} * speed};
+  std::cout << "Thrust: " << thrust << std::endl;
   std::chrono::high_resolution_clock::time_point start{std::chrono::high_resolution_clock::now()};
 
   std::cout << "Hash: " << std::hash<PhQ::Value::Vector>()(PhQ::Value::Vector{1.0, 2.0, 3.0}) << std::endl;
@@ -71,6 +548,9 @@ int main(int argc, char *argv[]) {
   PhQ::Mass mass1{10.0, PhQ::Unit::Mass::Pound};
   std::cout << mass1 << std::endl;
 
+  const PhQ::StaticPressure gauge_pressure{PhQ::make<PhQ::StaticPressure, PhQ::Unit::Pressure::PoundPerSquareInch>(14.7)};
+  std::cout << gauge_pressure << " = " << gauge_pressure.print(PhQ::Unit::Pressure::PoundPerSquareInch) << std::endl;
+
   const auto duration{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start)};
   std::cout << "Runtime: " << duration.count() << " microseconds." << std::endl;
   return EXIT_SUCCESS;
@@ -0,0 +1,263 @@
+// Copyright 2020 Alexandre Coderre-Chabot
+// This file is part of Physical Quantities (PhQ), a C++17 header-only library of physical quantities, physical models, and units of measure for scientific computation.
+// Physical Quantities is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Physical Quantities is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for more details.
+// You should have received a copy of the GNU Lesser General Public License along with Physical Quantities. If not, see <https://www.gnu.org/licenses/>.
+
+#include <iostream>
+
+#include "../include/PhQ/ConstitutiveModel/CompressibleNewtonianFluid.hpp"
+#include "../include/PhQ/ConstitutiveModel/ElasticIsotropicSolid.hpp"
+#include "../include/PhQ/Quantity/Binary.hpp"
+#include "../include/PhQ/ConstitutiveModel/IncompressibleNewtonianFluid.hpp"
+#include "../include/PhQ/Quantity/Sequence.hpp"
+#include "../include/PhQ/ReynoldsNumber.hpp"
+#include "../include/PhQ/Strain.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/Temperature.hpp"
+#include "../include/PhQ/ThermodynamicStateModel/IdealGas.hpp"
+#include "../include/PhQ/ThermodynamicStateModel/IncompressibleFluid.hpp"
+#include "../include/PhQ/Velocity.hpp"
+
+/// \brief Print a labelled text and, if a condition does not hold, a message that explains the failure. Returns the condition.
+bool report(const std::string& label, const std::string& text, bool condition, const std::string& failure) noexcept {
+  std::cout << "- " << label << ": " << text << std::endl;
+  if (!condition) {
+    std::cerr << failure << std::endl;
+  }
+  return condition;
+}
+
+bool check(const std::string& label, const std::string& text, const std::string& expected) noexcept {
+  return report(label, text, text == expected, "Expected: " + expected);
+}
+
+/// \brief Whether two values agree to within the precision with which PhQ writes numbers.
+template <typename Value> bool close(const Value& value_1, const Value& value_2) noexcept {
+  const auto components_1{PhQ::components(value_1)};
+  const auto components_2{PhQ::components(value_2)};
+  for (std::size_t index = 0; index < components_1.size(); ++index) {
+    if (std::abs(components_1[index] - components_2[index]) > 1.0e-6 * std::max(std::abs(components_1[index]), std::abs(components_2[index]))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename Type> bool close(const std::vector<Type>& quantities_1, const std::vector<Type>& quantities_2) noexcept {
+  if (quantities_1.size() != quantities_2.size()) {
+    return false;
+  }
+  for (std::size_t index = 0; index < quantities_1.size(); ++index) {
+    if (!close(quantities_1[index].value(), quantities_2[index].value())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// \brief Read an object back from a text in a given format and compare it to the original with a predicate.
+template <typename Type, typename Predicate> bool check_read(const std::string& label, const std::string& text, PhQ::TextFormat format, Predicate&& predicate) noexcept {
+  const std::optional<Type> object{PhQ::parse_text<Type>(text, format)};
+  return report(label, text, object.has_value() && predicate(object.value()), "Failed to read back: " + text);
+}
+
+template <typename Type> bool check_rejected(const std::string& label, const std::string& text, PhQ::TextFormat format) noexcept {
+  return report(label + " is rejected", text, !PhQ::parse_text<Type>(text, format).has_value(), "Unexpectedly read: " + text);
+}
+
+bool test_sequences() noexcept {
+  const std::vector<PhQ::Temperature> temperatures{{300.0, PhQ::Unit::Temperature::Kelvin}, {0.0, PhQ::Unit::Temperature::Celsius}};
+  const std::vector<PhQ::Velocity> velocities{{{1.0, 2.0, 3.0}, PhQ::Unit::Speed::MetrePerSecond}, {{-4.0, 5.0, -6.0}, PhQ::Unit::Speed::MetrePerSecond}};
+  const std::vector<PhQ::Stress> stresses{{{1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, PhQ::Unit::Pressure::Kilopascal}};
+  bool passed{true};
+  std::string text;
+
+  std::cout << "Temperatures:" << std::endl;
+  PhQ::json_sequence(text, temperatures);
+  passed = check("JSON", text, "{\"unit\": \"K\", \"dimension\": {\"length\": 0 , \"mass\": 0 , \"time\": 0 , \"electric_current\": 0 , \"temperature\": 1 , \"substance_amount\": 0 , \"luminous_intensity\": 0}, \"values\": [300.0000, 273.1500]}") && passed;
+  text.clear();
+  PhQ::csv_sequence(text, temperatures, PhQ::Unit::Temperature::Celsius);
+  passed = check("CSV", text, "value [°C]\n26.85000\n0\n") && passed;
+  text.clear();
+  PhQ::xml_sequence(text, temperatures, PhQ::System::FootPoundSecondRankine);
+  passed = check("XML", text, "<unit>°R</unit><dimension><length>0</length><mass>0</mass><time>0</time><electric_current>0</electric_current><temperature>1</temperature><substance_amount>0</substance_amount><luminous_intensity>0</luminous_intensity></dimension><values>540.0000 491.6700</values>") && passed;
+
+  std::cout << "Velocities:" << std::endl;
+  text.clear();
+  PhQ::json_sequence(text, velocities, PhQ::Unit::Speed::CentimetrePerSecond);
+  passed = check("JSON", text, "{\"unit\": \"cm/s\", \"dimension\": {\"length\": 1 , \"mass\": 0 , \"time\": -1 , \"electric_current\": 0 , \"temperature\": 0 , \"substance_amount\": 0 , \"luminous_intensity\": 0}, \"values\": {\"x\": [100.0000, -400.0000], \"y\": [200.0000, 500.0000], \"z\": [300.0000, -600.0000]}}") && passed;
+  text.clear();
+  PhQ::yaml_sequence(text, velocities);
+  passed = check("YAML", text, "{unit: m/s, dimension: {length: 1 , mass: 0 , time: -1 , electric_current: 0 , temperature: 0 , substance_amount: 0 , luminous_intensity: 0}, values: {x: [1.000000, -4.000000], y: [2.000000, 5.000000], z: [3.000000, -6.000000]}}") && passed;
+  text.clear();
+  PhQ::csv_sequence(text, velocities);
+  passed = check("CSV", text, "x [m/s],y [m/s],z [m/s]\n1.000000,2.000000,3.000000\n-4.000000,5.000000,-6.000000\n") && passed;
+
+  std::cout << "Stresses:" << std::endl;
+  text.clear();
+  PhQ::xml_sequence(text, stresses, PhQ::Unit::Pressure::Kilopascal);
+  passed = check("XML", text, "<unit>kPa</unit><dimension><length>-1</length><mass>1</mass><time>-2</time><electric_current>0</electric_current><temperature>0</temperature><substance_amount>0</substance_amount><luminous_intensity>0</luminous_intensity></dimension><values><xx>1.000000</xx><xy>2.000000</xy><xz>3.000000</xz><yy>4.000000</yy><yz>5.000000</yz><zz>6.000000</zz></values>") && passed;
+
+  std::vector<PhQ::Temperature> many_temperatures(1000, PhQ::Temperature{300.0, PhQ::Unit::Temperature::Kelvin});
+  std::string sequence_text;
+  PhQ::json_sequence(sequence_text, many_temperatures);
+  std::string element_text{"["};
+  for (std::size_t index = 0; index < many_temperatures.size(); ++index) {
+    element_text.append(index > 0 ? ", " : "").append(many_temperatures[index].json());
+  }
+  element_text.append("]");
+  std::cout << "Size of 1000 temperatures as a JSON sequence: " << sequence_text.size() << " characters, as JSON elements: " << element_text.size() << " characters." << std::endl;
+  return passed && sequence_text.size() < element_text.size();
+}
+
+bool test_readers() noexcept {
+  const PhQ::Stress stress{{1.0, -2.0, 3.5, 40000.0, 5.0e-6, 6.0}, PhQ::Unit::Pressure::Kilopascal};
+  const PhQ::Temperature temperature{21.5, PhQ::Unit::Temperature::Celsius};
+  const PhQ::Velocity velocity{{1.0, -2.0, 3.0}, PhQ::Unit::Speed::MetrePerSecond};
+  const PhQ::ReynoldsNumber reynolds_number{2300.0};
+  const PhQ::Strain strain{{0.001, 0.002, 0.003, 0.004, 0.005, 0.006}};
+  const PhQ::Direction direction{1.0, 2.0, 2.0};
+  const PhQ::Dimension::Set dimension_set{PhQ::dimension<PhQ::Unit::Pressure>};
+  const PhQ::ConstitutiveModel::ElasticIsotropicSolid elastic_isotropic_solid{PhQ::ShearModulus{80.0, PhQ::Unit::Pressure::Gigapascal}, PhQ::LameFirstModulus{110.0, PhQ::Unit::Pressure::Gigapascal}};
+  const PhQ::ConstitutiveModel::IncompressibleNewtonianFluid incompressible_newtonian_fluid{PhQ::DynamicViscosity{0.001, PhQ::Unit::DynamicViscosity::PascalSecond}};
+  const PhQ::ConstitutiveModel::CompressibleNewtonianFluid compressible_newtonian_fluid{PhQ::DynamicViscosity{1.8e-5, PhQ::Unit::DynamicViscosity::PascalSecond}};
+  const PhQ::ThermodynamicStateModel::IdealGas ideal_gas{PhQ::SpecificGasConstant{287.0, PhQ::Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin}, PhQ::SpecificIsobaricHeatCapacity{1005.0, PhQ::Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin}};
+  const PhQ::ThermodynamicStateModel::IncompressibleFluid incompressible_fluid{PhQ::MassDensity{1000.0, PhQ::Unit::MassDensity::KilogramPerCubicMetre}, PhQ::SpecificIsobaricHeatCapacity{4186.0, PhQ::Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin}};
+  const std::vector<PhQ::Temperature> temperatures{{300.0, PhQ::Unit::Temperature::Kelvin}, {0.0, PhQ::Unit::Temperature::Celsius}};
+  const std::vector<PhQ::Velocity> velocities{{{1.0, 2.0, 3.0}, PhQ::Unit::Speed::MetrePerSecond}, {{-4.0, 5.0, -6.0}, PhQ::Unit::Speed::MetrePerSecond}};
+  const std::vector<PhQ::Stress> stresses{stress, {{-7.0, 0.0, 0.125, 1.0e6, -3.0, 2.0}, PhQ::Unit::Pressure::Pascal}};
+  const auto same_stress{[&stress](const PhQ::Stress& read) { return close(read.value(), stress.value()); }};
+  bool passed{true};
+
+  std::cout << "Quantities and values:" << std::endl;
+  passed = check_read<PhQ::Stress>("Stress as JSON", stress.json(), PhQ::TextFormat::JSON, same_stress) && passed;
+  passed = check_read<PhQ::Stress>("Stress as YAML in psi", stress.yaml(PhQ::Unit::Pressure::PoundPerSquareInch), PhQ::TextFormat::YAML, same_stress) && passed;
+  passed = check_read<PhQ::Stress>("Stress as XML in kPa", stress.xml(PhQ::Unit::Pressure::Kilopascal), PhQ::TextFormat::XML, same_stress) && passed;
+  passed = check_read<PhQ::Temperature>("Temperature as YAML in °F", temperature.yaml(PhQ::Unit::Temperature::Fahrenheit), PhQ::TextFormat::YAML, [&temperature](const PhQ::Temperature& read) { return close(read.value(), temperature.value()); }) && passed;
+  passed = check_read<PhQ::Velocity>("Velocity as XML in ft/s", velocity.xml(PhQ::System::FootPoundSecondRankine), PhQ::TextFormat::XML, [&velocity](const PhQ::Velocity& read) { return close(read.value(), velocity.value()); }) && passed;
+  passed = check_read<PhQ::ReynoldsNumber>("Reynolds number as JSON", reynolds_number.json(), PhQ::TextFormat::JSON, [&reynolds_number](const PhQ::ReynoldsNumber& read) { return close(read.value(), reynolds_number.value()); }) && passed;
+  passed = check_read<PhQ::Strain>("Strain as XML", strain.xml(), PhQ::TextFormat::XML, [&strain](const PhQ::Strain& read) { return close(read.value(), strain.value()); }) && passed;
+  passed = check_read<PhQ::Value::Vector>("Vector as YAML", velocity.value().yaml(), PhQ::TextFormat::YAML, [&velocity](const PhQ::Value::Vector& read) { return close(read, velocity.value()); }) && passed;
+  passed = check_read<PhQ::Direction>("Direction as JSON", direction.json(), PhQ::TextFormat::JSON, [&direction](const PhQ::Direction& read) { return close(read.x(), direction.x()) && close(read.y(), direction.y()) && close(read.z(), direction.z()); }) && passed;
+  passed = check_read<PhQ::Dimension::Set>("Dimension set as XML", dimension_set.xml(), PhQ::TextFormat::XML, [&dimension_set](const PhQ::Dimension::Set& read) { return read == dimension_set; }) && passed;
+
+  std::cout << "Models:" << std::endl;
+  passed = check_read<PhQ::ConstitutiveModel::ElasticIsotropicSolid>("Elastic isotropic solid as JSON", elastic_isotropic_solid.json(), PhQ::TextFormat::JSON, [&elastic_isotropic_solid](const PhQ::ConstitutiveModel::ElasticIsotropicSolid& read) { return close(read.shear_modulus().value(), elastic_isotropic_solid.shear_modulus().value()) && close(read.lame_first_modulus().value(), elastic_isotropic_solid.lame_first_modulus().value()); }) && passed;
+  passed = check_read<PhQ::ConstitutiveModel::ElasticIsotropicSolid>("Elastic isotropic solid as XML", elastic_isotropic_solid.xml(), PhQ::TextFormat::XML, [&elastic_isotropic_solid](const PhQ::ConstitutiveModel::ElasticIsotropicSolid& read) { return close(read.shear_modulus().value(), elastic_isotropic_solid.shear_modulus().value()) && close(read.lame_first_modulus().value(), elastic_isotropic_solid.lame_first_modulus().value()); }) && passed;
+  passed = check_read<PhQ::ConstitutiveModel::IncompressibleNewtonianFluid>("Incompressible Newtonian fluid as XML", incompressible_newtonian_fluid.xml(), PhQ::TextFormat::XML, [&incompressible_newtonian_fluid](const PhQ::ConstitutiveModel::IncompressibleNewtonianFluid& read) { return close(read.dynamic_viscosity().value(), incompressible_newtonian_fluid.dynamic_viscosity().value()); }) && passed;
+  passed = check_read<PhQ::ConstitutiveModel::CompressibleNewtonianFluid>("Compressible Newtonian fluid as JSON", compressible_newtonian_fluid.json(), PhQ::TextFormat::JSON, [&compressible_newtonian_fluid](const PhQ::ConstitutiveModel::CompressibleNewtonianFluid& read) { return close(read.dynamic_viscosity().value(), compressible_newtonian_fluid.dynamic_viscosity().value()) && close(read.bulk_dynamic_viscosity().value(), compressible_newtonian_fluid.bulk_dynamic_viscosity().value()); }) && passed;
+  passed = check_read<PhQ::ThermodynamicStateModel::IdealGas>("Ideal gas as JSON", ideal_gas.json(), PhQ::TextFormat::JSON, [&ideal_gas](const PhQ::ThermodynamicStateModel::IdealGas& read) { return close(read.specific_gas_constant().value(), ideal_gas.specific_gas_constant().value()) && close(read.specific_isobaric_heat_capacity().value(), ideal_gas.specific_isobaric_heat_capacity().value()); }) && passed;
+  passed = check_read<PhQ::ThermodynamicStateModel::IncompressibleFluid>("Incompressible fluid as XML", incompressible_fluid.xml(), PhQ::TextFormat::XML, [&incompressible_fluid](const PhQ::ThermodynamicStateModel::IncompressibleFluid& read) { return close(read.mass_density().value(), incompressible_fluid.mass_density().value()) && close(read.specific_isobaric_heat_capacity().value(), incompressible_fluid.specific_isobaric_heat_capacity().value()); }) && passed;
+
+  std::cout << "Sequences:" << std::endl;
+  std::string text;
+  PhQ::xml_sequence(text, temperatures, PhQ::System::FootPoundSecondRankine);
+  passed = check_read<std::vector<PhQ::Temperature>>("Temperatures as XML in °R", text, PhQ::TextFormat::XML, [&temperatures](const std::vector<PhQ::Temperature>& read) { return close(read, temperatures); }) && passed;
+  text.clear();
+  PhQ::json_sequence(text, velocities, PhQ::Unit::Speed::CentimetrePerSecond);
+  passed = check_read<std::vector<PhQ::Velocity>>("Velocities as JSON in cm/s", text, PhQ::TextFormat::JSON, [&velocities](const std::vector<PhQ::Velocity>& read) { return close(read, velocities); }) && passed;
+  text.clear();
+  PhQ::yaml_sequence(text, stresses, PhQ::Unit::Pressure::Megapascal);
+  passed = check_read<std::vector<PhQ::Stress>>("Stresses as YAML in MPa", text, PhQ::TextFormat::YAML, [&stresses](const std::vector<PhQ::Stress>& read) { return close(read, stresses); }) && passed;
+  text.clear();
+  const std::vector<PhQ::BasicVelocity<float>> single_velocities{PhQ::BasicVelocity<float>{{1.5f, -2.0f, 0.25f}, PhQ::Unit::Speed::MetrePerSecond}};
+  PhQ::csv_sequence(text, single_velocities);
+  passed = check("CSV of single-precision velocities", text, "x [m/s],y [m/s],z [m/s]\n1.500000,-2.000000,0.2500000\n") && passed;
+  text.clear();
+  PhQ::json_sequence(text, single_velocities);
+  passed = check_read<std::vector<PhQ::BasicVelocity<float>>>("Single-precision velocities as JSON", text, PhQ::TextFormat::JSON, [&single_velocities](const std::vector<PhQ::BasicVelocity<float>>& read) { return read == single_velocities; }) && passed;
+
+  std::cout << "Malformed texts:" << std::endl;
+  passed = check_rejected<PhQ::Stress>("Stress with a unit of length", "{\"value\": {\"xx\": 1 , \"xy\": 2 , \"xz\": 3 , \"yy\": 4 , \"yz\": 5 , \"zz\": 6}, \"unit\": \"m\"}", PhQ::TextFormat::JSON) && passed;
+  passed = check_rejected<PhQ::Temperature>("Truncated temperature", "{value: 300 , unit:", PhQ::TextFormat::YAML) && passed;
+  passed = check_rejected<PhQ::Temperature>("Temperature followed by text", "<value>300</value><unit>K</unit>K", PhQ::TextFormat::XML) && passed;
+  passed = check_rejected<PhQ::ThermodynamicStateModel::IdealGas>("Ideal gas of the wrong type", incompressible_fluid.json(), PhQ::TextFormat::JSON) && passed;
+  passed = check_rejected<PhQ::Direction>("Null direction", "{\"x\":0 , \"y\":0 , \"z\":0}", PhQ::TextFormat::JSON) && passed;
+  passed = check_rejected<std::vector<PhQ::Velocity>>("Velocities with columns of different lengths", "<unit>m/s</unit><dimension><length>1</length><mass>0</mass><time>-1</time><electric_current>0</electric_current><temperature>0</temperature><substance_amount>0</substance_amount><luminous_intensity>0</luminous_intensity></dimension><values><x>1 2</x><y>3</y><z>4 5</z></values>", PhQ::TextFormat::XML) && passed;
+  return passed;
+}
+
+/// \brief Throughput of writing a large number of stresses to JSON and reading them back, one object at a time and as a single columnar sequence.
+bool benchmark_round_trips() noexcept {
+  constexpr std::size_t count{100000};
+  std::vector<PhQ::Stress> stresses;
+  stresses.reserve(count);
+  for (std::size_t index = 0; index < count; ++index) {
+    const double real{static_cast<double>(index)};
+    stresses.push_back({{real, -0.5 * real, 0.25, 2.0 * real, 1.0e-3 * real, -real}, PhQ::Unit::Pressure::Kilopascal});
+  }
+
+  std::chrono::high_resolution_clock::time_point start{std::chrono::high_resolution_clock::now()};
+  std::string text;
+  std::size_t characters{0};
+  std::vector<PhQ::Stress> read_stresses;
+  read_stresses.reserve(count);
+  for (const PhQ::Stress& stress : stresses) {
+    text.clear();
+    stress.json(text, PhQ::Unit::Pressure::Kilopascal);
+    characters += text.size();
+    const std::optional<PhQ::Stress> read{PhQ::parse_json<PhQ::Stress>(text)};
+    if (!read.has_value()) {
+      return false;
+    }
+    read_stresses.push_back(read.value());
+  }
+  const auto objects_duration{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start)};
+  std::cout << "Round trip of " << count << " stresses as JSON objects: " << characters << " characters in " << objects_duration.count() << " microseconds." << std::endl;
+
+  start = std::chrono::high_resolution_clock::now();
+  text.clear();
+  PhQ::json_sequence(text, stresses, PhQ::Unit::Pressure::Kilopascal);
+  const std::optional<std::vector<PhQ::Stress>> read_sequence{PhQ::parse_json<std::vector<PhQ::Stress>>(text)};
+  const auto sequence_duration{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start)};
+  std::cout << "Round trip of " << count << " stresses as a JSON sequence: " << text.size() << " characters in " << sequence_duration.count() << " microseconds." << std::endl;
+  return read_sequence.has_value() && close(read_sequence.value(), stresses) && close(read_stresses, stresses);
+}
+
+/// \brief Write velocities and stresses to PhQ binary files, map them back, and compare the size and speed of a binary checkpoint with those of a JSON sequence.
+bool test_binary() noexcept {
+  const std::string velocities_path{"phq_velocities.bin"};
+  const std::string stresses_path{"phq_stresses.bin"};
+  const std::vector<PhQ::Velocity> velocities{{{1.0, 2.0, 3.0}, PhQ::Unit::Speed::MetrePerSecond}, {{-4.0, 5.0, -6.0}, PhQ::Unit::Speed::MetrePerSecond}};
+  constexpr std::size_t count{100000};
+  std::vector<PhQ::Stress> stresses;
+  stresses.reserve(count);
+  for (std::size_t index = 0; index < count; ++index) {
+    const double real{static_cast<double>(index)};
+    stresses.push_back({{real, -0.5 * real, 0.25, 2.0 * real, 1.0e-3 * real, -real}, PhQ::Unit::Pressure::Pascal});
+  }
+  bool passed{true};
+
+  std::cout << "Binary files:" << std::endl;
+  {
+    std::ofstream file{velocities_path, std::ios::binary};
+    passed = PhQ::write_binary(file, velocities, PhQ::Unit::Speed::CentimetrePerSecond) && passed;
+  }
+  PhQ::MappedQuantities<PhQ::Velocity> mapped_velocities{velocities_path};
+  std::cout << "- Velocities in " << PhQ::abbreviation(mapped_velocities.file_unit()) << ": " << mapped_velocities.size() << " velocities, the second of which is " << mapped_velocities[1] << std::endl;
+  passed = mapped_velocities.valid() && mapped_velocities.file_unit() == PhQ::Unit::Speed::CentimetrePerSecond && close(std::vector<PhQ::Velocity>{mapped_velocities.begin(), mapped_velocities.end()}, velocities) && passed;
+  const PhQ::MappedQuantities<PhQ::Stress> mismatched{velocities_path};
+  std::cout << "- Velocities mapped as stresses are rejected: " << (mismatched.valid() ? "no" : "yes") << std::endl;
+  passed = !mismatched.valid() && passed;
+
+  std::chrono::high_resolution_clock::time_point start{std::chrono::high_resolution_clock::now()};
+  {
+    std::ofstream file{stresses_path, std::ios::binary};
+    passed = PhQ::write_binary(file, stresses) && passed;
+  }
+  PhQ::MappedQuantities<PhQ::Stress> mapped_stresses{stresses_path};
+  passed = mapped_stresses.valid() && close(std::vector<PhQ::Stress>{mapped_stresses.begin(), mapped_stresses.end()}, stresses) && passed;
+  const auto binary_duration{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start)};
+  std::cout << "Round trip of " << count << " stresses as a binary file: " << sizeof(PhQ::BinaryHeader) + count * sizeof(PhQ::Stress) << " bytes in " << binary_duration.count() << " microseconds." << std::endl;
+  std::remove(velocities_path.c_str());
+  std::remove(stresses_path.c_str());
+  return passed;
+}
+
+int main(int argc, char *argv[]) {
+  if (!test_sequences() || !test_readers() || !benchmark_round_trips() || !test_binary()) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}